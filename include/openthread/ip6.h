@@ -195,8 +195,9 @@ typedef struct otNetifAddress
  */
 typedef struct otNetifMulticastAddress
 {
-    otIp6Address                          mAddress; ///< The IPv6 multicast address.
-    const struct otNetifMulticastAddress *mNext;    ///< A pointer to the next network interface multicast address.
+    otIp6Address                          mAddress;     ///< The IPv6 multicast address.
+    const struct otNetifMulticastAddress *mNext;        ///< A pointer to the next network interface multicast address.
+    struct otNetifMulticastAddress       *mNextInIndex; ///< The next address in the lookup index (internal use only).
 } otNetifMulticastAddress;
 
 /**
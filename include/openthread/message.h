@@ -249,7 +249,7 @@ uint16_t otMessageRead(const otMessage *aMessage, uint16_t aOffset, void *aBuf,
  * @param[in]  aBuf      A pointer to a buffer that message bytes are written from.
  * @param[in]  aLength   Number of bytes to write.
  *
- * @returns The number of bytes written.
+ * @returns The number of bytes written, or zero if the message buffers shared with a clone could not be copied.
  *
  * @sa otMessageFree
  * @sa otMessageAppend
@@ -297,6 +297,14 @@ typedef struct otBufferInfo
      */
     uint16_t mMaxUsedBuffers;
 
+    /**
+     * The number of buffers saved by sharing message buffers between cloned messages (copy-on-write), i.e., the number
+     * of additional buffers which would be in use if every cloned message had its own copy of its buffers. A shared
+     * buffer is copied when a message writes to it, which fails if no free buffer is available.
+     *
+     */
+    uint16_t mSharedBuffers;
+
     otMessageQueueInfo m6loSendQueue;         ///< Info about 6LoWPAN send queue.
     otMessageQueueInfo m6loReassemblyQueue;   ///< Info about 6LoWPAN reassembly queue.
     otMessageQueueInfo mIp6Queue;             ///< Info about IPv6 send queue.
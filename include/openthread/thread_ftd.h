@@ -123,6 +123,17 @@ typedef struct otCacheEntryIterator
     const void *mData[2]; ///< Opaque data used by the core implementation. Should not be changed by user.
 } otCacheEntryIterator;
 
+/**
+ * Represents the forwarding flow cache counters.
+ *
+ */
+typedef struct otFlowCacheCounters
+{
+    uint32_t mHits;   ///< The number of messages whose route was found in the flow cache.
+    uint32_t mMisses; ///< The number of messages whose route was not found in the flow cache.
+    uint32_t mStale;  ///< The number of misses due to a flow cache entry invalidated by a topology change.
+} otFlowCacheCounters;
+
 /**
  * Gets the maximum number of children currently allowed.
  *
@@ -909,6 +920,28 @@ void otThreadGetNextHopAndPathCost(otInstance *aInstance,
                                    uint16_t   *aNextHopRloc16,
                                    uint8_t    *aPathCost);
 
+/**
+ * Gets the forwarding flow cache counters.
+ *
+ * Requires `OPENTHREAD_CONFIG_MESH_FORWARDER_FLOW_CACHE_ENABLE`.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ * @returns A pointer to the flow cache counters.
+ *
+ */
+const otFlowCacheCounters *otThreadGetFlowCacheCounters(otInstance *aInstance);
+
+/**
+ * Resets the forwarding flow cache counters.
+ *
+ * Requires `OPENTHREAD_CONFIG_MESH_FORWARDER_FLOW_CACHE_ENABLE`.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ */
+void otThreadResetFlowCacheCounters(otInstance *aInstance);
+
 /**
  * @}
  *
@@ -1009,6 +1009,7 @@ exit:
  * total: 40
  * free: 40
  * max-used: 5
+ * shared: 0
  * 6lo send: 0 0 0
  * 6lo reas: 0 0 0
  * ip6: 0 0 0
@@ -1025,6 +1026,7 @@ exit:
  * *   `free` displays the number of free message buffers.
  * *   `max-used` displays max number of used buffers at the same time since OT stack
  *     initialization or last `bufferinfo reset`.
+ * *   `shared` displays the number of buffers saved by sharing buffers between cloned messages.
  * @par
  * Next, the CLI displays info about different queues used by the OpenThread stack,
  * for example `6lo send`. Each line after the queue represents info about a queue:
@@ -1063,6 +1065,7 @@ template <> otError Interpreter::Process<Cmd("bufferinfo")>(Arg aArgs[])
         OutputLine("total: %u", bufferInfo.mTotalBuffers);
         OutputLine("free: %u", bufferInfo.mFreeBuffers);
         OutputLine("max-used: %u", bufferInfo.mMaxUsedBuffers);
+        OutputLine("shared: %u", bufferInfo.mSharedBuffers);
 
         for (const BufferInfoName &info : kBufferInfoNames)
         {
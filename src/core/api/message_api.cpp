@@ -84,9 +84,7 @@ int otMessageWrite(otMessage *aMessage, uint16_t aOffset, const void *aBuf, uint
 {
     AssertPointerIsNotNull(aBuf);
 
-    AsCoreType(aMessage).WriteBytes(aOffset, aBuf, aLength);
-
-    return aLength;
+    return (AsCoreType(aMessage).WriteBytes(aOffset, aBuf, aLength) == kErrorNone) ? aLength : 0;
 }
 
 void otMessageQueueInit(otMessageQueue *aQueue)
@@ -421,4 +421,16 @@ void otThreadGetNextHopAndPathCost(otInstance *aInstance,
         (aPathCost != nullptr) ? *aPathCost : pathcost);
 }
 
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_FLOW_CACHE_ENABLE
+const otFlowCacheCounters *otThreadGetFlowCacheCounters(otInstance *aInstance)
+{
+    return &AsCoreType(aInstance).Get<MeshForwarder>().GetFlowCacheCounters();
+}
+
+void otThreadResetFlowCacheCounters(otInstance *aInstance)
+{
+    AsCoreType(aInstance).Get<MeshForwarder>().ResetFlowCacheCounters();
+}
+#endif
+
 #endif // OPENTHREAD_FTD
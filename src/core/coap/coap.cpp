@@ -54,6 +54,7 @@ CoapBase::CoapBase(Instance &aInstance, Sender aSender)
     : InstanceLocator(aInstance)
     , mMessageId(Random::NonCrypto::GetUint16())
     , mRetransmissionTimer(aInstance, Coap::HandleRetransmissionTimer, this)
+    , mNumUnindexedRequests(0)
     , mResponsesQueue(aInstance)
     , mResourceHandler(nullptr)
     , mSender(aSender)
@@ -61,6 +62,7 @@ CoapBase::CoapBase(Instance &aInstance, Sender aSender)
     , mLastResponse(nullptr)
 #endif
 {
+    mMatchCounters.Clear();
 }
 
 void CoapBase::ClearRequestsAndResponses(void)
@@ -494,7 +496,12 @@ void CoapBase::HandleRetransmissionTimer(void)
             metadata.mRetransmissionsRemaining--;
             metadata.mRetransmissionTimeout *= 2;
             metadata.mNextTimerShot = now + metadata.mRetransmissionTimeout;
-            metadata.UpdateIn(message);
+
+            if (metadata.UpdateIn(message) != kErrorNone)
+            {
+                FinalizeCoapTransaction(message, metadata, nullptr, nullptr, kErrorNoBufs);
+                continue;
+            }
 
             // Retransmit
             if (!metadata.mAcknowledged)
@@ -558,12 +565,23 @@ Message *CoapBase::CopyAndEnqueueMessage(const Message &aMessage, uint16_t aCopy
 {
     Error    error       = kErrorNone;
     Message *messageCopy = nullptr;
+    Metadata metadata    = aMetadata;
 
     VerifyOrExit((messageCopy = aMessage.Clone(aCopyLength)) != nullptr, error = kErrorNoBufs);
 
-    SuccessOrExit(error = aMetadata.AppendTo(*messageCopy));
+    metadata.mIndexSlot = mRequestSlots.Allocate();
+
+    error = metadata.AppendTo(*messageCopy);
 
-    mRetransmissionTimer.FireAtIfEarlier(aMetadata.mNextTimerShot);
+    if (error != kErrorNone)
+    {
+        mRequestSlots.Free(metadata.mIndexSlot);
+        ExitNow();
+    }
+
+    AddToRequestIndex(*messageCopy, metadata.mIndexSlot);
+
+    mRetransmissionTimer.FireAtIfEarlier(metadata.mNextTimerShot);
 
     mPendingRequests.Enqueue(*messageCopy);
 
@@ -574,6 +592,11 @@ exit:
 
 void CoapBase::DequeueMessage(Message &aMessage)
 {
+    Metadata metadata;
+
+    metadata.ReadFrom(aMessage);
+    RemoveFromRequestIndex(metadata.mIndexSlot);
+
     mPendingRequests.Dequeue(aMessage);
 
     if (mRetransmissionTimer.IsRunning() && (mPendingRequests.GetHead() == nullptr))
@@ -1005,46 +1028,138 @@ Message *CoapBase::FindRelatedRequest(const Message          &aResponse,
                                       const Ip6::MessageInfo &aMessageInfo,
                                       Metadata               &aMetadata)
 {
-    Message *request = nullptr;
+    Message                        *request = nullptr;
+    bool                            matchToken;
+    uint32_t                        hash;
+    Metadata                        metadata;
+    HashIndex<kMaxIndexedRequests> *index;
 
-    for (Message &message : mPendingRequests)
+    if (mNumUnindexedRequests > 0)
     {
-        aMetadata.ReadFrom(message);
+        // Some pending requests are not in the index, so we fall
+        // back to scanning all of them.
+
+        mMatchCounters.mRequestScans++;
 
-        if (((aMetadata.mDestinationAddress == aMessageInfo.GetPeerAddr()) ||
-             aMetadata.mDestinationAddress.IsMulticast() ||
-             aMetadata.mDestinationAddress.GetIid().IsAnycastLocator()) &&
-            (aMetadata.mDestinationPort == aMessageInfo.GetPeerPort()))
+        for (Message &message : mPendingRequests)
         {
-            switch (aResponse.GetType())
+            aMetadata.ReadFrom(message);
+
+            if (IsRelatedRequest(aResponse, aMessageInfo, message, aMetadata))
             {
-            case kTypeReset:
-            case kTypeAck:
-                if (aResponse.GetMessageId() == message.GetMessageId())
-                {
-                    request = &message;
-                    ExitNow();
-                }
+                request = &message;
+                ExitNow();
+            }
+        }
 
-                break;
+        ExitNow();
+    }
 
-            case kTypeConfirmable:
-            case kTypeNonConfirmable:
-                if (aResponse.IsTokenEqual(message))
-                {
-                    request = &message;
-                    ExitNow();
-                }
+    matchToken = (aResponse.GetType() == kTypeConfirmable) || (aResponse.GetType() == kTypeNonConfirmable);
+    index      = matchToken ? &mRequestTokenIndex : &mRequestIdIndex;
+    hash       = matchToken ? CalculateTokenHash(aResponse) : aResponse.GetMessageId();
 
-                break;
-            }
+    // Entries in a bucket are ordered from the most recently added
+    // one, so we keep the last match to select the earliest request
+    // (same as the order in `mPendingRequests`).
+
+    for (uint16_t slot = index->GetFirst(hash); slot != index->kInvalidIndex; slot = index->GetNext(slot))
+    {
+        Message &message = mRequestSlots.Get(slot);
+
+        metadata.ReadFrom(message);
+
+        if (IsRelatedRequest(aResponse, aMessageInfo, message, metadata))
+        {
+            request   = &message;
+            aMetadata = metadata;
         }
     }
 
 exit:
+    if (request != nullptr)
+    {
+        mMatchCounters.mRequestMatches++;
+    }
+    else
+    {
+        mMatchCounters.mRequestMisses++;
+    }
+
     return request;
 }
 
+bool CoapBase::IsRelatedRequest(const Message          &aResponse,
+                                const Ip6::MessageInfo &aMessageInfo,
+                                const Message          &aRequest,
+                                const Metadata         &aMetadata)
+{
+    bool isRelated = false;
+
+    VerifyOrExit((aMetadata.mDestinationAddress == aMessageInfo.GetPeerAddr()) ||
+                 aMetadata.mDestinationAddress.IsMulticast() ||
+                 aMetadata.mDestinationAddress.GetIid().IsAnycastLocator());
+    VerifyOrExit(aMetadata.mDestinationPort == aMessageInfo.GetPeerPort());
+
+    switch (aResponse.GetType())
+    {
+    case kTypeReset:
+    case kTypeAck:
+        isRelated = (aResponse.GetMessageId() == aRequest.GetMessageId());
+        break;
+
+    case kTypeConfirmable:
+    case kTypeNonConfirmable:
+        isRelated = aResponse.IsTokenEqual(aRequest);
+        break;
+    }
+
+exit:
+    return isRelated;
+}
+
+void CoapBase::AddToRequestIndex(Message &aRequest, uint16_t aSlot)
+{
+    if (aSlot == MessageSlots<kMaxIndexedRequests>::kInvalidSlot)
+    {
+        // Matching falls back to a linear scan until all unindexed
+        // requests are removed.
+
+        mNumUnindexedRequests++;
+        LogInfo("Request index full (%u pending), using linear scan", kMaxIndexedRequests + mNumUnindexedRequests);
+        ExitNow();
+    }
+
+    mRequestSlots.Set(aSlot, aRequest);
+    mRequestIdIndex.Add(aSlot, aRequest.GetMessageId());
+    mRequestTokenIndex.Add(aSlot, CalculateTokenHash(aRequest));
+
+exit:
+    return;
+}
+
+void CoapBase::RemoveFromRequestIndex(uint16_t aSlot)
+{
+    if (aSlot == MessageSlots<kMaxIndexedRequests>::kInvalidSlot)
+    {
+        OT_ASSERT(mNumUnindexedRequests > 0);
+        mNumUnindexedRequests--;
+        ExitNow();
+    }
+
+    mRequestIdIndex.Remove(aSlot);
+    mRequestTokenIndex.Remove(aSlot);
+    mRequestSlots.Free(aSlot);
+
+exit:
+    return;
+}
+
+uint32_t CoapBase::CalculateTokenHash(const Message &aMessage)
+{
+    return HashIndex<kMaxIndexedRequests>::CalculateHash(aMessage.GetToken(), aMessage.GetTokenLength());
+}
+
 void CoapBase::Receive(ot::Message &aMessage, const Ip6::MessageInfo &aMessageInfo)
 {
     Message &message = AsCoapMessage(&aMessage);
@@ -1130,7 +1245,10 @@ void CoapBase::ProcessReceivedResponse(Message &aMessage, const Ip6::MessageInfo
                 if (metadata.mConfirmable)
                 {
                     metadata.mAcknowledged = true;
-                    metadata.UpdateIn(*request);
+
+                    // If the metadata cannot be updated, the request is
+                    // retransmitted until the response arrives.
+                    IgnoreError(metadata.UpdateIn(*request));
                 }
 
                 // Remove the message if response is not expected, otherwise await
@@ -1155,7 +1273,7 @@ void CoapBase::ProcessReceivedResponse(Message &aMessage, const Ip6::MessageInfo
 
                 // Consider the message acknowledged at this point.
                 metadata.mAcknowledged = true;
-                metadata.UpdateIn(*request);
+                IgnoreError(metadata.UpdateIn(*request));
             }
             else
 #endif
@@ -1308,16 +1426,19 @@ void CoapBase::ProcessReceivedRequest(Message &aMessage, const Ip6::MessageInfo
     switch (mResponsesQueue.GetMatchedResponseCopy(aMessage, aMessageInfo, &cachedResponse))
     {
     case kErrorNone:
+        mMatchCounters.mResponseMatches++;
         cachedResponse->Finish();
         error = Send(*cachedResponse, aMessageInfo);
         ExitNow();
 
     case kErrorNoBufs:
+        mMatchCounters.mResponseMatches++;
         error = kErrorNoBufs;
         ExitNow();
 
     case kErrorNotFound:
     default:
+        mMatchCounters.mResponseMisses++;
         break;
     }
 
@@ -1471,13 +1592,14 @@ void CoapBase::Metadata::ReadFrom(const Message &aMessage)
     IgnoreError(aMessage.Read(length - sizeof(*this), *this));
 }
 
-void CoapBase::Metadata::UpdateIn(Message &aMessage) const
+Error CoapBase::Metadata::UpdateIn(Message &aMessage) const
 {
-    aMessage.Write(aMessage.GetLength() - sizeof(*this), *this);
+    return aMessage.Write(aMessage.GetLength() - sizeof(*this), *this);
 }
 
 ResponsesQueue::ResponsesQueue(Instance &aInstance)
-    : mTimer(aInstance, ResponsesQueue::HandleTimer, this)
+    : mNumUnindexedResponses(0)
+    , mTimer(aInstance, ResponsesQueue::HandleTimer, this)
 {
 }
 
@@ -1501,27 +1623,67 @@ exit:
 const Message *ResponsesQueue::FindMatchedResponse(const Message &aRequest, const Ip6::MessageInfo &aMessageInfo) const
 {
     const Message *response = nullptr;
+    uint32_t       hash;
 
-    for (const Message &message : mQueue)
+    if (mNumUnindexedResponses > 0)
     {
-        if (message.GetMessageId() == aRequest.GetMessageId())
-        {
-            ResponseMetadata metadata;
-
-            metadata.ReadFrom(message);
+        // Some cached responses are not in the index, so we fall
+        // back to scanning all of them.
 
-            if ((metadata.mMessageInfo.GetPeerPort() == aMessageInfo.GetPeerPort()) &&
-                (metadata.mMessageInfo.GetPeerAddr() == aMessageInfo.GetPeerAddr()))
+        for (const Message &message : mQueue)
+        {
+            if (IsMatchedResponse(message, aRequest, aMessageInfo))
             {
                 response = &message;
-                break;
+                ExitNow();
             }
         }
+
+        ExitNow();
     }
 
+    hash = CalculateHash(aRequest.GetMessageId(), aMessageInfo);
+
+    for (uint16_t slot = mIndex.GetFirst(hash); slot != mIndex.kInvalidIndex; slot = mIndex.GetNext(slot))
+    {
+        const Message &message = mSlots.Get(slot);
+
+        if (IsMatchedResponse(message, aRequest, aMessageInfo))
+        {
+            response = &message;
+            break;
+        }
+    }
+
+exit:
     return response;
 }
 
+bool ResponsesQueue::IsMatchedResponse(const Message          &aResponse,
+                                       const Message          &aRequest,
+                                       const Ip6::MessageInfo &aMessageInfo)
+{
+    bool             matches = false;
+    ResponseMetadata metadata;
+
+    VerifyOrExit(aResponse.GetMessageId() == aRequest.GetMessageId());
+
+    metadata.ReadFrom(aResponse);
+
+    matches = (metadata.mMessageInfo.GetPeerPort() == aMessageInfo.GetPeerPort()) &&
+              (metadata.mMessageInfo.GetPeerAddr() == aMessageInfo.GetPeerAddr());
+
+exit:
+    return matches;
+}
+
+uint32_t ResponsesQueue::CalculateHash(uint16_t aMessageId, const Ip6::MessageInfo &aMessageInfo)
+{
+    uint32_t hash = HashIndex<kMaxCachedResponses>::CalculateHash(&aMessageInfo.GetPeerAddr(), sizeof(Ip6::Address));
+
+    return hash ^ ((static_cast<uint32_t>(aMessageInfo.GetPeerPort()) << 16) | aMessageId);
+}
+
 void ResponsesQueue::EnqueueResponse(Message                &aMessage,
                                      const Ip6::MessageInfo &aMessageInfo,
                                      const TxParameters     &aTxParameters)
@@ -1538,10 +1700,30 @@ void ResponsesQueue::EnqueueResponse(Message                &aMessage,
 
     VerifyOrExit((responseCopy = aMessage.Clone()) != nullptr);
 
-    VerifyOrExit(metadata.AppendTo(*responseCopy) == kErrorNone, responseCopy->Free());
+    metadata.mIndexSlot = mSlots.Allocate();
+
+    if (metadata.AppendTo(*responseCopy) != kErrorNone)
+    {
+        mSlots.Free(metadata.mIndexSlot);
+        responseCopy->Free();
+        ExitNow();
+    }
 
     mQueue.Enqueue(*responseCopy);
 
+    if (metadata.mIndexSlot == MessageSlots<kMaxCachedResponses>::kInvalidSlot)
+    {
+        // Cache the response without indexing it. Lookups fall back
+        // to a linear scan until it is removed.
+
+        mNumUnindexedResponses++;
+    }
+    else
+    {
+        mSlots.Set(metadata.mIndexSlot, *responseCopy);
+        mIndex.Add(metadata.mIndexSlot, CalculateHash(aMessage.GetMessageId(), aMessageInfo));
+    }
+
     mTimer.FireAtIfEarlier(metadata.mDequeueTime);
 
 exit:
@@ -1579,9 +1761,33 @@ void ResponsesQueue::UpdateQueue(void)
     }
 }
 
-void ResponsesQueue::DequeueResponse(Message &aMessage) { mQueue.DequeueAndFree(aMessage); }
+void ResponsesQueue::DequeueResponse(Message &aMessage)
+{
+    ResponseMetadata metadata;
+
+    metadata.ReadFrom(aMessage);
+
+    if (metadata.mIndexSlot == MessageSlots<kMaxCachedResponses>::kInvalidSlot)
+    {
+        OT_ASSERT(mNumUnindexedResponses > 0);
+        mNumUnindexedResponses--;
+    }
+    else
+    {
+        mIndex.Remove(metadata.mIndexSlot);
+        mSlots.Free(metadata.mIndexSlot);
+    }
+
+    mQueue.DequeueAndFree(aMessage);
+}
 
-void ResponsesQueue::DequeueAllResponses(void) { mQueue.DequeueAndFreeAll(); }
+void ResponsesQueue::DequeueAllResponses(void)
+{
+    mQueue.DequeueAndFreeAll();
+    mSlots.Clear();
+    mIndex.Clear();
+    mNumUnindexedResponses = 0;
+}
 
 void ResponsesQueue::HandleTimer(Timer &aTimer)
 {
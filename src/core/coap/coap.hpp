@@ -36,7 +36,9 @@
 #include "coap/coap_message.hpp"
 #include "common/as_core_type.hpp"
 #include "common/callback.hpp"
+#include "common/clearable.hpp"
 #include "common/debug.hpp"
+#include "common/hash_index.hpp"
 #include "common/linked_list.hpp"
 #include "common/locator.hpp"
 #include "common/message.hpp"
@@ -276,6 +278,116 @@ protected:
 };
 #endif
 
+/**
+ * Represents the counters for matching received CoAP messages against pending requests and cached responses.
+ *
+ */
+struct MatchCounters : public Clearable<MatchCounters>
+{
+    uint32_t mRequestMatches;  ///< Number of pending request lookups which found a matching request.
+    uint32_t mRequestMisses;   ///< Number of pending request lookups which found no matching request.
+    uint32_t mRequestScans;    ///< Number of pending request lookups done by a linear scan (index was full).
+    uint32_t mResponseMatches; ///< Number of received requests answered from the response cache.
+    uint32_t mResponseMisses;  ///< Number of received requests not found in the response cache.
+};
+
+/**
+ * Maps the entry indexes of a `HashIndex` to queued CoAP messages.
+ *
+ * The free slots are kept in a free list, so allocating and freeing a slot take constant time.
+ *
+ * @tparam kNumSlots  The number of slots.
+ *
+ */
+template <uint16_t kNumSlots> class MessageSlots
+{
+public:
+    static constexpr uint16_t kInvalidSlot = 0xffff; ///< Invalid slot.
+
+    /**
+     * Initializes all slots as free.
+     *
+     */
+    MessageSlots(void) { Clear(); }
+
+    /**
+     * Frees all slots.
+     *
+     */
+    void Clear(void)
+    {
+        for (uint16_t i = 0; i < kNumSlots; i++)
+        {
+            mMessages[i] = nullptr;
+            mNextFree[i] = (i + 1 < kNumSlots) ? i + 1 : kInvalidSlot;
+        }
+
+        mFreeHead = 0;
+    }
+
+    /**
+     * Allocates a free slot.
+     *
+     * @returns The allocated slot, or `kInvalidSlot` if all slots are in use.
+     *
+     */
+    uint16_t Allocate(void)
+    {
+        uint16_t slot = mFreeHead;
+
+        if (slot != kInvalidSlot)
+        {
+            mFreeHead = mNextFree[slot];
+        }
+
+        return slot;
+    }
+
+    /**
+     * Sets the message in a given (allocated) slot.
+     *
+     * @param[in] aSlot     The slot.
+     * @param[in] aMessage  The message.
+     *
+     */
+    void Set(uint16_t aSlot, Message &aMessage) { mMessages[aSlot] = &aMessage; }
+
+    /**
+     * Frees a given slot.
+     *
+     * Does nothing if @p aSlot is `kInvalidSlot`.
+     *
+     * @param[in] aSlot  The slot.
+     *
+     */
+    void Free(uint16_t aSlot)
+    {
+        VerifyOrExit(aSlot != kInvalidSlot);
+
+        mMessages[aSlot] = nullptr;
+        mNextFree[aSlot] = mFreeHead;
+        mFreeHead        = aSlot;
+
+    exit:
+        return;
+    }
+
+    /**
+     * Gets the message in a given (used) slot.
+     *
+     * @param[in] aSlot  The slot.
+     *
+     * @returns The message in @p aSlot.
+     *
+     */
+    Message &Get(uint16_t aSlot) const { return *mMessages[aSlot]; }
+
+private:
+    Message *mMessages[kNumSlots];
+    uint16_t mNextFree[kNumSlots];
+    uint16_t mFreeHead;
+};
+
 /**
  * Caches CoAP responses to implement message deduplication.
  *
@@ -344,17 +456,26 @@ private:
 
         TimeMilli        mDequeueTime;
         Ip6::MessageInfo mMessageInfo;
+        uint16_t         mIndexSlot;
     };
 
     const Message *FindMatchedResponse(const Message &aRequest, const Ip6::MessageInfo &aMessageInfo) const;
     void           DequeueResponse(Message &aMessage);
     void           UpdateQueue(void);
 
+    static bool     IsMatchedResponse(const Message          &aResponse,
+                                      const Message          &aRequest,
+                                      const Ip6::MessageInfo &aMessageInfo);
+    static uint32_t CalculateHash(uint16_t aMessageId, const Ip6::MessageInfo &aMessageInfo);
+
     static void HandleTimer(Timer &aTimer);
     void        HandleTimer(void);
 
-    MessageQueue      mQueue;
-    TimerMilliContext mTimer;
+    MessageQueue                      mQueue;
+    MessageSlots<kMaxCachedResponses> mSlots;
+    HashIndex<kMaxCachedResponses>    mIndex;
+    uint16_t                          mNumUnindexedResponses;
+    TimerMilliContext                 mTimer;
 };
 
 /**
@@ -792,6 +913,20 @@ public:
      */
     const MessageQueue &GetCachedResponses(void) const { return mResponsesQueue.GetResponses(); }
 
+    /**
+     * Returns the counters for matching received messages against pending requests and cached responses.
+     *
+     * @returns A reference to the match counters.
+     *
+     */
+    const MatchCounters &GetMatchCounters(void) const { return mMatchCounters; }
+
+    /**
+     * Resets the match counters.
+     *
+     */
+    void ResetMatchCounters(void) { mMatchCounters.Clear(); }
+
 protected:
     /**
      * Defines function pointer to handle a CoAP resource.
@@ -854,11 +989,13 @@ protected:
     void SetResourceHandler(ResourceHandler aHandler) { mResourceHandler = aHandler; }
 
 private:
+    static constexpr uint16_t kMaxIndexedRequests = OPENTHREAD_CONFIG_COAP_MAX_INDEXED_REQUESTS;
+
     struct Metadata
     {
         Error AppendTo(Message &aMessage) const { return aMessage.Append(*this); }
         void  ReadFrom(const Message &aMessage);
-        void  UpdateIn(Message &aMessage) const;
+        Error UpdateIn(Message &aMessage) const;
 
         Ip6::Address    mSourceAddress;            // IPv6 address of the message source.
         Ip6::Address    mDestinationAddress;       // IPv6 address of the message destination.
@@ -868,6 +1005,7 @@ private:
         TimeMilli       mNextTimerShot;            // Time when the timer should shoot for this message.
         uint32_t        mRetransmissionTimeout;    // Delay that is applied to next retransmission.
         uint8_t         mRetransmissionsRemaining; // Number of retransmissions remaining.
+        uint16_t        mIndexSlot;                // Slot in the pending requests index (`kInvalidSlot` if none).
 #if OPENTHREAD_CONFIG_BACKBONE_ROUTER_ENABLE
         uint8_t mHopLimit; // The hop limit.
 #endif
@@ -896,6 +1034,14 @@ private:
     Message *CopyAndEnqueueMessage(const Message &aMessage, uint16_t aCopyLength, const Metadata &aMetadata);
     void     DequeueMessage(Message &aMessage);
     Message *FindRelatedRequest(const Message &aResponse, const Ip6::MessageInfo &aMessageInfo, Metadata &aMetadata);
+    void     AddToRequestIndex(Message &aRequest, uint16_t aSlot);
+    void     RemoveFromRequestIndex(uint16_t aSlot);
+
+    static bool     IsRelatedRequest(const Message          &aResponse,
+                                     const Ip6::MessageInfo &aMessageInfo,
+                                     const Message          &aRequest,
+                                     const Metadata         &aMetadata);
+    static uint32_t CalculateTokenHash(const Message &aMessage);
     void     FinalizeCoapTransaction(Message                &aRequest,
                                      const Metadata         &aMetadata,
                                      Message                *aResponse,
@@ -943,6 +1089,12 @@ private:
     uint16_t          mMessageId;
     TimerMilliContext mRetransmissionTimer;
 
+    MessageSlots<kMaxIndexedRequests> mRequestSlots;
+    HashIndex<kMaxIndexedRequests>    mRequestIdIndex;
+    HashIndex<kMaxIndexedRequests>    mRequestTokenIndex;
+    uint16_t                          mNumUnindexedRequests;
+    MatchCounters                     mMatchCounters;
+
     LinkedList<Resource> mResources;
 
     Callback<Interceptor> mInterceptor;
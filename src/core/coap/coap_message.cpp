@@ -100,7 +100,7 @@ void Message::Finish(void)
         IgnoreError(SetLength(GetLength() - 1));
     }
 
-    WriteBytes(0, &GetHelpData().mHeader, GetOptionStart());
+    IgnoreError(WriteBytes(0, &GetHelpData().mHeader, GetOptionStart()));
 }
 
 uint8_t Message::WriteExtendedOptionField(uint16_t aValue, uint8_t *&aBuffer)
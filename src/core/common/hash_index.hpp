@@ -0,0 +1,242 @@
+/*
+ *  Copyright (c) 2023, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for a generic hash index over a fixed-size array of entries.
+ */
+
+#ifndef HASH_INDEX_HPP_
+#define HASH_INDEX_HPP_
+
+#include "openthread-core-config.h"
+
+#include <stdint.h>
+
+#include "common/code_utils.hpp"
+#include "common/debug.hpp"
+#include "common/non_copyable.hpp"
+
+namespace ot {
+
+/**
+ * @addtogroup core-hash-index
+ *
+ * @brief
+ *   This module includes definitions for a generic hash index.
+ *
+ * @{
+ *
+ */
+
+/**
+ * Represents a hash index over a fixed-size array (or pool) of entries.
+ *
+ * The hash index maps a hash value to the indexes of the entries in the array. It does not store the entries or their
+ * keys. It chains the entry indexes within each hash bucket, so a lookup iterates over the indexes in the bucket of a
+ * given hash and the caller checks whether the entry at each index matches the key.
+ *
+ * The hash index tracks the bucket of every added entry index, so an entry index can be removed without knowing the
+ * hash value that was used when adding it (e.g., after the entry key is changed).
+ *
+ * @tparam kNumEntries  The number of entries in the indexed array (entry indexes are from zero to `kNumEntries - 1`).
+ * @tparam kNumBuckets  The number of hash buckets.
+ *
+ */
+template <uint16_t kNumEntries, uint16_t kNumBuckets = kNumEntries> class HashIndex : private NonCopyable
+{
+    static_assert(kNumEntries < 0xffff, "kNumEntries is too large");
+    static_assert((kNumBuckets > 0) && (kNumBuckets < 0xffff), "kNumBuckets is invalid");
+
+public:
+    static constexpr uint16_t kInvalidIndex = 0xffff; ///< Invalid entry index (indicates end of a bucket chain).
+
+    /**
+     * Initializes the hash index as empty.
+     *
+     */
+    HashIndex(void) { Clear(); }
+
+    /**
+     * Clears the hash index (removes all entry indexes).
+     *
+     */
+    void Clear(void)
+    {
+        for (uint16_t &index : mBuckets)
+        {
+            index = kInvalidIndex;
+        }
+
+        for (uint16_t &bucket : mEntryBuckets)
+        {
+            bucket = kInvalidIndex;
+        }
+    }
+
+    /**
+     * Indicates whether a given entry index is in the hash index.
+     *
+     * @param[in] aIndex  The entry index.
+     *
+     * @retval TRUE   @p aIndex is in the hash index.
+     * @retval FALSE  @p aIndex is not in the hash index.
+     *
+     */
+    bool Contains(uint16_t aIndex) const { return (mEntryBuckets[aIndex] != kInvalidIndex); }
+
+    /**
+     * Adds an entry index to the hash index.
+     *
+     * @param[in] aIndex  The entry index. MUST be smaller than `kNumEntries` and not already in the hash index.
+     * @param[in] aHash   The hash value of the entry key.
+     *
+     */
+    void Add(uint16_t aIndex, uint32_t aHash)
+    {
+        uint16_t bucket = static_cast<uint16_t>(aHash % kNumBuckets);
+
+        OT_ASSERT(aIndex < kNumEntries);
+        OT_ASSERT(!Contains(aIndex));
+
+        mNext[aIndex]         = mBuckets[bucket];
+        mBuckets[bucket]      = aIndex;
+        mEntryBuckets[aIndex] = bucket;
+    }
+
+    /**
+     * Removes an entry index from the hash index.
+     *
+     * Does nothing if @p aIndex is not in the hash index.
+     *
+     * @param[in] aIndex  The entry index.
+     *
+     */
+    void Remove(uint16_t aIndex)
+    {
+        uint16_t *indexPtr;
+
+        VerifyOrExit(Contains(aIndex));
+
+        indexPtr              = &mBuckets[mEntryBuckets[aIndex]];
+        mEntryBuckets[aIndex] = kInvalidIndex;
+
+        while (*indexPtr != kInvalidIndex)
+        {
+            if (*indexPtr == aIndex)
+            {
+                *indexPtr = mNext[aIndex];
+                break;
+            }
+
+            indexPtr = &mNext[*indexPtr];
+        }
+
+    exit:
+        return;
+    }
+
+    /**
+     * Gets the first entry index in the bucket of a given hash value.
+     *
+     * @param[in] aHash   The hash value.
+     *
+     * @returns The first entry index in the bucket, or `kInvalidIndex` if the bucket is empty.
+     *
+     */
+    uint16_t GetFirst(uint32_t aHash) const { return mBuckets[aHash % kNumBuckets]; }
+
+    /**
+     * Gets the next entry index following a given one in the same bucket.
+     *
+     * @param[in] aIndex  The current entry index (MUST be in the hash index).
+     *
+     * @returns The next entry index in the bucket, or `kInvalidIndex` if @p aIndex is the last one.
+     *
+     */
+    uint16_t GetNext(uint16_t aIndex) const { return mNext[aIndex]; }
+
+    /**
+     * Calculates a hash value over a given sequence of bytes (32-bit FNV-1a).
+     *
+     * @param[in] aBytes   A pointer to the bytes.
+     * @param[in] aLength  The number of bytes.
+     *
+     * @returns The hash value.
+     *
+     */
+    static uint32_t CalculateHash(const void *aBytes, uint16_t aLength)
+    {
+        static constexpr uint32_t kFnvOffsetBasis = 2166136261UL;
+
+        return CalculateHash(aBytes, aLength, kFnvOffsetBasis);
+    }
+
+    /**
+     * Continues calculating a hash value (32-bit FNV-1a) over a given sequence of bytes.
+     *
+     * This can be used to calculate the hash over bytes that are not contiguous in memory, e.g.,
+     * `CalculateHash(b, bLen, CalculateHash(a, aLen))` is the hash over `a` followed by `b`.
+     *
+     * @param[in] aBytes     A pointer to the bytes.
+     * @param[in] aLength    The number of bytes.
+     * @param[in] aPrevHash  The hash value over the preceding bytes.
+     *
+     * @returns The hash value.
+     *
+     */
+    static uint32_t CalculateHash(const void *aBytes, uint16_t aLength, uint32_t aPrevHash)
+    {
+        static constexpr uint32_t kFnvPrime = 16777619UL;
+
+        const uint8_t *bytes = static_cast<const uint8_t *>(aBytes);
+        uint32_t       hash  = aPrevHash;
+
+        for (uint16_t i = 0; i < aLength; i++)
+        {
+            hash ^= bytes[i];
+            hash *= kFnvPrime;
+        }
+
+        return hash;
+    }
+
+private:
+    uint16_t mBuckets[kNumBuckets];
+    uint16_t mNext[kNumEntries];
+    uint16_t mEntryBuckets[kNumEntries];
+};
+
+/**
+ * @}
+ *
+ */
+
+} // namespace ot
+
+#endif // HASH_INDEX_HPP_
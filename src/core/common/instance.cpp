@@ -406,6 +406,9 @@ void Instance::GetBufferInfo(BufferInfo &aInfo)
     aInfo.mTotalBuffers   = Get<MessagePool>().GetTotalBufferCount();
     aInfo.mFreeBuffers    = Get<MessagePool>().GetFreeBufferCount();
     aInfo.mMaxUsedBuffers = Get<MessagePool>().GetMaxUsedBufferCount();
+#if OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFERS_ENABLE
+    aInfo.mSharedBuffers = Get<MessagePool>().GetSharedBufferCount();
+#endif
 
     Get<MeshForwarder>().GetSendQueue().GetInfo(aInfo.m6loSendQueue);
     Get<MeshForwarder>().GetReassemblyQueue().GetInfo(aInfo.m6loReassemblyQueue);
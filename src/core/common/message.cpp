@@ -51,6 +51,11 @@
 #error "OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE conflicts with OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT."
 #endif
 
+#if OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFERS_ENABLE && \
+    (OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE || OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT)
+#error "OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFERS_ENABLE requires message buffers from the OpenThread buffer pool."
+#endif
+
 namespace ot {
 
 RegisterLogModule("Message");
@@ -60,9 +65,15 @@ RegisterLogModule("Message");
 
 MessagePool::MessagePool(Instance &aInstance)
     : InstanceLocator(aInstance)
+#if OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFERS_ENABLE
+    , mNumSharedBuffers(0)
+#endif
     , mNumAllocated(0)
     , mMaxAllocated(0)
 {
+#if OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFERS_ENABLE
+    memset(mBufferRefs, 0, sizeof(mBufferRefs));
+#endif
 #if OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT
     otPlatMessagePoolInit(&GetInstance(), kNumBuffers, sizeof(Buffer));
 #endif
@@ -129,6 +140,9 @@ Buffer *MessagePool::NewBuffer(Message::Priority aPriority)
     mMaxAllocated = Max(mMaxAllocated, mNumAllocated);
 
     buffer->SetNextBuffer(nullptr);
+#if OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFERS_ENABLE
+    mBufferRefs[mBufferPool.GetIndexOf(*buffer)] = 0;
+#endif
 
 exit:
     if (buffer == nullptr)
@@ -144,6 +158,16 @@ void MessagePool::FreeBuffers(Buffer *aBuffer)
     while (aBuffer != nullptr)
     {
         Buffer *next = aBuffer->GetNextBuffer();
+
+#if OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFERS_ENABLE
+        if (IsBufferShared(*aBuffer))
+        {
+            // The remaining buffers are still used by another message.
+            ReleaseBuffers(*aBuffer);
+            break;
+        }
+#endif
+
 #if OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE
         Heap::Free(aBuffer);
 #elif OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT
@@ -159,6 +183,58 @@ void MessagePool::FreeBuffers(Buffer *aBuffer)
 
 Error MessagePool::ReclaimBuffers(Message::Priority aPriority) { return Get<MeshForwarder>().EvictMessage(aPriority); }
 
+#if OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFERS_ENABLE
+
+void MessagePool::RetainBuffers(Buffer &aBuffer)
+{
+    // A new message references `aBuffer` and the buffers after it.
+
+    mBufferRefs[mBufferPool.GetIndexOf(aBuffer)]++;
+    mNumSharedBuffers += CountBuffers(aBuffer);
+}
+
+void MessagePool::ReleaseBuffers(Buffer &aBuffer)
+{
+    // A message no longer references the shared `aBuffer` and the
+    // buffers after it.
+
+    OT_ASSERT(IsBufferShared(aBuffer));
+
+    mBufferRefs[mBufferPool.GetIndexOf(aBuffer)]--;
+    mNumSharedBuffers -= CountBuffers(aBuffer);
+}
+
+void MessagePool::ReplaceSharedBuffer(Buffer &aBuffer, Buffer &aCopy)
+{
+    // A message now references `aCopy` (whose next buffer is
+    // the same as `aBuffer`) instead of the shared `aBuffer`.
+
+    OT_ASSERT(IsBufferShared(aBuffer));
+
+    mBufferRefs[mBufferPool.GetIndexOf(aBuffer)]--;
+
+    if (aCopy.GetNextBuffer() != nullptr)
+    {
+        mBufferRefs[mBufferPool.GetIndexOf(*aCopy.GetNextBuffer())]++;
+    }
+
+    mNumSharedBuffers--;
+}
+
+uint16_t MessagePool::CountBuffers(const Buffer &aBuffer)
+{
+    uint16_t count = 0;
+
+    for (const Buffer *buffer = &aBuffer; buffer != nullptr; buffer = buffer->GetNextBuffer())
+    {
+        count++;
+    }
+
+    return count;
+}
+
+#endif // OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFERS_ENABLE
+
 uint16_t MessagePool::GetFreeBufferCount(void) const
 {
     uint16_t rval;
@@ -232,23 +308,51 @@ Error Message::ResizeMessage(uint16_t aLength)
     Buffer  *curBuffer = this;
     Buffer  *lastBuffer;
     uint16_t curLength = kHeadBufferDataSize;
+    bool     isShared  = false;
 
     while (curLength < aLength)
     {
         if (curBuffer->GetNextBuffer() == nullptr)
         {
+#if OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFERS_ENABLE
+            if (isShared)
+            {
+                // Appending a buffer changes the last buffer, so
+                // it can no longer be shared with other messages.
+
+                SuccessOrExit(error = UnshareBuffers(curLength));
+                isShared  = false;
+                curBuffer = this;
+
+                while (curBuffer->GetNextBuffer() != nullptr)
+                {
+                    curBuffer = curBuffer->GetNextBuffer();
+                }
+            }
+#endif
             curBuffer->SetNextBuffer(GetMessagePool()->NewBuffer(GetPriority()));
             VerifyOrExit(curBuffer->GetNextBuffer() != nullptr, error = kErrorNoBufs);
         }
 
         curBuffer = curBuffer->GetNextBuffer();
         curLength += kBufferDataSize;
+
+#if OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFERS_ENABLE
+        isShared = isShared || GetMessagePool()->IsBufferShared(*curBuffer);
+#endif
     }
 
     lastBuffer = curBuffer;
     curBuffer  = curBuffer->GetNextBuffer();
-    lastBuffer->SetNextBuffer(nullptr);
 
+    // When `lastBuffer` is shared with other messages, the
+    // buffers after it are kept and freed along with the
+    // message.
+
+    VerifyOrExit((curBuffer != nullptr) && !isShared);
+
+    lastBuffer->SetNextBuffer(nullptr);
+    InvalidateCacheBuffer();
     GetMessagePool()->FreeBuffers(curBuffer);
 
 exit:
@@ -377,6 +481,13 @@ Error Message::SetPriority(Priority aPriority)
         priorityQueue->Enqueue(*this);
     }
 
+#if OPENTHREAD_FTD
+    if (IsChildPending())
+    {
+        Get<IndirectSender>().HandleMessagePriorityChange(*this);
+    }
+#endif
+
 exit:
     return error;
 }
@@ -404,7 +515,7 @@ Error Message::AppendBytes(const void *aBuf, uint16_t aLength)
     uint16_t oldLength = GetLength();
 
     SuccessOrExit(error = SetLength(GetLength() + aLength));
-    WriteBytes(oldLength, aBuf, aLength);
+    error = WriteBytes(oldLength, aBuf, aLength);
 
 exit:
     return error;
@@ -423,7 +534,7 @@ Error Message::AppendBytesFromMessage(const Message &aMessage, uint16_t aOffset,
 
     while (chunk.GetLength() > 0)
     {
-        WriteBytes(writeOffset, chunk.GetBytes(), chunk.GetLength());
+        SuccessOrExit(error = WriteBytes(writeOffset, chunk.GetBytes(), chunk.GetLength()));
         writeOffset += chunk.GetLength();
         aMessage.GetNextChunk(aLength, chunk);
     }
@@ -443,6 +554,7 @@ Error Message::PrependBytes(const void *aBuf, uint16_t aLength)
 
         newBuffer->SetNextBuffer(GetNextBuffer());
         SetNextBuffer(newBuffer);
+        InvalidateCacheBuffer();
 
         if (GetReserved() < sizeof(mBuffer.mHead.mData))
         {
@@ -460,7 +572,7 @@ Error Message::PrependBytes(const void *aBuf, uint16_t aLength)
 
     if (aBuf != nullptr)
     {
-        WriteBytes(0, aBuf, aLength);
+        error = WriteBytes(0, aBuf, aLength);
     }
 
 exit:
@@ -484,8 +596,10 @@ void Message::RemoveHeader(uint16_t aLength)
     }
 }
 
-void Message::RemoveHeader(uint16_t aOffset, uint16_t aLength)
+Error Message::RemoveHeader(uint16_t aOffset, uint16_t aLength)
 {
+    Error error;
+
     // To shrink the header, we copy the header byte before `aOffset`
     // forward. Starting at offset `aLength`, we write bytes we read
     // from offset `0` onward and copy a total of `aOffset` bytes.
@@ -508,8 +622,12 @@ void Message::RemoveHeader(uint16_t aOffset, uint16_t aLength)
     //  +-----------------------+------------------------+
     //
 
-    WriteBytesFromMessage(/* aWriteOffset */ aLength, *this, /* aReadOffset */ 0, /* aLength */ aOffset);
+    SuccessOrExit(error = WriteBytesFromMessage(/* aWriteOffset */ aLength, *this, /* aReadOffset */ 0,
+                                                /* aLength */ aOffset));
     RemoveHeader(aLength);
+
+exit:
+    return error;
 }
 
 Error Message::InsertHeader(uint16_t aOffset, uint16_t aLength)
@@ -539,7 +657,7 @@ Error Message::InsertHeader(uint16_t aOffset, uint16_t aLength)
     //
 
     SuccessOrExit(error = PrependBytes(nullptr, aLength));
-    WriteBytesFromMessage(/* aWriteOffset */ 0, *this, /* aReadOffset */ aLength, /* aLength */ aOffset);
+    error = WriteBytesFromMessage(/* aWriteOffset */ 0, *this, /* aReadOffset */ aLength, /* aLength */ aOffset);
 
 exit:
     return error;
@@ -554,6 +672,10 @@ void Message::GetFirstChunk(uint16_t aOffset, uint16_t &aLength, Chunk &aChunk)
     // its length. The `aLength` is also decreased by the chunk
     // length.
 
+    Metadata     &metadata = AsNonConst(this)->GetMetadata();
+    const Buffer *buffer;
+    uint16_t      bufferOffset;
+
     VerifyOrExit(aOffset < GetLength(), aChunk.SetLength(0));
 
     if (aOffset + aLength >= GetLength())
@@ -573,25 +695,44 @@ void Message::GetFirstChunk(uint16_t aOffset, uint16_t &aLength, Chunk &aChunk)
         ExitNow();
     }
 
-    aOffset -= kHeadBufferDataSize;
+    // Find the `Buffer` matching the offset. Parsers mostly read
+    // at increasing offsets, so we resume the search from the
+    // buffer found by the previous call when possible instead of
+    // walking the buffer chain from the head.
+
+    if ((metadata.mCacheBuffer != nullptr) && (aOffset >= metadata.mCacheOffset))
+    {
+        buffer       = metadata.mCacheBuffer;
+        bufferOffset = metadata.mCacheOffset;
+    }
+    else
+    {
+        buffer       = GetNextBuffer();
+        bufferOffset = kHeadBufferDataSize;
+    }
 
-    // Find the `Buffer` matching the offset
+    aOffset -= bufferOffset;
 
     while (true)
     {
-        aChunk.SetBuffer(aChunk.GetBuffer()->GetNextBuffer());
-
-        OT_ASSERT(aChunk.GetBuffer() != nullptr);
+        OT_ASSERT(buffer != nullptr);
 
         if (aOffset < kBufferDataSize)
         {
-            aChunk.Init(aChunk.GetBuffer()->GetData() + aOffset, kBufferDataSize - aOffset);
-            ExitNow();
+            break;
         }
 
+        buffer = buffer->GetNextBuffer();
         aOffset -= kBufferDataSize;
+        bufferOffset += kBufferDataSize;
     }
 
+    metadata.mCacheBuffer = AsNonConst(buffer);
+    metadata.mCacheOffset = bufferOffset;
+
+    aChunk.SetBuffer(buffer);
+    aChunk.Init(buffer->GetData() + aOffset, kBufferDataSize - aOffset);
+
 exit:
     if (aChunk.GetLength() > aLength)
     {
@@ -628,6 +769,28 @@ exit:
     return;
 }
 
+Error Message::GetFirstChunk(uint16_t aOffset, uint16_t &aLength, MutableChunk &aChunk)
+{
+    Error error = kErrorNone;
+
+#if OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFERS_ENABLE
+    // The chunks are written to, so the buffers containing them
+    // are first copied if they are shared with other messages.
+    // If this fails, no chunk is provided (nothing is written).
+
+    error = UnshareBuffers(static_cast<uint16_t>(GetReserved() + Min<uint32_t>(aOffset + aLength, GetLength())));
+
+    if (error != kErrorNone)
+    {
+        aLength = 0;
+    }
+#endif
+
+    AsConst(this)->GetFirstChunk(aOffset, aLength, static_cast<Chunk &>(aChunk));
+
+    return error;
+}
+
 uint16_t Message::ReadBytes(uint16_t aOffset, void *aBuf, uint16_t aLength) const
 {
     uint8_t *bufPtr = reinterpret_cast<uint8_t *>(aBuf);
@@ -645,6 +808,32 @@ uint16_t Message::ReadBytes(uint16_t aOffset, void *aBuf, uint16_t aLength) cons
     return static_cast<uint16_t>(bufPtr - reinterpret_cast<uint8_t *>(aBuf));
 }
 
+Error Message::GetDataChunks(uint16_t                 aOffset,
+                             uint16_t                 aLength,
+                             Data<kWithUint16Length> *aChunks,
+                             uint16_t                &aNumChunks) const
+{
+    Error    error     = kErrorNone;
+    uint16_t maxChunks = aNumChunks;
+    Chunk    chunk;
+
+    aNumChunks = 0;
+
+    VerifyOrExit(aOffset + aLength <= GetLength(), error = kErrorParse);
+
+    GetFirstChunk(aOffset, aLength, chunk);
+
+    while (chunk.GetLength() > 0)
+    {
+        VerifyOrExit(aNumChunks < maxChunks, error = kErrorNoBufs);
+        aChunks[aNumChunks++].Init(chunk.GetBytes(), chunk.GetLength());
+        GetNextChunk(aLength, chunk);
+    }
+
+exit:
+    return error;
+}
+
 Error Message::Read(uint16_t aOffset, void *aBuf, uint16_t aLength) const
 {
     return (ReadBytes(aOffset, aBuf, aLength) == aLength) ? kErrorNone : kErrorParse;
@@ -693,14 +882,15 @@ exit:
     return (bytesToCompare == 0);
 }
 
-void Message::WriteBytes(uint16_t aOffset, const void *aBuf, uint16_t aLength)
+Error Message::WriteBytes(uint16_t aOffset, const void *aBuf, uint16_t aLength)
 {
+    Error          error;
     const uint8_t *bufPtr = reinterpret_cast<const uint8_t *>(aBuf);
     MutableChunk   chunk;
 
     OT_ASSERT(aOffset + aLength <= GetLength());
 
-    GetFirstChunk(aOffset, aLength, chunk);
+    error = GetFirstChunk(aOffset, aLength, chunk);
 
     while (chunk.GetLength() > 0)
     {
@@ -708,13 +898,17 @@ void Message::WriteBytes(uint16_t aOffset, const void *aBuf, uint16_t aLength)
         bufPtr += chunk.GetLength();
         GetNextChunk(aLength, chunk);
     }
+
+    return error;
 }
 
-void Message::WriteBytesFromMessage(uint16_t       aWriteOffset,
-                                    const Message &aMessage,
-                                    uint16_t       aReadOffset,
-                                    uint16_t       aLength)
+Error Message::WriteBytesFromMessage(uint16_t       aWriteOffset,
+                                     const Message &aMessage,
+                                     uint16_t       aReadOffset,
+                                     uint16_t       aLength)
 {
+    Error error = kErrorNone;
+
     if ((&aMessage != this) || (aReadOffset >= aWriteOffset))
     {
         Chunk chunk;
@@ -723,7 +917,7 @@ void Message::WriteBytesFromMessage(uint16_t       aWriteOffset,
 
         while (chunk.GetLength() > 0)
         {
-            WriteBytes(aWriteOffset, chunk.GetBytes(), chunk.GetLength());
+            SuccessOrExit(error = WriteBytes(aWriteOffset, chunk.GetBytes(), chunk.GetLength()));
             aWriteOffset += chunk.GetLength();
             aMessage.GetNextChunk(aLength, chunk);
         }
@@ -750,9 +944,12 @@ void Message::WriteBytesFromMessage(uint16_t       aWriteOffset,
             aWriteOffset -= copyLength;
 
             ReadBytes(aReadOffset, buf, copyLength);
-            WriteBytes(aWriteOffset, buf, copyLength);
+            SuccessOrExit(error = WriteBytes(aWriteOffset, buf, copyLength));
         }
     }
+
+exit:
+    return error;
 }
 
 Message *Message::Clone(uint16_t aLength) const
@@ -765,7 +962,17 @@ Message *Message::Clone(uint16_t aLength) const
     aLength     = Min(GetLength(), aLength);
     messageCopy = GetMessagePool()->Allocate(GetType(), GetReserved(), settings);
     VerifyOrExit(messageCopy != nullptr, error = kErrorNoBufs);
-    SuccessOrExit(error = messageCopy->AppendBytesFromMessage(*this, 0, aLength));
+
+#if OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFERS_ENABLE
+    if (GetReserved() + aLength > kHeadBufferDataSize)
+    {
+        messageCopy->ShareBuffers(*this, aLength);
+    }
+    else
+#endif
+    {
+        SuccessOrExit(error = messageCopy->AppendBytesFromMessage(*this, 0, aLength));
+    }
 
     // Copy selected message information.
     offset = Min(GetOffset(), aLength);
@@ -781,6 +988,83 @@ exit:
     return messageCopy;
 }
 
+#if OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFERS_ENABLE
+
+void Message::ShareBuffers(const Message &aMessage, uint16_t aLength)
+{
+    // This method makes a newly allocated message (with the same
+    // reserved header length as `aMessage`) a copy of the first
+    // `aLength` bytes of `aMessage`. The head buffer is copied and
+    // the other buffers are shared.
+
+    Buffer *buffers = AsNonConst(aMessage.GetNextBuffer());
+
+    OT_ASSERT((GetLength() == 0) && (GetReserved() == aMessage.GetReserved()) && (buffers != nullptr));
+
+    GetMessagePool()->FreeBuffers(GetNextBuffer());
+    InvalidateCacheBuffer();
+
+    memcpy(GetFirstData(), aMessage.GetFirstData(), kHeadBufferDataSize);
+    SetNextBuffer(buffers);
+    GetMessagePool()->RetainBuffers(*buffers);
+
+    GetMetadata().mLength = aLength;
+}
+
+Error Message::UnshareBuffers(uint16_t aEndOffset)
+{
+    // This method copies the buffers shared with other messages
+    // which contain the message data before `aEndOffset` (including
+    // the reserved bytes), so that they can be changed. Since a
+    // shared buffer is followed by shared buffers, the copying
+    // starts from the first shared buffer.
+
+    Error        error        = kErrorNone;
+    MessagePool *pool         = GetMessagePool();
+    Buffer      *prevBuffer   = this;
+    uint16_t     bufferOffset = kHeadBufferDataSize;
+
+    while (bufferOffset < aEndOffset)
+    {
+        Buffer *curBuffer = prevBuffer->GetNextBuffer();
+
+        OT_ASSERT(curBuffer != nullptr);
+
+        if (pool->IsBufferShared(*curBuffer))
+        {
+            Buffer *newBuffer = pool->NewBuffer(GetPriority());
+
+            VerifyOrExit(newBuffer != nullptr, error = kErrorNoBufs);
+
+            // Reclaiming buffers to allocate `newBuffer` may have
+            // freed the other messages sharing `curBuffer`.
+
+            if (pool->IsBufferShared(*curBuffer))
+            {
+                memcpy(newBuffer->GetData(), curBuffer->GetData(), kBufferDataSize);
+                newBuffer->SetNextBuffer(curBuffer->GetNextBuffer());
+                pool->ReplaceSharedBuffer(*curBuffer, *newBuffer);
+
+                prevBuffer->SetNextBuffer(newBuffer);
+                InvalidateCacheBuffer();
+                curBuffer = newBuffer;
+            }
+            else
+            {
+                pool->FreeBuffers(newBuffer);
+            }
+        }
+
+        prevBuffer = curBuffer;
+        bufferOffset += kBufferDataSize;
+    }
+
+exit:
+    return error;
+}
+
+#endif // OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFERS_ENABLE
+
 #if OPENTHREAD_FTD
 bool Message::GetChildMask(uint16_t aChildIndex) const { return GetMetadata().mChildMask.Get(aChildIndex); }
 
@@ -191,6 +191,7 @@ protected:
         Message     *mPrev;        // Previous message in a doubly linked list.
         MessagePool *mMessagePool; // Message pool for this message.
         void        *mQueue;       // The queue where message is queued (if any). Queue type from `mInPriorityQ`.
+        Buffer      *mCacheBuffer; // Last non-head buffer located by `GetFirstChunk()` (`nullptr` if none).
         uint32_t     mDatagramTag; // The datagram tag used for 6LoWPAN frags or IPv6fragmentation.
         TimeMilli    mTimestamp;   // The message timestamp.
         uint16_t     mReserved;    // Number of reserved bytes (for header).
@@ -198,6 +199,7 @@ protected:
         uint16_t     mOffset;      // A byte offset within the message.
         uint16_t     mMeshDest;    // Used for unicast non-link-local messages.
         uint16_t     mPanId;       // PAN ID (used for MLE Discover Request and Response).
+        uint16_t     mCacheOffset; // Offset of `mCacheBuffer` data (including reserved bytes).
         uint8_t      mChannel;     // The message channel (used for MLE Announce).
         RssAverager  mRssAverager; // The averager maintaining the received signal strength (RSS) average.
 #if OPENTHREAD_CONFIG_MLE_LINK_METRICS_SUBJECT_ENABLE
@@ -632,8 +634,11 @@ public:
      * @param[in]  aOffset  The offset to start removing.
      * @param[in]  aLength  Number of header bytes to remove.
      *
+     * @retval kErrorNone    Successfully removed the header bytes.
+     * @retval kErrorNoBufs  Failed to copy the buffers shared with a clone of the message, nothing was removed.
+     *
      */
-    void RemoveHeader(uint16_t aOffset, uint16_t aLength);
+    Error RemoveHeader(uint16_t aOffset, uint16_t aLength);
 
     /**
      * Grows the message to make space for new header bytes at a given offset.
@@ -732,6 +737,27 @@ public:
      */
     uint16_t ReadBytes(uint16_t aOffset, void *aBuf, uint16_t aLength) const;
 
+    /**
+     * Gets the contiguous data chunks (within the message buffers) holding a range of bytes in the message.
+     *
+     * Allows the message content to be passed to scatter/gather I/O without first copying it into a contiguous
+     * buffer. The chunks remain valid until the message is modified or freed.
+     *
+     * @param[in]     aOffset     Byte offset within the message to begin.
+     * @param[in]     aLength     Number of bytes.
+     * @param[out]    aChunks     A pointer to an array to output the chunks.
+     * @param[in,out] aNumChunks  On input, the number of entries in @p aChunks. On exit, the number of chunks.
+     *
+     * @retval kErrorNone    Successfully got the chunks.
+     * @retval kErrorParse   The range of bytes is not contained in the message.
+     * @retval kErrorNoBufs  The @p aChunks array is too small.
+     *
+     */
+    Error GetDataChunks(uint16_t                 aOffset,
+                        uint16_t                 aLength,
+                        Data<kWithUint16Length> *aChunks,
+                        uint16_t                &aNumChunks) const;
+
     /**
      * Reads a given number of bytes from the message.
      *
@@ -843,8 +869,11 @@ public:
      * @param[in]  aBuf     A pointer to a data buffer.
      * @param[in]  aLength  Number of bytes to write.
      *
+     * @retval kErrorNone    Successfully wrote the bytes.
+     * @retval kErrorNoBufs  Failed to copy the buffers shared with a clone of the message, nothing was written.
+     *
      */
-    void WriteBytes(uint16_t aOffset, const void *aBuf, uint16_t aLength);
+    Error WriteBytes(uint16_t aOffset, const void *aBuf, uint16_t aLength);
 
     /**
      * Writes bytes read from another or potentially the same message to the message at a given offset.
@@ -860,8 +889,11 @@ public:
      * @param[in] aReadOffset   The offset in @p aMessage to start reading the bytes from.
      * @param[in] aLength       The number of bytes to read from @p aMessage and write.
      *
+     * @retval kErrorNone    Successfully wrote the bytes.
+     * @retval kErrorNoBufs  Failed to copy the buffers shared with a clone of the message, nothing was written.
+     *
      */
-    void WriteBytesFromMessage(uint16_t aWriteOffset, const Message &aMessage, uint16_t aReadOffset, uint16_t aLength);
+    Error WriteBytesFromMessage(uint16_t aWriteOffset, const Message &aMessage, uint16_t aReadOffset, uint16_t aLength);
 
     /**
      * Writes an object to the message.
@@ -874,12 +906,15 @@ public:
      * @param[in]  aOffset      Byte offset within the message to begin writing.
      * @param[in]  aObject      A reference to the object to write.
      *
+     * @retval kErrorNone    Successfully wrote the object.
+     * @retval kErrorNoBufs  Failed to copy the buffers shared with a clone of the message, nothing was written.
+     *
      */
-    template <typename ObjectType> void Write(uint16_t aOffset, const ObjectType &aObject)
+    template <typename ObjectType> Error Write(uint16_t aOffset, const ObjectType &aObject)
     {
         static_assert(!TypeTraits::IsPointer<ObjectType>::kValue, "ObjectType must not be a pointer");
 
-        WriteBytes(aOffset, &aObject, sizeof(ObjectType));
+        return WriteBytes(aOffset, &aObject, sizeof(ObjectType));
     }
 
     /**
@@ -893,10 +928,13 @@ public:
      * @param[in]  aOffset    Byte offset within the message to begin writing.
      * @param[in]  aData      The `Data` to write to the message.
      *
+     * @retval kErrorNone    Successfully wrote the data.
+     * @retval kErrorNoBufs  Failed to copy the buffers shared with a clone of the message, nothing was written.
+     *
      */
-    template <DataLengthType kDataLengthType> void WriteData(uint16_t aOffset, const Data<kDataLengthType> &aData)
+    template <DataLengthType kDataLengthType> Error WriteData(uint16_t aOffset, const Data<kDataLengthType> &aData)
     {
-        WriteBytes(aOffset, aData.GetBytes(), aData.GetLength());
+        return WriteBytes(aOffset, aData.GetBytes(), aData.GetLength());
     }
 
     /**
@@ -906,6 +944,9 @@ public:
      * of the payload. The `Type`, `SubType`, `LinkSecurity`, `Offset`, `InterfaceId`, and `Priority` fields on the
      * cloned message are also copied from the original one.
      *
+     * If `OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFERS_ENABLE` is set, only the first buffer is copied and the others are
+     * shared with the original message until either message writes to them.
+     *
      * @param[in] aLength  Number of payload bytes to copy.
      *
      * @returns A pointer to the message or nullptr if insufficient message buffers are available.
@@ -1394,11 +1435,9 @@ private:
 
     void GetFirstChunk(uint16_t aOffset, uint16_t &aLength, Chunk &aChunk) const;
     void GetNextChunk(uint16_t &aLength, Chunk &aChunk) const;
+    void InvalidateCacheBuffer(void) { GetMetadata().mCacheBuffer = nullptr; }
 
-    void GetFirstChunk(uint16_t aOffset, uint16_t &aLength, MutableChunk &aChunk)
-    {
-        AsConst(this)->GetFirstChunk(aOffset, aLength, static_cast<Chunk &>(aChunk));
-    }
+    Error GetFirstChunk(uint16_t aOffset, uint16_t &aLength, MutableChunk &aChunk);
 
     void GetNextChunk(uint16_t &aLength, MutableChunk &aChunk)
     {
@@ -1420,6 +1459,11 @@ private:
     static const Message *NextOf(const Message *aMessage) { return (aMessage != nullptr) ? aMessage->Next() : nullptr; }
 
     Error ResizeMessage(uint16_t aLength);
+
+#if OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFERS_ENABLE
+    void  ShareBuffers(const Message &aMessage, uint16_t aLength);
+    Error UnshareBuffers(uint16_t aEndOffset);
+#endif
 };
 
 /**
@@ -1774,13 +1818,41 @@ public:
      */
     void ResetMaxUsedBufferCount(void) { mMaxAllocated = mNumAllocated; }
 
+#if OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFERS_ENABLE
+    /**
+     * Returns the number of buffers saved by sharing message buffers between cloned messages.
+     *
+     * @returns The number of buffers currently saved by sharing.
+     *
+     */
+    uint16_t GetSharedBufferCount(void) const { return mNumSharedBuffers; }
+#endif
+
 private:
     Buffer *NewBuffer(Message::Priority aPriority);
     void    FreeBuffers(Buffer *aBuffer);
     Error   ReclaimBuffers(Message::Priority aPriority);
 
+#if OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFERS_ENABLE
+    // A buffer is shared when more than one buffer or message
+    // points to it, so it and all the buffers after it are used
+    // by more than one message. `mBufferRefs` tracks the number
+    // of such additional references to each buffer.
+
+    bool IsBufferShared(const Buffer &aBuffer) const { return mBufferRefs[mBufferPool.GetIndexOf(aBuffer)] > 0; }
+    void RetainBuffers(Buffer &aBuffer);
+    void ReleaseBuffers(Buffer &aBuffer);
+    void ReplaceSharedBuffer(Buffer &aBuffer, Buffer &aCopy);
+
+    static uint16_t CountBuffers(const Buffer &aBuffer);
+#endif
+
 #if !OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT && !OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE
     Pool<Buffer, kNumBuffers> mBufferPool;
+#endif
+#if OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFERS_ENABLE
+    uint16_t mBufferRefs[kNumBuffers];
+    uint16_t mNumSharedBuffers;
 #endif
     uint16_t mNumAllocated;
     uint16_t mMaxAllocated;
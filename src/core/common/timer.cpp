@@ -33,6 +33,8 @@
 
 #include "timer.hpp"
 
+#include <string.h>
+
 #include "common/as_core_type.hpp"
 #include "common/code_utils.hpp"
 #include "common/debug.hpp"
@@ -103,6 +105,13 @@ void TimerMilli::Stop(void) { Get<Scheduler>().Remove(*this); }
 
 void TimerMilli::RemoveAll(Instance &aInstance) { aInstance.Get<Scheduler>().RemoveAll(); }
 
+#if !OPENTHREAD_CONFIG_TIMER_WHEEL_ENABLE
+
+Timer::Scheduler::Scheduler(Instance &aInstance)
+    : InstanceLocator(aInstance)
+{
+}
+
 void Timer::Scheduler::Add(Timer &aTimer, const AlarmApi &aAlarmApi)
 {
     Timer *prev = nullptr;
@@ -203,6 +212,351 @@ void Timer::Scheduler::RemoveAll(const AlarmApi &aAlarmApi)
     SetAlarm(aAlarmApi);
 }
 
+#else // OPENTHREAD_CONFIG_TIMER_WHEEL_ENABLE
+
+Timer::Scheduler::Scheduler(Instance &aInstance)
+    : InstanceLocator(aInstance)
+    , mEarliest(nullptr)
+    , mIsProcessing(false)
+{
+    memset(mLists, 0, sizeof(mLists));
+    memset(mOccupiedSlots, 0, sizeof(mOccupiedSlots));
+}
+
+void Timer::Scheduler::Add(Timer &aTimer, const AlarmApi &aAlarmApi)
+{
+    Time now(aAlarmApi.AlarmGetNow());
+
+    Remove(aTimer, aAlarmApi);
+
+    AdvanceWheel(now);
+
+    if (aTimer.mFireTime <= now)
+    {
+        InsertInDueList(aTimer);
+    }
+    else
+    {
+        InsertInWheel(aTimer);
+    }
+
+    VerifyOrExit(!mIsProcessing);
+
+    if ((mEarliest == nullptr) || aTimer.DoesFireBefore(*mEarliest, now))
+    {
+        mEarliest = &aTimer;
+        SetAlarm(aAlarmApi);
+    }
+
+exit:
+    return;
+}
+
+void Timer::Scheduler::Remove(Timer &aTimer, const AlarmApi &aAlarmApi)
+{
+    VerifyOrExit(aTimer.IsRunning());
+
+    RemoveFromList(aTimer);
+
+    VerifyOrExit(!mIsProcessing && (mEarliest == &aTimer));
+
+    mEarliest = FindEarliest();
+    SetAlarm(aAlarmApi);
+
+exit:
+    return;
+}
+
+void Timer::Scheduler::SetAlarm(const AlarmApi &aAlarmApi)
+{
+    if (mEarliest == nullptr)
+    {
+        aAlarmApi.AlarmStop(&GetInstance());
+    }
+    else
+    {
+        Time     now(aAlarmApi.AlarmGetNow());
+        uint32_t remaining;
+
+        remaining = (now < mEarliest->mFireTime) ? (mEarliest->mFireTime - now) : 0;
+
+        aAlarmApi.AlarmStartAt(&GetInstance(), now.GetValue(), remaining);
+    }
+}
+
+void Timer::Scheduler::ProcessTimers(const AlarmApi &aAlarmApi)
+{
+    // All timers which are due are fired as one batch. Newly
+    // started timers (from the timer handlers) which are already
+    // due are added to `kDueList` and are fired on the next
+    // alarm callback.
+
+    Timer *timer;
+
+    AdvanceWheel(Time(aAlarmApi.AlarmGetNow()));
+
+    while ((timer = mLists[kDueList]) != nullptr)
+    {
+        RemoveFromList(*timer);
+        AddToList(kFiringList, *timer, (mLists[kFiringList] == nullptr) ? nullptr : mLists[kFiringList]->mPrev);
+    }
+
+    mIsProcessing = true;
+
+    while ((timer = mLists[kFiringList]) != nullptr)
+    {
+        RemoveFromList(*timer);
+        timer->Fired();
+    }
+
+    mIsProcessing = false;
+
+    mEarliest = FindEarliest();
+    SetAlarm(aAlarmApi);
+}
+
+void Timer::Scheduler::RemoveAll(const AlarmApi &aAlarmApi)
+{
+    for (Timer *&head : mLists)
+    {
+        while (head != nullptr)
+        {
+            RemoveFromList(*head);
+        }
+    }
+
+    mEarliest = nullptr;
+
+    if (!mIsProcessing)
+    {
+        SetAlarm(aAlarmApi);
+    }
+}
+
+uint8_t Timer::Scheduler::GetSlotIndex(Time aTime, uint8_t aLevel)
+{
+    return static_cast<uint8_t>((aTime.GetValue() >> (aLevel * kLevelBits)) & (kNumSlots - 1));
+}
+
+void Timer::Scheduler::AdvanceWheel(Time aNow)
+{
+    // Moves `mWheelTime` forward to `aNow`, cascading all the slots
+    // reached on the way (in order) to lower levels and moving the
+    // level zero timers into the due list.
+
+    uint16_t list;
+    Time     slotTime;
+
+    while (FindNextSlot(list, slotTime) && (slotTime <= aNow))
+    {
+        Timer *timer;
+
+        mWheelTime = slotTime;
+
+        while ((timer = mLists[list]) != nullptr)
+        {
+            RemoveFromList(*timer);
+
+            if (timer->mFireTime <= mWheelTime)
+            {
+                InsertInDueList(*timer);
+            }
+            else
+            {
+                InsertInWheel(*timer);
+            }
+        }
+    }
+
+    mWheelTime = aNow;
+}
+
+bool Timer::Scheduler::FindNextSlot(uint16_t &aList, Time &aSlotTime) const
+{
+    // Finds the next occupied slot (after the current one) from the
+    // lowest non-empty level. All the timers in this slot fire before
+    // any timer in other slots in the wheel. Determines the list index
+    // of the slot and the time at which the slot starts.
+
+    bool found = false;
+
+    for (uint8_t level = 0; level < kNumLevels; level++)
+    {
+        uint32_t occupied = mOccupiedSlots[level];
+        uint8_t  current  = GetSlotIndex(mWheelTime, level);
+        uint8_t  slot     = current;
+        uint8_t  shift    = level * kLevelBits;
+        uint32_t distance;
+
+        if (occupied == 0)
+        {
+            continue;
+        }
+
+        do
+        {
+            slot = (slot + 1) & (kNumSlots - 1);
+        } while ((occupied & (1U << slot)) == 0);
+
+        distance = static_cast<uint8_t>(slot - current) & (kNumSlots - 1);
+
+        aList = level * kNumSlots + slot;
+        aSlotTime.SetValue((mWheelTime.GetValue() & ~((1U << shift) - 1)) + (distance << shift));
+        found = true;
+        break;
+    }
+
+    return found;
+}
+
+Timer *Timer::Scheduler::FindEarliest(void) const
+{
+    Timer   *earliest = mLists[kDueList];
+    uint16_t list;
+    Time     slotTime;
+
+    VerifyOrExit(earliest == nullptr);
+    VerifyOrExit(FindNextSlot(list, slotTime));
+
+    earliest = mLists[list];
+
+    // Level zero slots contain timers with same fire time (in the
+    // order they were added). A higher level slot is searched for
+    // the earliest timer.
+
+    if (list >= kNumSlots)
+    {
+        for (Timer *timer = earliest->mNext; timer != nullptr; timer = timer->mNext)
+        {
+            if (timer->DoesFireBefore(*earliest, mWheelTime))
+            {
+                earliest = timer;
+            }
+        }
+    }
+
+exit:
+    return earliest;
+}
+
+void Timer::Scheduler::InsertInWheel(Timer &aTimer)
+{
+    // The timer fire time MUST be after `mWheelTime`.
+
+    uint32_t diff  = aTimer.mFireTime.GetValue() ^ mWheelTime.GetValue();
+    uint8_t  level = 0;
+    uint8_t  slot;
+    uint16_t list;
+
+    while ((diff >> kLevelBits) != 0)
+    {
+        diff >>= kLevelBits;
+        level++;
+    }
+
+    slot = GetSlotIndex(aTimer.mFireTime, level);
+    list = level * kNumSlots + slot;
+
+    AddToList(list, aTimer, (mLists[list] == nullptr) ? nullptr : mLists[list]->mPrev);
+    mOccupiedSlots[level] |= (1U << slot);
+}
+
+void Timer::Scheduler::InsertInDueList(Timer &aTimer)
+{
+    // Keeps the due list sorted by fire time, the search starts
+    // from the tail since timers are mostly added in order.
+
+    Timer *head = mLists[kDueList];
+    Timer *prev = (head == nullptr) ? nullptr : head->mPrev;
+
+    while ((prev != nullptr) && aTimer.DoesFireBefore(*prev, mWheelTime))
+    {
+        prev = (prev == head) ? nullptr : prev->mPrev;
+    }
+
+    AddToList(kDueList, aTimer, prev);
+}
+
+void Timer::Scheduler::AddToList(uint16_t aList, Timer &aTimer, Timer *aPrevTimer)
+{
+    // Adds `aTimer` after `aPrevTimer`, or at the head of the list
+    // if `aPrevTimer` is `nullptr`.
+
+    Timer *&head = mLists[aList];
+
+    aTimer.mWheelList = aList;
+
+    if (aPrevTimer == nullptr)
+    {
+        aTimer.mNext = head;
+
+        if (head == nullptr)
+        {
+            aTimer.mPrev = &aTimer;
+        }
+        else
+        {
+            aTimer.mPrev = head->mPrev;
+            head->mPrev  = &aTimer;
+        }
+
+        head = &aTimer;
+    }
+    else
+    {
+        aTimer.mNext = aPrevTimer->mNext;
+        aTimer.mPrev = aPrevTimer;
+
+        if (aPrevTimer->mNext == nullptr)
+        {
+            head->mPrev = &aTimer;
+        }
+        else
+        {
+            aPrevTimer->mNext->mPrev = &aTimer;
+        }
+
+        aPrevTimer->mNext = &aTimer;
+    }
+}
+
+void Timer::Scheduler::RemoveFromList(Timer &aTimer)
+{
+    Timer *&head = mLists[aTimer.mWheelList];
+
+    if (&aTimer == head)
+    {
+        head = aTimer.mNext;
+
+        if (head != nullptr)
+        {
+            head->mPrev = aTimer.mPrev;
+        }
+    }
+    else
+    {
+        aTimer.mPrev->mNext = aTimer.mNext;
+
+        if (aTimer.mNext == nullptr)
+        {
+            head->mPrev = aTimer.mPrev;
+        }
+        else
+        {
+            aTimer.mNext->mPrev = aTimer.mPrev;
+        }
+    }
+
+    if ((head == nullptr) && (aTimer.mWheelList < kNumWheelLists))
+    {
+        mOccupiedSlots[aTimer.mWheelList / kNumSlots] &= ~(1U << (aTimer.mWheelList % kNumSlots));
+    }
+
+    aTimer.mNext = &aTimer;
+}
+
+#endif // OPENTHREAD_CONFIG_TIMER_WHEEL_ENABLE
+
 extern "C" void otPlatAlarmMilliFired(otInstance *aInstance)
 {
     VerifyOrExit(otInstanceIsInitialized(aInstance));
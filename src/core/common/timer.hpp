@@ -36,6 +36,7 @@
 
 #include "openthread-core-config.h"
 
+#include <limits.h>
 #include <stddef.h>
 #include <stdint.h>
 
@@ -114,10 +115,7 @@ protected:
             uint32_t (*AlarmGetNow)(void);
         };
 
-        explicit Scheduler(Instance &aInstance)
-            : InstanceLocator(aInstance)
-        {
-        }
+        explicit Scheduler(Instance &aInstance);
 
         void Add(Timer &aTimer, const AlarmApi &aAlarmApi);
         void Remove(Timer &aTimer, const AlarmApi &aAlarmApi);
@@ -125,13 +123,53 @@ protected:
         void ProcessTimers(const AlarmApi &aAlarmApi);
         void SetAlarm(const AlarmApi &aAlarmApi);
 
+#if OPENTHREAD_CONFIG_TIMER_WHEEL_ENABLE
+        // The hierarchical timing wheel has `kNumLevels` levels, each with `kNumSlots` slots. A timer is placed at
+        // the level determined by the most significant bit in which its fire time differs from `mWheelTime`, and
+        // in the slot given by the fire time bits covered by that level. Level zero slots hold timers firing at one
+        // exact time. Slots at higher levels are cascaded down to lower levels as `mWheelTime` reaches them.
+        //
+        // Each slot is a doubly linked list (the `mPrev` of the head points to the tail). Two extra lists hold the
+        // timers which are due (sorted by fire time) and the ones being fired from `ProcessTimers()`.
+
+        static constexpr uint8_t  kLevelBits     = 5;
+        static constexpr uint16_t kNumSlots      = (1U << kLevelBits);
+        static constexpr uint8_t  kNumLevels     = 7; // `kNumLevels * kLevelBits` should cover all `Time` bits.
+        static constexpr uint16_t kNumWheelLists = kNumLevels * kNumSlots;
+        static constexpr uint16_t kDueList       = kNumWheelLists;
+        static constexpr uint16_t kFiringList    = kNumWheelLists + 1;
+        static constexpr uint16_t kNumLists      = kNumWheelLists + 2;
+
+        static_assert(kNumLevels * kLevelBits >= sizeof(uint32_t) * CHAR_BIT, "kNumLevels does not cover Time range");
+
+        void   AdvanceWheel(Time aNow);
+        bool   FindNextSlot(uint16_t &aList, Time &aSlotTime) const;
+        Timer *FindEarliest(void) const;
+        void   InsertInWheel(Timer &aTimer);
+        void   InsertInDueList(Timer &aTimer);
+        void   AddToList(uint16_t aList, Timer &aTimer, Timer *aPrevTimer);
+        void   RemoveFromList(Timer &aTimer);
+
+        static uint8_t GetSlotIndex(Time aTime, uint8_t aLevel);
+
+        Timer   *mLists[kNumLists];
+        uint32_t mOccupiedSlots[kNumLevels];
+        Timer   *mEarliest;
+        Time     mWheelTime;
+        bool     mIsProcessing;
+#else
         LinkedList<Timer> mTimerList;
+#endif
     };
 
     Timer(Instance &aInstance, Handler aHandler)
         : InstanceLocator(aInstance)
         , mHandler(aHandler)
         , mNext(this)
+#if OPENTHREAD_CONFIG_TIMER_WHEEL_ENABLE
+        , mPrev(nullptr)
+        , mWheelList(0)
+#endif
     {
     }
 
@@ -141,6 +179,10 @@ protected:
     Handler mHandler;
     Time    mFireTime;
     Timer  *mNext;
+#if OPENTHREAD_CONFIG_TIMER_WHEEL_ENABLE
+    Timer   *mPrev;
+    uint16_t mWheelList;
+#endif
 };
 
 extern "C" void otPlatAlarmMilliFired(otInstance *aInstance);
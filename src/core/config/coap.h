@@ -47,6 +47,20 @@
 #define OPENTHREAD_CONFIG_COAP_SERVER_MAX_CACHED_RESPONSES 10
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_COAP_MAX_INDEXED_REQUESTS
+ *
+ * Maximum number of pending CoAP requests (per CoAP agent) tracked by the hash indexes used to match received
+ * responses to requests by Message ID and token.
+ *
+ * If more requests are pending, matching falls back to a linear scan until the unindexed requests are removed (this
+ * is logged at info level). Each indexed request costs about 18 bytes of RAM per CoAP agent (on 32-bit targets).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_COAP_MAX_INDEXED_REQUESTS
+#define OPENTHREAD_CONFIG_COAP_MAX_INDEXED_REQUESTS 16
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_COAP_API_ENABLE
  *
@@ -109,6 +109,23 @@
 #define OPENTHREAD_CONFIG_IP6_REASSEMBLY_TIMEOUT 60
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_IP6_REASSEMBLY_MAX_DATAGRAMS
+ *
+ * The maximum number of IPv6 datagrams being reassembled from fragments at the same time.
+ *
+ * Each datagram uses an entry in a fixed-size reassembly table, which tracks the received 8-byte blocks of the
+ * datagram (up to `OPENTHREAD_CONFIG_IP6_MAX_ASSEMBLED_DATAGRAM` bytes). When a fragment of a new datagram is received
+ * while this many datagrams are being reassembled, the oldest one (the first one started) is dropped to make room.
+ *
+ * The default of 4 covers the few fragmented datagrams a Thread device is expected to receive at a time, while
+ * keeping the table small.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_IP6_REASSEMBLY_MAX_DATAGRAMS
+#define OPENTHREAD_CONFIG_IP6_REASSEMBLY_MAX_DATAGRAMS 4
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_IP6_SLAAC_ENABLE
  *
@@ -202,4 +219,40 @@
 #define OPENTHREAD_CONFIG_IP6_BR_COUNTERS_ENABLE OPENTHREAD_CONFIG_BORDER_ROUTING_ENABLE
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_IP6_CHECKSUM_SIMD_ENABLE
+ *
+ * Define as 1 to use SIMD instructions (SSE2 or NEON, when supported by the target) to calculate the one's
+ * complement checksum of TCP/UDP/ICMP messages.
+ *
+ * When disabled (or when the target supports neither instruction set), the checksum is calculated a 32-bit word at
+ * a time.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_IP6_CHECKSUM_SIMD_ENABLE
+#define OPENTHREAD_CONFIG_IP6_CHECKSUM_SIMD_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_IP6_UDP_PORT_INDEX_BUCKETS
+ *
+ * The number of hash buckets used to index the open UDP sockets by their local port.
+ *
+ * Received UDP datagrams are matched against the sockets in the bucket of their destination port only.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_IP6_UDP_PORT_INDEX_BUCKETS
+#define OPENTHREAD_CONFIG_IP6_UDP_PORT_INDEX_BUCKETS 8
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_IP6_MULTICAST_INDEX_BUCKETS
+ *
+ * The number of hash buckets used to index the multicast addresses subscribed on a network interface.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_IP6_MULTICAST_INDEX_BUCKETS
+#define OPENTHREAD_CONFIG_IP6_MULTICAST_INDEX_BUCKETS 8
+#endif
+
 #endif // CONFIG_IP6_H_
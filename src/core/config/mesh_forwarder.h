@@ -60,6 +60,23 @@
 #define OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_TIMEOUT 2
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_MAX_DATAGRAMS
+ *
+ * The maximum number of 6LoWPAN datagrams being reassembled from fragments at the same time.
+ *
+ * Each datagram uses an entry in a fixed-size reassembly table, which tracks the received 8-byte blocks of the
+ * datagram (up to the 2047-byte max datagram size of a fragment header). When a first fragment of a new datagram is
+ * received while this many datagrams are being reassembled, the oldest one (the least recently updated) is dropped to
+ * make room.
+ *
+ * The default of 8 lets a router reassemble datagrams from several neighbors at the same time.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_MAX_DATAGRAMS
+#define OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_MAX_DATAGRAMS 8
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_NUM_FRAGMENT_PRIORITY_ENTRIES
  *
@@ -70,6 +87,19 @@
 #define OPENTHREAD_CONFIG_NUM_FRAGMENT_PRIORITY_ENTRIES 8
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_NUM_INDIRECT_QUEUE_ENTRIES
+ *
+ * The number of entries shared by the per-child indirect transmission queues on an FTD.
+ *
+ * One entry is used for each (message, sleepy child) pair queued for indirect transmission. When all entries are in
+ * use, indirect messages for the affected child are found by scanning the send queue instead.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NUM_INDIRECT_QUEUE_ENTRIES
+#define OPENTHREAD_CONFIG_NUM_INDIRECT_QUEUE_ENTRIES OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_DELAY_AWARE_QUEUE_MANAGEMENT_ENABLE
  *
@@ -148,4 +178,33 @@
 #endif
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MESH_FORWARDER_FLOW_CACHE_ENABLE
+ *
+ * Define to 1 to enable the forwarding flow cache on an FTD.
+ *
+ * The flow cache memoizes the mesh destination and next hop determined for recent IPv6 destinations, so that
+ * subsequent messages to the same destination skip the route, child table and address cache lookups. Entries are
+ * invalidated when the router table, child table, Network Data or address cache change, which requires tracking a
+ * generation counter in each of them.
+ *
+ * The measured gain is small compared to the whole transmit path, so the cache is disabled by default.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MESH_FORWARDER_FLOW_CACHE_ENABLE
+#define OPENTHREAD_CONFIG_MESH_FORWARDER_FLOW_CACHE_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MESH_FORWARDER_FLOW_CACHE_SIZE
+ *
+ * The number of entries in the forwarding flow cache.
+ *
+ * Applicable when `OPENTHREAD_CONFIG_MESH_FORWARDER_FLOW_CACHE_ENABLE` is set.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MESH_FORWARDER_FLOW_CACHE_SIZE
+#define OPENTHREAD_CONFIG_MESH_FORWARDER_FLOW_CACHE_SIZE 16
+#endif
+
 #endif // CONFIG_MESH_FORWARDER_H_
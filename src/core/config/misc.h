@@ -121,6 +121,36 @@
 #define OPENTHREAD_CONFIG_UPTIME_ENABLE OPENTHREAD_FTD
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_NETDATA_LOOKUP_INDEX_ENABLE
+ *
+ * Define to 1 to keep an index of the Network Data prefixes used by the per-packet lookups (on-mesh prefix, route,
+ * and context lookups).
+ *
+ * The index is rebuilt on the first lookup after the Network Data changes and uses about 1.2 KB of RAM per Network
+ * Data instance.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NETDATA_LOOKUP_INDEX_ENABLE
+#define OPENTHREAD_CONFIG_NETDATA_LOOKUP_INDEX_ENABLE OPENTHREAD_FTD
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_TIMER_WHEEL_ENABLE
+ *
+ * Define to 1 to use a hierarchical timing wheel in the `TimerMilli` and `TimerMicro` schedulers instead of a single
+ * sorted list of timers.
+ *
+ * The timing wheel makes starting and stopping a timer O(1) independent of the number of active timers and fires all
+ * expired timers in a single batch from the alarm callback. It uses more RAM (a few hundred list heads per scheduler
+ * plus an extra pointer per timer) and is intended for devices with a large number of active timers (e.g., a border
+ * router serving many children).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_TIMER_WHEEL_ENABLE
+#define OPENTHREAD_CONFIG_TIMER_WHEEL_ENABLE 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_JAM_DETECTION_ENABLE
  *
@@ -183,6 +213,24 @@
 #define OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS 44
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFERS_ENABLE
+ *
+ * Define to 1 to share the message buffers between a message and its clones (copy-on-write).
+ *
+ * When enabled, cloning a message copies only its first buffer and references the remaining ones. A shared buffer
+ * is copied when either message writes to it. No buffers are reserved for these copies, so such a write fails with
+ * `kErrorNoBufs` when the pool is exhausted. Each buffer in the pool needs an additional `uint16_t` reference count.
+ *
+ * @note This requires message buffers to be allocated from the OpenThread buffer pool, i.e., it cannot be used with
+ * OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE or OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFERS_ENABLE
+#define OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFERS_ENABLE \
+    (!OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE && !OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT)
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_MESSAGE_BUFFER_SIZE
  *
@@ -313,6 +361,21 @@
 #define OPENTHREAD_CONFIG_HEAP_EXTERNAL_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_HEAP_TLSF_ENABLE
+ *
+ * Define as 1 to use a two-level segregated fit (TLSF) allocator for the internal heap instead of the default
+ * first-fit free list.
+ *
+ * The TLSF allocator keeps free blocks in size-class lists (indexed by bitmaps), so allocating and freeing take
+ * constant time regardless of the number of free blocks. It requires a few hundred bytes of RAM for the free list
+ * heads. Applicable only when the internal heap is used (`OPENTHREAD_CONFIG_HEAP_EXTERNAL_ENABLE` is not set).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_HEAP_TLSF_ENABLE
+#define OPENTHREAD_CONFIG_HEAP_TLSF_ENABLE 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_DTLS_APPLICATION_DATA_MAX_LENGTH
  *
@@ -55,6 +55,16 @@
 #define OPENTHREAD_CONFIG_NAT64_MAX_MAPPINGS 254
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_NAT64_MAPPING_INDEX_BUCKETS
+ *
+ * Specifies the number of hash buckets used to look up NAT64 address mappings by IPv6 and by IPv4 address.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NAT64_MAPPING_INDEX_BUCKETS
+#define OPENTHREAD_CONFIG_NAT64_MAPPING_INDEX_BUCKETS 32
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_NAT64_IDLE_TIMEOUT_SECONDS
  *
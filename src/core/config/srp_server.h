@@ -109,4 +109,32 @@
 #define OPENTHREAD_CONFIG_SRP_SERVER_SERVICE_UPDATE_TIMEOUT ((4 * 250u) + 250u)
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_BUCKETS
+ *
+ * Specifies the number of hash buckets used by the SRP server to index the registered hosts by host name and the
+ * registered services by service name and by service instance name.
+ *
+ * The indexes are used when resolving DNS-SD queries and when checking for name conflicts, so that the server does not
+ * need to iterate over all registered hosts and their services.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_BUCKETS
+#define OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_BUCKETS 64
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_SRP_SERVER_MAX_LEASE_EXPIRIES_PER_RUN
+ *
+ * Specifies the maximum number of host and service lease expirations processed by the SRP server in one run of its
+ * lease timer.
+ *
+ * When more leases expire at the same time, the remaining ones are processed on the following runs of the timer, so
+ * that a large burst of expirations does not block other tasks.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_SRP_SERVER_MAX_LEASE_EXPIRIES_PER_RUN
+#define OPENTHREAD_CONFIG_SRP_SERVER_MAX_LEASE_EXPIRIES_PER_RUN 16
+#endif
+
 #endif // CONFIG_SRP_SERVER_H_
@@ -249,17 +249,20 @@ void AesCcm::Payload(void *aPlainText, void *aCipherText, uint32_t aLength, Mode
 }
 
 #if !OPENTHREAD_RADIO
-void AesCcm::Payload(Message &aMessage, uint16_t aOffset, uint16_t aLength, Mode aMode)
+Error AesCcm::Payload(Message &aMessage, uint16_t aOffset, uint16_t aLength, Mode aMode)
 {
+    Error                 error;
     Message::MutableChunk chunk;
 
-    aMessage.GetFirstChunk(aOffset, aLength, chunk);
+    error = aMessage.GetFirstChunk(aOffset, aLength, chunk);
 
     while (chunk.GetLength() > 0)
     {
         Payload(chunk.GetBytes(), chunk.GetBytes(), chunk.GetLength(), aMode);
         aMessage.GetNextChunk(aLength, chunk);
     }
+
+    return error;
 }
 #endif
 
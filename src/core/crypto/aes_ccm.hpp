@@ -164,8 +164,11 @@ public:
      * @param[in]      aLength      Payload length in bytes.
      * @param[in]      aMode        Mode to indicate whether to encrypt (`kEncrypt`) or decrypt (`kDecrypt`).
      *
+     * @retval kErrorNone    Successfully processed the payload.
+     * @retval kErrorNoBufs  Failed to copy the buffers shared with a clone of @p aMessage, the payload is unchanged.
+     *
      */
-    void Payload(Message &aMessage, uint16_t aOffset, uint16_t aLength, Mode aMode);
+    Error Payload(Message &aMessage, uint16_t aOffset, uint16_t aLength, Mode aMode);
 #endif
 
     /**
@@ -33,6 +33,14 @@
 
 #include "checksum.hpp"
 
+#if OPENTHREAD_CONFIG_IP6_CHECKSUM_SIMD_ENABLE
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+#endif
+
 #include "common/code_utils.hpp"
 #include "common/message.hpp"
 #include "net/icmp6.hpp"
@@ -70,13 +78,99 @@ void Checksum::AddUint16(uint16_t aUint16)
 
 void Checksum::AddData(const uint8_t *aBuffer, uint16_t aLength)
 {
-    for (uint16_t i = 0; i < aLength; i++)
+    // The one's complement sum is independent of byte order and the
+    // carries can be deferred (RFC 1071), so the data is summed as
+    // native-endian words in a wide accumulator which is then folded
+    // to 16 bits and byte swapped (on little-endian hosts) before it
+    // is added to `mValue`.
+
+    uint64_t sum = 0;
+
+    VerifyOrExit(aLength > 0);
+
+    if (mAtOddIndex)
+    {
+        AddUint8(*aBuffer++);
+        aLength--;
+    }
+
+#if OPENTHREAD_CONFIG_IP6_CHECKSUM_SIMD_ENABLE && (defined(__SSE2__) || defined(__ARM_NEON))
+    {
+        // Sum 16-bit words into four 32-bit lanes. With `aLength`
+        // limited to `uint16_t`, each lane adds at most 8192 words
+        // and therefore cannot overflow.
+
+        static constexpr uint16_t kBlockSize = 16;
+
+        uint32_t lanes[4];
+
+#if defined(__SSE2__)
+        const __m128i zero = _mm_setzero_si128();
+        __m128i       acc  = zero;
+
+        for (; aLength >= kBlockSize; aBuffer += kBlockSize, aLength -= kBlockSize)
+        {
+            __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(aBuffer));
+
+            acc = _mm_add_epi32(acc, _mm_unpacklo_epi16(block, zero));
+            acc = _mm_add_epi32(acc, _mm_unpackhi_epi16(block, zero));
+        }
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(lanes), acc);
+#else
+        uint32x4_t acc = vdupq_n_u32(0);
+
+        for (; aLength >= kBlockSize; aBuffer += kBlockSize, aLength -= kBlockSize)
+        {
+            acc = vpadalq_u16(acc, vreinterpretq_u16_u8(vld1q_u8(aBuffer)));
+        }
+
+        vst1q_u32(lanes, acc);
+#endif
+
+        for (uint32_t lane : lanes)
+        {
+            sum += lane;
+        }
+    }
+#endif
+
+    for (; aLength >= sizeof(uint32_t); aBuffer += sizeof(uint32_t), aLength -= sizeof(uint32_t))
+    {
+        uint32_t word;
+
+        memcpy(&word, aBuffer, sizeof(word));
+        sum += word;
+    }
+
+    if (aLength >= sizeof(uint16_t))
+    {
+        uint16_t word;
+
+        memcpy(&word, aBuffer, sizeof(word));
+        sum += word;
+
+        aBuffer += sizeof(uint16_t);
+        aLength -= sizeof(uint16_t);
+    }
+
+    while (sum >> 16)
+    {
+        sum = (sum & 0xffff) + (sum >> 16);
+    }
+
+    AddUint16(Encoding::BigEndian::HostSwap16(static_cast<uint16_t>(sum)));
+
+    if (aLength > 0)
     {
-        AddUint8(aBuffer[i]);
+        AddUint8(*aBuffer);
     }
+
+exit:
+    return;
 }
 
-void Checksum::WriteToMessage(uint16_t aOffset, Message &aMessage) const
+Error Checksum::WriteToMessage(uint16_t aOffset, Message &aMessage) const
 {
     uint16_t checksum = GetValue();
 
@@ -87,7 +181,39 @@ void Checksum::WriteToMessage(uint16_t aOffset, Message &aMessage) const
 
     checksum = Encoding::BigEndian::HostSwap16(checksum);
 
-    aMessage.Write(aOffset, checksum);
+    return aMessage.Write(aOffset, checksum);
+}
+
+void Checksum::AddPseudoHeader(const Ip6::Address &aSource,
+                               const Ip6::Address &aDestination,
+                               uint8_t             aIpProto,
+                               uint16_t            aLength)
+{
+    // Pseudo-header for checksum calculation (RFC-2460).
+
+    AddData(aSource.GetBytes(), sizeof(Ip6::Address));
+    AddData(aDestination.GetBytes(), sizeof(Ip6::Address));
+    AddUint16(aLength);
+    AddUint16(static_cast<uint16_t>(aIpProto));
+}
+
+void Checksum::AddPseudoHeader(const Ip4::Address &aSource,
+                               const Ip4::Address &aDestination,
+                               uint8_t             aIpProto,
+                               uint16_t            aLength)
+{
+    // Pseudo-header for checksum calculation (RFC-768/792/793).
+    // Note: ICMP checksum won't count the pseudo header like TCP and UDP.
+
+    VerifyOrExit(aIpProto != Ip4::kProtoIcmp);
+
+    AddData(aSource.GetBytes(), sizeof(Ip4::Address));
+    AddData(aDestination.GetBytes(), sizeof(Ip4::Address));
+    AddUint16(static_cast<uint16_t>(aIpProto));
+    AddUint16(aLength);
+
+exit:
+    return;
 }
 
 void Checksum::Calculate(const Ip6::Address &aSource,
@@ -98,12 +224,7 @@ void Checksum::Calculate(const Ip6::Address &aSource,
     Message::Chunk chunk;
     uint16_t       length = aMessage.GetLength() - aMessage.GetOffset();
 
-    // Pseudo-header for checksum calculation (RFC-2460).
-
-    AddData(aSource.GetBytes(), sizeof(Ip6::Address));
-    AddData(aDestination.GetBytes(), sizeof(Ip6::Address));
-    AddUint16(length);
-    AddUint16(static_cast<uint16_t>(aIpProto));
+    AddPseudoHeader(aSource, aDestination, aIpProto, length);
 
     // Add message content (from offset to the end) to checksum.
 
@@ -124,15 +245,7 @@ void Checksum::Calculate(const Ip4::Address &aSource,
     Message::Chunk chunk;
     uint16_t       length = aMessage.GetLength() - aMessage.GetOffset();
 
-    // Pseudo-header for checksum calculation (RFC-768/792/793).
-    // Note: ICMP checksum won't count the pseudo header like TCP and UDP.
-    if (aIpProto != Ip4::kProtoIcmp)
-    {
-        AddData(aSource.GetBytes(), sizeof(Ip4::Address));
-        AddData(aDestination.GetBytes(), sizeof(Ip4::Address));
-        AddUint16(static_cast<uint16_t>(aIpProto));
-        AddUint16(length);
-    }
+    AddPseudoHeader(aSource, aDestination, aIpProto, length);
 
     // Add message content (from offset to the end) to checksum.
 
@@ -154,11 +267,12 @@ Error Checksum::VerifyMessageChecksum(const Message &aMessage, const Ip6::Messag
     return (checksum.GetValue() == kValidRxChecksum) ? kErrorNone : kErrorDrop;
 }
 
-void Checksum::UpdateMessageChecksum(Message            &aMessage,
-                                     const Ip6::Address &aSource,
-                                     const Ip6::Address &aDestination,
-                                     uint8_t             aIpProto)
+Error Checksum::UpdateMessageChecksum(Message            &aMessage,
+                                      const Ip6::Address &aSource,
+                                      const Ip6::Address &aDestination,
+                                      uint8_t             aIpProto)
 {
+    Error    error = kErrorNone;
     uint16_t headerOffset;
     Checksum checksum;
 
@@ -181,19 +295,20 @@ void Checksum::UpdateMessageChecksum(Message            &aMessage,
     }
 
     // Clear the checksum before calculating it.
-    aMessage.Write<uint16_t>(aMessage.GetOffset() + headerOffset, 0);
+    SuccessOrExit(error = aMessage.Write<uint16_t>(aMessage.GetOffset() + headerOffset, 0));
     checksum.Calculate(aSource, aDestination, aIpProto, aMessage);
-    checksum.WriteToMessage(aMessage.GetOffset() + headerOffset, aMessage);
+    error = checksum.WriteToMessage(aMessage.GetOffset() + headerOffset, aMessage);
 
 exit:
-    return;
+    return error;
 }
 
-void Checksum::UpdateMessageChecksum(Message            &aMessage,
-                                     const Ip4::Address &aSource,
-                                     const Ip4::Address &aDestination,
-                                     uint8_t             aIpProto)
+Error Checksum::UpdateMessageChecksum(Message            &aMessage,
+                                      const Ip4::Address &aSource,
+                                      const Ip4::Address &aDestination,
+                                      uint8_t             aIpProto)
 {
+    Error    error = kErrorNone;
     uint16_t headerOffset;
     Checksum checksum;
 
@@ -216,12 +331,132 @@ void Checksum::UpdateMessageChecksum(Message            &aMessage,
     }
 
     // Clear the checksum before calculating it.
-    aMessage.Write<uint16_t>(aMessage.GetOffset() + headerOffset, 0);
+    SuccessOrExit(error = aMessage.Write<uint16_t>(aMessage.GetOffset() + headerOffset, 0));
     checksum.Calculate(aSource, aDestination, aIpProto, aMessage);
-    checksum.WriteToMessage(aMessage.GetOffset() + headerOffset, aMessage);
+    error = checksum.WriteToMessage(aMessage.GetOffset() + headerOffset, aMessage);
 
 exit:
-    return;
+    return error;
+}
+
+uint16_t Checksum::GetChecksumFieldOffset(uint8_t aIpProto)
+{
+    uint16_t offset = kInvalidFieldOffset;
+
+    switch (aIpProto)
+    {
+    case Ip6::kProtoTcp:
+        offset = Ip6::Tcp::Header::kChecksumFieldOffset;
+        break;
+
+    case Ip6::kProtoUdp:
+        offset = Ip6::Udp::Header::kChecksumFieldOffset;
+        break;
+
+    case Ip6::kProtoIcmp6:
+        offset = Ip6::Icmp::Header::kChecksumFieldOffset;
+        break;
+
+    case Ip4::kProtoIcmp:
+        offset = Ip4::Icmp::Header::kChecksumFieldOffset;
+        break;
+
+    default:
+        break;
+    }
+
+    return offset;
+}
+
+Error Checksum::AdjustMessageChecksum(Message        &aMessage,
+                                      uint8_t         aIpProto,
+                                      const Checksum &aOldPseudoHeader,
+                                      const Checksum &aNewPseudoHeader)
+{
+    Error    error  = kErrorNone;
+    uint16_t offset = GetChecksumFieldOffset(aIpProto);
+    uint16_t value;
+    Checksum checksum;
+
+    VerifyOrExit(offset != kInvalidFieldOffset);
+
+    offset += aMessage.GetOffset();
+    VerifyOrExit(aMessage.Read(offset, value) == kErrorNone);
+    value = Encoding::BigEndian::HostSwap16(value);
+
+    // A zero UDP checksum indicates that the checksum is not used
+    // (only allowed over IPv4), so there is nothing to adjust.
+    VerifyOrExit((aIpProto != Ip6::kProtoUdp) || (value != 0), error = kErrorNotFound);
+
+    // The message content is unchanged, so only the pseudo-header
+    // sums differ. From RFC 1624 (Eqn. 3): HC' = ~(~HC + ~m + m').
+
+    checksum.AddUint16(static_cast<uint16_t>(~value));
+    checksum.AddUint16(static_cast<uint16_t>(~aOldPseudoHeader.GetValue()));
+    checksum.AddUint16(aNewPseudoHeader.GetValue());
+    error = checksum.WriteToMessage(offset, aMessage);
+
+exit:
+    return error;
+}
+
+Error Checksum::UpdateMessageChecksum(Message &aMessage, const Ip6::Header &aIp6Header, const Ip4::Header &aIp4Header)
+{
+    Error    error;
+    uint16_t length = aMessage.GetLength() - aMessage.GetOffset();
+    Checksum oldPseudoHeader;
+    Checksum newPseudoHeader;
+
+    oldPseudoHeader.AddPseudoHeader(aIp6Header.GetSource(), aIp6Header.GetDestination(), aIp6Header.GetNextHeader(),
+                                    length);
+    newPseudoHeader.AddPseudoHeader(aIp4Header.GetSource(), aIp4Header.GetDestination(), aIp4Header.GetProtocol(),
+                                    length);
+
+    error = AdjustMessageChecksum(aMessage, aIp4Header.GetProtocol(), oldPseudoHeader, newPseudoHeader);
+
+    if (error == kErrorNotFound)
+    {
+        error = UpdateMessageChecksum(aMessage, aIp4Header.GetSource(), aIp4Header.GetDestination(),
+                                      aIp4Header.GetProtocol());
+    }
+
+    return error;
+}
+
+Error Checksum::UpdateMessageChecksum(Message &aMessage, const Ip4::Header &aIp4Header, const Ip6::Header &aIp6Header)
+{
+    Error    error;
+    uint16_t length = aMessage.GetLength() - aMessage.GetOffset();
+    Checksum oldPseudoHeader;
+    Checksum newPseudoHeader;
+
+    oldPseudoHeader.AddPseudoHeader(aIp4Header.GetSource(), aIp4Header.GetDestination(), aIp4Header.GetProtocol(),
+                                    length);
+    newPseudoHeader.AddPseudoHeader(aIp6Header.GetSource(), aIp6Header.GetDestination(), aIp6Header.GetNextHeader(),
+                                    length);
+
+    error = AdjustMessageChecksum(aMessage, aIp6Header.GetNextHeader(), oldPseudoHeader, newPseudoHeader);
+
+    if (error == kErrorNotFound)
+    {
+        error = UpdateMessageChecksum(aMessage, aIp6Header.GetSource(), aIp6Header.GetDestination(),
+                                      aIp6Header.GetNextHeader());
+    }
+
+    return error;
+}
+
+uint16_t Checksum::UpdateChecksum(uint16_t aChecksum, uint16_t aOldValue, uint16_t aNewValue)
+{
+    Checksum checksum;
+
+    // From RFC 1624 (Eqn. 3): HC' = ~(~HC + ~m + m').
+
+    checksum.AddUint16(static_cast<uint16_t>(~aChecksum));
+    checksum.AddUint16(static_cast<uint16_t>(~aOldValue));
+    checksum.AddUint16(aNewValue);
+
+    return static_cast<uint16_t>(~checksum.GetValue());
 }
 
 void Checksum::UpdateIp4HeaderChecksum(Ip4::Header &aHeader)
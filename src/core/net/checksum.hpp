@@ -79,11 +79,14 @@ public:
      * @param[in] aDestination  The destination address.
      * @param[in] aIpProto      The Internet Protocol value.
      *
+     * @retval kErrorNone    Successfully updated the checksum (or there was no checksum to update).
+     * @retval kErrorNoBufs  Failed to copy the buffers shared with a clone of @p aMessage.
+     *
      */
-    static void UpdateMessageChecksum(Message            &aMessage,
-                                      const Ip6::Address &aSource,
-                                      const Ip6::Address &aDestination,
-                                      uint8_t             aIpProto);
+    static Error UpdateMessageChecksum(Message            &aMessage,
+                                       const Ip6::Address &aSource,
+                                       const Ip6::Address &aDestination,
+                                       uint8_t             aIpProto);
 
     /**
      * Calculates and then updates the checksum in a given IPv4 message (if TCP/UDP/ICMP(v4)).
@@ -95,11 +98,65 @@ public:
      * @param[in] aDestination  The destination address.
      * @param[in] aIpProto      The Internet Protocol value.
      *
+     * @retval kErrorNone    Successfully updated the checksum (or there was no checksum to update).
+     * @retval kErrorNoBufs  Failed to copy the buffers shared with a clone of @p aMessage.
+     *
+     */
+    static Error UpdateMessageChecksum(Message            &aMessage,
+                                       const Ip4::Address &aSource,
+                                       const Ip4::Address &aDestination,
+                                       uint8_t             aIpProto);
+
+    /**
+     * Incrementally updates the checksum in a given message after its IPv6 header is translated into an IPv4 header
+     * (RFC 1624), replacing the IPv6 pseudo-header with the IPv4 one (if any).
+     *
+     * If the message is too short to contain the checksum field, it is not updated.
+     *
+     * @param[in,out] aMessage    The message to update the checksum in. The `aMessage.GetOffset()` should point to
+     *                            start of the TCP/UDP/ICMP(v4) header.
+     * @param[in]     aIp6Header  The original IPv6 header.
+     * @param[in]     aIp4Header  The translated IPv4 header.
+     *
+     * @retval kErrorNone    Successfully updated the checksum (or there was no checksum to update).
+     * @retval kErrorNoBufs  Failed to copy the buffers shared with a clone of @p aMessage.
+     *
      */
-    static void UpdateMessageChecksum(Message            &aMessage,
-                                      const Ip4::Address &aSource,
-                                      const Ip4::Address &aDestination,
-                                      uint8_t             aIpProto);
+    static Error UpdateMessageChecksum(Message           &aMessage,
+                                       const Ip6::Header &aIp6Header,
+                                       const Ip4::Header &aIp4Header);
+
+    /**
+     * Incrementally updates the checksum in a given message after its IPv4 header is translated into an IPv6 header
+     * (RFC 1624), replacing the IPv4 pseudo-header (if any) with the IPv6 one.
+     *
+     * A UDP datagram without checksum (zero checksum field) gets its checksum fully calculated, as IPv6 requires it.
+     * If the message is too short to contain the checksum field, it is not updated.
+     *
+     * @param[in,out] aMessage    The message to update the checksum in. The `aMessage.GetOffset()` should point to
+     *                            start of the TCP/UDP/ICMPv6 header.
+     * @param[in]     aIp4Header  The original IPv4 header.
+     * @param[in]     aIp6Header  The translated IPv6 header.
+     *
+     * @retval kErrorNone    Successfully updated the checksum (or there was no checksum to update).
+     * @retval kErrorNoBufs  Failed to copy the buffers shared with a clone of @p aMessage.
+     *
+     */
+    static Error UpdateMessageChecksum(Message           &aMessage,
+                                       const Ip4::Header &aIp4Header,
+                                       const Ip6::Header &aIp6Header);
+
+    /**
+     * Incrementally updates a checksum after a 16-bit word of the data covered by it is changed (RFC 1624).
+     *
+     * @param[in] aChecksum  The checksum.
+     * @param[in] aOldValue  The old value of the changed 16-bit word.
+     * @param[in] aNewValue  The new value of the changed 16-bit word.
+     *
+     * @returns The updated checksum.
+     *
+     */
+    static uint16_t UpdateChecksum(uint16_t aChecksum, uint16_t aOldValue, uint16_t aNewValue);
 
     /**
      * Calculates and then updates the checksum field in the IPv4 header.
@@ -120,7 +177,15 @@ private:
     void     AddUint8(uint8_t aUint8);
     void     AddUint16(uint16_t aUint16);
     void     AddData(const uint8_t *aBuffer, uint16_t aLength);
-    void     WriteToMessage(uint16_t aOffset, Message &aMessage) const;
+    Error    WriteToMessage(uint16_t aOffset, Message &aMessage) const;
+    void     AddPseudoHeader(const Ip6::Address &aSource,
+                             const Ip6::Address &aDestination,
+                             uint8_t             aIpProto,
+                             uint16_t            aLength);
+    void     AddPseudoHeader(const Ip4::Address &aSource,
+                             const Ip4::Address &aDestination,
+                             uint8_t             aIpProto,
+                             uint16_t            aLength);
     void     Calculate(const Ip6::Address &aSource,
                        const Ip6::Address &aDestination,
                        uint8_t             aIpProto,
@@ -130,7 +195,14 @@ private:
                        uint8_t             aIpProto,
                        const Message      &aMessage);
 
-    static constexpr uint16_t kValidRxChecksum = 0xffff;
+    static uint16_t GetChecksumFieldOffset(uint8_t aIpProto);
+    static Error    AdjustMessageChecksum(Message        &aMessage,
+                                          uint8_t         aIpProto,
+                                          const Checksum &aOldPseudoHeader,
+                                          const Checksum &aNewPseudoHeader);
+
+    static constexpr uint16_t kValidRxChecksum    = 0xffff;
+    static constexpr uint16_t kInvalidFieldOffset = 0xffff;
 
     uint16_t mValue;
     bool     mAtOddIndex;
@@ -257,10 +257,11 @@ void Server::SendResponse(Header                  aHeader,
     }
 
     aHeader.SetResponseCode(aResponseCode);
-    aMessage.Write(0, aHeader);
+    SuccessOrExit(error = aMessage.Write(0, aHeader));
 
     error = aSocket.SendTo(aMessage, aMessageInfo);
 
+exit:
     if (error != kErrorNone)
     {
         // do not use `FreeMessageOnError()` to avoid null check on nonnull pointer
@@ -386,7 +387,7 @@ Error Server::AppendPtrRecord(Message          &aMessage,
     SuccessOrExit(error = AppendInstanceName(aMessage, aInstanceName, aCompressInfo));
 
     ptrRecord.SetLength(aMessage.GetLength() - (recordOffset + sizeof(ResourceRecord)));
-    aMessage.Write(recordOffset, ptrRecord);
+    SuccessOrExit(error = aMessage.Write(recordOffset, ptrRecord));
 
 exit:
     return error;
@@ -419,7 +420,7 @@ Error Server::AppendSrvRecord(Message          &aMessage,
     SuccessOrExit(error = AppendHostName(aMessage, aHostName, aCompressInfo));
 
     srvRecord.SetLength(aMessage.GetLength() - (recordOffset + sizeof(ResourceRecord)));
-    aMessage.Write(recordOffset, srvRecord);
+    SuccessOrExit(error = aMessage.Write(recordOffset, srvRecord));
 
 exit:
     return error;
@@ -708,6 +709,7 @@ Header::Response Server::ResolveBySrp(Header                   &aResponseHeader,
     uint16_t         readOffset = sizeof(Header);
     Header::Response response   = Header::kResponseSuccess;
     char             name[Name::kMaxNameSize];
+    SrpHostList      addedHosts;
 
     for (uint16_t i = 0; i < aResponseHeader.GetQuestionCount(); i++)
     {
@@ -716,7 +718,7 @@ Header::Response Server::ResolveBySrp(Header                   &aResponseHeader,
         readOffset += sizeof(question);
 
         response = ResolveQuestionBySrp(name, question, aResponseHeader, aResponseMessage, aCompressInfo,
-                                        /* aAdditional */ false);
+                                        /* aAdditional */ false, addedHosts);
 
         LogInfo("ANSWER: TRANSACTION=0x%04x, QUESTION=[%s %d %d], RCODE=%d", aResponseHeader.GetMessageId(), name,
                 question.GetClass(), question.GetType(), response);
@@ -736,7 +738,7 @@ Header::Response Server::ResolveBySrp(Header                   &aResponseHeader,
 
             VerifyOrExit(Header::kResponseServerFailure != ResolveQuestionBySrp(name, question, aResponseHeader,
                                                                                 aResponseMessage, aCompressInfo,
-                                                                                /* aAdditional */ true),
+                                                                                /* aAdditional */ true, addedHosts),
                          response = Header::kResponseServerFailure);
 
             LogInfo("ADDITIONAL: TRANSACTION=0x%04x, QUESTION=[%s %d %d], RCODE=%d", aResponseHeader.GetMessageId(),
@@ -752,85 +754,69 @@ Header::Response Server::ResolveQuestionBySrp(const char       *aName,
                                               Header           &aResponseHeader,
                                               Message          &aResponseMessage,
                                               NameCompressInfo &aCompressInfo,
-                                              bool              aAdditional)
+                                              bool              aAdditional,
+                                              SrpHostList      &aAddedHosts)
 {
-    Error                    error    = kErrorNone;
-    const Srp::Server::Host *host     = nullptr;
-    TimeMilli                now      = TimerMilli::GetNow();
-    uint16_t                 qtype    = aQuestion.GetType();
-    Header::Response         response = Header::kResponseNameError;
+    Error                       error    = kErrorNone;
+    const Srp::Server::Service *service  = nullptr;
+    TimeMilli                   now      = TimerMilli::GetNow();
+    uint16_t                    qtype    = aQuestion.GetType();
+    Header::Response            response = Header::kResponseNameError;
+
+    // Handle AAAA query
+    if (qtype == ResourceRecord::kTypeAaaa)
+    {
+        const Srp::Server::Host *host = Get<Srp::Server>().FindHost(aName);
+
+        VerifyOrExit(!aAdditional && host != nullptr && !host->IsDeleted());
+
+        SuccessOrExit(error = AppendSrpHostAaaaRecords(*host, aResponseHeader, aResponseMessage, aCompressInfo,
+                                                       aAdditional));
+        ExitNow(response = Header::kResponseSuccess);
+    }
 
-    while ((host = GetNextSrpHost(host)) != nullptr)
+    // Handle PTR/SRV/TXT query
+    while ((service = GetNextSrpService(aName, qtype, service)) != nullptr)
     {
-        bool        needAdditionalAaaaRecord = false;
-        const char *hostName                 = host->GetFullName();
+        uint32_t    instanceTtl  = TimeMilli::MsecToSec(service->GetExpireTime() - now);
+        const char *instanceName = service->GetInstanceName();
+        const char *hostName     = service->GetHost().GetFullName();
 
-        // Handle PTR/SRV/TXT query
-        if (qtype == ResourceRecord::kTypePtr || qtype == ResourceRecord::kTypeSrv || qtype == ResourceRecord::kTypeTxt)
+        if (!aAdditional && qtype == ResourceRecord::kTypePtr)
         {
-            const Srp::Server::Service *service = nullptr;
-
-            while ((service = GetNextSrpService(*host, service)) != nullptr)
-            {
-                uint32_t    instanceTtl         = TimeMilli::MsecToSec(service->GetExpireTime() - TimerMilli::GetNow());
-                const char *instanceName        = service->GetInstanceName();
-                bool        serviceNameMatched  = service->MatchesServiceName(aName);
-                bool        instanceNameMatched = service->MatchesInstanceName(aName);
-                bool        ptrQueryMatched     = qtype == ResourceRecord::kTypePtr && serviceNameMatched;
-                bool        srvQueryMatched     = qtype == ResourceRecord::kTypeSrv && instanceNameMatched;
-                bool        txtQueryMatched     = qtype == ResourceRecord::kTypeTxt && instanceNameMatched;
-
-                if (ptrQueryMatched || srvQueryMatched)
-                {
-                    needAdditionalAaaaRecord = true;
-                }
-
-                if (!aAdditional && ptrQueryMatched)
-                {
-                    SuccessOrExit(
-                        error = AppendPtrRecord(aResponseMessage, aName, instanceName, instanceTtl, aCompressInfo));
-                    IncResourceRecordCount(aResponseHeader, aAdditional);
-                    response = Header::kResponseSuccess;
-                }
-
-                if ((!aAdditional && srvQueryMatched) ||
-                    (aAdditional && ptrQueryMatched &&
-                     !HasQuestion(aResponseHeader, aResponseMessage, instanceName, ResourceRecord::kTypeSrv)))
-                {
-                    SuccessOrExit(error = AppendSrvRecord(aResponseMessage, instanceName, hostName, instanceTtl,
-                                                          service->GetPriority(), service->GetWeight(),
-                                                          service->GetPort(), aCompressInfo));
-                    IncResourceRecordCount(aResponseHeader, aAdditional);
-                    response = Header::kResponseSuccess;
-                }
-
-                if ((!aAdditional && txtQueryMatched) ||
-                    (aAdditional && ptrQueryMatched &&
-                     !HasQuestion(aResponseHeader, aResponseMessage, instanceName, ResourceRecord::kTypeTxt)))
-                {
-                    SuccessOrExit(error = AppendTxtRecord(aResponseMessage, instanceName, service->GetTxtData(),
-                                                          service->GetTxtDataLength(), instanceTtl, aCompressInfo));
-                    IncResourceRecordCount(aResponseHeader, aAdditional);
-                    response = Header::kResponseSuccess;
-                }
-            }
+            SuccessOrExit(error = AppendPtrRecord(aResponseMessage, aName, instanceName, instanceTtl, aCompressInfo));
+            IncResourceRecordCount(aResponseHeader, aAdditional);
+            response = Header::kResponseSuccess;
         }
 
-        // Handle AAAA query
-        if ((!aAdditional && qtype == ResourceRecord::kTypeAaaa && host->Matches(aName)) ||
-            (aAdditional && needAdditionalAaaaRecord &&
-             !HasQuestion(aResponseHeader, aResponseMessage, hostName, ResourceRecord::kTypeAaaa)))
+        if ((!aAdditional && qtype == ResourceRecord::kTypeSrv) ||
+            (aAdditional && qtype == ResourceRecord::kTypePtr &&
+             !HasQuestion(aResponseHeader, aResponseMessage, instanceName, ResourceRecord::kTypeSrv)))
         {
-            uint8_t             addrNum;
-            const Ip6::Address *addrs   = host->GetAddresses(addrNum);
-            uint32_t            hostTtl = TimeMilli::MsecToSec(host->GetExpireTime() - now);
+            SuccessOrExit(error = AppendSrvRecord(aResponseMessage, instanceName, hostName, instanceTtl,
+                                                  service->GetPriority(), service->GetWeight(), service->GetPort(),
+                                                  aCompressInfo));
+            IncResourceRecordCount(aResponseHeader, aAdditional);
+            response = Header::kResponseSuccess;
+        }
 
-            for (uint8_t i = 0; i < addrNum; i++)
-            {
-                SuccessOrExit(error = AppendAaaaRecord(aResponseMessage, hostName, addrs[i], hostTtl, aCompressInfo));
-                IncResourceRecordCount(aResponseHeader, aAdditional);
-            }
+        if ((!aAdditional && qtype == ResourceRecord::kTypeTxt) ||
+            (aAdditional && qtype == ResourceRecord::kTypePtr &&
+             !HasQuestion(aResponseHeader, aResponseMessage, instanceName, ResourceRecord::kTypeTxt)))
+        {
+            SuccessOrExit(error = AppendTxtRecord(aResponseMessage, instanceName, service->GetTxtData(),
+                                                  service->GetTxtDataLength(), instanceTtl, aCompressInfo));
+            IncResourceRecordCount(aResponseHeader, aAdditional);
+            response = Header::kResponseSuccess;
+        }
 
+        // Add the host addresses for PTR and SRV queries, once per host.
+        if (aAdditional && qtype != ResourceRecord::kTypeTxt &&
+            MarkSrpHostInResponse(aName, qtype, *service, aAddedHosts) &&
+            !HasQuestion(aResponseHeader, aResponseMessage, hostName, ResourceRecord::kTypeAaaa))
+        {
+            SuccessOrExit(error = AppendSrpHostAaaaRecords(service->GetHost(), aResponseHeader, aResponseMessage,
+                                                           aCompressInfo, aAdditional));
             response = Header::kResponseSuccess;
         }
     }
@@ -839,22 +825,106 @@ exit:
     return error == kErrorNone ? response : Header::kResponseServerFailure;
 }
 
-const Srp::Server::Host *Server::GetNextSrpHost(const Srp::Server::Host *aHost)
+Error Server::AppendSrpHostAaaaRecords(const Srp::Server::Host &aHost,
+                                       Header                  &aResponseHeader,
+                                       Message                 &aResponseMessage,
+                                       NameCompressInfo        &aCompressInfo,
+                                       bool                     aAdditional)
 {
-    const Srp::Server::Host *host = Get<Srp::Server>().GetNextHost(aHost);
+    Error               error = kErrorNone;
+    uint8_t             addrNum;
+    const Ip6::Address *addrs   = aHost.GetAddresses(addrNum);
+    uint32_t            hostTtl = TimeMilli::MsecToSec(aHost.GetExpireTime() - TimerMilli::GetNow());
 
-    while (host != nullptr && host->IsDeleted())
+    for (uint8_t i = 0; i < addrNum; i++)
     {
-        host = Get<Srp::Server>().GetNextHost(host);
+        SuccessOrExit(error =
+                          AppendAaaaRecord(aResponseMessage, aHost.GetFullName(), addrs[i], hostTtl, aCompressInfo));
+        IncResourceRecordCount(aResponseHeader, aAdditional);
     }
 
-    return host;
+exit:
+    return error;
 }
 
-const Srp::Server::Service *Server::GetNextSrpService(const Srp::Server::Host    &aHost,
-                                                      const Srp::Server::Service *aService)
+const Srp::Server::Service *Server::GetNextSrpService(const char                 *aName,
+                                                      uint16_t                    aQueryType,
+                                                      const Srp::Server::Service *aPrevService)
 {
-    return aHost.FindNextService(aService, Srp::Server::kFlagsAnyTypeActiveService);
+    // PTR queries are matched against the service name and SRV/TXT
+    // queries against the service instance name, using the indexes
+    // maintained by the SRP server. Services of deleted hosts are
+    // skipped.
+
+    const Srp::Server::Service *service = aPrevService;
+
+    do
+    {
+        switch (aQueryType)
+        {
+        case ResourceRecord::kTypePtr:
+            service = Get<Srp::Server>().FindNextServiceByServiceName(service, Srp::Server::kFlagsAnyTypeActiveService,
+                                                                      aName);
+            break;
+
+        case ResourceRecord::kTypeSrv:
+        case ResourceRecord::kTypeTxt:
+            service = Get<Srp::Server>().FindNextServiceByInstanceName(service, Srp::Server::kFlagsAnyTypeActiveService,
+                                                                       aName);
+            break;
+
+        default:
+            service = nullptr;
+            break;
+        }
+    } while (service != nullptr && service->GetHost().IsDeleted());
+
+    return service;
+}
+
+bool Server::IsFirstSrpServiceOfHost(const char *aName, uint16_t aQueryType, const Srp::Server::Service &aService)
+{
+    bool                        isFirst = true;
+    const Srp::Server::Service *service = nullptr;
+
+    while ((service = GetNextSrpService(aName, aQueryType, service)) != &aService)
+    {
+        if (&service->GetHost() == &aService.GetHost())
+        {
+            ExitNow(isFirst = false);
+        }
+    }
+
+exit:
+    return isFirst;
+}
+
+bool Server::MarkSrpHostInResponse(const char                 *aName,
+                                   uint16_t                    aQueryType,
+                                   const Srp::Server::Service &aService,
+                                   SrpHostList                &aAddedHosts)
+{
+    // Returns `true` the first time it is called for the host of
+    // `aService` while resolving a response, and `false` afterwards.
+    // If `aAddedHosts` is full, we fall back to checking whether
+    // `aService` is the first service of its host matching `aName`.
+
+    bool isFirst;
+
+    if (aAddedHosts.Contains(&aService.GetHost()))
+    {
+        ExitNow(isFirst = false);
+    }
+
+    if (aAddedHosts.PushBack(&aService.GetHost()) == kErrorNone)
+    {
+        ExitNow(isFirst = true);
+    }
+
+    isFirst = IsFirstSrpServiceOfHost(aName, aQueryType, aService);
+
+exit:
+    return isFirst;
 }
 #endif // OPENTHREAD_CONFIG_SRP_SERVER_ENABLE
 
@@ -1236,14 +1306,17 @@ bool Server::HasQuestion(const Header &aHeader, const Message &aMessage, const c
 
     for (uint16_t i = 0, readOffset = sizeof(Header); i < aHeader.GetQuestionCount(); i++)
     {
+        uint16_t nameOffset = readOffset;
         Question question;
-        Error    error;
 
-        error = Name::CompareName(aMessage, readOffset, aName);
-        IgnoreError(aMessage.Read(readOffset, question));
+        // Check the question type first so that the name is only
+        // compared for questions of the same type.
+
+        SuccessOrExit(Name::ParseName(aMessage, readOffset));
+        SuccessOrExit(aMessage.Read(readOffset, question));
         readOffset += sizeof(question);
 
-        if (error == kErrorNone && aQuestionType == question.GetType())
+        if (aQuestionType == question.GetType() && Name::CompareName(aMessage, nameOffset, aName) == kErrorNone)
         {
             ExitNow(found = true);
         }
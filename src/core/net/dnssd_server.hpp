@@ -35,6 +35,7 @@
 
 #include <openthread/dnssd_server.h>
 
+#include "common/array.hpp"
 #include "common/as_core_type.hpp"
 #include "common/message.hpp"
 #include "common/non_copyable.hpp"
@@ -369,6 +370,15 @@ private:
     static constexpr uint8_t  kSubTypeLabelLength           = 4;
     static constexpr uint16_t kMaxConcurrentQueries         = 32;
     static constexpr uint16_t kMaxConcurrentUpstreamQueries = 32;
+#if OPENTHREAD_CONFIG_SRP_SERVER_ENABLE
+    static constexpr uint16_t kMaxSrpHostsInResponse = 16;
+
+    // SRP hosts whose addresses are added to a response as additional
+    // records, so that each host's addresses are added only once. A
+    // response is limited to one IPv6 datagram, which in practice holds
+    // fewer hosts than this; beyond it the older scan is used.
+    typedef Array<const Srp::Server::Host *, kMaxSrpHostsInResponse> SrpHostList;
+#endif
 
     // This structure represents the splitting information of a full name.
     struct NameComponentsOffsetInfo
@@ -493,10 +503,23 @@ private:
                                                             Header           &aResponseHeader,
                                                             Message          &aResponseMessage,
                                                             NameCompressInfo &aCompressInfo,
-                                                            bool              aAdditional);
-    const Srp::Server::Host           *GetNextSrpHost(const Srp::Server::Host *aHost);
-    static const Srp::Server::Service *GetNextSrpService(const Srp::Server::Host    &aHost,
-                                                         const Srp::Server::Service *aService);
+                                                            bool              aAdditional,
+                                                            SrpHostList      &aAddedHosts);
+    Error                              AppendSrpHostAaaaRecords(const Srp::Server::Host &aHost,
+                                                                Header                  &aResponseHeader,
+                                                                Message                 &aResponseMessage,
+                                                                NameCompressInfo        &aCompressInfo,
+                                                                bool                     aAdditional);
+    const Srp::Server::Service        *GetNextSrpService(const char                 *aName,
+                                                         uint16_t                    aQueryType,
+                                                         const Srp::Server::Service *aPrevService);
+    bool                               IsFirstSrpServiceOfHost(const char                 *aName,
+                                                               uint16_t                    aQueryType,
+                                                               const Srp::Server::Service &aService);
+    bool                               MarkSrpHostInResponse(const char                 *aName,
+                                                             uint16_t                    aQueryType,
+                                                             const Srp::Server::Service &aService,
+                                                             SrpHostList                &aAddedHosts);
 #endif
 
 #if OPENTHREAD_CONFIG_DNS_UPSTREAM_QUERY_ENABLE
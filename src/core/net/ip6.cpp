@@ -252,7 +252,7 @@ Error Ip6::InsertMplOption(Message &aMessage, Header &aHeader)
             // Increment hop-by-hop option header length by one which
             // increases its total size by 8 bytes.
             hbh.SetLength(hbh.GetLength() + 1);
-            aMessage.Write(0, hbh);
+            SuccessOrExit(error = aMessage.Write(0, hbh));
 
             // Make space for MPL Option + padding (8 bytes) at the end
             // of hop-by-hop header
@@ -260,12 +260,13 @@ Error Ip6::InsertMplOption(Message &aMessage, Header &aHeader)
 
             // Insert MPL Option
             mMpl.InitOption(mplOption, aHeader.GetSource());
-            aMessage.WriteBytes(hbhSize, &mplOption, mplOption.GetSize());
+            SuccessOrExit(error = aMessage.WriteBytes(hbhSize, &mplOption, mplOption.GetSize()));
 
             // Insert Pad Option (if needed)
             if (padOption.InitToPadHeaderWithSize(mplOption.GetSize()) == kErrorNone)
             {
-                aMessage.WriteBytes(hbhSize + mplOption.GetSize(), &padOption, padOption.GetSize());
+                SuccessOrExit(
+                    error = aMessage.WriteBytes(hbhSize + mplOption.GetSize(), &padOption, padOption.GetSize()));
             }
 
             // Update IPv6 Payload Length
@@ -373,7 +374,8 @@ Error Ip6::RemoveMplOption(Message &aMessage)
     {
         // Last IPv6 Option, shrink HBH Option header by
         // 8 bytes (`kLengthUnitSize`)
-        aMessage.RemoveHeader(endOffset - ExtensionHeader::kLengthUnitSize, ExtensionHeader::kLengthUnitSize);
+        SuccessOrExit(error = aMessage.RemoveHeader(endOffset - ExtensionHeader::kLengthUnitSize,
+                                                    ExtensionHeader::kLengthUnitSize));
 
         if (mplOffset == sizeof(ip6Header) + sizeof(hbh))
         {
@@ -386,11 +388,11 @@ Error Ip6::RemoveMplOption(Message &aMessage)
             // which decreases its total size by 8 bytes.
 
             hbh.SetLength(hbh.GetLength() - 1);
-            aMessage.Write(sizeof(ip6Header), hbh);
+            SuccessOrExit(error = aMessage.Write(sizeof(ip6Header), hbh));
         }
 
         ip6Header.SetPayloadLength(ip6Header.GetPayloadLength() - ExtensionHeader::kLengthUnitSize);
-        aMessage.Write(0, ip6Header);
+        SuccessOrExit(error = aMessage.Write(0, ip6Header));
     }
     else if (mplOffset != 0)
     {
@@ -398,7 +400,7 @@ Error Ip6::RemoveMplOption(Message &aMessage)
         PadOption padOption;
 
         padOption.InitForPadSize(sizeof(Option) + mplLength);
-        aMessage.WriteBytes(mplOffset, &padOption, padOption.GetSize());
+        SuccessOrExit(error = aMessage.WriteBytes(mplOffset, &padOption, padOption.GetSize()));
     }
 
 exit:
@@ -465,7 +467,8 @@ Error Ip6::SendDatagram(Message &aMessage, MessageInfo &aMessageInfo, uint8_t aI
 
     SuccessOrExit(error = aMessage.Prepend(header));
 
-    Checksum::UpdateMessageChecksum(aMessage, header.GetSource(), header.GetDestination(), aIpProto);
+    SuccessOrExit(error = Checksum::UpdateMessageChecksum(aMessage, header.GetSource(), header.GetDestination(),
+                                                          aIpProto));
 
     if (aMessageInfo.GetPeerAddr().IsMulticastLargerThanRealmLocal())
     {
@@ -603,15 +606,15 @@ Error Ip6::FragmentDatagram(Message &aMessage, uint8_t aIpProto)
         SuccessOrExit(error = fragment->SetLength(aMessage.GetOffset() + sizeof(fragmentHeader) + payloadFragment));
 
         header.SetPayloadLength(payloadFragment + sizeof(fragmentHeader));
-        fragment->Write(0, header);
+        SuccessOrExit(error = fragment->Write(0, header));
 
         fragment->SetOffset(aMessage.GetOffset());
-        fragment->Write(aMessage.GetOffset(), fragmentHeader);
+        SuccessOrExit(error = fragment->Write(aMessage.GetOffset(), fragmentHeader));
 
-        fragment->WriteBytesFromMessage(
-            /* aWriteOffset */ aMessage.GetOffset() + sizeof(fragmentHeader), aMessage,
-            /* aReadOffset */ aMessage.GetOffset() + FragmentHeader::FragmentOffsetToBytes(offset),
-            /* aLength */ payloadFragment);
+        SuccessOrExit(error = fragment->WriteBytesFromMessage(
+                          /* aWriteOffset */ aMessage.GetOffset() + sizeof(fragmentHeader), aMessage,
+                          /* aReadOffset */ aMessage.GetOffset() + FragmentHeader::FragmentOffsetToBytes(offset),
+                          /* aLength */ payloadFragment));
 
         EnqueueDatagram(*fragment);
 
@@ -636,13 +639,15 @@ exit:
 
 Error Ip6::HandleFragment(Message &aMessage, MessageOrigin aOrigin, MessageInfo &aMessageInfo)
 {
-    Error          error = kErrorNone;
-    Header         header, headerBuffer;
-    FragmentHeader fragmentHeader;
-    Message       *message         = nullptr;
-    uint16_t       offset          = 0;
-    uint16_t       payloadFragment = 0;
-    bool           isFragmented    = true;
+    Error                           error = kErrorNone;
+    Header                          header;
+    FragmentHeader                  fragmentHeader;
+    ReassemblyKey                   key;
+    FragmentReassemblyTable::Entry *entry           = nullptr;
+    Message                        *message         = nullptr;
+    uint16_t                        offset          = 0;
+    uint16_t                        payloadFragment = 0;
+    bool                            isFragmented    = true;
 
     SuccessOrExit(error = aMessage.Read(0, header));
     SuccessOrExit(error = aMessage.Read(aMessage.GetOffset(), fragmentHeader));
@@ -654,16 +659,15 @@ Error Ip6::HandleFragment(Message &aMessage, MessageOrigin aOrigin, MessageInfo
         ExitNow();
     }
 
-    for (Message &msg : mReassemblyList)
-    {
-        SuccessOrExit(error = msg.Read(0, headerBuffer));
+    key.mSource         = header.GetSource();
+    key.mDestination    = header.GetDestination();
+    key.mIdentification = fragmentHeader.GetIdentification();
 
-        if (msg.GetDatagramTag() == fragmentHeader.GetIdentification() &&
-            headerBuffer.GetSource() == header.GetSource() && headerBuffer.GetDestination() == header.GetDestination())
-        {
-            message = &msg;
-            break;
-        }
+    entry = mReassemblyTable.Find(key);
+
+    if (entry != nullptr)
+    {
+        message = &entry->GetMessage();
     }
 
     offset          = FragmentHeader::FragmentOffsetToBytes(fragmentHeader.GetOffset());
@@ -678,10 +682,26 @@ Error Ip6::HandleFragment(Message &aMessage, MessageOrigin aOrigin, MessageInfo
         ExitNow(error = kErrorNoBufs);
     }
 
+    // All fragments except the last one must be a multiple of 8 bytes.
+    VerifyOrExit(!fragmentHeader.IsMoreFlagSet() || (payloadFragment % FragmentReassemblyTable::kBlockSize == 0),
+                 error = kErrorParse);
+
     if (message == nullptr)
     {
         LogDebg("start reassembly");
         VerifyOrExit((message = NewMessage()) != nullptr, error = kErrorNoBufs);
+
+        // If the reassembly table is full, drop the oldest datagram
+        // (at the head of the reassembly list).
+
+        if (mReassemblyTable.IsFull())
+        {
+            LogNote("Too many datagrams being reassembled, dropping oldest");
+            DropReassemblyMessage(*mReassemblyList.GetHead());
+        }
+
+        entry = mReassemblyTable.Add(key, *message);
+        OT_ASSERT(entry != nullptr);
         mReassemblyList.Enqueue(*message);
 
         message->SetTimestampToNow();
@@ -694,31 +714,56 @@ Error Ip6::HandleFragment(Message &aMessage, MessageOrigin aOrigin, MessageInfo
         Get<TimeTicker>().RegisterReceiver(TimeTicker::kIp6FragmentReassembler);
     }
 
+    // Fragments may be received out of order. A duplicate fragment
+    // is dropped, while a fragment overlapping part of a received
+    // one invalidates the whole datagram (RFC 5722).
+
+    error = entry->MarkReceived(offset, payloadFragment);
+    VerifyOrExit(error != kErrorDuplicated, error = kErrorDrop);
+    SuccessOrExit(error);
+
     // increase message buffer if necessary
     if (message->GetLength() < offset + payloadFragment + aMessage.GetOffset())
     {
         SuccessOrExit(error = message->SetLength(offset + payloadFragment + aMessage.GetOffset()));
     }
 
+    // the last fragment gives the length of the whole datagram, a
+    // second last fragment with a different length invalidates it
+    if (!fragmentHeader.IsMoreFlagSet())
+    {
+        SuccessOrExit(error = entry->SetDatagramLength(offset + payloadFragment));
+    }
+
     // copy the fragment payload into the message buffer
-    message->WriteBytesFromMessage(
-        /* aWriteOffset */ aMessage.GetOffset() + offset, aMessage,
-        /* aReadOffset */ aMessage.GetOffset() + sizeof(fragmentHeader), /* aLength */ payloadFragment);
+    SuccessOrExit(error = message->WriteBytesFromMessage(
+                      /* aWriteOffset */ aMessage.GetOffset() + offset, aMessage,
+                      /* aReadOffset */ aMessage.GetOffset() + sizeof(fragmentHeader), /* aLength */ payloadFragment));
 
-    // check if it is the last frame
-    if (!fragmentHeader.IsMoreFlagSet())
+    // the next header of the reassembled datagram is taken from the
+    // first fragment (RFC 8200 section 4.5)
+    if (offset == 0)
+    {
+        Header firstHeader;
+
+        SuccessOrExit(error = message->Read(0, firstHeader));
+        firstHeader.SetNextHeader(fragmentHeader.GetNextHeader());
+        SuccessOrExit(error = message->Write(0, firstHeader));
+    }
+
+    if (entry->IsComplete())
     {
         // use the offset value for the whole ip message length
-        message->SetOffset(aMessage.GetOffset() + offset + payloadFragment);
+        message->SetOffset(message->GetLength());
 
         // creates the header for the reassembled ipv6 package
-        SuccessOrExit(error = aMessage.Read(0, header));
+        SuccessOrExit(error = message->Read(0, header));
         header.SetPayloadLength(message->GetLength() - sizeof(header));
-        header.SetNextHeader(fragmentHeader.GetNextHeader());
-        message->Write(0, header);
+        SuccessOrExit(error = message->Write(0, header));
 
         LogDebg("Reassembly complete.");
 
+        mReassemblyTable.Remove(*entry);
         mReassemblyList.Dequeue(*message);
 
         IgnoreError(HandleDatagram(*message, aOrigin, aMessageInfo.mLinkInfo, /* aIsReassembled */ true));
@@ -729,7 +774,15 @@ exit:
     {
         if (message != nullptr)
         {
-            mReassemblyList.DequeueAndFree(*message);
+            if (entry != nullptr)
+            {
+                mReassemblyTable.Remove(*entry);
+                mReassemblyList.DequeueAndFree(*message);
+            }
+            else
+            {
+                message->Free();
+            }
         }
 
         LogWarn("Reassembly failed: %s", ErrorToString(error));
@@ -744,7 +797,11 @@ exit:
     return error;
 }
 
-void Ip6::CleanupFragmentationBuffer(void) { mReassemblyList.DequeueAndFreeAll(); }
+void Ip6::CleanupFragmentationBuffer(void)
+{
+    mReassemblyList.DequeueAndFreeAll();
+    mReassemblyTable.Clear();
+}
 
 void Ip6::HandleTimeTick(void)
 {
@@ -760,18 +817,46 @@ void Ip6::UpdateReassemblyList(void)
 {
     TimeMilli now = TimerMilli::GetNow();
 
+    // The reassembly list is ordered by the time reassembly started,
+    // so stop at the first message which has not timed out.
+
     for (Message &message : mReassemblyList)
     {
-        if (now - message.GetTimestamp() >= TimeMilli::SecToMsec(kIp6ReassemblyTimeout))
+        if (now - message.GetTimestamp() < TimeMilli::SecToMsec(kIp6ReassemblyTimeout))
         {
-            LogNote("Reassembly timeout.");
-            SendIcmpError(message, Icmp::Header::kTypeTimeExceeded, Icmp::Header::kCodeFragmReasTimeEx);
-
-            mReassemblyList.DequeueAndFree(message);
+            break;
         }
+
+        LogNote("Reassembly timeout.");
+        SendIcmpError(message, Icmp::Header::kTypeTimeExceeded, Icmp::Header::kCodeFragmReasTimeEx);
+
+        DropReassemblyMessage(message);
     }
 }
 
+void Ip6::DropReassemblyMessage(Message &aMessage)
+{
+    mReassemblyTable.Remove(aMessage);
+    mReassemblyList.DequeueAndFree(aMessage);
+}
+
+uint32_t Ip6::ReassemblyKey::GetHash(void) const
+{
+    uint8_t bytes[2 * sizeof(Address) + sizeof(uint32_t)];
+
+    memcpy(bytes, &mSource, sizeof(Address));
+    memcpy(&bytes[sizeof(Address)], &mDestination, sizeof(Address));
+    Encoding::BigEndian::WriteUint32(mIdentification, &bytes[2 * sizeof(Address)]);
+
+    return HashIndex<kNumReassemblyEntries>::CalculateHash(bytes, sizeof(bytes));
+}
+
+bool Ip6::ReassemblyKey::operator==(const ReassemblyKey &aOther) const
+{
+    return (mIdentification == aOther.mIdentification) && (mSource == aOther.mSource) &&
+           (mDestination == aOther.mDestination);
+}
+
 void Ip6::SendIcmpError(Message &aMessage, Icmp::Header::Type aIcmpType, Icmp::Header::Code aIcmpCode)
 {
     Error       error = kErrorNone;
@@ -1248,7 +1333,7 @@ start:
         VerifyOrExit(header.GetHopLimit() > 0, error = kErrorDrop);
 
         hopLimit = header.GetHopLimit();
-        aMessage.Write(Header::kHopLimitFieldOffset, hopLimit);
+        SuccessOrExit(error = aMessage.Write(Header::kHopLimitFieldOffset, hopLimit));
 
         if (nextHeader == kProtoIcmp6)
         {
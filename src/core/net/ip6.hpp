@@ -57,6 +57,7 @@
 #include "net/ip6_mpl.hpp"
 #include "net/ip6_types.hpp"
 #include "net/netif.hpp"
+#include "net/reassembly_table.hpp"
 #include "net/socket.hpp"
 #include "net/tcp6.hpp"
 #include "net/udp6.hpp"
@@ -381,6 +382,23 @@ private:
 
     static constexpr uint16_t kMinimalMtu = 1280;
 
+#if OPENTHREAD_CONFIG_IP6_FRAGMENTATION_ENABLE
+    static constexpr uint16_t kNumReassemblyEntries = OPENTHREAD_CONFIG_IP6_REASSEMBLY_MAX_DATAGRAMS;
+
+    // Identifies a datagram being reassembled from IPv6 fragments.
+    struct ReassemblyKey
+    {
+        uint32_t GetHash(void) const;
+        bool     operator==(const ReassemblyKey &aOther) const;
+
+        Address  mSource;
+        Address  mDestination;
+        uint32_t mIdentification;
+    };
+
+    typedef ReassemblyTable<ReassemblyKey, kNumReassemblyEntries, kMaxAssembledDatagramLength> FragmentReassemblyTable;
+#endif
+
     void HandleSendQueue(void);
 
     static uint8_t PriorityToDscp(Message::Priority aPriority);
@@ -404,6 +422,7 @@ private:
     void CleanupFragmentationBuffer(void);
     void HandleTimeTick(void);
     void UpdateReassemblyList(void);
+    void DropReassemblyMessage(Message &aMessage);
     void SendIcmpError(Message &aMessage, Icmp::Header::Type aIcmpType, Icmp::Header::Code aIcmpCode);
 #endif
     Error AddMplOption(Message &aMessage, Header &aHeader);
@@ -444,7 +463,8 @@ private:
 #endif
 
 #if OPENTHREAD_CONFIG_IP6_FRAGMENTATION_ENABLE
-    MessageQueue mReassemblyList;
+    MessageQueue            mReassemblyList;
+    FragmentReassemblyTable mReassemblyTable;
 #endif
 
 #if OPENTHREAD_CONFIG_IP6_BR_COUNTERS_ENABLE
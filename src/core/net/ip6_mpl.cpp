@@ -355,7 +355,7 @@ void Mpl::AddBufferedMessage(Message &aMessage, uint16_t aSeedId, uint8_t aSeque
     {
         IgnoreError(aMessage.Read(Header::kHopLimitFieldOffset, hopLimit));
         VerifyOrExit(hopLimit-- > 1, error = kErrorDrop);
-        messageCopy->Write(Header::kHopLimitFieldOffset, hopLimit);
+        SuccessOrExit(error = messageCopy->Write(Header::kHopLimitFieldOffset, hopLimit));
     }
 
     metadata.mSeedId            = aSeedId;
@@ -396,7 +396,22 @@ void Mpl::HandleRetransmissionTimer(void)
 
             if (metadata.mTransmissionCount < timerExpirations)
             {
-                Message *messageCopy = message.Clone(message.GetLength() - sizeof(Metadata));
+                Message *messageCopy;
+
+                // Update the metadata before cloning the message, so
+                // that the buffers the copy may share with `message`
+                // are not written while the copy is being sent.
+
+                metadata.GenerateNextTransmissionTime(now, kDataMessageInterval);
+
+                if (metadata.UpdateIn(message) != kErrorNone)
+                {
+                    mBufferedMessageSet.Dequeue(message);
+                    message.Free();
+                    continue;
+                }
+
+                messageCopy = message.Clone(message.GetLength() - sizeof(Metadata));
 
                 if (messageCopy != nullptr)
                 {
@@ -408,9 +423,6 @@ void Mpl::HandleRetransmissionTimer(void)
                     Get<Ip6>().EnqueueDatagram(*messageCopy);
                 }
 
-                metadata.GenerateNextTransmissionTime(now, kDataMessageInterval);
-                metadata.UpdateIn(message);
-
                 nextTime = Min(nextTime, metadata.mTransmissionTime);
             }
             else
@@ -455,7 +467,10 @@ void Mpl::Metadata::RemoveFrom(Message &aMessage) const
     SuccessOrAssert(aMessage.SetLength(aMessage.GetLength() - sizeof(*this)));
 }
 
-void Mpl::Metadata::UpdateIn(Message &aMessage) const { aMessage.Write(aMessage.GetLength() - sizeof(*this), *this); }
+Error Mpl::Metadata::UpdateIn(Message &aMessage) const
+{
+    return aMessage.Write(aMessage.GetLength() - sizeof(*this), *this);
+}
 
 void Mpl::Metadata::GenerateNextTransmissionTime(TimeMilli aCurrentTime, uint8_t aInterval)
 {
@@ -177,8 +177,11 @@ Translator::Result Translator::TranslateFromIp6(Message &aMessage)
     // res here must be kForward based on the switch above.
     // TODO: Implement the logic for replying ICMP messages.
     ip4Header.SetTotalLength(sizeof(Ip4::Header) + aMessage.GetLength() - aMessage.GetOffset());
-    Checksum::UpdateMessageChecksum(aMessage, ip4Header.GetSource(), ip4Header.GetDestination(),
-                                    ip4Header.GetProtocol());
+    if (Checksum::UpdateMessageChecksum(aMessage, ip6Header, ip4Header) != kErrorNone)
+    {
+        LogWarn("failed to update checksum of translated message");
+        ExitNow(res = kDrop);
+    }
     Checksum::UpdateIp4HeaderChecksum(ip4Header);
     if (aMessage.Prepend(ip4Header) != kErrorNone)
     {
@@ -272,8 +275,11 @@ Translator::Result Translator::TranslateToIp6(Message &aMessage)
     // res here must be kForward based on the switch above.
     // TODO: Implement the logic for replying ICMP datagrams.
     ip6Header.SetPayloadLength(aMessage.GetLength() - aMessage.GetOffset());
-    Checksum::UpdateMessageChecksum(aMessage, ip6Header.GetSource(), ip6Header.GetDestination(),
-                                    ip6Header.GetNextHeader());
+    if (Checksum::UpdateMessageChecksum(aMessage, ip4Header, ip6Header) != kErrorNone)
+    {
+        LogWarn("failed to update checksum of translated message");
+        ExitNow(res = kDrop);
+    }
     if (aMessage.Prepend(ip6Header) != kErrorNone)
     {
         // This might happen when the platform failed to reserve enough space before the original IPv4 datagram.
@@ -323,6 +329,10 @@ void Translator::AddressMapping::CopyTo(otNat64AddressMapping &aMapping, TimeMil
 
 void Translator::ReleaseMapping(AddressMapping &aMapping)
 {
+    uint16_t index = mAddressMappingPool.GetIndexOf(aMapping);
+
+    mIp6Index.Remove(index);
+    mIp4Index.Remove(index);
     IgnoreError(mIp4AddressPool.PushBack(aMapping.mIp4));
     mAddressMappingPool.Free(aMapping);
     LogInfo("mapping removed: %s", aMapping.ToString().AsCString());
@@ -372,6 +382,8 @@ Translator::AddressMapping *Translator::AllocateMapping(const Ip6::Address &aIp6
     // PopBack must return a valid address since it is not empty.
     mapping->mIp4 = *mIp4AddressPool.PopBack();
     mapping->Touch(TimerMilli::GetNow());
+    mIp6Index.Add(mAddressMappingPool.GetIndexOf(*mapping), CalculateHash(mapping->mIp6));
+    mIp4Index.Add(mAddressMappingPool.GetIndexOf(*mapping), CalculateHash(mapping->mIp4));
     LogInfo("mapping created: %s", mapping->ToString().AsCString());
 
 exit:
@@ -380,7 +392,7 @@ exit:
 
 Translator::AddressMapping *Translator::FindOrAllocateMapping(const Ip6::Address &aIp6Addr)
 {
-    AddressMapping *mapping = mActiveAddressMappings.FindMatching(aIp6Addr);
+    AddressMapping *mapping = LookUpMapping(mIp6Index, aIp6Addr);
 
     // Exit if we found a valid mapping.
     VerifyOrExit(mapping == nullptr);
@@ -393,7 +405,7 @@ exit:
 
 Translator::AddressMapping *Translator::FindMapping(const Ip4::Address &aIp4Addr)
 {
-    AddressMapping *mapping = mActiveAddressMappings.FindMatching(aIp4Addr);
+    AddressMapping *mapping = LookUpMapping(mIp4Index, aIp4Addr);
 
     if (mapping != nullptr)
     {
@@ -402,6 +414,24 @@ Translator::AddressMapping *Translator::FindMapping(const Ip4::Address &aIp4Addr
     return mapping;
 }
 
+template <typename AddressType>
+Translator::AddressMapping *Translator::LookUpMapping(const MappingIndex &aIndex, const AddressType &aAddress)
+{
+    AddressMapping *mapping = nullptr;
+
+    for (uint16_t index = aIndex.GetFirst(CalculateHash(aAddress)); index != MappingIndex::kInvalidIndex;
+         index          = aIndex.GetNext(index))
+    {
+        if (mAddressMappingPool.GetEntryAt(index).Matches(aAddress))
+        {
+            mapping = &mAddressMappingPool.GetEntryAt(index);
+            break;
+        }
+    }
+
+    return mapping;
+}
+
 Error Translator::TranslateIcmp4(Message &aMessage)
 {
     Error             err = kErrorNone;
@@ -420,7 +450,11 @@ Error Translator::TranslateIcmp4(Message &aMessage)
         // ICMP6 header and set the message type.
         SuccessOrExit(err = aMessage.Read(0, icmp6Header));
         icmp6Header.SetType(Ip6::Icmp::Header::Type::kTypeEchoReply);
-        aMessage.Write(0, icmp6Header);
+        // Only the type (high byte of the first 16-bit word) changes, so the checksum is updated incrementally.
+        icmp6Header.SetChecksum(Checksum::UpdateChecksum(icmp6Header.GetChecksum(),
+                                                         static_cast<uint16_t>(icmp4Header.GetType() << 8),
+                                                         static_cast<uint16_t>(icmp6Header.GetType() << 8)));
+        SuccessOrExit(err = aMessage.Write(0, icmp6Header));
         break;
     }
     default:
@@ -450,7 +484,11 @@ Error Translator::TranslateIcmp6(Message &aMessage)
         // ICMP6 header and set the message type.
         SuccessOrExit(err = aMessage.Read(0, icmp4Header));
         icmp4Header.SetType(Ip4::Icmp::Header::Type::kTypeEchoRequest);
-        aMessage.Write(0, icmp4Header);
+        // Only the type (high byte of the first 16-bit word) changes, so the checksum is updated incrementally.
+        icmp4Header.SetChecksum(Checksum::UpdateChecksum(icmp4Header.GetChecksum(),
+                                                         static_cast<uint16_t>(icmp6Header.GetType() << 8),
+                                                         static_cast<uint16_t>(icmp4Header.GetType() << 8)));
+        SuccessOrExit(err = aMessage.Write(0, icmp4Header));
         break;
     }
     default:
@@ -494,6 +532,8 @@ Error Translator::SetIp4Cidr(const Ip4::Cidr &aCidr)
 
     mAddressMappingPool.FreeAll();
     mActiveAddressMappings.Clear();
+    mIp6Index.Clear();
+    mIp4Index.Clear();
     mIp4AddressPool.Clear();
 
     for (uint32_t i = 0; i < numberOfHosts; i++)
@@ -38,6 +38,7 @@
 #include "openthread-core-config.h"
 
 #include "common/array.hpp"
+#include "common/hash_index.hpp"
 #include "common/linked_list.hpp"
 #include "common/locator.hpp"
 #include "common/pool.hpp"
@@ -78,6 +79,7 @@ public:
     static constexpr uint32_t kAddressMappingIdleTimeoutMsec =
         OPENTHREAD_CONFIG_NAT64_IDLE_TIMEOUT_SECONDS * Time::kOneSecondInMsec;
     static constexpr uint32_t kAddressMappingPoolSize = OPENTHREAD_CONFIG_NAT64_MAX_MAPPINGS;
+    static constexpr uint16_t kMappingIndexBuckets    = OPENTHREAD_CONFIG_NAT64_MAPPING_INDEX_BUCKETS;
 
     typedef otNat64AddressMappingIterator AddressMappingIterator; ///< Address mapping Iterator.
 
@@ -359,6 +361,8 @@ private:
         ProtocolCounters mCounters;
 
     private:
+        friend class Translator;
+
         bool Matches(const Ip4::Address &aIp4) const { return mIp4 == aIp4; }
         bool Matches(const Ip6::Address &aIp6) const { return mIp6 == aIp6; }
         bool Matches(const TimeMilli aNow) const { return mExpiry < aNow; }
@@ -366,6 +370,8 @@ private:
         AddressMapping *mNext;
     };
 
+    typedef HashIndex<kAddressMappingPoolSize, kMappingIndexBuckets> MappingIndex;
+
     Error TranslateIcmp4(Message &aMessage);
     Error TranslateIcmp6(Message &aMessage);
 
@@ -376,6 +382,14 @@ private:
     AddressMapping *FindOrAllocateMapping(const Ip6::Address &aIp6Addr);
     AddressMapping *FindMapping(const Ip4::Address &aIp4Addr);
 
+    template <typename AddressType>
+    AddressMapping *LookUpMapping(const MappingIndex &aIndex, const AddressType &aAddress);
+
+    template <typename AddressType> static uint32_t CalculateHash(const AddressType &aAddress)
+    {
+        return MappingIndex::CalculateHash(aAddress.GetBytes(), sizeof(AddressType));
+    }
+
     void HandleMappingExpirerTimer(void);
 
     using MappingTimer = TimerMilliIn<Translator, &Translator::HandleMappingExpirerTimer>;
@@ -390,6 +404,8 @@ private:
     Array<Ip4::Address, kAddressMappingPoolSize>  mIp4AddressPool;
     Pool<AddressMapping, kAddressMappingPoolSize> mAddressMappingPool;
     LinkedList<AddressMapping>                    mActiveAddressMappings;
+    MappingIndex                                  mIp6Index;
+    MappingIndex                                  mIp4Index;
 
     Ip6::Prefix mNat64Prefix;
     Ip4::Cidr   mIp4Cidr;
@@ -33,6 +33,8 @@
 
 #include "netif.hpp"
 
+#include <string.h>
+
 #include "common/as_core_type.hpp"
 #include "common/debug.hpp"
 #include "common/instance.hpp"
@@ -58,40 +60,109 @@ namespace Ip6 {
 // "ff03::fc"
 const otNetifMulticastAddress Netif::kRealmLocalAllMplForwardersMulticastAddress = {
     {{{0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc}}},
+    nullptr,
     nullptr};
 
 // "ff03::01"
 const otNetifMulticastAddress Netif::kRealmLocalAllNodesMulticastAddress = {
     {{{0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01}}},
-    &Netif::kRealmLocalAllMplForwardersMulticastAddress};
+    &Netif::kRealmLocalAllMplForwardersMulticastAddress,
+    nullptr};
 
 // "ff02::01"
 const otNetifMulticastAddress Netif::kLinkLocalAllNodesMulticastAddress = {
     {{{0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01}}},
-    &Netif::kRealmLocalAllNodesMulticastAddress};
+    &Netif::kRealmLocalAllNodesMulticastAddress,
+    nullptr};
 
 // "ff03::02"
 const otNetifMulticastAddress Netif::kRealmLocalAllRoutersMulticastAddress = {
     {{{0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02}}},
-    &Netif::kLinkLocalAllNodesMulticastAddress};
+    &Netif::kLinkLocalAllNodesMulticastAddress,
+    nullptr};
 
 // "ff02::02"
 const otNetifMulticastAddress Netif::kLinkLocalAllRoutersMulticastAddress = {
     {{{0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02}}},
-    &Netif::kRealmLocalAllRoutersMulticastAddress};
+    &Netif::kRealmLocalAllRoutersMulticastAddress,
+    nullptr};
 
 //---------------------------------------------------------------------------------------------------------------------
 // Netif
 
 Netif::Netif(Instance &aInstance)
     : InstanceLocator(aInstance)
+    , mFixedMulticastAddresses(nullptr)
     , mMulticastPromiscuous(false)
 {
+    memset(mMulticastIndex, 0, sizeof(mMulticastIndex));
 }
 
 bool Netif::IsMulticastSubscribed(const Address &aAddress) const
 {
-    return mMulticastAddresses.ContainsMatching(aAddress);
+    bool                    subscribed = false;
+    const MulticastAddress *entry      = mMulticastIndex[GetMulticastIndexBucket(aAddress)];
+
+    for (; entry != nullptr; entry = entry->GetNextInIndex())
+    {
+        VerifyOrExit(entry->GetAddress() != aAddress, subscribed = true);
+    }
+
+    // The fixed multicast addresses are constant and so are not
+    // included in the index. They are checked separately from the
+    // portion of their chain currently appended to the list.
+
+    for (entry = mFixedMulticastAddresses; entry != nullptr; entry = entry->GetNext())
+    {
+        VerifyOrExit(entry->GetAddress() != aAddress, subscribed = true);
+    }
+
+exit:
+    return subscribed;
+}
+
+uint16_t Netif::GetMulticastIndexBucket(const Address &aAddress)
+{
+    uint32_t hash = aAddress.mFields.m32[0] ^ aAddress.mFields.m32[1];
+
+    hash ^= aAddress.mFields.m32[2] ^ aAddress.mFields.m32[3];
+    hash ^= (hash >> 16);
+    hash ^= (hash >> 8);
+
+    return static_cast<uint16_t>(hash % kNumMulticastIndexBuckets);
+}
+
+void Netif::AddToMulticastIndex(MulticastAddress &aAddress)
+{
+    MulticastAddress *&head = mMulticastIndex[GetMulticastIndexBucket(aAddress.GetAddress())];
+
+    aAddress.mNextInIndex = head;
+    head                  = &aAddress;
+}
+
+void Netif::RemoveFromMulticastIndex(const MulticastAddress &aAddress)
+{
+    MulticastAddress *&head = mMulticastIndex[GetMulticastIndexBucket(aAddress.GetAddress())];
+    MulticastAddress  *prev = nullptr;
+
+    for (MulticastAddress *entry = head; entry != nullptr; prev = entry, entry = entry->GetNextInIndex())
+    {
+        if (entry != &aAddress)
+        {
+            continue;
+        }
+
+        if (prev == nullptr)
+        {
+            head = entry->GetNextInIndex();
+        }
+        else
+        {
+            prev->mNextInIndex = entry->mNextInIndex;
+        }
+
+        break;
+    }
 }
 
 void Netif::SubscribeAllNodesMulticast(void)
@@ -117,6 +188,8 @@ void Netif::SubscribeAllNodesMulticast(void)
         tail->SetNext(&linkLocalAllNodesAddress);
     }
 
+    mFixedMulticastAddresses = &linkLocalAllNodesAddress;
+
     SignalMulticastAddressesChange(kAddressAdded, &linkLocalAllNodesAddress, nullptr);
 
 exit:
@@ -155,6 +228,8 @@ void Netif::UnsubscribeAllNodesMulticast(void)
         prev->SetNext(nullptr);
     }
 
+    mFixedMulticastAddresses = nullptr;
+
     SignalMulticastAddressesChange(kAddressRemoved, &linkLocalAllNodesAddress, nullptr);
 
 exit:
@@ -198,6 +273,8 @@ void Netif::SubscribeAllRoutersMulticast(void)
         prev->SetNext(&linkLocalAllRoutersAddress);
     }
 
+    mFixedMulticastAddresses = &linkLocalAllRoutersAddress;
+
     SignalMulticastAddressesChange(kAddressAdded, &linkLocalAllRoutersAddress, &linkLocalAllNodesAddress);
 
 exit:
@@ -231,6 +308,8 @@ void Netif::UnsubscribeAllRoutersMulticast(void)
         prev->SetNext(&linkLocalAllNodesAddress);
     }
 
+    mFixedMulticastAddresses = &linkLocalAllNodesAddress;
+
     SignalMulticastAddressesChange(kAddressRemoved, &linkLocalAllRoutersAddress, &linkLocalAllNodesAddress);
 
 exit:
@@ -279,6 +358,7 @@ bool Netif::IsMulticastAddressExternal(const MulticastAddress &aAddress) const
 void Netif::SubscribeMulticast(MulticastAddress &aAddress)
 {
     SuccessOrExit(mMulticastAddresses.Add(aAddress));
+    AddToMulticastIndex(aAddress);
     SignalMulticastAddressChange(kAddressAdded, aAddress, kOriginThread);
 
 exit:
@@ -288,6 +368,7 @@ exit:
 void Netif::UnsubscribeMulticast(const MulticastAddress &aAddress)
 {
     SuccessOrExit(mMulticastAddresses.Remove(aAddress));
+    RemoveFromMulticastIndex(aAddress);
     SignalMulticastAddressChange(kAddressRemoved, aAddress, kOriginThread);
 
 exit:
@@ -320,6 +401,7 @@ Error Netif::SubscribeExternalMulticast(const Address &aAddress)
     entry->mMlrState = kMlrStateToRegister;
 #endif
     mMulticastAddresses.Push(*entry);
+    AddToMulticastIndex(*entry);
 
     SignalMulticastAddressChange(kAddressAdded, *entry, kOriginManual);
 
@@ -339,6 +421,7 @@ Error Netif::UnsubscribeExternalMulticast(const Address &aAddress)
     VerifyOrExit(IsMulticastAddressExternal(*entry), error = kErrorRejected);
 
     mMulticastAddresses.PopAfter(prev);
+    RemoveFromMulticastIndex(*entry);
 
     SignalMulticastAddressChange(kAddressRemoved, *entry, kOriginManual);
 
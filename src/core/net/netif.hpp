@@ -227,6 +227,7 @@ public:
                              public LinkedListEntry<MulticastAddress>,
                              public Clearable<MulticastAddress>
     {
+        friend class Netif;
         friend class LinkedList<MulticastAddress>;
 
     public:
@@ -264,6 +265,12 @@ public:
 
     private:
         bool Matches(const Address &aAddress) const { return GetAddress() == aAddress; }
+
+        MulticastAddress *GetNextInIndex(void) { return static_cast<MulticastAddress *>(mNextInIndex); }
+        const MulticastAddress *GetNextInIndex(void) const
+        {
+            return static_cast<const MulticastAddress *>(mNextInIndex);
+        }
     };
 
     class ExternalMulticastAddress : public MulticastAddress
@@ -652,14 +659,25 @@ private:
 
     static constexpr uint8_t kMulticastPrefixLength = 128; // Multicast prefix length used in `AdressInfo`.
 
+    // Subscribed multicast addresses (other than the fixed ones) are
+    // also chained in a hash table keyed by address for faster lookup.
+    static constexpr uint16_t kNumMulticastIndexBuckets = OPENTHREAD_CONFIG_IP6_MULTICAST_INDEX_BUCKETS;
+
     void SignalUnicastAddressChange(AddressEvent aEvent, const UnicastAddress &aAddress);
     void SignalMulticastAddressChange(AddressEvent aEvent, const MulticastAddress &aAddress, AddressOrigin aOrigin);
     void SignalMulticastAddressesChange(AddressEvent            aEvent,
                                         const MulticastAddress *aStart,
                                         const MulticastAddress *aEnd);
 
+    static uint16_t GetMulticastIndexBucket(const Address &aAddress);
+
+    void AddToMulticastIndex(MulticastAddress &aAddress);
+    void RemoveFromMulticastIndex(const MulticastAddress &aAddress);
+
     LinkedList<UnicastAddress>   mUnicastAddresses;
     LinkedList<MulticastAddress> mMulticastAddresses;
+    MulticastAddress            *mMulticastIndex[kNumMulticastIndexBuckets];
+    const MulticastAddress      *mFixedMulticastAddresses;
     bool                         mMulticastPromiscuous;
 
     Callback<otIp6AddressCallback> mAddressCallback;
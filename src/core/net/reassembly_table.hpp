@@ -0,0 +1,357 @@
+/*
+ *  Copyright (c) 2023, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for tracking the datagrams being reassembled from fragments.
+ */
+
+#ifndef REASSEMBLY_TABLE_HPP_
+#define REASSEMBLY_TABLE_HPP_
+
+#include "openthread-core-config.h"
+
+#include <stdint.h>
+
+#include "common/clearable.hpp"
+#include "common/code_utils.hpp"
+#include "common/const_cast.hpp"
+#include "common/error.hpp"
+#include "common/hash_index.hpp"
+#include "common/message.hpp"
+#include "common/non_copyable.hpp"
+#include "common/num_utils.hpp"
+
+namespace ot {
+
+/**
+ * Represents a table of datagrams being reassembled from fragments.
+ *
+ * Each entry associates a datagram key (e.g., source, tag and size) with the message into which the datagram is
+ * reassembled, and tracks which 8-byte blocks of the datagram are received so that fragments can be received out of
+ * order and duplicate or overlapping fragments are detected. Entries are hash indexed by their key.
+ *
+ * The table does not own the messages. The caller is responsible for queuing and freeing them.
+ *
+ * `KeyType` MUST provide `uint32_t GetHash(void) const` and `bool operator==(const KeyType &) const`.
+ *
+ * @tparam KeyType             The datagram key type.
+ * @tparam kNumEntries         The maximum number of datagrams being reassembled at the same time.
+ * @tparam kMaxDatagramLength  The maximum length (in bytes) of a reassembled datagram.
+ *
+ */
+template <typename KeyType, uint16_t kNumEntries, uint16_t kMaxDatagramLength>
+class ReassemblyTable : private NonCopyable
+{
+    static_assert(kNumEntries > 0, "The max number of datagrams being reassembled MUST be at least one");
+
+public:
+    static constexpr uint16_t kBlockSize = 8; ///< Fragment offsets are in units of 8-byte blocks.
+
+    /**
+     * Represents a datagram being reassembled.
+     *
+     */
+    class Entry : public Clearable<Entry>
+    {
+        friend class ReassemblyTable;
+
+    public:
+        /**
+         * Returns the message into which the datagram is reassembled.
+         *
+         * @returns The message.
+         *
+         */
+        Message &GetMessage(void) const { return *mMessage; }
+
+        /**
+         * Returns the datagram key.
+         *
+         * @returns The datagram key.
+         *
+         */
+        const KeyType &GetKey(void) const { return mKey; }
+
+        /**
+         * Marks a fragment of the datagram as received.
+         *
+         * @param[in] aOffset  The offset of the fragment in the datagram (MUST be a multiple of `kBlockSize`).
+         * @param[in] aLength  The fragment length.
+         *
+         * @retval kErrorNone        Successfully marked the fragment as received.
+         * @retval kErrorDuplicated  The fragment was already received.
+         * @retval kErrorParse       The fragment is misaligned, too long, ends past the datagram length (if known), or
+         *                           overlaps part of a received fragment.
+         *
+         */
+        Error MarkReceived(uint16_t aOffset, uint16_t aLength)
+        {
+            Error    error = kErrorNone;
+            uint16_t start = aOffset / kBlockSize;
+            uint16_t end;
+            uint16_t numReceived = 0;
+
+            VerifyOrExit(aOffset % kBlockSize == 0, error = kErrorParse);
+            VerifyOrExit(aLength <= kMaxDatagramLength && aOffset <= kMaxDatagramLength - aLength,
+                         error = kErrorParse);
+            VerifyOrExit(mDatagramLength == 0 || aOffset + aLength <= mDatagramLength, error = kErrorParse);
+
+            end = start + BytesToBlocks(aLength);
+
+            for (uint16_t block = start; block < end; block++)
+            {
+                numReceived += IsBlockReceived(block) ? 1 : 0;
+            }
+
+            VerifyOrExit(numReceived == 0, error = (numReceived == end - start) ? kErrorDuplicated : kErrorParse);
+
+            for (uint16_t block = start; block < end; block++)
+            {
+                mReceivedBlocks[block / kBitsPerByte] |= (1U << (block % kBitsPerByte));
+            }
+
+            mNumReceivedBlocks += end - start;
+            mReceivedLength = Max<uint16_t>(mReceivedLength, aOffset + aLength);
+
+        exit:
+            return error;
+        }
+
+        /**
+         * Sets the total length of the datagram (once it is known).
+         *
+         * The length can be set only once. Setting it again to a different value, or to a value shorter than the end
+         * of a received fragment, fails and the datagram should be dropped (RFC 8200 section 4.5).
+         *
+         * @param[in] aLength  The datagram length.
+         *
+         * @retval kErrorNone   Successfully set the datagram length.
+         * @retval kErrorParse  The length conflicts with a previously set length or with a received fragment.
+         *
+         */
+        Error SetDatagramLength(uint16_t aLength)
+        {
+            Error error = kErrorNone;
+
+            VerifyOrExit(mDatagramLength == 0 || mDatagramLength == aLength, error = kErrorParse);
+            VerifyOrExit(mReceivedLength <= aLength, error = kErrorParse);
+            mDatagramLength = aLength;
+
+        exit:
+            return error;
+        }
+
+        /**
+         * Indicates whether all fragments of the datagram are received.
+         *
+         * @retval TRUE   The datagram length is known and all of its fragments are received.
+         * @retval FALSE  The datagram length is not known yet or some fragments are missing.
+         *
+         */
+        bool IsComplete(void) const
+        {
+            // No fragment ends past the datagram length, so counting
+            // the received blocks is enough to detect holes.
+            return (mDatagramLength != 0) && (mNumReceivedBlocks == BytesToBlocks(mDatagramLength));
+        }
+
+    private:
+        static constexpr uint8_t kBitsPerByte = 8;
+
+        static uint16_t BytesToBlocks(uint16_t aLength) { return (aLength + kBlockSize - 1) / kBlockSize; }
+
+        bool IsBlockReceived(uint16_t aBlock) const
+        {
+            return (mReceivedBlocks[aBlock / kBitsPerByte] & (1U << (aBlock % kBitsPerByte))) != 0;
+        }
+
+        Message *mMessage;
+        KeyType  mKey;
+        uint16_t mDatagramLength;
+        uint16_t mReceivedLength; // End of the furthest received fragment.
+        uint16_t mNumReceivedBlocks;
+        uint8_t  mReceivedBlocks[(kMaxDatagramLength / kBlockSize + kBitsPerByte) / kBitsPerByte];
+    };
+
+    /**
+     * Initializes the table as empty.
+     *
+     */
+    ReassemblyTable(void) { Clear(); }
+
+    /**
+     * Removes all entries from the table.
+     *
+     */
+    void Clear(void)
+    {
+        for (Entry &entry : mEntries)
+        {
+            entry.Clear();
+        }
+
+        mIndex.Clear();
+    }
+
+    /**
+     * Indicates whether the table is full.
+     *
+     * @retval TRUE   The table has no free entry.
+     * @retval FALSE  The table has at least one free entry.
+     *
+     */
+    bool IsFull(void) const { return FindFreeEntry() == nullptr; }
+
+    /**
+     * Finds the entry of a given datagram key.
+     *
+     * @param[in] aKey  The datagram key.
+     *
+     * @returns A pointer to the matching entry, or `nullptr` if none is found.
+     *
+     */
+    Entry *Find(const KeyType &aKey)
+    {
+        Entry *match = nullptr;
+
+        for (uint16_t index = mIndex.GetFirst(aKey.GetHash()); index != Index::kInvalidIndex;
+             index          = mIndex.GetNext(index))
+        {
+            if (mEntries[index].mKey == aKey)
+            {
+                match = &mEntries[index];
+                break;
+            }
+        }
+
+        return match;
+    }
+
+    /**
+     * Finds the entry of a given message.
+     *
+     * @param[in] aMessage  The message.
+     *
+     * @returns A pointer to the entry, or `nullptr` if none is found.
+     *
+     */
+    Entry *Find(const Message &aMessage)
+    {
+        Entry *match = nullptr;
+
+        for (Entry &entry : mEntries)
+        {
+            if (entry.mMessage == &aMessage)
+            {
+                match = &entry;
+                break;
+            }
+        }
+
+        return match;
+    }
+
+    /**
+     * Adds an entry for a new datagram.
+     *
+     * @param[in] aKey      The datagram key. MUST not match an existing entry.
+     * @param[in] aMessage  The message into which the datagram is reassembled.
+     *
+     * @returns A pointer to the new entry, or `nullptr` if the table is full.
+     *
+     */
+    Entry *Add(const KeyType &aKey, Message &aMessage)
+    {
+        Entry *entry = FindFreeEntry();
+
+        VerifyOrExit(entry != nullptr);
+
+        entry->Clear();
+        entry->mMessage = &aMessage;
+        entry->mKey     = aKey;
+        mIndex.Add(static_cast<uint16_t>(entry - mEntries), aKey.GetHash());
+
+    exit:
+        return entry;
+    }
+
+    /**
+     * Removes an entry from the table.
+     *
+     * @param[in] aEntry  The entry to remove.
+     *
+     */
+    void Remove(Entry &aEntry)
+    {
+        mIndex.Remove(static_cast<uint16_t>(&aEntry - mEntries));
+        aEntry.Clear();
+    }
+
+    /**
+     * Removes the entry of a given message from the table (if any).
+     *
+     * @param[in] aMessage  The message.
+     *
+     */
+    void Remove(const Message &aMessage)
+    {
+        Entry *entry = Find(aMessage);
+
+        if (entry != nullptr)
+        {
+            Remove(*entry);
+        }
+    }
+
+private:
+    typedef HashIndex<kNumEntries> Index;
+
+    Entry *FindFreeEntry(void) const
+    {
+        const Entry *freeEntry = nullptr;
+
+        for (const Entry &entry : mEntries)
+        {
+            if (entry.mMessage == nullptr)
+            {
+                freeEntry = &entry;
+                break;
+            }
+        }
+
+        return AsNonConst(freeEntry);
+    }
+
+    Entry mEntries[kNumEntries];
+    Index mIndex;
+};
+
+} // namespace ot
+
+#endif // REASSEMBLY_TABLE_HPP_
@@ -248,7 +248,12 @@ void Client::HandleRetransmissionTimer(void)
             // Increment retransmission counter and timer.
             queryMetadata.mRetransmissionCount++;
             queryMetadata.mTransmissionTime = now + kResponseTimeout;
-            queryMetadata.UpdateIn(message);
+
+            if (queryMetadata.UpdateIn(message) != kErrorNone)
+            {
+                FinalizeSntpTransaction(message, queryMetadata, 0, kErrorNoBufs);
+                continue;
+            }
 
             // Retransmit
             messageInfo.SetPeerAddr(queryMetadata.mDestinationAddress);
@@ -223,7 +223,7 @@ private:
             IgnoreError(aMessage.Read(aMessage.GetLength() - sizeof(*this), *this));
         }
 
-        void UpdateIn(Message &aMessage) const { aMessage.Write(aMessage.GetLength() - sizeof(*this), *this); }
+        Error UpdateIn(Message &aMessage) const { return aMessage.Write(aMessage.GetLength() - sizeof(*this), *this); }
 
         uint32_t                  mTransmitTimestamp;   // Time at client when request departed for server
         Callback<ResponseHandler> mResponseHandler;     // Response handler callback
@@ -876,7 +876,7 @@ Error Client::PrepareUpdateMessage(Message &aMessage)
     SuccessOrExit(error = AppendHostDescriptionInstruction(aMessage, info));
 
     header.SetUpdateRecordCount(info.mRecordCount);
-    aMessage.Write(kHeaderOffset, header);
+    SuccessOrExit(error = aMessage.Write(kHeaderOffset, header));
 
     // Prepare Additional Data section
 
@@ -884,7 +884,7 @@ Error Client::PrepareUpdateMessage(Message &aMessage)
     SuccessOrExit(error = AppendSignature(aMessage, info));
 
     header.SetAdditionalRecordCount(2); // Lease OPT and SIG RRs
-    aMessage.Write(kHeaderOffset, header);
+    SuccessOrExit(error = aMessage.Write(kHeaderOffset, header));
 
 exit:
     return error;
@@ -1136,7 +1136,7 @@ Error Client::AppendServiceInstruction(Service &aService, Message &aMessage, Inf
     SuccessOrExit(error = Dns::Name::AppendLabel(aService.GetInstanceName(), aMessage));
     SuccessOrExit(error = Dns::Name::AppendPointerLabel(serviceNameOffset, aMessage));
 
-    UpdateRecordLengthInMessage(rr, offset, aMessage);
+    SuccessOrExit(error = UpdateRecordLengthInMessage(rr, offset, aMessage));
     aInfo.mRecordCount++;
 
     if (aService.HasSubType() && !removing)
@@ -1166,7 +1166,7 @@ Error Client::AppendServiceInstruction(Service &aService, Message &aMessage, Inf
             SuccessOrExit(error = aMessage.Append(rr));
 
             SuccessOrExit(error = Dns::Name::AppendPointerLabel(instanceNameOffset, aMessage));
-            UpdateRecordLengthInMessage(rr, offset, aMessage);
+            SuccessOrExit(error = UpdateRecordLengthInMessage(rr, offset, aMessage));
             aInfo.mRecordCount++;
         }
     }
@@ -1193,7 +1193,7 @@ Error Client::AppendServiceInstruction(Service &aService, Message &aMessage, Inf
     offset = aMessage.GetLength();
     SuccessOrExit(error = aMessage.Append(srv));
     SuccessOrExit(error = AppendHostName(aMessage, aInfo));
-    UpdateRecordLengthInMessage(srv, offset, aMessage);
+    SuccessOrExit(error = UpdateRecordLengthInMessage(srv, offset, aMessage));
     aInfo.mRecordCount++;
 
     // TXT RR
@@ -1204,7 +1204,7 @@ Error Client::AppendServiceInstruction(Service &aService, Message &aMessage, Inf
     SuccessOrExit(error = aMessage.Append(rr));
     SuccessOrExit(error =
                       Dns::TxtEntry::AppendEntries(aService.GetTxtEntries(), aService.GetNumTxtEntries(), aMessage));
-    UpdateRecordLengthInMessage(rr, offset, aMessage);
+    SuccessOrExit(error = UpdateRecordLengthInMessage(rr, offset, aMessage));
     aInfo.mRecordCount++;
 
 #if OPENTHREAD_CONFIG_REFERENCE_DEVICE_ENABLE
@@ -1471,13 +1471,13 @@ Error Client::AppendSignature(Message &aMessage, Info &aInfo)
     SuccessOrExit(error = aMessage.Append(sig));
     SuccessOrExit(error = AppendHostName(aMessage, aInfo));
     SuccessOrExit(error = aMessage.Append(signature));
-    UpdateRecordLengthInMessage(sig, offset, aMessage);
+    SuccessOrExit(error = UpdateRecordLengthInMessage(sig, offset, aMessage));
 
 exit:
     return error;
 }
 
-void Client::UpdateRecordLengthInMessage(Dns::ResourceRecord &aRecord, uint16_t aOffset, Message &aMessage) const
+Error Client::UpdateRecordLengthInMessage(Dns::ResourceRecord &aRecord, uint16_t aOffset, Message &aMessage) const
 {
     // This method is used to calculate an RR DATA length and update
     // (rewrite) it in a message. This should be called immediately
@@ -1486,7 +1486,8 @@ void Client::UpdateRecordLengthInMessage(Dns::ResourceRecord &aRecord, uint16_t
     // record.
 
     aRecord.SetLength(aMessage.GetLength() - aOffset - sizeof(Dns::ResourceRecord));
-    aMessage.Write(aOffset, aRecord);
+
+    return aMessage.Write(aOffset, aRecord);
 }
 
 void Client::HandleUdpReceive(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo)
@@ -37,6 +37,7 @@
 
 #include "common/as_core_type.hpp"
 #include "common/const_cast.hpp"
+#include "common/hash_index.hpp"
 #include "common/instance.hpp"
 #include "common/locator_getters.hpp"
 #include "common/log.hpp"
@@ -99,6 +100,10 @@ Server::Server(Instance &aInstance)
     , mAutoEnable(false)
 #endif
 {
+    memset(mHostNameIndex, 0, sizeof(mHostNameIndex));
+    memset(mServiceNameIndex, 0, sizeof(mServiceNameIndex));
+    memset(mInstanceNameIndex, 0, sizeof(mInstanceNameIndex));
+
     IgnoreError(SetDomain(kDefaultDomain));
 }
 
@@ -308,14 +313,177 @@ const Server::Host *Server::GetNextHost(const Server::Host *aHost)
     return (aHost == nullptr) ? mHosts.GetHead() : aHost->GetNext();
 }
 
+const Server::Host *Server::FindHost(const char *aFullName) const
+{
+    const Host *host = mHostNameIndex[GetNameIndexBucket(aFullName)];
+
+    while (host != nullptr && !host->Matches(aFullName))
+    {
+        host = host->mNextInNameIndex;
+    }
+
+    return host;
+}
+
+Server::Host *Server::FindHost(const char *aFullName) { return AsNonConst(AsConst(this)->FindHost(aFullName)); }
+
+const Server::Service *Server::FindNextServiceByServiceName(const Service *aPrevService,
+                                                            Service::Flags aFlags,
+                                                            const char    *aServiceName) const
+{
+    const Service *service = (aPrevService == nullptr) ? mServiceNameIndex[GetNameIndexBucket(aServiceName)]
+                                                       : aPrevService->mNextInServiceNameIndex;
+
+    for (; service != nullptr; service = service->mNextInServiceNameIndex)
+    {
+        if (service->MatchesFlags(aFlags) && service->MatchesServiceName(aServiceName))
+        {
+            break;
+        }
+    }
+
+    return service;
+}
+
+const Server::Service *Server::FindNextServiceByInstanceName(const Service *aPrevService,
+                                                             Service::Flags aFlags,
+                                                             const char    *aInstanceName) const
+{
+    const Service *service = (aPrevService == nullptr) ? mInstanceNameIndex[GetNameIndexBucket(aInstanceName)]
+                                                       : aPrevService->mNextInInstanceNameIndex;
+
+    for (; service != nullptr; service = service->mNextInInstanceNameIndex)
+    {
+        if (service->MatchesFlags(aFlags) && service->MatchesInstanceName(aInstanceName))
+        {
+            break;
+        }
+    }
+
+    return service;
+}
+
+uint16_t Server::GetNameIndexBucket(const char *aName)
+{
+    // Hash over the lowercase name, since names are matched
+    // case-insensitively.
+
+    typedef HashIndex<kNameIndexBuckets> NameHash;
+
+    uint32_t hash = NameHash::CalculateHash(aName, 0); // Hash of the empty string.
+
+    for (; *aName != kNullChar; aName++)
+    {
+        char ch = ToLowercase(*aName);
+
+        hash = NameHash::CalculateHash(&ch, sizeof(ch), hash);
+    }
+
+    return static_cast<uint16_t>(hash % kNameIndexBuckets);
+}
+
+void Server::AddToNameIndex(Host &aHost)
+{
+    uint16_t bucket = GetNameIndexBucket(aHost.GetFullName());
+
+    OT_ASSERT(!aHost.mIsIndexed);
+
+    aHost.mNextInNameIndex = mHostNameIndex[bucket];
+    mHostNameIndex[bucket] = &aHost;
+    aHost.mIsIndexed       = true;
+
+    for (Service &service : aHost.mServices)
+    {
+        AddToNameIndex(service);
+    }
+}
+
+void Server::RemoveFromNameIndex(Host &aHost)
+{
+    // Only removes the host itself. Its services stay indexed
+    // until they are freed (see `Host::RemoveService()`).
+
+    Host **link;
+
+    VerifyOrExit(aHost.mIsIndexed);
+
+    for (link = &mHostNameIndex[GetNameIndexBucket(aHost.GetFullName())]; *link != nullptr;
+         link = &(*link)->mNextInNameIndex)
+    {
+        if (*link == &aHost)
+        {
+            *link = aHost.mNextInNameIndex;
+            break;
+        }
+    }
+
+    aHost.mNextInNameIndex = nullptr;
+    aHost.mIsIndexed       = false;
+
+exit:
+    return;
+}
+
+void Server::AddToNameIndex(Service &aService)
+{
+    uint16_t bucket;
+
+    OT_ASSERT(!aService.mIsIndexed);
+
+    bucket                           = GetNameIndexBucket(aService.GetServiceName());
+    aService.mNextInServiceNameIndex = mServiceNameIndex[bucket];
+    mServiceNameIndex[bucket]        = &aService;
+
+    bucket                            = GetNameIndexBucket(aService.GetInstanceName());
+    aService.mNextInInstanceNameIndex = mInstanceNameIndex[bucket];
+    mInstanceNameIndex[bucket]        = &aService;
+
+    aService.mIsIndexed = true;
+}
+
+void Server::RemoveFromNameIndex(Service &aService)
+{
+    Service **link;
+
+    VerifyOrExit(aService.mIsIndexed);
+
+    for (link = &mServiceNameIndex[GetNameIndexBucket(aService.GetServiceName())]; *link != nullptr;
+         link = &(*link)->mNextInServiceNameIndex)
+    {
+        if (*link == &aService)
+        {
+            *link = aService.mNextInServiceNameIndex;
+            break;
+        }
+    }
+
+    for (link = &mInstanceNameIndex[GetNameIndexBucket(aService.GetInstanceName())]; *link != nullptr;
+         link = &(*link)->mNextInInstanceNameIndex)
+    {
+        if (*link == &aService)
+        {
+            *link = aService.mNextInInstanceNameIndex;
+            break;
+        }
+    }
+
+    aService.mNextInServiceNameIndex  = nullptr;
+    aService.mNextInInstanceNameIndex = nullptr;
+    aService.mIsIndexed               = false;
+
+exit:
+    return;
+}
+
 // This method adds a SRP service host and takes ownership of it.
 // The caller MUST make sure that there is no existing host with the same hostname.
 void Server::AddHost(Host &aHost)
 {
     LogInfo("Add new host %s", aHost.GetFullName());
 
-    OT_ASSERT(mHosts.FindMatching(aHost.GetFullName()) == nullptr);
-    IgnoreError(mHosts.Add(aHost));
+    OT_ASSERT(FindHost(aHost.GetFullName()) == nullptr);
+    mHosts.Push(aHost);
+    AddToNameIndex(aHost);
 }
 void Server::RemoveHost(Host *aHost, RetainName aRetainName, NotifyMode aNotifyServiceHandler)
 {
@@ -332,6 +500,8 @@ void Server::RemoveHost(Host *aHost, RetainName aRetainName, NotifyMode aNotifyS
     {
         aHost->mKeyLease = 0;
         IgnoreError(mHosts.Remove(*aHost));
+        RemoveFromNameIndex(*aHost);
+        mHostExpiryQueue.Remove(*aHost);
         LogInfo("Fully remove host %s", aHost->GetFullName());
     }
 
@@ -360,7 +530,7 @@ exit:
 bool Server::HasNameConflictsWith(Host &aHost) const
 {
     bool        hasConflicts = false;
-    const Host *existingHost = mHosts.FindMatching(aHost.GetFullName());
+    const Host *existingHost = FindHost(aHost.GetFullName());
 
     if (existingHost != nullptr && aHost.GetKeyRecord()->GetKey() != existingHost->GetKeyRecord()->GetKey())
     {
@@ -374,10 +544,13 @@ bool Server::HasNameConflictsWith(Host &aHost) const
         // instance name and if found, verify that it has the same
         // key.
 
-        for (const Host &host : mHosts)
+        const char    *instanceName    = service.GetInstanceName();
+        const Service *existingService = nullptr;
+
+        while ((existingService = FindNextServiceByInstanceName(existingService, kFlagsAnyService, instanceName)) !=
+               nullptr)
         {
-            if (host.HasServiceInstance(service.GetInstanceName()) &&
-                aHost.GetKeyRecord()->GetKey() != host.GetKeyRecord()->GetKey())
+            if (aHost.GetKeyRecord()->GetKey() != existingService->GetHost().GetKeyRecord()->GetKey())
             {
                 LogWarn("Name conflict: service name %s has already been allocated", service.GetInstanceName());
                 ExitNow(hasConflicts = true);
@@ -469,7 +642,7 @@ void Server::CommitSrpUpdate(Error                    aError,
         service.mDescription->mTtl      = grantedTtl;
     }
 
-    existingHost = mHosts.FindMatching(aHost.GetFullName());
+    existingHost = FindHost(aHost.GetFullName());
 
     if (aHost.GetLease() == 0)
     {
@@ -516,7 +689,14 @@ void Server::CommitSrpUpdate(Error                    aError,
 #endif
     }
 
-    // Re-schedule the lease timer.
+    existingHost = FindHost(aHost.GetFullName());
+
+    if (existingHost != nullptr)
+    {
+        UpdateLeaseExpiry(*existingHost);
+    }
+
+    // Process any expired leases and re-schedule the lease timer.
     HandleLeaseTimer();
 
 exit:
@@ -1272,7 +1452,7 @@ Error Server::ValidateServiceSubTypes(Host &aHost, const MessageMetadata &aMetad
     // message, we add any previously registered service sub-type that
     // does not appear in new Update message as "deleted".
 
-    existingHost = mHosts.FindMatching(aHost.GetFullName());
+    existingHost = FindHost(aHost.GetFullName());
     VerifyOrExit(existingHost != nullptr);
 
     for (const Service &baseService : existingHost->GetServices())
@@ -1308,7 +1488,7 @@ void Server::HandleUpdate(Host &aHost, const MessageMetadata &aMetadata)
 
     aHost.ClearResources();
 
-    existingHost = mHosts.FindMatching(aHost.GetFullName());
+    existingHost = FindHost(aHost.GetFullName());
     VerifyOrExit(existingHost != nullptr);
 
     // The client may not include all services it has registered before
@@ -1543,110 +1723,131 @@ exit:
 
 void Server::HandleLeaseTimer(void)
 {
-    TimeMilli now                = TimerMilli::GetNow();
-    TimeMilli earliestExpireTime = now.GetDistantFuture();
-    Host     *nextHost;
+    TimeMilli now = TimerMilli::GetNow();
+
+    // Hosts and services are processed in the order of their next
+    // lease event. At most `kMaxLeaseExpiriesPerRun` are processed in
+    // one run, and the timer is re-scheduled right away to process any
+    // remaining expired ones.
 
-    for (Host *host = mHosts.GetHead(); host != nullptr; host = nextHost)
+    for (uint16_t count = 0; count < kMaxLeaseExpiriesPerRun; count++)
     {
-        nextHost = host->GetNext();
+        LeaseExpiryEntry *hostEntry    = mHostExpiryQueue.GetEarliest();
+        LeaseExpiryEntry *serviceEntry = mServiceExpiryQueue.GetEarliest();
 
-        if (host->GetKeyExpireTime() <= now)
+        if ((hostEntry != nullptr) && (hostEntry->mExpiryTime <= now) &&
+            ((serviceEntry == nullptr) || (hostEntry->mExpiryTime <= serviceEntry->mExpiryTime)))
         {
-            LogInfo("KEY LEASE of host %s expired", host->GetFullName());
-
-            // Removes the whole host and all services if the KEY RR expired.
-            RemoveHost(host, kDeleteName, kNotifyServiceHandler);
+            ProcessLeaseExpiry(*static_cast<Host *>(hostEntry), now);
+        }
+        else if ((serviceEntry != nullptr) && (serviceEntry->mExpiryTime <= now))
+        {
+            ProcessLeaseExpiry(*static_cast<Service *>(serviceEntry), now);
         }
-        else if (host->IsDeleted())
+        else
         {
-            // The host has been deleted, but the hostname & service instance names retain.
+            break;
+        }
+    }
 
-            Service *next;
+    ScheduleLeaseTimer();
+}
+
+void Server::ProcessLeaseExpiry(Host &aHost, TimeMilli aNow)
+{
+    if (aHost.GetKeyExpireTime() <= aNow)
+    {
+        LogInfo("KEY LEASE of host %s expired", aHost.GetFullName());
 
-            earliestExpireTime = Min(earliestExpireTime, host->GetKeyExpireTime());
+        // Removes the whole host and all services if the KEY RR expired.
+        RemoveHost(&aHost, kDeleteName, kNotifyServiceHandler);
+        ExitNow();
+    }
 
-            // Check if any service instance name expired.
-            for (Service *service = host->mServices.GetHead(); service != nullptr; service = next)
-            {
-                next = service->GetNext();
-
-                OT_ASSERT(service->mIsDeleted);
-
-                if (service->GetKeyExpireTime() <= now)
-                {
-                    service->Log(Service::kKeyLeaseExpired);
-                    host->RemoveService(service, kDeleteName, kNotifyServiceHandler);
-                }
-                else
-                {
-                    earliestExpireTime = Min(earliestExpireTime, service->GetKeyExpireTime());
-                }
-            }
-        }
-        else if (host->GetExpireTime() <= now)
+    if (!aHost.IsDeleted() && (aHost.GetExpireTime() <= aNow))
+    {
+        LogInfo("LEASE of host %s expired", aHost.GetFullName());
+
+        // If the host expired, delete all resources of this host and its services.
+        for (Service &service : aHost.mServices)
         {
-            LogInfo("LEASE of host %s expired", host->GetFullName());
+            // Don't need to notify the service handler as `RemoveHost` at below will do.
+            aHost.RemoveService(&service, kRetainName, kDoNotNotifyServiceHandler);
+        }
 
-            // If the host expired, delete all resources of this host and its services.
-            for (Service &service : host->mServices)
-            {
-                // Don't need to notify the service handler as `RemoveHost` at below will do.
-                host->RemoveService(&service, kRetainName, kDoNotNotifyServiceHandler);
-            }
+        RemoveHost(&aHost, kRetainName, kNotifyServiceHandler);
+    }
 
-            RemoveHost(host, kRetainName, kNotifyServiceHandler);
+    UpdateLeaseExpiry(aHost);
 
-            earliestExpireTime = Min(earliestExpireTime, host->GetKeyExpireTime());
-        }
-        else
-        {
-            // The host doesn't expire, check if any service expired or is explicitly removed.
+exit:
+    return;
+}
 
-            Service *next;
+void Server::ProcessLeaseExpiry(Service &aService, TimeMilli aNow)
+{
+    Host &host = AsNonConst(aService.GetHost());
 
-            OT_ASSERT(!host->IsDeleted());
+    if (host.GetNextLeaseEventTime() <= aNow)
+    {
+        // Process the host first, which also handles its services.
+        ProcessLeaseExpiry(host, aNow);
+        ExitNow();
+    }
 
-            earliestExpireTime = Min(earliestExpireTime, host->GetExpireTime());
+    if (aService.GetKeyExpireTime() <= aNow)
+    {
+        aService.Log(Service::kKeyLeaseExpired);
+        host.RemoveService(&aService, kDeleteName, kNotifyServiceHandler);
+        ExitNow();
+    }
 
-            for (Service *service = host->mServices.GetHead(); service != nullptr; service = next)
-            {
-                next = service->GetNext();
-
-                if (service->GetKeyExpireTime() <= now)
-                {
-                    service->Log(Service::kKeyLeaseExpired);
-                    host->RemoveService(service, kDeleteName, kNotifyServiceHandler);
-                }
-                else if (service->mIsDeleted)
-                {
-                    // The service has been deleted but the name retains.
-                    earliestExpireTime = Min(earliestExpireTime, service->GetKeyExpireTime());
-                }
-                else if (service->GetExpireTime() <= now)
-                {
-                    service->Log(Service::kLeaseExpired);
-
-                    // The service is expired, delete it.
-                    host->RemoveService(service, kRetainName, kNotifyServiceHandler);
-                    earliestExpireTime = Min(earliestExpireTime, service->GetKeyExpireTime());
-                }
-                else
-                {
-                    earliestExpireTime = Min(earliestExpireTime, service->GetExpireTime());
-                }
-            }
-        }
+    if (!aService.mIsDeleted && (aService.GetExpireTime() <= aNow))
+    {
+        aService.Log(Service::kLeaseExpired);
+
+        // The service is expired, delete it but retain its name.
+        host.RemoveService(&aService, kRetainName, kNotifyServiceHandler);
+    }
+
+    mServiceExpiryQueue.Add(aService, aService.GetNextLeaseEventTime());
+
+exit:
+    return;
+}
+
+void Server::UpdateLeaseExpiry(Host &aHost)
+{
+    mHostExpiryQueue.Add(aHost, aHost.GetNextLeaseEventTime());
+
+    for (Service &service : aHost.mServices)
+    {
+        mServiceExpiryQueue.Add(service, service.GetNextLeaseEventTime());
+    }
+}
+
+void Server::ScheduleLeaseTimer(void)
+{
+    TimeMilli               now                = TimerMilli::GetNow();
+    TimeMilli               earliestExpireTime = now.GetDistantFuture();
+    const LeaseExpiryEntry *entry;
+
+    if ((entry = mHostExpiryQueue.GetEarliest()) != nullptr)
+    {
+        earliestExpireTime = Min(earliestExpireTime, entry->mExpiryTime);
+    }
+
+    if ((entry = mServiceExpiryQueue.GetEarliest()) != nullptr)
+    {
+        earliestExpireTime = Min(earliestExpireTime, entry->mExpiryTime);
     }
 
     if (earliestExpireTime != now.GetDistantFuture())
     {
-        OT_ASSERT(earliestExpireTime >= now);
-        if (!mLeaseTimer.IsRunning() || earliestExpireTime <= mLeaseTimer.GetFireTime())
-        {
-            LogInfo("Lease timer is scheduled for %lu seconds", ToUlong(Time::MsecToSec(earliestExpireTime - now)));
-            mLeaseTimer.StartAt(earliestExpireTime, 0);
-        }
+        earliestExpireTime = Max(earliestExpireTime, now);
+
+        LogInfo("Lease timer is scheduled for %lu seconds", ToUlong(Time::MsecToSec(earliestExpireTime - now)));
+        mLeaseTimer.FireAt(earliestExpireTime);
     }
     else
     {
@@ -1702,17 +1903,145 @@ void Server::UpdateResponseCounters(Dns::UpdateHeader::Response aResponseCode)
     }
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+// Server::LeaseExpiryQueue
+
+void Server::LeaseExpiryQueue::Add(LeaseExpiryEntry &aEntry, TimeMilli aExpiryTime)
+{
+    Remove(aEntry);
+
+    aEntry.mExpiryTime = aExpiryTime;
+    aEntry.mIsQueued   = true;
+    mRoot              = Meld(mRoot, &aEntry);
+}
+
+void Server::LeaseExpiryQueue::Remove(LeaseExpiryEntry &aEntry)
+{
+    LeaseExpiryEntry *children;
+
+    VerifyOrExit(aEntry.mIsQueued);
+
+    if (&aEntry != mRoot)
+    {
+        // Detach the entry (along with its children) from its parent
+        // or previous sibling.
+
+        if (aEntry.mPrev->mChild == &aEntry)
+        {
+            aEntry.mPrev->mChild = aEntry.mSibling;
+        }
+        else
+        {
+            aEntry.mPrev->mSibling = aEntry.mSibling;
+        }
+
+        if (aEntry.mSibling != nullptr)
+        {
+            aEntry.mSibling->mPrev = aEntry.mPrev;
+        }
+    }
+
+    children = MergePairs(aEntry.mChild);
+    mRoot    = (&aEntry == mRoot) ? children : Meld(mRoot, children);
+
+    aEntry.mChild    = nullptr;
+    aEntry.mSibling  = nullptr;
+    aEntry.mPrev     = nullptr;
+    aEntry.mIsQueued = false;
+
+exit:
+    return;
+}
+
+Server::LeaseExpiryEntry *Server::LeaseExpiryQueue::Meld(LeaseExpiryEntry *aFirst, LeaseExpiryEntry *aSecond)
+{
+    // Melds two heaps (given by their root entries) and returns the
+    // root of the resulting heap. The root with the later expiry time
+    // becomes the leftmost child of the other root.
+
+    LeaseExpiryEntry *root  = aFirst;
+    LeaseExpiryEntry *child = aSecond;
+
+    VerifyOrExit(aFirst != nullptr, root = aSecond);
+    VerifyOrExit(aSecond != nullptr);
+
+    if (aSecond->mExpiryTime < aFirst->mExpiryTime)
+    {
+        root  = aSecond;
+        child = aFirst;
+    }
+
+    child->mPrev    = root;
+    child->mSibling = root->mChild;
+
+    if (root->mChild != nullptr)
+    {
+        root->mChild->mPrev = child;
+    }
+
+    root->mChild = child;
+
+exit:
+    return root;
+}
+
+Server::LeaseExpiryEntry *Server::LeaseExpiryQueue::MergePairs(LeaseExpiryEntry *aFirstSibling)
+{
+    // Melds a list of sibling heaps into one using two passes: first
+    // melds the siblings in pairs from left to right (collecting the
+    // results in a list linked through `mSibling`), then melds the
+    // collected heaps together.
+
+    LeaseExpiryEntry *pairs = nullptr;
+    LeaseExpiryEntry *root  = nullptr;
+
+    while (aFirstSibling != nullptr)
+    {
+        LeaseExpiryEntry *first  = aFirstSibling;
+        LeaseExpiryEntry *second = first->mSibling;
+
+        aFirstSibling = (second != nullptr) ? second->mSibling : nullptr;
+
+        first->mPrev    = nullptr;
+        first->mSibling = nullptr;
+
+        if (second != nullptr)
+        {
+            second->mPrev    = nullptr;
+            second->mSibling = nullptr;
+        }
+
+        first           = Meld(first, second);
+        first->mSibling = pairs;
+        pairs           = first;
+    }
+
+    while (pairs != nullptr)
+    {
+        LeaseExpiryEntry *next = pairs->mSibling;
+
+        pairs->mSibling = nullptr;
+        root            = Meld(root, pairs);
+        pairs           = next;
+    }
+
+    return root;
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 // Server::Service
 
 Error Server::Service::Init(const char *aServiceName, Description &aDescription, bool aIsSubType, TimeMilli aUpdateTime)
 {
     mDescription.Reset(&aDescription);
-    mNext        = nullptr;
-    mUpdateTime  = aUpdateTime;
-    mIsDeleted   = false;
-    mIsSubType   = aIsSubType;
-    mIsCommitted = false;
+    mNext                    = nullptr;
+    mNextInServiceNameIndex  = nullptr;
+    mNextInInstanceNameIndex = nullptr;
+    mUpdateTime              = aUpdateTime;
+    mIsDeleted               = false;
+    mIsSubType               = aIsSubType;
+    mIsCommitted             = false;
+    mIsIndexed               = false;
 
     return mServiceName.Set(aServiceName);
 }
@@ -1760,6 +2089,11 @@ TimeMilli Server::Service::GetKeyExpireTime(void) const
     return mUpdateTime + Time::SecToMsec(mDescription->mKeyLease);
 }
 
+TimeMilli Server::Service::GetNextLeaseEventTime(void) const
+{
+    return mIsDeleted ? GetKeyExpireTime() : Min(GetExpireTime(), GetKeyExpireTime());
+}
+
 void Server::Service::GetLeaseInfo(LeaseInfo &aLeaseInfo) const
 {
     TimeMilli now           = TimerMilli::GetNow();
@@ -1930,10 +2264,12 @@ exit:
 Server::Host::Host(Instance &aInstance, TimeMilli aUpdateTime)
     : InstanceLocator(aInstance)
     , mNext(nullptr)
+    , mNextInNameIndex(nullptr)
     , mTtl(0)
     , mLease(0)
     , mKeyLease(0)
     , mUpdateTime(aUpdateTime)
+    , mIsIndexed(false)
 {
     mKeyRecord.Clear();
 }
@@ -1981,6 +2317,11 @@ TimeMilli Server::Host::GetExpireTime(void) const
 
 TimeMilli Server::Host::GetKeyExpireTime(void) const { return mUpdateTime + Time::SecToMsec(mKeyLease); }
 
+TimeMilli Server::Host::GetNextLeaseEventTime(void) const
+{
+    return IsDeleted() ? GetKeyExpireTime() : Min(GetExpireTime(), GetKeyExpireTime());
+}
+
 void Server::Host::GetLeaseInfo(LeaseInfo &aLeaseInfo) const
 {
     TimeMilli now           = TimerMilli::GetNow();
@@ -2072,6 +2413,11 @@ Server::Service *Server::Host::AddNewService(const char *aServiceName,
 
     mServices.Push(*service);
 
+    if (mIsIndexed)
+    {
+        Get<Server>().AddToNameIndex(*service);
+    }
+
 exit:
     return service;
 }
@@ -2108,6 +2454,8 @@ void Server::Host::RemoveService(Service *aService, RetainName aRetainName, Noti
     if (!aRetainName)
     {
         IgnoreError(mServices.Remove(*aService));
+        server.RemoveFromNameIndex(*aService);
+        server.mServiceExpiryQueue.Remove(*aService);
         aService->Free();
     }
 
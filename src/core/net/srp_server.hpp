@@ -128,6 +128,50 @@ class Server : public InstanceLocator, private NonCopyable
         kNotifyServiceHandler      = true,
     };
 
+    // An entry in a `LeaseExpiryQueue` (base class of `Host` and `Service`).
+    class LeaseExpiryEntry
+    {
+        friend class Server;
+
+    protected:
+        LeaseExpiryEntry(void)
+            : mChild(nullptr)
+            , mSibling(nullptr)
+            , mPrev(nullptr)
+            , mIsQueued(false)
+        {
+        }
+
+    private:
+        TimeMilli         mExpiryTime;
+        LeaseExpiryEntry *mChild;
+        LeaseExpiryEntry *mSibling;
+        LeaseExpiryEntry *mPrev; // Parent if the leftmost child, otherwise the previous sibling.
+        bool              mIsQueued;
+    };
+
+    // A priority queue of entries ordered by their expiry time, kept as
+    // an intrusive pairing heap (no allocation). Adding an entry takes
+    // O(1), and removing an entry takes O(log n) amortized time.
+    class LeaseExpiryQueue
+    {
+    public:
+        LeaseExpiryQueue(void)
+            : mRoot(nullptr)
+        {
+        }
+
+        LeaseExpiryEntry *GetEarliest(void) const { return mRoot; }
+        void              Add(LeaseExpiryEntry &aEntry, TimeMilli aExpiryTime);
+        void              Remove(LeaseExpiryEntry &aEntry);
+
+    private:
+        static LeaseExpiryEntry *Meld(LeaseExpiryEntry *aFirst, LeaseExpiryEntry *aSecond);
+        static LeaseExpiryEntry *MergePairs(LeaseExpiryEntry *aFirstSibling);
+
+        LeaseExpiryEntry *mRoot;
+    };
+
 public:
     static constexpr uint16_t kUdpPortMin = OPENTHREAD_CONFIG_SRP_SERVER_UDP_PORT_MIN; ///< The reserved min port.
     static constexpr uint16_t kUdpPortMax = OPENTHREAD_CONFIG_SRP_SERVER_UDP_PORT_MAX; ///< The reserved max port.
@@ -178,6 +222,7 @@ public:
      */
     class Service : public otSrpServerService,
                     public LinkedListEntry<Service>,
+                    private LeaseExpiryEntry,
                     private Heap::Allocatable<Service>,
                     private NonCopyable
     {
@@ -439,18 +484,22 @@ public:
             kKeyLeaseExpired,
         };
 
-        Error Init(const char *aServiceName, Description &aDescription, bool aIsSubType, TimeMilli aUpdateTime);
-        bool  MatchesFlags(Flags aFlags) const;
+        Error     Init(const char *aServiceName, Description &aDescription, bool aIsSubType, TimeMilli aUpdateTime);
+        bool      MatchesFlags(Flags aFlags) const;
+        TimeMilli GetNextLeaseEventTime(void) const;
         const TimeMilli &GetUpdateTime(void) const { return mUpdateTime; }
         void             Log(Action aAction) const;
 
         Heap::String           mServiceName;
         RetainPtr<Description> mDescription;
         Service               *mNext;
+        Service               *mNextInServiceNameIndex;
+        Service               *mNextInInstanceNameIndex;
         TimeMilli              mUpdateTime;
         bool                   mIsDeleted : 1;
         bool                   mIsSubType : 1;
         bool                   mIsCommitted : 1;
+        bool                   mIsIndexed : 1;
     };
 
     /**
@@ -460,6 +509,7 @@ public:
     class Host : public otSrpServerHost,
                  public InstanceLocator,
                  public LinkedListEntry<Host>,
+                 private LeaseExpiryEntry,
                  private Heap::Allocatable<Host>,
                  private NonCopyable
     {
@@ -598,14 +648,15 @@ public:
         Host(Instance &aInstance, TimeMilli aUpdateTime);
         ~Host(void);
 
-        Error SetFullName(const char *aFullName);
-        void  SetKeyRecord(Dns::Ecdsa256KeyRecord &aKeyRecord);
-        void  SetTtl(uint32_t aTtl) { mTtl = aTtl; }
-        void  SetLease(uint32_t aLease) { mLease = aLease; }
-        void  SetKeyLease(uint32_t aKeyLease) { mKeyLease = aKeyLease; }
-        void  SetUseShortLeaseOption(bool aUse) { mUseShortLeaseOption = aUse; }
-        bool  ShouldUseShortLeaseOption(void) const { return mUseShortLeaseOption; }
-        Error ProcessTtl(uint32_t aTtl);
+        Error     SetFullName(const char *aFullName);
+        void      SetKeyRecord(Dns::Ecdsa256KeyRecord &aKeyRecord);
+        TimeMilli GetNextLeaseEventTime(void) const;
+        void      SetTtl(uint32_t aTtl) { mTtl = aTtl; }
+        void      SetLease(uint32_t aLease) { mLease = aLease; }
+        void      SetKeyLease(uint32_t aKeyLease) { mKeyLease = aKeyLease; }
+        void      SetUseShortLeaseOption(bool aUse) { mUseShortLeaseOption = aUse; }
+        bool      ShouldUseShortLeaseOption(void) const { return mUseShortLeaseOption; }
+        Error     ProcessTtl(uint32_t aTtl);
 
         LinkedList<Service> &GetServices(void) { return mServices; }
         Service             *AddNewService(const char *aServiceName,
@@ -629,6 +680,7 @@ public:
         const Service                        *FindBaseService(const char *aInstanceName) const;
 
         Host                     *mNext;
+        Host                     *mNextInNameIndex;
         Heap::String              mFullName;
         Heap::Array<Ip6::Address> mAddresses;
 
@@ -641,6 +693,7 @@ public:
         TimeMilli              mUpdateTime;
         LinkedList<Service>    mServices;
         bool                   mUseShortLeaseOption; // Use short lease option (lease only - 4 byte) when responding.
+        bool                   mIsIndexed;           // Whether the host and its services are in the name indexes.
     };
 
     /**
@@ -911,6 +964,50 @@ public:
      */
     const Host *GetNextHost(const Host *aHost);
 
+    /**
+     * Finds a registered SRP host with a given full name.
+     *
+     * @param[in]  aFullName  The full host name.
+     *
+     * @returns  A pointer to the SRP host or `nullptr` if no host with @p aFullName is registered.
+     *
+     */
+    const Host *FindHost(const char *aFullName) const;
+
+    /**
+     * Finds the next registered SRP service (across all hosts) with a given service name.
+     *
+     * The lookup uses the server's service name index and does not iterate over all registered hosts and services.
+     * The order in which matching services are returned is unspecified.
+     *
+     * @param[in]  aPrevService  The previous matching service; use `nullptr` to get the first one.
+     * @param[in]  aFlags        The flags indicating which services to include (base/sub-type, active/deleted).
+     * @param[in]  aServiceName  The full service name to match.
+     *
+     * @returns  A pointer to the next matching service or `nullptr` if no more matching services can be found.
+     *
+     */
+    const Service *FindNextServiceByServiceName(const Service *aPrevService,
+                                                Service::Flags aFlags,
+                                                const char    *aServiceName) const;
+
+    /**
+     * Finds the next registered SRP service (across all hosts) with a given service instance name.
+     *
+     * The lookup uses the server's service instance name index and does not iterate over all registered hosts and
+     * services. The order in which matching services are returned is unspecified.
+     *
+     * @param[in]  aPrevService   The previous matching service; use `nullptr` to get the first one.
+     * @param[in]  aFlags         The flags indicating which services to include (base/sub-type, active/deleted).
+     * @param[in]  aInstanceName  The full service instance name to match.
+     *
+     * @returns  A pointer to the next matching service or `nullptr` if no more matching services can be found.
+     *
+     */
+    const Service *FindNextServiceByInstanceName(const Service *aPrevService,
+                                                 Service::Flags aFlags,
+                                                 const char    *aInstanceName) const;
+
     /**
      * Returns the response counters of the SRP server.
      *
@@ -945,6 +1042,10 @@ private:
 
     static constexpr uint16_t kAnycastAddressModePort = 53;
 
+    static constexpr uint16_t kNameIndexBuckets = OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_BUCKETS;
+
+    static constexpr uint16_t kMaxLeaseExpiriesPerRun = OPENTHREAD_CONFIG_SRP_SERVER_MAX_LEASE_EXPIRIES_PER_RUN;
+
     // Metadata for a received SRP Update message.
     struct MessageMetadata
     {
@@ -1073,6 +1174,18 @@ private:
 
     void UpdateResponseCounters(Dns::Header::Response aResponseCode);
 
+    Host           *FindHost(const char *aFullName);
+    void            AddToNameIndex(Host &aHost);
+    void            RemoveFromNameIndex(Host &aHost);
+    void            AddToNameIndex(Service &aService);
+    void            RemoveFromNameIndex(Service &aService);
+    static uint16_t GetNameIndexBucket(const char *aName);
+
+    void UpdateLeaseExpiry(Host &aHost);
+    void ProcessLeaseExpiry(Host &aHost, TimeMilli aNow);
+    void ProcessLeaseExpiry(Service &aService, TimeMilli aNow);
+    void ScheduleLeaseTimer(void);
+
     using LeaseTimer  = TimerMilliIn<Server, &Server::HandleLeaseTimer>;
     using UpdateTimer = TimerMilliIn<Server, &Server::HandleOutstandingUpdatesTimer>;
 
@@ -1087,6 +1200,13 @@ private:
 
     LinkedList<Host> mHosts;
     LeaseTimer       mLeaseTimer;
+    LeaseExpiryQueue mHostExpiryQueue;
+    LeaseExpiryQueue mServiceExpiryQueue;
+
+    // Hash chains indexing `mHosts` and their services by name.
+    Host    *mHostNameIndex[kNameIndexBuckets];
+    Service *mServiceNameIndex[kNameIndexBuckets];
+    Service *mInstanceNameIndex[kNameIndexBuckets];
 
     UpdateTimer                mOutstandingUpdatesTimer;
     LinkedList<UpdateMetadata> mOutstandingUpdates;
@@ -34,6 +34,7 @@
 #include "udp6.hpp"
 
 #include <stdio.h>
+#include <string.h>
 
 #include <openthread/platform/udp.h>
 
@@ -154,6 +155,10 @@ Udp::Udp(Instance &aInstance)
     , mPrevBackboneSockets(nullptr)
 #endif
 {
+    memset(mPortIndex, 0, sizeof(mPortIndex));
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_BACKBONE_ROUTER_ENABLE
+    memset(mBackbonePortIndex, 0, sizeof(mBackbonePortIndex));
+#endif
 }
 
 Error Udp::AddReceiver(Receiver &aReceiver) { return mReceivers.Add(aReceiver); }
@@ -195,7 +200,8 @@ Error Udp::Bind(SocketHandle &aSocket, const SockAddr &aSockAddr, NetifIdentifie
 {
     OT_UNUSED_VARIABLE(aNetifIdentifier);
 
-    Error error = kErrorNone;
+    Error    error   = kErrorNone;
+    uint16_t oldPort = aSocket.GetSockName().GetPort();
 
 #if OPENTHREAD_CONFIG_PLATFORM_UDP_ENABLE
     SuccessOrExit(error = otPlatUdpBindToNetif(&aSocket, MapEnum(aNetifIdentifier)));
@@ -231,6 +237,12 @@ Error Udp::Bind(SocketHandle &aSocket, const SockAddr &aSockAddr, NetifIdentifie
 #endif
 
 exit:
+    if (oldPort != aSocket.GetSockName().GetPort())
+    {
+        UpdatePortIndex(oldPort);
+        UpdatePortIndex(aSocket.GetSockName().GetPort());
+    }
+
     return error;
 }
 
@@ -247,6 +259,8 @@ void Udp::SetBackboneSocket(SocketHandle &aSocket)
     {
         mSockets.Push(aSocket);
     }
+
+    UpdatePortIndex(aSocket.GetSockName().GetPort());
 }
 
 const Udp::SocketHandle *Udp::GetBackboneSockets(void) const
@@ -377,6 +391,9 @@ void Udp::AddSocket(SocketHandle &aSocket)
         mPrevBackboneSockets = &aSocket;
     }
 #endif
+
+    UpdatePortIndex(aSocket.GetSockName().GetPort());
+
 exit:
     return;
 }
@@ -397,10 +414,92 @@ void Udp::RemoveSocket(SocketHandle &aSocket)
     }
 #endif
 
+    UpdatePortIndex(aSocket.GetSockName().GetPort());
+
 exit:
     return;
 }
 
+void Udp::UpdatePortIndex(uint16_t aPort)
+{
+    // Rebuilds the port index bucket of `aPort` from `mSockets`. The
+    // sockets in a bucket are chained in the same order as they
+    // appear in `mSockets` so that the first matching socket in the
+    // bucket is the same as the first matching one in `mSockets`.
+    // The Thread and Backbone sockets are indexed separately.
+
+    uint16_t       bucket = GetPortIndexBucket(aPort);
+    SocketHandle **head   = &mPortIndex[bucket];
+    SocketHandle  *last   = nullptr;
+
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_BACKBONE_ROUTER_ENABLE
+    const SocketHandle *backboneSockets = GetBackboneSockets();
+
+    mBackbonePortIndex[bucket] = nullptr;
+#endif
+
+    *head = nullptr;
+
+    for (SocketHandle &socket : mSockets)
+    {
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_BACKBONE_ROUTER_ENABLE
+        if (&socket == backboneSockets)
+        {
+            if (last != nullptr)
+            {
+                last->mNextInPortIndex = nullptr;
+            }
+
+            head = &mBackbonePortIndex[bucket];
+            last = nullptr;
+        }
+#endif
+
+        if (GetPortIndexBucket(socket.GetSockName().GetPort()) != bucket)
+        {
+            continue;
+        }
+
+        if (last == nullptr)
+        {
+            *head = &socket;
+        }
+        else
+        {
+            last->mNextInPortIndex = &socket;
+        }
+
+        last = &socket;
+    }
+
+    if (last != nullptr)
+    {
+        last->mNextInPortIndex = nullptr;
+    }
+}
+
+Udp::SocketHandle *Udp::FindSocket(const MessageInfo &aMessageInfo)
+{
+    SocketHandle *socket = mPortIndex[GetPortIndexBucket(aMessageInfo.GetSockPort())];
+
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_BACKBONE_ROUTER_ENABLE
+    if (aMessageInfo.IsHostInterface())
+    {
+        socket = mBackbonePortIndex[GetPortIndexBucket(aMessageInfo.GetSockPort())];
+    }
+#endif
+
+    for (; socket != nullptr; socket = socket->GetNextInPortIndex())
+    {
+        if (socket->Matches(aMessageInfo))
+        {
+            break;
+        }
+    }
+
+    return socket;
+}
+
 uint16_t Udp::GetEphemeralPort(void)
 {
     do
@@ -490,29 +589,7 @@ exit:
 
 void Udp::HandlePayload(Message &aMessage, MessageInfo &aMessageInfo)
 {
-    SocketHandle *socket;
-    SocketHandle *prev;
-
-#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_BACKBONE_ROUTER_ENABLE
-    {
-        const SocketHandle *socketsBegin, *socketsEnd;
-
-        if (!aMessageInfo.IsHostInterface())
-        {
-            socketsBegin = mSockets.GetHead();
-            socketsEnd   = GetBackboneSockets();
-        }
-        else
-        {
-            socketsBegin = GetBackboneSockets();
-            socketsEnd   = nullptr;
-        }
-
-        socket = mSockets.FindMatching(socketsBegin, socketsEnd, aMessageInfo, prev);
-    }
-#else
-    socket = mSockets.FindMatching(aMessageInfo, prev);
-#endif
+    SocketHandle *socket = FindSocket(aMessageInfo);
 
     VerifyOrExit(socket != nullptr);
 
@@ -526,17 +603,24 @@ exit:
 
 bool Udp::IsPortInUse(uint16_t aPort) const
 {
-    bool found = false;
+    bool                found  = false;
+    const SocketHandle *socket = mPortIndex[GetPortIndexBucket(aPort)];
 
-    for (const SocketHandle &socket : mSockets)
+    for (; socket != nullptr; socket = socket->GetNextInPortIndex())
     {
-        if (socket.GetSockName().GetPort() == aPort)
-        {
-            found = true;
-            break;
-        }
+        VerifyOrExit(socket->GetSockName().GetPort() != aPort, found = true);
     }
 
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_BACKBONE_ROUTER_ENABLE
+    socket = mBackbonePortIndex[GetPortIndexBucket(aPort)];
+
+    for (; socket != nullptr; socket = socket->GetNextInPortIndex())
+    {
+        VerifyOrExit(socket->GetSockName().GetPort() != aPort, found = true);
+    }
+#endif
+
+exit:
     return found;
 }
 
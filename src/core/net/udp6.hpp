@@ -138,6 +138,12 @@ public:
     private:
         bool Matches(const MessageInfo &aMessageInfo) const;
 
+        SocketHandle       *GetNextInPortIndex(void) { return static_cast<SocketHandle *>(mNextInPortIndex); }
+        const SocketHandle *GetNextInPortIndex(void) const
+        {
+            return static_cast<const SocketHandle *>(mNextInPortIndex);
+        }
+
         void HandleUdpReceive(Message &aMessage, const MessageInfo &aMessageInfo)
         {
             mHandler(mContext, &aMessage, &aMessageInfo);
@@ -664,10 +670,15 @@ private:
     static constexpr uint16_t kSrpServerPortMin = OPENTHREAD_CONFIG_SRP_SERVER_UDP_PORT_MIN;
     static constexpr uint16_t kSrpServerPortMax = OPENTHREAD_CONFIG_SRP_SERVER_UDP_PORT_MAX;
 
-    static bool IsPortReserved(uint16_t aPort);
+    static constexpr uint16_t kNumPortIndexBuckets = OPENTHREAD_CONFIG_IP6_UDP_PORT_INDEX_BUCKETS;
+
+    static bool     IsPortReserved(uint16_t aPort);
+    static uint16_t GetPortIndexBucket(uint16_t aPort) { return aPort % kNumPortIndexBuckets; }
 
-    void AddSocket(SocketHandle &aSocket);
-    void RemoveSocket(SocketHandle &aSocket);
+    void          AddSocket(SocketHandle &aSocket);
+    void          RemoveSocket(SocketHandle &aSocket);
+    void          UpdatePortIndex(uint16_t aPort);
+    SocketHandle *FindSocket(const MessageInfo &aMessageInfo);
 #if OPENTHREAD_CONFIG_PLATFORM_UDP_ENABLE
     bool ShouldUsePlatformUdp(const SocketHandle &aSocket) const;
 #endif
@@ -681,8 +692,10 @@ private:
     uint16_t                 mEphemeralPort;
     LinkedList<Receiver>     mReceivers;
     LinkedList<SocketHandle> mSockets;
+    SocketHandle            *mPortIndex[kNumPortIndexBuckets];
 #if OPENTHREAD_FTD && OPENTHREAD_CONFIG_BACKBONE_ROUTER_ENABLE
     SocketHandle *mPrevBackboneSockets;
+    SocketHandle *mBackbonePortIndex[kNumPortIndexBuckets];
 #endif
 #if OPENTHREAD_CONFIG_UDP_FORWARD_ENABLE
     Callback<otUdpForwarder> mUdpForwarder;
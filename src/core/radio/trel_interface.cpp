@@ -60,6 +60,7 @@ Interface::Interface(Instance &aInstance)
     , mEnabled(false)
     , mFiltered(false)
     , mRegisterServiceTask(aInstance)
+    , mUseSequence(0)
 {
 }
 
@@ -112,7 +113,7 @@ void Interface::Disable(void)
     VerifyOrExit(mInitialized);
 
     otPlatTrelDisable(&GetInstance());
-    mPeerTable.Clear();
+    ClearPeerTable();
     LogDebg("Disabled interface");
 
 exit:
@@ -198,7 +199,7 @@ void Interface::HandleDiscoveredPeerInfo(const Peer::Info &aInfo)
 
     if (aInfo.IsRemoved())
     {
-        entry = mPeerTable.FindMatching(extAddress);
+        entry = FindPeer(extAddress);
         VerifyOrExit(entry != nullptr);
         RemovePeerEntry(*entry);
         ExitNow();
@@ -210,7 +211,7 @@ void Interface::HandleDiscoveredPeerInfo(const Peer::Info &aInfo)
     // different Extended MAC address. This ensures that we do not
     // keep stale entries in the peer table.
 
-    entry = mPeerTable.FindMatching(aInfo.GetSockAddr());
+    entry = FindPeer(aInfo.GetSockAddr());
 
     if ((entry != nullptr) && !entry->Matches(extAddress))
     {
@@ -220,7 +221,7 @@ void Interface::HandleDiscoveredPeerInfo(const Peer::Info &aInfo)
 
     if (entry == nullptr)
     {
-        entry = mPeerTable.FindMatching(extAddress);
+        entry = FindPeer(extAddress);
     }
 
     if (entry == nullptr)
@@ -229,6 +230,7 @@ void Interface::HandleDiscoveredPeerInfo(const Peer::Info &aInfo)
         VerifyOrExit(entry != nullptr);
 
         entry->SetExtAddress(extAddress);
+        MarkPeerUsed(*entry);
         isNew = true;
     }
 
@@ -239,6 +241,7 @@ void Interface::HandleDiscoveredPeerInfo(const Peer::Info &aInfo)
 
     entry->SetExtPanId(extPanId);
     entry->SetSockAddr(aInfo.GetSockAddr());
+    IndexPeerEntry(*entry);
 
     entry->Log(isNew ? "Added" : "Updated");
 
@@ -298,23 +301,78 @@ exit:
     return error;
 }
 
+Interface::Peer *Interface::FindPeer(const Mac::ExtAddress &aExtAddress)
+{
+    Peer *peerEntry = nullptr;
+
+    for (uint16_t index = mExtAddressIndex.GetFirst(CalculateHash(aExtAddress)); index != PeerIndex::kInvalidIndex;
+         index          = mExtAddressIndex.GetNext(index))
+    {
+        if (mPeerTable[index].Matches(aExtAddress))
+        {
+            ExitNow(peerEntry = &mPeerTable[index]);
+        }
+    }
+
+exit:
+    return peerEntry;
+}
+
+Interface::Peer *Interface::FindPeer(const Ip6::SockAddr &aSockAddr)
+{
+    Peer *peerEntry = nullptr;
+
+    for (uint16_t index = mSockAddrIndex.GetFirst(CalculateHash(aSockAddr)); index != PeerIndex::kInvalidIndex;
+         index          = mSockAddrIndex.GetNext(index))
+    {
+        if (mPeerTable[index].Matches(aSockAddr))
+        {
+            ExitNow(peerEntry = &mPeerTable[index]);
+        }
+    }
+
+exit:
+    return peerEntry;
+}
+
 Interface::Peer *Interface::GetNewPeerEntry(void)
 {
     Peer *peerEntry;
+    Peer *otherNetworkPeer = nullptr;
+    Peer *nonNeighborPeer  = nullptr;
 
     peerEntry = mPeerTable.PushBack();
     VerifyOrExit(peerEntry == nullptr);
 
+    // The table is full. Evict the least recently used peer from
+    // a different network (Extended PAN ID) if any, otherwise the
+    // least recently used peer which is not a neighbor.
+
     for (Peer &entry : mPeerTable)
     {
         if (entry.GetExtPanId() != Get<MeshCoP::ExtendedPanIdManager>().GetExtPanId())
         {
-            ExitNow(peerEntry = &entry);
+            if ((otherNetworkPeer == nullptr) || IsLessRecentlyUsed(entry, *otherNetworkPeer))
+            {
+                otherNetworkPeer = &entry;
+            }
+
+            continue;
+        }
+
+        // Once a peer from a different network is found, the
+        // (more expensive) neighbor checks are no longer needed.
+
+        if (otherNetworkPeer != nullptr)
+        {
+            continue;
+        }
+
+        if ((nonNeighborPeer != nullptr) && !IsLessRecentlyUsed(entry, *nonNeighborPeer))
+        {
+            continue;
         }
-    }
 
-    for (Peer &entry : mPeerTable)
-    {
         // We skip over any existing entry in neighbor table (even if the
         // entry is in invalid state).
 
@@ -336,9 +394,15 @@ Interface::Peer *Interface::GetNewPeerEntry(void)
         }
 #endif
 
-        ExitNow(peerEntry = &entry);
+        nonNeighborPeer = &entry;
     }
 
+    peerEntry = (otherNetworkPeer != nullptr) ? otherNetworkPeer : nonNeighborPeer;
+    VerifyOrExit(peerEntry != nullptr);
+
+    peerEntry->Log("Evicting");
+    UnindexPeerEntry(*peerEntry);
+
 exit:
     return peerEntry;
 }
@@ -347,17 +411,66 @@ void Interface::RemovePeerEntry(Peer &aEntry)
 {
     aEntry.Log("Removing");
 
+    UnindexPeerEntry(aEntry);
+
     // Replace the entry being removed with the last entry (if not the
     // last one already) and then pop the last entry from array.
 
     if (&aEntry != mPeerTable.Back())
     {
+        UnindexPeerEntry(*mPeerTable.Back());
         aEntry = *mPeerTable.Back();
+        IndexPeerEntry(aEntry);
     }
 
     mPeerTable.PopBack();
 }
 
+void Interface::ClearPeerTable(void)
+{
+    mPeerTable.Clear();
+    mExtAddressIndex.Clear();
+    mSockAddrIndex.Clear();
+}
+
+void Interface::IndexPeerEntry(Peer &aEntry)
+{
+    uint16_t index = mPeerTable.IndexOf(aEntry);
+
+    // Re-index the entry since its socket address may have changed.
+
+    mExtAddressIndex.Remove(index);
+    mSockAddrIndex.Remove(index);
+    mExtAddressIndex.Add(index, CalculateHash(aEntry.GetExtAddress()));
+    mSockAddrIndex.Add(index, CalculateHash(aEntry.GetSockAddr()));
+}
+
+void Interface::UnindexPeerEntry(const Peer &aEntry)
+{
+    uint16_t index = mPeerTable.IndexOf(aEntry);
+
+    mExtAddressIndex.Remove(index);
+    mSockAddrIndex.Remove(index);
+}
+
+bool Interface::IsLessRecentlyUsed(const Peer &aFirst, const Peer &aSecond) const
+{
+    // Compare the ages (rather than the sequence values) so that the
+    // result stays correct when `mUseSequence` wraps.
+
+    return (mUseSequence - aFirst.mLastUseSequence) > (mUseSequence - aSecond.mLastUseSequence);
+}
+
+uint32_t Interface::CalculateHash(const Mac::ExtAddress &aExtAddress)
+{
+    return PeerIndex::CalculateHash(aExtAddress.m8, sizeof(aExtAddress));
+}
+
+uint32_t Interface::CalculateHash(const Ip6::SockAddr &aSockAddr)
+{
+    return PeerIndex::CalculateHash(aSockAddr.GetAddress().GetBytes(), sizeof(Ip6::Address)) ^ aSockAddr.GetPort();
+}
+
 Error Interface::Send(const Packet &aPacket, bool aIsDiscovery)
 {
     Error error = kErrorNone;
@@ -382,8 +495,9 @@ Error Interface::Send(const Packet &aPacket, bool aIsDiscovery)
 
     case Header::kTypeUnicast:
     case Header::kTypeAck:
-        peerEntry = mPeerTable.FindMatching(aPacket.GetHeader().GetDestination());
+        peerEntry = FindPeer(aPacket.GetHeader().GetDestination());
         VerifyOrExit(peerEntry != nullptr, error = kErrorAbort);
+        MarkPeerUsed(*peerEntry);
         otPlatTrelSend(&GetInstance(), aPacket.GetBuffer(), aPacket.GetLength(), &peerEntry->mSockAddr);
         break;
     }
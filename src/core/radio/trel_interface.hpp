@@ -42,6 +42,7 @@
 #include <openthread/platform/trel.h>
 
 #include "common/array.hpp"
+#include "common/hash_index.hpp"
 #include "common/locator.hpp"
 #include "common/tasklet.hpp"
 #include "common/time.hpp"
@@ -55,6 +56,7 @@ namespace ot {
 namespace Trel {
 
 class Link;
+class PeerTableTester;
 
 extern "C" void otPlatTrelHandleReceived(otInstance *aInstance, uint8_t *aBuffer, uint16_t aLength);
 extern "C" void otPlatTrelHandleDiscoveredPeerInfo(otInstance *aInstance, const otPlatTrelPeerInfo *aInfo);
@@ -66,6 +68,7 @@ extern "C" void otPlatTrelHandleDiscoveredPeerInfo(otInstance *aInstance, const
 class Interface : public InstanceLocator
 {
     friend class Link;
+    friend class PeerTableTester;
     friend void otPlatTrelHandleReceived(otInstance *aInstance, uint8_t *aBuffer, uint16_t aLength);
     friend void otPlatTrelHandleDiscoveredPeerInfo(otInstance *aInstance, const otPlatTrelPeerInfo *aInfo);
 
@@ -143,6 +146,8 @@ public:
         void SetExtPanId(const MeshCoP::ExtendedPanId &aExtPanId) { mExtPanId = aExtPanId; }
         void SetSockAddr(const Ip6::SockAddr &aSockAddr) { mSockAddr = aSockAddr; }
         void Log(const char *aAction) const;
+
+        uint32_t mLastUseSequence; // The `Interface::mUseSequence` value when the peer was last used.
     };
 
     /**
@@ -236,6 +241,7 @@ private:
     static const char kTxtRecordExtPanIdKey[];
 
     typedef Array<Peer, kPeerTableSize, uint16_t> PeerTable;
+    typedef HashIndex<kPeerTableSize>             PeerIndex;
 
     explicit Interface(Instance &aInstance);
 
@@ -253,8 +259,18 @@ private:
     Error ParsePeerInfoTxtData(const Peer::Info       &aInfo,
                                Mac::ExtAddress        &aExtAddress,
                                MeshCoP::ExtendedPanId &aExtPanId) const;
+    Peer *FindPeer(const Mac::ExtAddress &aExtAddress);
+    Peer *FindPeer(const Ip6::SockAddr &aSockAddr);
     Peer *GetNewPeerEntry(void);
     void  RemovePeerEntry(Peer &aEntry);
+    void  ClearPeerTable(void);
+    void  IndexPeerEntry(Peer &aEntry);
+    void  UnindexPeerEntry(const Peer &aEntry);
+    void  MarkPeerUsed(Peer &aEntry) { aEntry.mLastUseSequence = ++mUseSequence; }
+    bool  IsLessRecentlyUsed(const Peer &aFirst, const Peer &aSecond) const;
+
+    static uint32_t CalculateHash(const Mac::ExtAddress &aExtAddress);
+    static uint32_t CalculateHash(const Ip6::SockAddr &aSockAddr);
 
     using RegisterServiceTask = TaskletIn<Interface, &Interface::RegisterService>;
 
@@ -264,7 +280,10 @@ private:
     RegisterServiceTask mRegisterServiceTask;
     uint16_t            mUdpPort;
     Packet              mRxPacket;
+    uint32_t            mUseSequence;
     PeerTable           mPeerTable;
+    PeerIndex           mExtAddressIndex;
+    PeerIndex           mSockAddrIndex;
 };
 
 } // namespace Trel
@@ -56,7 +56,14 @@ AddressResolver::AddressResolver(Instance &aInstance)
     : InstanceLocator(aInstance)
 #if OPENTHREAD_FTD
     , mCacheEntryPool(aInstance)
+    , mCachedList(kCachedList)
+    , mSnoopedList(kSnoopedList)
+    , mQueryList(kQueryList)
+    , mQueryRetryList(kQueryRetryList)
     , mIcmpHandler(&AddressResolver::HandleIcmpReceive, this)
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_FLOW_CACHE_ENABLE
+    , mCacheGeneration(0)
+#endif
 #endif
 {
 #if OPENTHREAD_FTD
@@ -84,6 +91,9 @@ void AddressResolver::Clear(void)
             mCacheEntryPool.Free(*entry);
         }
     }
+
+    mCacheEntryHashIndex.Clear();
+    IncrementCacheGeneration();
 }
 
 Error AddressResolver::GetNextCacheEntry(EntryInfo &aInfo, Iterator &aIterator) const
@@ -190,7 +200,7 @@ void AddressResolver::Remove(Mac::ShortAddress aRloc16, bool aMatchRouterId)
                 (!aMatchRouterId && (entry->GetRloc16() == aRloc16)))
             {
                 RemoveCacheEntry(*entry, *list, prev, aMatchRouterId ? kReasonRemovingRouterId : kReasonRemovingRloc16);
-                mCacheEntryPool.Free(*entry);
+                FreeCacheEntry(*entry);
 
                 // If the entry is removed from list, we keep the same
                 // `prev` pointer.
@@ -207,20 +217,74 @@ AddressResolver::CacheEntry *AddressResolver::FindCacheEntry(const Ip6::Address
                                                              CacheEntryList    *&aList,
                                                              CacheEntry        *&aPrevEntry)
 {
-    CacheEntry     *entry   = nullptr;
-    CacheEntryList *lists[] = {&mCachedList, &mSnoopedList, &mQueryList, &mQueryRetryList};
+    // Looks up the entry using the hash index, then determines its
+    // current list and the previous entry in that list (needed to
+    // remove the entry from the singly linked list).
 
-    for (CacheEntryList *list : lists)
+    CacheEntry *entry = nullptr;
+    uint32_t    hash  = CalculateHash(aEid);
+
+    for (uint16_t index = mCacheEntryHashIndex.GetFirst(hash); index != CacheEntryHashIndex::kInvalidIndex;
+         index          = mCacheEntryHashIndex.GetNext(index))
     {
-        aList = list;
-        entry = aList->FindMatching(aEid, aPrevEntry);
-        VerifyOrExit(entry == nullptr);
+        CacheEntry &cur = mCacheEntryPool.GetEntryAt(index);
+
+        if (cur.Matches(aEid))
+        {
+            entry      = &cur;
+            aList      = &GetCacheEntryList(entry->GetListId());
+            aPrevEntry = (aList->GetHead() == entry) ? nullptr : entry->GetPrev();
+            break;
+        }
     }
 
-exit:
     return entry;
 }
 
+void AddressResolver::FreeCacheEntry(CacheEntry &aEntry)
+{
+    RemoveFromHashIndex(aEntry);
+    mCacheEntryPool.Free(aEntry);
+}
+
+void AddressResolver::AddToHashIndex(CacheEntry &aEntry)
+{
+    mCacheEntryHashIndex.Add(mCacheEntryPool.GetIndexOf(aEntry), CalculateHash(aEntry.GetTarget()));
+}
+
+void AddressResolver::RemoveFromHashIndex(CacheEntry &aEntry)
+{
+    mCacheEntryHashIndex.Remove(mCacheEntryPool.GetIndexOf(aEntry));
+    IncrementCacheGeneration();
+}
+
+uint32_t AddressResolver::CalculateHash(const Ip6::Address &aEid)
+{
+    return CacheEntryHashIndex::CalculateHash(aEid.GetIid().GetBytes(), sizeof(Ip6::InterfaceIdentifier));
+}
+
+AddressResolver::CacheEntryList &AddressResolver::GetCacheEntryList(ListId aListId)
+{
+    CacheEntryList *list = &mCachedList;
+
+    switch (aListId)
+    {
+    case kCachedList:
+        break;
+    case kSnoopedList:
+        list = &mSnoopedList;
+        break;
+    case kQueryList:
+        list = &mQueryList;
+        break;
+    case kQueryRetryList:
+        list = &mQueryRetryList;
+        break;
+    }
+
+    return *list;
+}
+
 void AddressResolver::RemoveEntryForAddress(const Ip6::Address &aEid) { Remove(aEid, kReasonRemovingEid); }
 
 void AddressResolver::Remove(const Ip6::Address &aEid, Reason aReason)
@@ -233,7 +297,7 @@ void AddressResolver::Remove(const Ip6::Address &aEid, Reason aReason)
     VerifyOrExit(entry != nullptr);
 
     RemoveCacheEntry(*entry, *list, prev, aReason);
-    mCacheEntryPool.Free(*entry);
+    FreeCacheEntry(*entry);
 
 exit:
     return;
@@ -250,6 +314,7 @@ void AddressResolver::ReplaceEntriesForRloc16(uint16_t aOldRloc16, uint16_t aNew
             if (entry.GetRloc16() == aOldRloc16)
             {
                 entry.SetRloc16(aNewRloc16);
+                IncrementCacheGeneration();
             }
         }
     }
@@ -296,6 +361,7 @@ AddressResolver::CacheEntry *AddressResolver::NewCacheEntry(bool aSnoopedEntry)
         if (newEntry != nullptr)
         {
             RemoveCacheEntry(*newEntry, *list, prevEntry, kReasonEvictingForNewEntry);
+            RemoveFromHashIndex(*newEntry);
             ExitNow();
         }
 
@@ -370,6 +436,7 @@ Error AddressResolver::UpdateCacheEntry(const Ip6::Address &aEid, Mac::ShortAddr
         Get<MeshForwarder>().HandleResolved(aEid, kErrorNone);
     }
 
+    IncrementCacheGeneration();
     LogCacheEntryChange(kEntryUpdated, kReasonSnoop, *entry);
 
 exit:
@@ -416,6 +483,7 @@ void AddressResolver::UpdateSnoopedCacheEntry(const Ip6::Address &aEid,
 
     entry->SetTarget(aEid);
     entry->SetRloc16(aRloc16);
+    AddToHashIndex(*entry);
 
     if (numNonEvictable < kMaxNonEvictableSnoopedEntries)
     {
@@ -461,6 +529,8 @@ void AddressResolver::RestartAddressQueries(void)
 
     for (CacheEntry &entry : mQueryList)
     {
+        entry.SetListId(kQueryList);
+
         IgnoreError(SendAddressQuery(entry.GetTarget()));
 
         entry.SetTimeout(kAddressQueryTimeout);
@@ -506,6 +576,7 @@ Error AddressResolver::Resolve(const Ip6::Address &aEid, Mac::ShortAddress &aRlo
         entry->SetRloc16(Mac::kShortAddrInvalid);
         entry->SetRetryDelay(kAddressQueryInitialRetryDelay);
         entry->SetCanEvict(false);
+        AddToHashIndex(*entry);
         list = nullptr;
     }
 
@@ -552,7 +623,7 @@ Error AddressResolver::Resolve(const Ip6::Address &aEid, Mac::ShortAddress &aRlo
     entry->SetTimeout(kAddressQueryTimeout);
 
     error = SendAddressQuery(aEid);
-    VerifyOrExit(error == kErrorNone, mCacheEntryPool.Free(*entry));
+    VerifyOrExit(error == kErrorNone, FreeCacheEntry(*entry));
 
     if (list == nullptr)
     {
@@ -692,6 +763,7 @@ void AddressResolver::HandleTmf<kUriAddressNotify>(Coap::Message &aMessage, cons
 
     list->PopAfter(prev);
     mCachedList.Push(*entry);
+    IncrementCacheGeneration();
 
     LogCacheEntryChange(kEntryUpdated, kReasonReceivedNotification, *entry);
 
@@ -1089,6 +1161,7 @@ void AddressResolver::CacheEntry::Init(Instance &aInstance)
 {
     InstanceLocatorInit::Init(aInstance);
     mNextIndex = kNoNextIndex;
+    mPrevIndex = kNoNextIndex;
 }
 
 AddressResolver::CacheEntry *AddressResolver::CacheEntry::GetNext(void)
@@ -1103,13 +1176,25 @@ const AddressResolver::CacheEntry *AddressResolver::CacheEntry::GetNext(void) co
 
 void AddressResolver::CacheEntry::SetNext(CacheEntry *aEntry)
 {
+    // All list operations link an entry by calling `SetNext()` on
+    // its previous entry, so `aEntry` also records this entry as its
+    // previous one. `mPrevIndex` of the head of a list is not used.
+
+    CacheEntryPool &pool = Get<AddressResolver>().GetCacheEntryPool();
+
     VerifyOrExit(aEntry != nullptr, mNextIndex = kNoNextIndex);
-    mNextIndex = Get<AddressResolver>().GetCacheEntryPool().GetIndexOf(*aEntry);
+    mNextIndex         = pool.GetIndexOf(*aEntry);
+    aEntry->mPrevIndex = pool.GetIndexOf(*this);
 
 exit:
     return;
 }
 
+AddressResolver::CacheEntry *AddressResolver::CacheEntry::GetPrev(void)
+{
+    return (mPrevIndex == kNoNextIndex) ? nullptr : &Get<AddressResolver>().GetCacheEntryPool().GetEntryAt(mPrevIndex);
+}
+
 #endif // OPENTHREAD_FTD
 
 } // namespace ot
@@ -38,6 +38,7 @@
 
 #include "coap/coap.hpp"
 #include "common/as_core_type.hpp"
+#include "common/hash_index.hpp"
 #include "common/linked_list.hpp"
 #include "common/locator.hpp"
 #include "common/non_copyable.hpp"
@@ -206,6 +207,19 @@ public:
      */
     Mac::ShortAddress LookUp(const Ip6::Address &aEid);
 
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MESH_FORWARDER_FLOW_CACHE_ENABLE
+    /**
+     * Returns the address cache generation.
+     *
+     * The generation is incremented whenever an EID-to-RLOC16 mapping in the address cache is changed or removed. It
+     * allows callers that memoize the outcome of `Resolve()` to detect when it may be stale.
+     *
+     * @returns The address cache generation.
+     *
+     */
+    uint32_t GetCacheGeneration(void) const { return mCacheGeneration; }
+#endif
+
     /**
      * Restarts any ongoing address queries.
      *
@@ -251,6 +265,14 @@ private:
     static constexpr uint16_t kAddressQueryMaxRetryDelay     = OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_MAX_RETRY_DELAY;
     static constexpr uint16_t kSnoopBlockEvictionTimeout     = OPENTHREAD_CONFIG_TMF_SNOOP_CACHE_ENTRY_TIMEOUT;
 
+    enum ListId : uint8_t
+    {
+        kCachedList,
+        kSnoopedList,
+        kQueryList,
+        kQueryRetryList,
+    };
+
     class CacheEntry : public InstanceLocatorInit
     {
     public:
@@ -259,6 +281,10 @@ private:
         CacheEntry       *GetNext(void);
         const CacheEntry *GetNext(void) const;
         void              SetNext(CacheEntry *aEntry);
+        CacheEntry       *GetPrev(void);
+
+        ListId GetListId(void) const { return mListId; }
+        void   SetListId(ListId aListId) { mListId = aListId; }
 
         const Ip6::Address &GetTarget(void) const { return mTarget; }
         void                SetTarget(const Ip6::Address &aTarget) { mTarget = aTarget; }
@@ -294,6 +320,8 @@ private:
         Ip6::Address      mTarget;
         Mac::ShortAddress mRloc16;
         uint16_t          mNextIndex;
+        uint16_t          mPrevIndex; // Valid only when the entry is not the head of its list.
+        ListId            mListId;
 
         union
         {
@@ -314,9 +342,24 @@ private:
     };
 
     typedef Pool<CacheEntry, kCacheEntries> CacheEntryPool;
+    typedef HashIndex<kCacheEntries>        CacheEntryHashIndex;
 
     class CacheEntryList : public LinkedList<CacheEntry>
     {
+    public:
+        explicit CacheEntryList(ListId aListId)
+            : mListId(aListId)
+        {
+        }
+
+        void Push(CacheEntry &aEntry)
+        {
+            aEntry.SetListId(mListId);
+            LinkedList<CacheEntry>::Push(aEntry);
+        }
+
+    private:
+        ListId mListId;
     };
 
     enum EntryChange : uint8_t
@@ -339,12 +382,16 @@ private:
     };
 
     CacheEntryPool &GetCacheEntryPool(void) { return mCacheEntryPool; }
+    CacheEntryList &GetCacheEntryList(ListId aListId);
 
     Error       Resolve(const Ip6::Address &aEid, Mac::ShortAddress &aRloc16, bool aAllowAddressQuery);
     void        Remove(Mac::ShortAddress aRloc16, bool aMatchRouterId);
     void        Remove(const Ip6::Address &aEid, Reason aReason);
     CacheEntry *FindCacheEntry(const Ip6::Address &aEid, CacheEntryList *&aList, CacheEntry *&aPrevEntry);
     CacheEntry *NewCacheEntry(bool aSnoopedEntry);
+    void        FreeCacheEntry(CacheEntry &aEntry);
+    void        AddToHashIndex(CacheEntry &aEntry);
+    void        RemoveFromHashIndex(CacheEntry &aEntry);
     void        RemoveCacheEntry(CacheEntry &aEntry, CacheEntryList &aList, CacheEntry *aPrevEntry, Reason aReason);
     Error       UpdateCacheEntry(const Ip6::Address &aEid, Mac::ShortAddress aRloc16);
     Error       SendAddressQuery(const Ip6::Address &aEid);
@@ -376,13 +423,24 @@ private:
     const char *ListToString(const CacheEntryList *aList) const;
 
     static AddressResolver::CacheEntry *GetEntryAfter(CacheEntry *aPrev, CacheEntryList &aList);
+    static uint32_t                     CalculateHash(const Ip6::Address &aEid);
 
-    CacheEntryPool     mCacheEntryPool;
-    CacheEntryList     mCachedList;
-    CacheEntryList     mSnoopedList;
-    CacheEntryList     mQueryList;
-    CacheEntryList     mQueryRetryList;
-    Ip6::Icmp::Handler mIcmpHandler;
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_FLOW_CACHE_ENABLE
+    void IncrementCacheGeneration(void) { mCacheGeneration++; }
+#else
+    void IncrementCacheGeneration(void) {}
+#endif
+
+    CacheEntryPool      mCacheEntryPool;
+    CacheEntryHashIndex mCacheEntryHashIndex;
+    CacheEntryList      mCachedList;
+    CacheEntryList      mSnoopedList;
+    CacheEntryList      mQueryList;
+    CacheEntryList      mQueryRetryList;
+    Ip6::Icmp::Handler  mIcmpHandler;
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_FLOW_CACHE_ENABLE
+    uint32_t mCacheGeneration;
+#endif
 
 #endif // OPENTHREAD_FTD
 };
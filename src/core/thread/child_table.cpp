@@ -76,6 +76,9 @@ exit:
 ChildTable::ChildTable(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mMaxChildrenAllowed(kMaxChildren)
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_FLOW_CACHE_ENABLE
+    , mGeneration(0)
+#endif
 {
     for (Child &child : mChildren)
     {
@@ -116,13 +119,36 @@ exit:
 
 const Child *ChildTable::FindChild(const Child::AddressMatcher &aMatcher) const
 {
+    // Uses the Child ID or the Extended Address index when the
+    // matcher specifies an address and its state filter rejects
+    // `kStateInvalid` (unused entries are not indexed), otherwise
+    // scans the table.
+
     const Child *child = mChildren;
 
-    for (uint16_t num = mMaxChildrenAllowed; num != 0; num--, child++)
+    if (IsIndexed(aMatcher.mStateFilter) && (aMatcher.mShortAddress != Mac::kShortAddrInvalid))
+    {
+        for (uint16_t index = mChildIdIndex.GetFirst(Mle::ChildIdFromRloc16(aMatcher.mShortAddress));
+             index != ChildIdIndex::kInvalidIndex; index = mChildIdIndex.GetNext(index))
+        {
+            child = &mChildren[index];
+            VerifyOrExit(!child->Matches(aMatcher));
+        }
+    }
+    else if (IsIndexed(aMatcher.mStateFilter) && (aMatcher.mExtAddress != nullptr))
+    {
+        for (uint16_t index = mExtAddressIndex.GetFirst(CalculateHash(*aMatcher.mExtAddress));
+             index != ExtAddressIndex::kInvalidIndex; index = mExtAddressIndex.GetNext(index))
+        {
+            child = &mChildren[index];
+            VerifyOrExit(!child->Matches(aMatcher));
+        }
+    }
+    else
     {
-        if (child->Matches(aMatcher))
+        for (uint16_t num = mMaxChildrenAllowed; num != 0; num--, child++)
         {
-            ExitNow();
+            VerifyOrExit(!child->Matches(aMatcher));
         }
     }
 
@@ -147,6 +173,112 @@ Child *ChildTable::FindChild(const Mac::Address &aMacAddress, Child::StateFilter
     return FindChild(Child::AddressMatcher(aMacAddress, aFilter));
 }
 
+Child *ChildTable::FindChild(const Ip6::Address &aIp6Address, Child::StateFilter aFilter)
+{
+    return AsNonConst(AsConst(this)->FindChild(aIp6Address, aFilter, /* aSleepyOnly */ false));
+}
+
+const Child *ChildTable::FindChild(const Ip6::Address &aIp6Address, Child::StateFilter aFilter, bool aSleepyOnly) const
+{
+    const Child *child = nullptr;
+
+    if (IsIndexed(aFilter))
+    {
+        for (uint16_t index = mIp6AddressIndex.GetFirst(CalculateHash(aIp6Address));
+             index != Ip6AddressIndex::kInvalidIndex; index = mIp6AddressIndex.GetNext(index))
+        {
+            child = &mChildren[index / kNumIp6AddressSlots];
+            VerifyOrExit(!MatchesIp6Address(*child, aIp6Address, aFilter, aSleepyOnly));
+        }
+    }
+    else
+    {
+        child = mChildren;
+
+        for (uint16_t num = mMaxChildrenAllowed; num != 0; num--, child++)
+        {
+            VerifyOrExit(!MatchesIp6Address(*child, aIp6Address, aFilter, aSleepyOnly));
+        }
+    }
+
+    child = nullptr;
+
+exit:
+    return child;
+}
+
+void ChildTable::UpdateIndexes(const Child &aChild)
+{
+    uint16_t index     = GetChildIndex(aChild);
+    uint16_t slotIndex = index * kNumIp6AddressSlots;
+
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_FLOW_CACHE_ENABLE
+    mGeneration++;
+#endif
+
+    mChildIdIndex.Remove(index);
+    mExtAddressIndex.Remove(index);
+
+    for (uint16_t slot = 0; slot < kNumIp6AddressSlots; slot++)
+    {
+        mIp6AddressIndex.Remove(slotIndex + slot);
+    }
+
+    VerifyOrExit(!aChild.IsStateInvalid());
+
+    mChildIdIndex.Add(index, Mle::ChildIdFromRloc16(aChild.GetRloc16()));
+    mExtAddressIndex.Add(index, CalculateHash(aChild.GetExtAddress()));
+
+    for (const Ip6::Address &address : aChild.IterateIp6Addresses())
+    {
+        OT_ASSERT(slotIndex < (index + 1) * kNumIp6AddressSlots);
+        mIp6AddressIndex.Add(slotIndex++, CalculateHash(address));
+    }
+
+exit:
+    return;
+}
+
+bool ChildTable::IsIndexed(Child::StateFilter aFilter)
+{
+    // Indicates whether the filter rejects `kStateInvalid`, i.e.,
+    // whether all matching children are in the lookup indexes.
+
+    bool isIndexed = true;
+
+    switch (aFilter)
+    {
+    case Child::kInStateInvalid:
+    case Child::kInStateAnyExceptValidOrRestoring:
+    case Child::kInStateAny:
+        isIndexed = false;
+        break;
+    default:
+        break;
+    }
+
+    return isIndexed;
+}
+
+bool ChildTable::MatchesIp6Address(const Child        &aChild,
+                                   const Ip6::Address &aIp6Address,
+                                   Child::StateFilter  aFilter,
+                                   bool                aSleepyOnly)
+{
+    return aChild.MatchesFilter(aFilter) && !(aSleepyOnly && aChild.IsRxOnWhenIdle()) &&
+           aChild.HasIp6Address(aIp6Address);
+}
+
+uint32_t ChildTable::CalculateHash(const Mac::ExtAddress &aExtAddress)
+{
+    return ExtAddressIndex::CalculateHash(aExtAddress.m8, sizeof(aExtAddress));
+}
+
+uint32_t ChildTable::CalculateHash(const Ip6::Address &aIp6Address)
+{
+    return Ip6AddressIndex::CalculateHash(aIp6Address.GetIid().GetBytes(), sizeof(Ip6::InterfaceIdentifier));
+}
+
 bool ChildTable::HasChildren(Child::StateFilter aFilter) const
 {
     return (FindChild(Child::AddressMatcher(aFilter)) != nullptr);
@@ -316,19 +448,7 @@ exit:
 
 bool ChildTable::HasSleepyChildWithAddress(const Ip6::Address &aIp6Address) const
 {
-    bool         hasChild = false;
-    const Child *child    = &mChildren[0];
-
-    for (uint16_t num = mMaxChildrenAllowed; num != 0; num--, child++)
-    {
-        if (child->IsStateValidOrRestoring() && !child->IsRxOnWhenIdle() && child->HasIp6Address(aIp6Address))
-        {
-            hasChild = true;
-            break;
-        }
-    }
-
-    return hasChild;
+    return FindChild(aIp6Address, Child::kInStateValidOrRestoring, /* aSleepyOnly */ true) != nullptr;
 }
 
 } // namespace ot
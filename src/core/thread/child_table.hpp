@@ -39,6 +39,7 @@
 #if OPENTHREAD_FTD
 
 #include "common/const_cast.hpp"
+#include "common/hash_index.hpp"
 #include "common/iterator_utils.hpp"
 #include "common/locator.hpp"
 #include "common/non_copyable.hpp"
@@ -180,6 +181,17 @@ public:
      */
     Child *FindChild(const Mac::Address &aMacAddress, Child::StateFilter aFilter);
 
+    /**
+     * Searches the child table for a `Child` with a given registered IPv6 address also matching a given state filter.
+     *
+     * @param[in]  aIp6Address  A reference to an IPv6 address.
+     * @param[in]  aFilter      A child state filter.
+     *
+     * @returns  A pointer to the `Child` entry if one is found, or `nullptr` otherwise.
+     *
+     */
+    Child *FindChild(const Ip6::Address &aIp6Address, Child::StateFilter aFilter);
+
     /**
      * Indicates whether the child table contains any child matching a given state filter.
      *
@@ -320,9 +332,47 @@ public:
         return (mChildren <= child) && (child < GetArrayEnd(mChildren));
     }
 
+    /**
+     * Updates the lookup indexes for a given `Child` entry in the child table.
+     *
+     * MUST be called whenever the state, the RLOC16, the Extended Address, or the registered IPv6 addresses of a
+     * `Child` entry are changed. `Neighbor` and `Child` methods changing these call it.
+     *
+     * @param[in]  aChild  A reference to a `Child` entry in the child table.
+     *
+     */
+    void UpdateIndexes(const Child &aChild);
+
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_FLOW_CACHE_ENABLE
+    /**
+     * Returns the generation of the child table.
+     *
+     * The generation changes whenever the state, the RLOC16, the Extended Address, or the registered IPv6 addresses
+     * of a `Child` entry change.
+     *
+     * @returns The generation of the child table.
+     *
+     */
+    uint32_t GetGeneration(void) const { return mGeneration; }
+#endif
+
 private:
     static constexpr uint16_t kMaxChildren = OPENTHREAD_CONFIG_MLE_MAX_CHILDREN;
 
+    // Children in `kStateInvalid` are not indexed. A child is added
+    // to `mChildIdIndex` with its Child ID as the hash value (so the
+    // bucket array is a direct Child ID to child index map). Each
+    // child uses `kNumIp6AddressSlots` consecutive entries in
+    // `mIp6AddressIndex` (one per registered address), which are
+    // hashed on the address IID so that a mesh-local prefix change
+    // does not require re-indexing.
+
+    static constexpr uint16_t kNumIp6AddressSlots = OPENTHREAD_CONFIG_MLE_IP_ADDRS_PER_CHILD;
+
+    typedef HashIndex<kMaxChildren, Mle::kMaxChildId + 1> ChildIdIndex;
+    typedef HashIndex<kMaxChildren>                       ExtAddressIndex;
+    typedef HashIndex<kMaxChildren * kNumIp6AddressSlots> Ip6AddressIndex;
+
     class IteratorBuilder : public InstanceLocator
     {
     public:
@@ -342,10 +392,25 @@ private:
     Child *FindChild(const Child::AddressMatcher &aMatcher) { return AsNonConst(AsConst(this)->FindChild(aMatcher)); }
 
     const Child *FindChild(const Child::AddressMatcher &aMatcher) const;
+    const Child *FindChild(const Ip6::Address &aIp6Address, Child::StateFilter aFilter, bool aSleepyOnly) const;
     void         RefreshStoredChildren(void);
 
+    static bool     IsIndexed(Child::StateFilter aFilter);
+    static bool     MatchesIp6Address(const Child        &aChild,
+                                      const Ip6::Address &aIp6Address,
+                                      Child::StateFilter  aFilter,
+                                      bool                aSleepyOnly);
+    static uint32_t CalculateHash(const Mac::ExtAddress &aExtAddress);
+    static uint32_t CalculateHash(const Ip6::Address &aIp6Address);
+
     uint16_t mMaxChildrenAllowed;
-    Child    mChildren[kMaxChildren];
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_FLOW_CACHE_ENABLE
+    uint32_t mGeneration;
+#endif
+    ChildIdIndex    mChildIdIndex;
+    ExtAddressIndex mExtAddressIndex;
+    Ip6AddressIndex mIp6AddressIndex;
+    Child           mChildren[kMaxChildren];
 };
 
 } // namespace ot
@@ -191,7 +191,7 @@ void EnergyScanServer::SendReport(void)
 
     // Update the Energy List TLV length in Report message
     offset = mReportMessage->GetLength() - mNumScanResults - sizeof(uint8_t);
-    mReportMessage->Write(offset, mNumScanResults);
+    SuccessOrExit(error = mReportMessage->Write(offset, mNumScanResults));
 
     messageInfo.SetSockAddrToRlocPeerAddrTo(mCommissioner);
 
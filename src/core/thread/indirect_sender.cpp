@@ -68,6 +68,7 @@ IndirectSender::IndirectSender(Instance &aInstance)
     , mCslTxScheduler(aInstance)
 #endif
 {
+    mQueueOverflowMask.Clear();
 }
 
 void IndirectSender::Stop(void)
@@ -86,6 +87,7 @@ void IndirectSender::Stop(void)
 #endif
 
 exit:
+    ClearAllChildQueues();
     mEnabled = false;
 }
 
@@ -99,6 +101,7 @@ void IndirectSender::AddMessageForSleepyChild(Message &aMessage, Child &aChild)
     VerifyOrExit(!aMessage.GetChildMask(childIndex));
 
     aMessage.SetChildMask(childIndex);
+    AddToChildQueue(aMessage, childIndex);
     mSourceMatchController.IncrementMessageCount(aChild);
 
     if ((aMessage.GetType() != Message::kTypeSupervision) && (aChild.GetIndirectMessageCount() > 1))
@@ -126,6 +129,7 @@ Error IndirectSender::RemoveMessageFromSleepyChild(Message &aMessage, Child &aCh
     VerifyOrExit(aMessage.GetChildMask(childIndex), error = kErrorNotFound);
 
     aMessage.ClearChildMask(childIndex);
+    RemoveFromChildQueue(aMessage, childIndex);
     mSourceMatchController.DecrementMessageCount(aChild);
 
     RequestMessageUpdate(aChild);
@@ -134,15 +138,73 @@ exit:
     return error;
 }
 
+void IndirectSender::RemoveMessageFromAllSleepyChildren(Message &aMessage)
+{
+    for (uint16_t childIndex = 0; childIndex < kMaxChildren; childIndex++)
+    {
+        Child *child;
+
+        if (!aMessage.GetChildMask(childIndex))
+        {
+            continue;
+        }
+
+        child = Get<ChildTable>().GetChildAtIndex(childIndex);
+
+        if ((child != nullptr) && !child->IsStateInvalid())
+        {
+            IgnoreError(RemoveMessageFromSleepyChild(aMessage, *child));
+        }
+        else
+        {
+            aMessage.ClearChildMask(childIndex);
+            RemoveFromChildQueue(aMessage, childIndex);
+        }
+    }
+}
+
+void IndirectSender::RemoveMessageFromChildQueues(Message &aMessage)
+{
+    for (uint16_t childIndex = 0; childIndex < kMaxChildren; childIndex++)
+    {
+        if (aMessage.GetChildMask(childIndex))
+        {
+            aMessage.ClearChildMask(childIndex);
+            RemoveFromChildQueue(aMessage, childIndex);
+        }
+    }
+}
+
+void IndirectSender::HandleMessagePriorityChange(Message &aMessage)
+{
+    // The message was moved to the tail of its new priority level in
+    // the send queue. Re-adding it to each child queue places it at
+    // the same position there.
+
+    for (uint16_t childIndex = 0; childIndex < kMaxChildren; childIndex++)
+    {
+        if (aMessage.GetChildMask(childIndex))
+        {
+            RemoveFromChildQueue(aMessage, childIndex);
+            AddToChildQueue(aMessage, childIndex);
+        }
+    }
+}
+
 void IndirectSender::ClearAllMessagesForSleepyChild(Child &aChild)
 {
+    uint16_t childIndex;
+    Message *message;
+
     VerifyOrExit(aChild.GetIndirectMessageCount() > 0);
 
-    for (Message &message : Get<MeshForwarder>().mSendQueue)
+    childIndex = Get<ChildTable>().GetChildIndex(aChild);
+
+    while ((message = PopFromChildQueue(childIndex)) != nullptr)
     {
-        message.ClearChildMask(Get<ChildTable>().GetChildIndex(aChild));
+        message->ClearChildMask(childIndex);
 
-        Get<MeshForwarder>().RemoveMessageIfNoPendingTx(message);
+        Get<MeshForwarder>().RemoveMessageIfNoPendingTx(*message);
     }
 
     aChild.SetIndirectMessage(nullptr);
@@ -180,14 +242,12 @@ void IndirectSender::HandleChildModeChange(Child &aChild, Mle::DeviceMode aOldMo
     if (!aOldMode.IsRxOnWhenIdle() && aChild.IsRxOnWhenIdle() && (aChild.GetIndirectMessageCount() > 0))
     {
         uint16_t childIndex = Get<ChildTable>().GetChildIndex(aChild);
+        Message *message;
 
-        for (Message &message : Get<MeshForwarder>().mSendQueue)
+        while ((message = PopFromChildQueue(childIndex)) != nullptr)
         {
-            if (message.GetChildMask(childIndex))
-            {
-                message.ClearChildMask(childIndex);
-                message.SetDirectTransmission();
-            }
+            message->ClearChildMask(childIndex);
+            message->SetDirectTransmission();
         }
 
         aChild.SetIndirectMessage(nullptr);
@@ -212,19 +272,158 @@ Message *IndirectSender::FindIndirectMessage(Child &aChild, bool aSupervisionTyp
     Message *msg        = nullptr;
     uint16_t childIndex = Get<ChildTable>().GetChildIndex(aChild);
 
-    for (Message &message : Get<MeshForwarder>().mSendQueue)
+    if (mQueueOverflowMask.Get(childIndex))
+    {
+        for (Message &message : Get<MeshForwarder>().mSendQueue)
+        {
+            if (message.GetChildMask(childIndex) &&
+                (!aSupervisionTypeOnly || (message.GetType() == Message::kTypeSupervision)))
+            {
+                msg = &message;
+                break;
+            }
+        }
+
+        // Once no message is left for the child in the send queue,
+        // switch back to using its indirect queue (which is empty).
+
+        if ((msg == nullptr) && !aSupervisionTypeOnly)
+        {
+            mQueueOverflowMask.Set(childIndex, false);
+        }
+
+        ExitNow();
+    }
+
+    for (QueueEntry &entry : mChildQueues[childIndex])
     {
-        if (message.GetChildMask(childIndex) &&
-            (!aSupervisionTypeOnly || (message.GetType() == Message::kTypeSupervision)))
+        if (!aSupervisionTypeOnly || (entry.mMessage->GetType() == Message::kTypeSupervision))
         {
-            msg = &message;
+            msg = entry.mMessage;
             break;
         }
     }
 
+exit:
     return msg;
 }
 
+void IndirectSender::AddToChildQueue(Message &aMessage, uint16_t aChildIndex)
+{
+    ChildQueue &queue = mChildQueues[aChildIndex];
+    QueueEntry *prev  = nullptr;
+    QueueEntry *entry;
+
+    VerifyOrExit(!mQueueOverflowMask.Get(aChildIndex));
+
+    entry = mQueueEntryPool.Allocate();
+
+    if (entry == nullptr)
+    {
+        // Fall back to scanning the send queue for this child until
+        // all its currently queued messages are sent or removed.
+
+        ClearChildQueue(aChildIndex);
+        mQueueOverflowMask.Set(aChildIndex, true);
+        ExitNow();
+    }
+
+    entry->mMessage = &aMessage;
+
+    // Keep the queue in the same order as the send queue, i.e., the
+    // new message goes after all messages with same or higher priority.
+
+    for (QueueEntry &cur : queue)
+    {
+        if (cur.mMessage->GetPriority() < aMessage.GetPriority())
+        {
+            break;
+        }
+
+        prev = &cur;
+    }
+
+    if (prev == nullptr)
+    {
+        queue.Push(*entry);
+    }
+    else
+    {
+        queue.PushAfter(*entry, *prev);
+    }
+
+exit:
+    return;
+}
+
+void IndirectSender::RemoveFromChildQueue(Message &aMessage, uint16_t aChildIndex)
+{
+    QueueEntry *entry = mChildQueues[aChildIndex].RemoveMatching(aMessage);
+
+    if (entry != nullptr)
+    {
+        mQueueEntryPool.Free(*entry);
+    }
+}
+
+Message *IndirectSender::PopFromChildQueue(uint16_t aChildIndex)
+{
+    // Removes and returns the first message for the child. The caller
+    // is expected to clear the child mask on the returned message.
+
+    Message    *message = nullptr;
+    QueueEntry *entry;
+
+    if (mQueueOverflowMask.Get(aChildIndex))
+    {
+        for (Message &msg : Get<MeshForwarder>().mSendQueue)
+        {
+            if (msg.GetChildMask(aChildIndex))
+            {
+                message = &msg;
+                break;
+            }
+        }
+
+        if (message == nullptr)
+        {
+            mQueueOverflowMask.Set(aChildIndex, false);
+        }
+
+        ExitNow();
+    }
+
+    entry = mChildQueues[aChildIndex].Pop();
+    VerifyOrExit(entry != nullptr);
+
+    message = entry->mMessage;
+    mQueueEntryPool.Free(*entry);
+
+exit:
+    return message;
+}
+
+void IndirectSender::ClearChildQueue(uint16_t aChildIndex)
+{
+    QueueEntry *entry;
+
+    while ((entry = mChildQueues[aChildIndex].Pop()) != nullptr)
+    {
+        mQueueEntryPool.Free(*entry);
+    }
+}
+
+void IndirectSender::ClearAllChildQueues(void)
+{
+    for (ChildQueue &queue : mChildQueues)
+    {
+        queue.Clear();
+    }
+
+    mQueueEntryPool.FreeAll();
+    mQueueOverflowMask.Clear();
+}
+
 void IndirectSender::RequestMessageUpdate(Child &aChild)
 {
     Message *curMessage = aChild.GetIndirectMessage();
@@ -533,6 +732,7 @@ void IndirectSender::HandleSentFrameToChild(const Mac::TxFrame &aFrame,
         if (message->GetChildMask(childIndex))
         {
             message->ClearChildMask(childIndex);
+            RemoveFromChildQueue(*message, childIndex);
             mSourceMatchController.DecrementMessageCount(aChild);
         }
 
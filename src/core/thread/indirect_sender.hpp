@@ -38,11 +38,14 @@
 
 #if OPENTHREAD_FTD
 
+#include "common/linked_list.hpp"
 #include "common/locator.hpp"
 #include "common/message.hpp"
 #include "common/non_copyable.hpp"
+#include "common/pool.hpp"
 #include "mac/data_poll_handler.hpp"
 #include "mac/mac_frame.hpp"
+#include "thread/child_mask.hpp"
 #include "thread/csl_tx_scheduler.hpp"
 #include "thread/indirect_sender_frame_context.hpp"
 #include "thread/mle_types.hpp"
@@ -60,6 +63,7 @@ namespace ot {
  */
 
 class Child;
+class IndirectSenderTester;
 
 /**
  * Implements indirect transmission.
@@ -72,6 +76,7 @@ class IndirectSender : public InstanceLocator, public IndirectSenderBase, privat
 #if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
     friend class CslTxScheduler::Callbacks;
 #endif
+    friend class IndirectSenderTester;
 
 public:
     /**
@@ -202,7 +207,61 @@ public:
      */
     void HandleChildModeChange(Child &aChild, Mle::DeviceMode aOldMode);
 
+    /**
+     * Removes a message from indirect transmission to all sleepy children it is queued for.
+     *
+     * @param[in] aMessage  The message to remove.
+     *
+     */
+    void RemoveMessageFromAllSleepyChildren(Message &aMessage);
+
+    /**
+     * Removes a message from the indirect queues of all sleepy children it is queued for, without updating the
+     * children.
+     *
+     * Unlike `RemoveMessageFromAllSleepyChildren()`, the source match entries of the children are not updated and no
+     * update of their indirect message is requested. MUST be called before freeing a message which is removed from
+     * the send queue while still queued for sleepy children.
+     *
+     * @param[in] aMessage  The message to remove.
+     *
+     */
+    void RemoveMessageFromChildQueues(Message &aMessage);
+
+    /**
+     * Handles a priority change of a message queued for indirect transmission.
+     *
+     * Moves the message within the indirect queue of each sleepy child it is queued for, so that the child queues
+     * keep the same order as the send queue.
+     *
+     * @param[in] aMessage  The message whose priority was changed.
+     *
+     */
+    void HandleMessagePriorityChange(Message &aMessage);
+
 private:
+    static constexpr uint16_t kMaxChildren     = OPENTHREAD_CONFIG_MLE_MAX_CHILDREN;
+    static constexpr uint16_t kNumQueueEntries = OPENTHREAD_CONFIG_NUM_INDIRECT_QUEUE_ENTRIES;
+
+    // Each sleepy child has its own indirect queue listing the messages
+    // (from the `MeshForwarder` send queue) that are destined to it, in
+    // the same order as they appear in the send queue. A message sent
+    // to multiple children (e.g., multicast) has one entry per child.
+    // The message `ChildMask` remains the authoritative record and the
+    // per-child queue mirrors it. If the entry pool runs out, the child
+    // is marked in `mQueueOverflowMask` and its indirect messages are
+    // looked up by scanning the send queue until its queue drains.
+
+    struct QueueEntry : public LinkedListEntry<QueueEntry>
+    {
+        bool Matches(const Message &aMessage) const { return mMessage == &aMessage; }
+
+        Message    *mMessage;
+        QueueEntry *mNext;
+    };
+
+    typedef LinkedList<QueueEntry> ChildQueue;
+
     // Callbacks from DataPollHandler
     Error PrepareFrameForChild(Mac::TxFrame &aFrame, FrameContext &aContext, Child &aChild);
     void  HandleSentFrameToChild(const Mac::TxFrame &aFrame, const FrameContext &aContext, Error aError, Child &aChild);
@@ -214,10 +273,18 @@ private:
     uint16_t PrepareDataFrame(Mac::TxFrame &aFrame, Child &aChild, Message &aMessage);
     void     PrepareEmptyFrame(Mac::TxFrame &aFrame, Child &aChild, bool aAckRequest);
     void     ClearMessagesForRemovedChildren(void);
-
-    bool                  mEnabled;
-    SourceMatchController mSourceMatchController;
-    DataPollHandler       mDataPollHandler;
+    void     AddToChildQueue(Message &aMessage, uint16_t aChildIndex);
+    void     RemoveFromChildQueue(Message &aMessage, uint16_t aChildIndex);
+    Message *PopFromChildQueue(uint16_t aChildIndex);
+    void     ClearChildQueue(uint16_t aChildIndex);
+    void     ClearAllChildQueues(void);
+
+    bool                               mEnabled;
+    ChildQueue                         mChildQueues[kMaxChildren];
+    Pool<QueueEntry, kNumQueueEntries> mQueueEntryPool;
+    ChildMask                          mQueueOverflowMask;
+    SourceMatchController              mSourceMatchController;
+    DataPollHandler                    mDataPollHandler;
 #if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
     CslTxScheduler mCslTxScheduler;
 #endif
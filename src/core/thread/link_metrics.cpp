@@ -504,7 +504,7 @@ Error Subject::AppendReport(Message &aMessage, const Message &aRequestMessage, N
     // Update the TLV length in message.
     length = aMessage.GetLength() - offset - sizeof(Tlv);
     tlv.SetLength(static_cast<uint8_t>(length));
-    aMessage.Write(offset, tlv);
+    SuccessOrExit(error = aMessage.Write(offset, tlv));
 
 exit:
     LogDebg("AppendReport, error:%s", ErrorToString(error));
@@ -155,6 +155,15 @@ void LinkQualityInfo::AddRss(int8_t aRss)
 
     SetLinkQuality(CalculateLinkQuality(GetLinkMargin(), oldLinkQuality));
 
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MESH_FORWARDER_FLOW_CACHE_ENABLE
+    if (GetLinkQuality() != oldLinkQuality)
+    {
+        // Link cost to the neighbor changed, which may change the
+        // next hop towards some destinations.
+        Get<RouterTable>().IncrementGeneration();
+    }
+#endif
+
 exit:
     return;
 }
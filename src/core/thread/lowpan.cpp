@@ -1029,7 +1029,7 @@ Error Lowpan::Decompress(Message              &aMessage,
             HostSwap16(aMessage.GetOffset() - currentOffset - sizeof(Ip6::Header) + aFrameData.GetLength());
     }
 
-    aMessage.Write(currentOffset + Ip6::Header::kPayloadLengthFieldOffset, ip6PayloadLength);
+    SuccessOrExit(error = aMessage.Write(currentOffset + Ip6::Header::kPayloadLengthFieldOffset, ip6PayloadLength));
 
     error = kErrorNone;
 
@@ -1064,7 +1064,7 @@ exit:
     return ecn;
 }
 
-void Lowpan::MarkCompressedEcn(Message &aMessage, uint16_t aOffset)
+Error Lowpan::MarkCompressedEcn(Message &aMessage, uint16_t aOffset)
 {
     uint8_t byte;
 
@@ -1074,7 +1074,7 @@ void Lowpan::MarkCompressedEcn(Message &aMessage, uint16_t aOffset)
     byte &= ~kEcnMask;
     byte |= static_cast<uint8_t>(Ip6::kEcnMarked << kEcnOffset);
 
-    aMessage.Write(aOffset, byte);
+    return aMessage.Write(aOffset, byte);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
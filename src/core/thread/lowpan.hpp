@@ -208,8 +208,11 @@ public:
      * @param[in,out] aMessage  The message containing the IPHC header and to update.
      * @param[in]     aOffset   The offset in @p aMessage to start of IPHC header.
      *
+     * @retval kErrorNone    Successfully updated the ECN field.
+     * @retval kErrorNoBufs  Failed to copy the buffers shared with a clone of @p aMessage.
+     *
      */
-    void MarkCompressedEcn(Message &aMessage, uint16_t aOffset);
+    Error MarkCompressedEcn(Message &aMessage, uint16_t aOffset);
 
 private:
     static constexpr uint16_t kHcDispatch     = 3 << 13;
@@ -108,6 +108,9 @@ MeshForwarder::MeshForwarder(Instance &aInstance)
     , mScheduleTransmissionTask(aInstance)
 #if OPENTHREAD_FTD
     , mIndirectSender(aInstance)
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_FLOW_CACHE_ENABLE
+    , mFlowCache(aInstance)
+#endif
 #endif
     , mDataPollSender(aInstance)
 {
@@ -143,10 +146,14 @@ void MeshForwarder::Stop(void)
 
     mSendQueue.DequeueAndFreeAll();
     mReassemblyList.DequeueAndFreeAll();
+    mReassemblyTable.Clear();
 
 #if OPENTHREAD_FTD
     mIndirectSender.Stop();
     mFragmentPriorityList.Clear();
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_FLOW_CACHE_ENABLE
+    mFlowCache.Clear();
+#endif
 #endif
 
 #if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MAC_COLLISION_AVOIDANCE_DELAY_ENABLE
@@ -194,10 +201,7 @@ void MeshForwarder::RemoveMessage(Message &aMessage)
     if (queue == &mSendQueue)
     {
 #if OPENTHREAD_FTD
-        for (Child &child : Get<ChildTable>().Iterate(Child::kInStateAnyExceptInvalid))
-        {
-            IgnoreError(mIndirectSender.RemoveMessageFromSleepyChild(aMessage, child));
-        }
+        mIndirectSender.RemoveMessageFromAllSleepyChildren(aMessage);
 #endif
 
         if (mSendMessage == &aMessage)
@@ -272,7 +276,7 @@ Error MeshForwarder::UpdateEcnOrDrop(Message &aMessage, bool aPreparingToSend)
             case Ip6::kEcnCapable0:
             case Ip6::kEcnCapable1:
                 ip6Header.SetEcn(Ip6::kEcnMarked);
-                aMessage.Write(0, ip6Header);
+                SuccessOrExit(error = aMessage.Write(0, ip6Header));
                 LogMessage(kMessageMarkEcn, aMessage);
                 break;
 
@@ -328,7 +332,7 @@ Error MeshForwarder::UpdateEcnOrDrop(Message &aMessage, bool aPreparingToSend)
                 {
                 case Ip6::kEcnCapable0:
                 case Ip6::kEcnCapable1:
-                    Get<Lowpan::Lowpan>().MarkCompressedEcn(aMessage, offset);
+                    SuccessOrExit(error = Get<Lowpan::Lowpan>().MarkCompressedEcn(aMessage, offset));
                     LogMessage(kMessageMarkEcn, aMessage);
                     break;
 
@@ -581,6 +585,9 @@ Message *MeshForwarder::PrepareNextDirectTransmission(void)
 
         default:
             LogMessage(kMessageDrop, *curMessage, error);
+#if OPENTHREAD_FTD
+            mIndirectSender.RemoveMessageFromAllSleepyChildren(*curMessage);
+#endif
             mSendQueue.DequeueAndFree(*curMessage);
             continue;
         }
@@ -1350,9 +1357,11 @@ void MeshForwarder::HandleFragment(FrameData            &aFrameData,
                                    const Mac::Addresses &aMacAddrs,
                                    const ThreadLinkInfo &aLinkInfo)
 {
-    Error                  error = kErrorNone;
-    Lowpan::FragmentHeader fragmentHeader;
-    Message               *message = nullptr;
+    Error                         error = kErrorNone;
+    Lowpan::FragmentHeader        fragmentHeader;
+    ReassemblyKey                 key;
+    LowpanReassemblyTable::Entry *entry   = nullptr;
+    Message                      *message = nullptr;
 
     SuccessOrExit(error = fragmentHeader.ParseFrom(aFrameData));
 
@@ -1375,13 +1384,12 @@ void MeshForwarder::HandleFragment(FrameData            &aFrameData,
                     VerifyOrExit(fragmentHeader.GetDatagramOffset() != 0, error = kErrorDuplicated);
 
                     // Duplication suppression for a "next fragment" is handled
-                    // by the code below where the the datagram offset is
-                    // checked against the offset of the corresponding message
-                    // (same datagram tag and size) in Reassembly List. Note
-                    // that if there is no matching message in the Reassembly
-                    // List (e.g., in case the message is already fully
-                    // assembled) the received "next fragment" frame would be
-                    // dropped.
+                    // by the code below where the received fragments of the
+                    // corresponding datagram (same source, datagram tag and
+                    // size) in the reassembly table are checked. Note that
+                    // if there is no matching datagram being reassembled
+                    // (e.g., in case the message is already fully assembled)
+                    // the received "next fragment" frame would be dropped.
                 }
             }
 
@@ -1391,9 +1399,17 @@ void MeshForwarder::HandleFragment(FrameData            &aFrameData,
 
 #endif // OPENTHREAD_CONFIG_MULTI_RADIO
 
+    key.mSource       = aMacAddrs.mSource;
+    key.mTag          = fragmentHeader.GetDatagramTag();
+    key.mSize         = fragmentHeader.GetDatagramSize();
+    key.mLinkSecurity = aLinkInfo.IsLinkSecurityEnabled();
+
     if (fragmentHeader.GetDatagramOffset() == 0)
     {
         uint16_t datagramSize = fragmentHeader.GetDatagramSize();
+        uint16_t fragmentLength;
+
+        VerifyOrExit(mReassemblyTable.Find(key) == nullptr, error = kErrorDuplicated);
 
 #if OPENTHREAD_FTD
         UpdateRoutes(aFrameData, aMacAddrs);
@@ -1401,7 +1417,8 @@ void MeshForwarder::HandleFragment(FrameData            &aFrameData,
 
         SuccessOrExit(error = FrameToMessage(aFrameData, datagramSize, aMacAddrs, message));
 
-        VerifyOrExit(datagramSize >= message->GetLength(), error = kErrorParse);
+        fragmentLength = message->GetLength();
+        VerifyOrExit(datagramSize >= fragmentLength, error = kErrorParse);
         SuccessOrExit(error = message->SetLength(datagramSize));
 
         message->SetDatagramTag(fragmentHeader.GetDatagramTag());
@@ -1423,55 +1440,89 @@ void MeshForwarder::HandleFragment(FrameData            &aFrameData,
             ClearReassemblyList();
         }
 
+        // If the reassembly table is full, drop the least recently
+        // updated datagram (at the head of the reassembly list).
+
+        if (mReassemblyTable.IsFull())
+        {
+            DropReassemblyMessage(*mReassemblyList.GetHead(), kErrorNoBufs);
+        }
+
+        entry = mReassemblyTable.Add(key, *message);
+        OT_ASSERT(entry != nullptr);
+
+        if ((entry->SetDatagramLength(datagramSize) != kErrorNone) ||
+            (entry->MarkReceived(0, fragmentLength) != kErrorNone))
+        {
+            mReassemblyTable.Remove(*entry);
+            ExitNow(error = kErrorParse);
+        }
+
         mReassemblyList.Enqueue(*message);
 
         Get<TimeTicker>().RegisterReceiver(TimeTicker::kMeshForwarder);
     }
     else // Received frame is a "next fragment".
     {
-        for (Message &msg : mReassemblyList)
-        {
-            // Security Check: only consider reassembly buffers that had the same Security Enabled setting.
-            if (msg.GetLength() == fragmentHeader.GetDatagramSize() &&
-                msg.GetDatagramTag() == fragmentHeader.GetDatagramTag() &&
-                msg.GetOffset() == fragmentHeader.GetDatagramOffset() &&
-                msg.GetOffset() + aFrameData.GetLength() <= fragmentHeader.GetDatagramSize() &&
-                msg.IsLinkSecurityEnabled() == aLinkInfo.IsLinkSecurityEnabled())
-            {
-                message = &msg;
-                break;
-            }
-        }
+        uint16_t offset = fragmentHeader.GetDatagramOffset();
+
+        // Security Check: only consider reassembly buffers that had the same
+        // Security Enabled setting (included in the key).
+
+        entry = mReassemblyTable.Find(key);
 
         // For a sleepy-end-device, if we receive a new (secure) next fragment
-        // with a non-matching fragmentation offset or tag, it indicates that
-        // we have either missed a fragment, or the parent has moved to a new
-        // message with a new tag. In either case, we can safely clear any
-        // remaining fragments stored in the reassembly list.
+        // with a non-matching tag, it indicates that we have either missed
+        // the first fragment, or the parent has moved to a new message with
+        // a new tag. In either case, we can safely clear any remaining
+        // fragments stored in the reassembly list.
 
-        if (!GetRxOnWhenIdle() && (message == nullptr) && aLinkInfo.IsLinkSecurityEnabled())
+        if (!GetRxOnWhenIdle() && (entry == nullptr) && aLinkInfo.IsLinkSecurityEnabled())
         {
             ClearReassemblyList();
         }
 
-        VerifyOrExit(message != nullptr, error = kErrorDrop);
+        VerifyOrExit(entry != nullptr, error = kErrorDrop);
+
+        // Fragments may be received out of order. A duplicate fragment
+        // is dropped, while a fragment extending past the end of the
+        // datagram or overlapping part of a received one invalidates
+        // the whole datagram (same as in `Ip6`).
+
+        error = entry->MarkReceived(offset, aFrameData.GetLength());
+
+        if ((error != kErrorNone) && (error != kErrorDuplicated))
+        {
+            DropReassemblyMessage(entry->GetMessage(), error);
+            ExitNow();
+        }
 
-        message->WriteData(message->GetOffset(), aFrameData);
-        message->MoveOffset(aFrameData.GetLength());
+        SuccessOrExit(error);
+
+        message = &entry->GetMessage();
+
+        message->WriteData(offset, aFrameData);
         message->AddRss(aLinkInfo.GetRss());
 #if OPENTHREAD_CONFIG_MLE_LINK_METRICS_SUBJECT_ENABLE
         message->AddLqi(aLinkInfo.GetLqi());
 #endif
         message->SetTimestampToNow();
+
+        // Keep the reassembly list ordered by last update time.
+
+        mReassemblyList.Dequeue(*message);
+        mReassemblyList.Enqueue(*message);
     }
 
 exit:
 
     if (error == kErrorNone)
     {
-        if (message->GetOffset() >= message->GetLength())
+        if (entry->IsComplete())
         {
+            mReassemblyTable.Remove(*entry);
             mReassemblyList.Dequeue(*message);
+            message->SetOffset(message->GetLength());
             IgnoreError(HandleDatagram(*message, aLinkInfo, aMacAddrs.mSource));
         }
     }
@@ -1483,18 +1534,24 @@ exit:
     }
 }
 
-void MeshForwarder::ClearReassemblyList(void)
+void MeshForwarder::DropReassemblyMessage(Message &aMessage, Error aError)
 {
-    for (Message &message : mReassemblyList)
+    LogMessage(kMessageReassemblyDrop, aMessage, aError);
+
+    if (aMessage.GetType() == Message::kTypeIp6)
     {
-        LogMessage(kMessageReassemblyDrop, message, kErrorNoFrameReceived);
+        mIpCounters.mRxFailure++;
+    }
 
-        if (message.GetType() == Message::kTypeIp6)
-        {
-            mIpCounters.mRxFailure++;
-        }
+    mReassemblyTable.Remove(aMessage);
+    mReassemblyList.DequeueAndFree(aMessage);
+}
 
-        mReassemblyList.DequeueAndFree(message);
+void MeshForwarder::ClearReassemblyList(void)
+{
+    for (Message &message : mReassemblyList)
+    {
+        DropReassemblyMessage(message, kErrorNoFrameReceived);
     }
 }
 
@@ -1518,24 +1575,68 @@ bool MeshForwarder::UpdateReassemblyList(void)
 {
     TimeMilli now = TimerMilli::GetNow();
 
+    // The reassembly list is ordered by last update time, so stop at
+    // the first message which has not timed out.
+
     for (Message &message : mReassemblyList)
     {
-        if (now - message.GetTimestamp() >= TimeMilli::SecToMsec(kReassemblyTimeout))
+        if (now - message.GetTimestamp() < TimeMilli::SecToMsec(kReassemblyTimeout))
         {
-            LogMessage(kMessageReassemblyDrop, message, kErrorReassemblyTimeout);
-
-            if (message.GetType() == Message::kTypeIp6)
-            {
-                mIpCounters.mRxFailure++;
-            }
-
-            mReassemblyList.DequeueAndFree(message);
+            break;
         }
+
+        DropReassemblyMessage(message, kErrorReassemblyTimeout);
     }
 
     return mReassemblyList.GetHead() != nullptr;
 }
 
+uint32_t MeshForwarder::ReassemblyKey::GetHash(void) const
+{
+    uint8_t  bytes[sizeof(Mac::ExtAddress) + 2 * sizeof(uint16_t)];
+    uint16_t length = 0;
+
+    if (mSource.IsExtended())
+    {
+        memcpy(bytes, mSource.GetExtended().m8, sizeof(Mac::ExtAddress));
+        length = sizeof(Mac::ExtAddress);
+    }
+    else
+    {
+        Encoding::BigEndian::WriteUint16(mSource.GetShort(), bytes);
+        length = sizeof(uint16_t);
+    }
+
+    Encoding::BigEndian::WriteUint16(mTag, &bytes[length]);
+    length += sizeof(uint16_t);
+    Encoding::BigEndian::WriteUint16(mSize, &bytes[length]);
+    length += sizeof(uint16_t);
+
+    return HashIndex<kNumReassemblyEntries>::CalculateHash(bytes, length);
+}
+
+bool MeshForwarder::ReassemblyKey::operator==(const ReassemblyKey &aOther) const
+{
+    bool matches = false;
+
+    VerifyOrExit((mTag == aOther.mTag) && (mSize == aOther.mSize) && (mLinkSecurity == aOther.mLinkSecurity));
+    VerifyOrExit(mSource.GetType() == aOther.mSource.GetType());
+
+    if (mSource.IsExtended())
+    {
+        VerifyOrExit(mSource.GetExtended() == aOther.mSource.GetExtended());
+    }
+    else if (mSource.IsShort())
+    {
+        VerifyOrExit(mSource.GetShort() == aOther.mSource.GetShort());
+    }
+
+    matches = true;
+
+exit:
+    return matches;
+}
+
 Error MeshForwarder::FrameToMessage(const FrameData      &aFrameData,
                                     uint16_t              aDatagramSize,
                                     const Mac::Addresses &aMacAddrs,
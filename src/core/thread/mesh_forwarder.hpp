@@ -36,6 +36,8 @@
 
 #include "openthread-core-config.h"
 
+#include <openthread/thread_ftd.h>
+
 #include "common/as_core_type.hpp"
 #include "common/clearable.hpp"
 #include "common/frame_data.hpp"
@@ -49,6 +51,7 @@
 #include "mac/mac.hpp"
 #include "mac/mac_frame.hpp"
 #include "net/ip6.hpp"
+#include "net/reassembly_table.hpp"
 #include "thread/address_resolver.hpp"
 #include "thread/indirect_sender.hpp"
 #include "thread/lowpan.hpp"
@@ -311,6 +314,31 @@ public:
      */
     void ResetCounters(void) { memset(&mIpCounters, 0, sizeof(mIpCounters)); }
 
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MESH_FORWARDER_FLOW_CACHE_ENABLE
+    /**
+     * Clears all entries in the forwarding flow cache.
+     *
+     * Is used when a change that is not tracked by the flow cache (e.g., a new Mesh Local Prefix) may change the
+     * route towards a destination.
+     *
+     */
+    void ClearFlowCache(void) { mFlowCache.Clear(); }
+
+    /**
+     * Returns a reference to the forwarding flow cache counters.
+     *
+     * @returns A reference to the flow cache counters.
+     *
+     */
+    const otFlowCacheCounters &GetFlowCacheCounters(void) const { return mFlowCache.GetCounters(); }
+
+    /**
+     * Resets the forwarding flow cache counters.
+     *
+     */
+    void ResetFlowCacheCounters(void) { mFlowCache.ResetCounters(); }
+#endif
+
 #if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
     /**
      * Handles a deferred ack.
@@ -342,6 +370,9 @@ private:
 
     static constexpr uint32_t kTxDelayInterval = OPENTHREAD_CONFIG_MAC_COLLISION_AVOIDANCE_DELAY_INTERVAL; // In msec
 
+    static constexpr uint16_t kNumReassemblyEntries      = OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_MAX_DATAGRAMS;
+    static constexpr uint16_t kMaxReassemblyDatagramSize = 0x7ff; // Max Datagram Size in a 6LoWPAN Fragment Header.
+
 #if OPENTHREAD_CONFIG_DELAY_AWARE_QUEUE_MANAGEMENT_ENABLE
     static constexpr uint32_t kTimeInQueueMarkEcn = OPENTHREAD_CONFIG_DELAY_AWARE_QUEUE_MANAGEMENT_MARK_ECN_INTERVAL;
     static constexpr uint32_t kTimeInQueueDropMsg = OPENTHREAD_CONFIG_DELAY_AWARE_QUEUE_MANAGEMENT_DROP_MSG_INTERVAL;
@@ -371,6 +402,29 @@ private:
         kAnycastService,
     };
 
+    enum FlowType : uint8_t
+    {
+        kFlowNone,       // The route towards the destination is not cacheable.
+        kFlowToLocator,  // The destination is an RLOC.
+        kFlowToNeighbor, // The destination is an address of a neighbor.
+        kFlowResolved,   // The destination is an on-mesh address resolved from the address cache.
+        kFlowRouted,     // The destination is off-mesh, routed to a border router based on the IPv6 source.
+    };
+
+    // Identifies a datagram being reassembled from 6LoWPAN fragments.
+    struct ReassemblyKey
+    {
+        uint32_t GetHash(void) const;
+        bool     operator==(const ReassemblyKey &aOther) const;
+
+        Mac::Address mSource;
+        uint16_t     mTag;
+        uint16_t     mSize;
+        bool         mLinkSecurity;
+    };
+
+    typedef ReassemblyTable<ReassemblyKey, kNumReassemblyEntries, kMaxReassemblyDatagramSize> LowpanReassemblyTable;
+
 #if OPENTHREAD_FTD
     class FragmentPriorityList : public Clearable<FragmentPriorityList>
     {
@@ -430,6 +484,49 @@ private:
 
         Entry mEntries[kNumEntries];
     };
+
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_FLOW_CACHE_ENABLE
+    // `FlowCache` memoizes the mesh destination and next hop determined
+    // for recent IPv6 destinations. It is direct-mapped on a hash of
+    // the destination. Each entry records the sum of the generations of
+    // the router table, the child table, the Network Data and the
+    // address cache at the time it is added. As the generations only
+    // ever increase, an entry is stale as soon as the sum changes.
+
+    class FlowCache : public InstanceLocator
+    {
+    public:
+        explicit FlowCache(Instance &aInstance);
+
+        Error Find(const Ip6::Header &aIp6Header, uint16_t &aMeshDest, uint16_t &aNextHop);
+        void  Add(const Ip6::Header &aIp6Header, FlowType aType, uint16_t aMeshDest, uint16_t aNextHop);
+        void  Clear(void);
+
+        const otFlowCacheCounters &GetCounters(void) const { return mCounters; }
+        void                       ResetCounters(void) { memset(&mCounters, 0, sizeof(mCounters)); }
+
+    private:
+        static constexpr uint16_t kNumEntries = OPENTHREAD_CONFIG_MESH_FORWARDER_FLOW_CACHE_SIZE;
+
+        struct Entry : public Clearable<Entry>
+        {
+            Ip6::Address mDestination;
+            Ip6::Address mSource; // Used only for `kFlowRouted` entries.
+            uint32_t     mGeneration;
+            uint16_t     mMeshSource;
+            uint16_t     mMeshDest;
+            uint16_t     mNextHop;
+            FlowType     mType;
+        };
+
+        Entry   &GetEntry(const Ip6::Address &aDestination);
+        uint32_t GetGeneration(void) const;
+
+        Entry               mEntries[kNumEntries];
+        otFlowCacheCounters mCounters;
+    };
+#endif
+
 #endif // OPENTHREAD_FTD
 
     void     SendIcmpErrorIfDstUnreach(const Message &aMessage, const Mac::Addresses &aMacAddrs);
@@ -475,6 +572,7 @@ private:
     void  SendDestinationUnreachable(uint16_t aMeshSource, const Ip6::Headers &aIp6Headers);
     Error UpdateIp6Route(Message &aMessage);
     Error UpdateIp6RouteFtd(Ip6::Header &ip6Header, Message &aMessage);
+    void  UpdateMacDestination(Message &aMessage, uint16_t aNextHop);
     void  EvaluateRoutingCost(uint16_t aDest, uint8_t &aBestCost, uint16_t &aBestDest) const;
     Error AnycastRouteLookup(uint8_t aServiceId, AnycastType aType, uint16_t &aMeshDest) const;
     Error UpdateMeshRoute(Message &aMessage);
@@ -485,6 +583,7 @@ private:
                                  Message::Priority       aPriority);
     Error HandleDatagram(Message &aMessage, const ThreadLinkInfo &aLinkInfo, const Mac::Address &aMacSource);
     void  ClearReassemblyList(void);
+    void  DropReassemblyMessage(Message &aMessage, Error aError);
     void  RemoveMessage(Message &aMessage);
     void  HandleDiscoverComplete(void);
 
@@ -574,10 +673,11 @@ private:
     using TxDelayTimer = TimerMilliIn<MeshForwarder, &MeshForwarder::HandleTxDelayTimer>;
 #endif
 
-    PriorityQueue mSendQueue;
-    MessageQueue  mReassemblyList;
-    uint16_t      mFragTag;
-    uint16_t      mMessageNextOffset;
+    PriorityQueue         mSendQueue;
+    MessageQueue          mReassemblyList;
+    LowpanReassemblyTable mReassemblyTable;
+    uint16_t              mFragTag;
+    uint16_t              mMessageNextOffset;
 
     Message *mSendMessage;
 
@@ -600,6 +700,9 @@ private:
 #if OPENTHREAD_FTD
     FragmentPriorityList mFragmentPriorityList;
     IndirectSender       mIndirectSender;
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_FLOW_CACHE_ENABLE
+    FlowCache mFlowCache;
+#endif
 #endif
 
     DataPollSender mDataPollSender;
@@ -183,7 +183,12 @@ void MeshForwarder::HandleResolved(const Ip6::Address &aEid, Error aError)
             // Avoid decreasing Hop Limit twice
             IgnoreError(message.Read(Ip6::Header::kHopLimitFieldOffset, hopLimit));
             hopLimit++;
-            message.Write(Ip6::Header::kHopLimitFieldOffset, hopLimit);
+
+            if (message.Write(Ip6::Header::kHopLimitFieldOffset, hopLimit) != kErrorNone)
+            {
+                message.Free();
+                continue;
+            }
 
             IgnoreError(Get<Ip6::Ip6>().HandleDatagram(message, Ip6::Ip6::kFromHostAllowLoopBack));
             continue;
@@ -329,10 +334,11 @@ void MeshForwarder::RemoveDataResponseMessages(void)
 
         if (!(ip6Header.GetDestination().IsMulticast()))
         {
-            for (Child &child : Get<ChildTable>().Iterate(Child::kInStateAnyExceptInvalid))
-            {
-                IgnoreError(mIndirectSender.RemoveMessageFromSleepyChild(message, child));
-            }
+            mIndirectSender.RemoveMessageFromAllSleepyChildren(message);
+        }
+        else
+        {
+            mIndirectSender.RemoveMessageFromChildQueues(message);
         }
 
         if (mSendMessage == &message)
@@ -500,19 +506,34 @@ exit:
 
 Error MeshForwarder::UpdateIp6RouteFtd(Ip6::Header &ip6Header, Message &aMessage)
 {
-    Mle::MleRouter &mle   = Get<Mle::MleRouter>();
-    Error           error = kErrorNone;
+    Mle::MleRouter &mle      = Get<Mle::MleRouter>();
+    Error           error    = kErrorNone;
+    FlowType        flowType = kFlowNone;
     Neighbor       *neighbor;
+    uint16_t        nextHop;
 
     if (aMessage.GetOffset() > 0)
     {
         mMeshDest = aMessage.GetMeshDest();
     }
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_FLOW_CACHE_ENABLE
+    else if (!mle.IsAnycastLocator(ip6Header.GetDestination()) &&
+             (mFlowCache.Find(ip6Header, mMeshDest, nextHop) == kErrorNone))
+    {
+        // The reachability check is still done on a hit as it also
+        // depends on the unicast addresses of this device, which the
+        // flow cache does not track.
+        mMeshSource = Get<Mac::Mac>().GetShortAddress();
+        SuccessOrExit(error = mle.CheckReachability(mMeshDest, ip6Header));
+        ExitNow(UpdateMacDestination(aMessage, nextHop));
+    }
+#endif
     else if (mle.IsRoutingLocator(ip6Header.GetDestination()))
     {
         uint16_t rloc16 = ip6Header.GetDestination().GetIid().GetLocator();
         VerifyOrExit(mle.IsRouterIdValid(Mle::RouterIdFromRloc16(rloc16)), error = kErrorDrop);
         mMeshDest = rloc16;
+        flowType  = kFlowToLocator;
     }
     else if (mle.IsAnycastLocator(ip6Header.GetDestination()))
     {
@@ -558,15 +579,17 @@ Error MeshForwarder::UpdateIp6RouteFtd(Ip6::Header &ip6Header, Message &aMessage
     else if ((neighbor = Get<NeighborTable>().FindNeighbor(ip6Header.GetDestination())) != nullptr)
     {
         mMeshDest = neighbor->GetRloc16();
+        flowType  = kFlowToNeighbor;
     }
     else if (Get<NetworkData::Leader>().IsOnMesh(ip6Header.GetDestination()))
     {
         SuccessOrExit(error = Get<AddressResolver>().Resolve(ip6Header.GetDestination(), mMeshDest));
+        flowType = kFlowResolved;
     }
-    else
+    else if (Get<NetworkData::Leader>().RouteLookup(ip6Header.GetSource(), ip6Header.GetDestination(), mMeshDest) ==
+             kErrorNone)
     {
-        IgnoreError(
-            Get<NetworkData::Leader>().RouteLookup(ip6Header.GetSource(), ip6Header.GetDestination(), mMeshDest));
+        flowType = kFlowRouted;
     }
 
     VerifyOrExit(mMeshDest != Mac::kShortAddrInvalid, error = kErrorDrop);
@@ -574,10 +597,30 @@ Error MeshForwarder::UpdateIp6RouteFtd(Ip6::Header &ip6Header, Message &aMessage
     mMeshSource = Get<Mac::Mac>().GetShortAddress();
 
     SuccessOrExit(error = mle.CheckReachability(mMeshDest, ip6Header));
+    nextHop = mle.GetNextHop(mMeshDest);
+    UpdateMacDestination(aMessage, nextHop);
+
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_FLOW_CACHE_ENABLE
+    // The reachability of this device as mesh destination depends on
+    // its own unicast addresses which the flow cache does not track.
+    if ((flowType != kFlowNone) && (mMeshDest != mMeshSource))
+    {
+        mFlowCache.Add(ip6Header, flowType, mMeshDest, nextHop);
+    }
+#else
+    OT_UNUSED_VARIABLE(flowType);
+#endif
+
+exit:
+    return error;
+}
+
+void MeshForwarder::UpdateMacDestination(Message &aMessage, uint16_t aNextHop)
+{
     aMessage.SetMeshDest(mMeshDest);
-    mMacAddrs.mDestination.SetShort(mle.GetNextHop(mMeshDest));
+    mMacAddrs.mDestination.SetShort(aNextHop);
 
-    if (mMacAddrs.mDestination.GetShort() != mMeshDest)
+    if (aNextHop != mMeshDest)
     {
         // destination is not neighbor
         mMacAddrs.mSource.SetShort(mMeshSource);
@@ -586,9 +629,6 @@ Error MeshForwarder::UpdateIp6RouteFtd(Ip6::Header &ip6Header, Message &aMessage
         mDelayNextTx = true;
 #endif
     }
-
-exit:
-    return error;
 }
 
 void MeshForwarder::SendIcmpErrorIfDstUnreach(const Message &aMessage, const Mac::Addresses &aMacAddrs)
@@ -917,6 +957,113 @@ exit:
     }
 }
 
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_FLOW_CACHE_ENABLE
+
+MeshForwarder::FlowCache::FlowCache(Instance &aInstance)
+    : InstanceLocator(aInstance)
+{
+    Clear();
+    ResetCounters();
+}
+
+void MeshForwarder::FlowCache::Clear(void)
+{
+    for (Entry &entry : mEntries)
+    {
+        entry.Clear();
+    }
+}
+
+Error MeshForwarder::FlowCache::Find(const Ip6::Header &aIp6Header, uint16_t &aMeshDest, uint16_t &aNextHop)
+{
+    Error  error = kErrorNotFound;
+    Entry &entry = GetEntry(aIp6Header.GetDestination());
+
+    VerifyOrExit(entry.mType != kFlowNone);
+    VerifyOrExit(entry.mDestination == aIp6Header.GetDestination());
+    VerifyOrExit((entry.mType != kFlowRouted) || (entry.mSource == aIp6Header.GetSource()));
+
+    if ((entry.mGeneration != GetGeneration()) || (entry.mMeshSource != Get<Mac::Mac>().GetShortAddress()))
+    {
+        entry.Clear();
+        mCounters.mStale++;
+        ExitNow();
+    }
+
+    if (entry.mType == kFlowResolved)
+    {
+        Mac::ShortAddress rloc16;
+
+        // Resolve again so that the address cache entry is refreshed
+        // (moved to the head of the cached list) as if the flow cache
+        // was not used. As the generation is unchanged, this finds the
+        // same RLOC16.
+        SuccessOrExit(Get<AddressResolver>().Resolve(aIp6Header.GetDestination(), rloc16));
+    }
+
+    aMeshDest = entry.mMeshDest;
+    aNextHop  = entry.mNextHop;
+    error     = kErrorNone;
+
+exit:
+    if (error == kErrorNone)
+    {
+        mCounters.mHits++;
+    }
+    else
+    {
+        mCounters.mMisses++;
+    }
+
+    return error;
+}
+
+void MeshForwarder::FlowCache::Add(const Ip6::Header &aIp6Header,
+                                   FlowType           aType,
+                                   uint16_t           aMeshDest,
+                                   uint16_t           aNextHop)
+{
+    Entry &entry = GetEntry(aIp6Header.GetDestination());
+
+    entry.mDestination = aIp6Header.GetDestination();
+    entry.mSource      = aIp6Header.GetSource();
+    entry.mGeneration  = GetGeneration();
+    entry.mMeshSource  = Get<Mac::Mac>().GetShortAddress();
+    entry.mMeshDest    = aMeshDest;
+    entry.mNextHop     = aNextHop;
+    entry.mType        = aType;
+}
+
+MeshForwarder::FlowCache::Entry &MeshForwarder::FlowCache::GetEntry(const Ip6::Address &aDestination)
+{
+    // Fold the address into 32 bits and use the high-order bits of a
+    // multiplicative (Fibonacci) hash of it to select the entry.
+
+    static constexpr uint32_t kMultiplier = 2654435769UL;
+
+    uint32_t hash = 0;
+
+    for (uint32_t word : aDestination.mFields.m32)
+    {
+        hash ^= word;
+    }
+
+    hash *= kMultiplier;
+
+    return mEntries[(hash >> 16) % kNumEntries];
+}
+
+uint32_t MeshForwarder::FlowCache::GetGeneration(void) const
+{
+    // All the generations only ever increase, so their sum changes
+    // whenever any one of them does.
+
+    return Get<RouterTable>().GetGeneration() + Get<ChildTable>().GetGeneration() +
+           Get<NetworkData::Leader>().GetGeneration() + Get<AddressResolver>().GetCacheGeneration();
+}
+
+#endif // OPENTHREAD_CONFIG_MESH_FORWARDER_FLOW_CACHE_ENABLE
+
 // LCOV_EXCL_START
 
 #if OT_SHOULD_LOG_AT(OT_LOG_LEVEL_NOTE)
@@ -925,6 +925,10 @@ void Mle::ApplyMeshLocalPrefix(void)
     mLinkLocalAllThreadNodes.GetAddress().SetMulticastNetworkPrefix(GetMeshLocalPrefix());
     mRealmLocalAllThreadNodes.GetAddress().SetMulticastNetworkPrefix(GetMeshLocalPrefix());
 
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MESH_FORWARDER_FLOW_CACHE_ENABLE
+    Get<MeshForwarder>().ClearFlowCache();
+#endif
+
     VerifyOrExit(!IsDisabled());
 
     // Add the addresses back into the table.
@@ -1130,7 +1134,10 @@ exit:
 
 void Mle::InitNeighbor(Neighbor &aNeighbor, const RxInfo &aRxInfo)
 {
-    aRxInfo.mMessageInfo.GetPeerAddr().GetIid().ConvertToExtAddress(aNeighbor.GetExtAddress());
+    Mac::ExtAddress extAddress;
+
+    aRxInfo.mMessageInfo.GetPeerAddr().GetIid().ConvertToExtAddress(extAddress);
+    aNeighbor.SetExtAddress(extAddress);
     aNeighbor.GetLinkInfo().Clear();
     aNeighbor.GetLinkInfo().AddRss(aRxInfo.mMessageInfo.GetThreadLinkInfo()->GetRss());
     aNeighbor.ResetLinkFailures();
@@ -2409,7 +2416,7 @@ Error Mle::ProcessMessageSecurity(Crypto::AesCcm::Mode    aMode,
     }
 #endif
 
-    aesCcm.Payload(aMessage, aCmdOffset, payloadLength, aMode);
+    SuccessOrExit(error = aesCcm.Payload(aMessage, aCmdOffset, payloadLength, aMode));
     aesCcm.Finalize(tag);
 
     if (aMode == Crypto::AesCcm::kEncrypt)
@@ -4690,7 +4697,7 @@ exit:
     if (error == kErrorNone)
     {
         tlv.SetLength(static_cast<uint8_t>(GetLength() - startOffset - sizeof(Tlv)));
-        Write(startOffset, tlv);
+        error = Write(startOffset, tlv);
     }
 
     return error;
@@ -4843,7 +4850,7 @@ Error Mle::TxMessage::SendTo(const Ip6::Address &aDestination)
         IgnoreError(Read(offset, header));
         header.SetFrameCounter(Get<KeyManager>().GetMleFrameCounter());
         header.SetKeyId(Get<KeyManager>().GetCurrentKeySequence());
-        Write(offset, header);
+        SuccessOrExit(error = Write(offset, header));
         offset += sizeof(SecurityHeader);
 
         SuccessOrExit(
@@ -4914,7 +4921,7 @@ Error Mle::TxMessage::AppendAddressRegistrationTlv(Child &aChild)
     }
 
     tlv.SetLength(static_cast<uint8_t>(GetLength() - startOffset - sizeof(Tlv)));
-    Write(startOffset, tlv);
+    SuccessOrExit(error = Write(startOffset, tlv));
 
 exit:
     return error;
@@ -113,6 +113,80 @@ Error LeaderBase::GetPreferredNat64Prefix(ExternalRouteConfig &aConfig) const
     return error;
 }
 
+#if OPENTHREAD_CONFIG_NETDATA_LOOKUP_INDEX_ENABLE
+
+Error LeaderBase::GetContext(const Ip6::Address &aAddress, Lowpan::Context &aContext) const
+{
+    const LookupIndex   &lookupIndex = GetLookupIndex();
+    LookupIndex::Matches matches;
+
+    aContext.mPrefix.SetLength(0);
+
+    if (Get<Mle::MleRouter>().IsMeshLocalAddress(aAddress))
+    {
+        GetContextForMeshLocalPrefix(aContext);
+    }
+
+    lookupIndex.FindMatches(aAddress, matches);
+
+    for (uint8_t index : matches)
+    {
+        const LookupIndex::Entry &entry     = lookupIndex.GetEntry(index);
+        const PrefixTlv          &prefixTlv = lookupIndex.GetPrefixTlv(entry);
+        const ContextTlv         *contextTlv;
+
+        if (entry.mContextTlvOffset == LookupIndex::kInvalidIndex)
+        {
+            continue;
+        }
+
+        // Matches are in increasing prefix length order, and among
+        // the same prefix the first Prefix TLV is used.
+
+        if (prefixTlv.GetPrefixLength() > aContext.mPrefix.GetLength())
+        {
+            contextTlv = &lookupIndex.GetContextTlv(entry);
+
+            prefixTlv.CopyPrefixTo(aContext.mPrefix);
+            aContext.mContextId    = contextTlv->GetContextId();
+            aContext.mCompressFlag = contextTlv->IsCompress();
+            aContext.mIsValid      = true;
+        }
+    }
+
+    return (aContext.mPrefix.GetLength() > 0) ? kErrorNone : kErrorNotFound;
+}
+
+Error LeaderBase::GetContext(uint8_t aContextId, Lowpan::Context &aContext) const
+{
+    Error                     error       = kErrorNotFound;
+    const LookupIndex        &lookupIndex = GetLookupIndex();
+    const LookupIndex::Entry *entry;
+    const ContextTlv         *contextTlv;
+
+    if (aContextId == Mle::kMeshLocalPrefixContextId)
+    {
+        GetContextForMeshLocalPrefix(aContext);
+        ExitNow(error = kErrorNone);
+    }
+
+    entry = lookupIndex.GetContextEntry(aContextId);
+    VerifyOrExit(entry != nullptr);
+
+    contextTlv = &lookupIndex.GetContextTlv(*entry);
+
+    lookupIndex.GetPrefixTlv(*entry).CopyPrefixTo(aContext.mPrefix);
+    aContext.mContextId    = contextTlv->GetContextId();
+    aContext.mCompressFlag = contextTlv->IsCompress();
+    aContext.mIsValid      = true;
+    error                  = kErrorNone;
+
+exit:
+    return error;
+}
+
+#else // OPENTHREAD_CONFIG_NETDATA_LOOKUP_INDEX_ENABLE
+
 const PrefixTlv *LeaderBase::FindNextMatchingPrefixTlv(const Ip6::Address &aAddress, const PrefixTlv *aPrevTlv) const
 {
     // This method iterates over Prefix TLVs which match a given IPv6
@@ -200,6 +274,8 @@ exit:
     return error;
 }
 
+#endif // OPENTHREAD_CONFIG_NETDATA_LOOKUP_INDEX_ENABLE
+
 void LeaderBase::GetContextForMeshLocalPrefix(Lowpan::Context &aContext) const
 {
     aContext.mPrefix.Set(Get<Mle::MleRouter>().GetMeshLocalPrefix());
@@ -208,6 +284,76 @@ void LeaderBase::GetContextForMeshLocalPrefix(Lowpan::Context &aContext) const
     aContext.mIsValid      = true;
 }
 
+#if OPENTHREAD_CONFIG_NETDATA_LOOKUP_INDEX_ENABLE
+
+bool LeaderBase::IsOnMesh(const Ip6::Address &aAddress) const
+{
+    const LookupIndex   &lookupIndex = GetLookupIndex();
+    LookupIndex::Matches matches;
+    bool                 isOnMesh = false;
+
+    VerifyOrExit(!Get<Mle::MleRouter>().IsMeshLocalAddress(aAddress), isOnMesh = true);
+
+    lookupIndex.FindMatches(aAddress, matches);
+
+    for (uint8_t index : matches)
+    {
+        if (lookupIndex.GetEntry(index).mIsOnMesh)
+        {
+            ExitNow(isOnMesh = true);
+        }
+    }
+
+exit:
+    return isOnMesh;
+}
+
+Error LeaderBase::RouteLookup(const Ip6::Address &aSource, const Ip6::Address &aDestination, uint16_t &aRloc16) const
+{
+    Error                error       = kErrorNoRoute;
+    const LookupIndex   &lookupIndex = GetLookupIndex();
+    LookupIndex::Matches matches;
+
+    lookupIndex.FindMatches(aSource, matches);
+
+    // Source prefixes are checked in the order of their Prefix TLVs
+    // in the Network Data (i.e., in increasing entry index order)
+    // rather than the longest match first.
+
+    for (uint8_t i = 1; i < matches.GetLength(); i++)
+    {
+        uint8_t index = matches[i];
+        uint8_t j;
+
+        for (j = i; (j > 0) && (matches[j - 1] > index); j--)
+        {
+            matches[j] = matches[j - 1];
+        }
+
+        matches[j] = index;
+    }
+
+    for (uint8_t index : matches)
+    {
+        const LookupIndex::Entry &entry = lookupIndex.GetEntry(index);
+
+        if (ExternalRouteLookup(lookupIndex.GetPrefixTlv(entry).GetDomainId(), aDestination, aRloc16) == kErrorNone)
+        {
+            ExitNow(error = kErrorNone);
+        }
+
+        if (DefaultRouteLookup(entry, aRloc16) == kErrorNone)
+        {
+            ExitNow(error = kErrorNone);
+        }
+    }
+
+exit:
+    return error;
+}
+
+#else // OPENTHREAD_CONFIG_NETDATA_LOOKUP_INDEX_ENABLE
+
 bool LeaderBase::IsOnMesh(const Ip6::Address &aAddress) const
 {
     const PrefixTlv *prefixTlv = nullptr;
@@ -259,6 +405,8 @@ exit:
     return error;
 }
 
+#endif // OPENTHREAD_CONFIG_NETDATA_LOOKUP_INDEX_ENABLE
+
 template <typename EntryType>
 int LeaderBase::CompareRouteEntries(const EntryType &aFirst, const EntryType &aSecond) const
 {
@@ -307,6 +455,85 @@ exit:
     return result;
 }
 
+#if OPENTHREAD_CONFIG_NETDATA_LOOKUP_INDEX_ENABLE
+
+Error LeaderBase::ExternalRouteLookup(uint8_t aDomainId, const Ip6::Address &aDestination, uint16_t &aRloc16) const
+{
+    Error                     error       = kErrorNoRoute;
+    const LookupIndex        &lookupIndex = GetLookupIndex();
+    const LookupIndex::Entry *bestEntry   = nullptr;
+    const HasRouteEntry      *bestRoute   = nullptr;
+    LookupIndex::Matches      matches;
+
+    lookupIndex.FindMatches(aDestination, matches);
+
+    // Matches are in increasing prefix length order. We select the
+    // longest matching prefix with any Has Route entry, and if
+    // multiple Prefix TLVs have the same prefix, the first one.
+
+    for (uint8_t index : matches)
+    {
+        const LookupIndex::Entry &entry = lookupIndex.GetEntry(index);
+
+        if ((entry.mNumExternalRoutes == 0) || (lookupIndex.GetPrefixTlv(entry).GetDomainId() != aDomainId))
+        {
+            continue;
+        }
+
+        if ((bestEntry != nullptr) && (lookupIndex.GetPrefixTlv(entry).GetPrefixLength() <=
+                                       lookupIndex.GetPrefixTlv(*bestEntry).GetPrefixLength()))
+        {
+            continue;
+        }
+
+        bestEntry = &entry;
+    }
+
+    VerifyOrExit(bestEntry != nullptr);
+
+    for (uint8_t i = 0; i < bestEntry->mNumExternalRoutes; i++)
+    {
+        const HasRouteEntry &route = lookupIndex.GetExternalRoute(*bestEntry, i);
+
+        if ((bestRoute == nullptr) || CompareRouteEntries(route, *bestRoute) > 0)
+        {
+            bestRoute = &route;
+        }
+    }
+
+    aRloc16 = bestRoute->GetRloc();
+    error   = kErrorNone;
+
+exit:
+    return error;
+}
+
+Error LeaderBase::DefaultRouteLookup(const LookupIndex::Entry &aEntry, uint16_t &aRloc16) const
+{
+    Error                    error = kErrorNoRoute;
+    const BorderRouterEntry *route = nullptr;
+
+    for (uint8_t i = 0; i < aEntry.mNumDefaultRoutes; i++)
+    {
+        const BorderRouterEntry &entry = mLookupIndex.GetDefaultRoute(aEntry, i);
+
+        if (route == nullptr || CompareRouteEntries(entry, *route) > 0)
+        {
+            route = &entry;
+        }
+    }
+
+    if (route != nullptr)
+    {
+        aRloc16 = route->GetRloc();
+        error   = kErrorNone;
+    }
+
+    return error;
+}
+
+#else // OPENTHREAD_CONFIG_NETDATA_LOOKUP_INDEX_ENABLE
+
 Error LeaderBase::ExternalRouteLookup(uint8_t aDomainId, const Ip6::Address &aDestination, uint16_t &aRloc16) const
 {
     Error                error           = kErrorNoRoute;
@@ -387,6 +614,8 @@ Error LeaderBase::DefaultRouteLookup(const PrefixTlv &aPrefix, uint16_t &aRloc16
     return error;
 }
 
+#endif // OPENTHREAD_CONFIG_NETDATA_LOOKUP_INDEX_ENABLE
+
 Error LeaderBase::SetNetworkData(uint8_t        aVersion,
                                  uint8_t        aStableVersion,
                                  Type           aType,
@@ -495,6 +724,7 @@ void LeaderBase::RemoveCommissioningData(void)
 
     VerifyOrExit(tlv != nullptr);
     RemoveTlv(tlv);
+    InvalidateLookupIndex();
 
 exit:
     return;
@@ -540,8 +770,272 @@ Error LeaderBase::SteeringDataCheckJoiner(const MeshCoP::JoinerDiscerner &aDisce
 void LeaderBase::SignalNetDataChanged(void)
 {
     mMaxLength = Max(mMaxLength, GetLength());
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MESH_FORWARDER_FLOW_CACHE_ENABLE
+    mGeneration++;
+#endif
+    InvalidateLookupIndex();
     Get<ot::Notifier>().Signal(kEventThreadNetdataChanged);
 }
 
+#if OPENTHREAD_CONFIG_NETDATA_LOOKUP_INDEX_ENABLE
+
+const LeaderBase::LookupIndex &LeaderBase::GetLookupIndex(void) const
+{
+    // The index is rebuilt on the first lookup after the Network
+    // Data is changed.
+
+    if (mLookupIndex.IsStale())
+    {
+        mLookupIndex.Build(*this);
+    }
+
+    return mLookupIndex;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// LeaderBase::LookupIndex
+
+void LeaderBase::LookupIndex::Build(const LeaderBase &aLeader)
+{
+    TlvIterator      tlvIterator(aLeader.GetTlvsStart(), aLeader.GetTlvsEnd());
+    const PrefixTlv *prefixTlv;
+
+    mTlvs       = reinterpret_cast<const uint8_t *>(aLeader.GetTlvsStart());
+    mIsStale    = false;
+    mNumEntries = 0;
+    mNumRoutes  = 0;
+    mNumNodes   = 0;
+    memset(mContextEntries, kInvalidIndex, sizeof(mContextEntries));
+
+    AddNode(0, kInvalidIndex, kInvalidIndex);
+
+    while ((prefixTlv = tlvIterator.Iterate<PrefixTlv>()) != nullptr)
+    {
+        Entry                 &entry = mEntries[mNumEntries];
+        TlvIterator            hasRouteIterator(*prefixTlv);
+        TlvIterator            brIterator(*prefixTlv);
+        const HasRouteTlv     *hasRouteTlv;
+        const BorderRouterTlv *brTlv;
+        const ContextTlv      *contextTlv;
+
+        if (!prefixTlv->IsValid())
+        {
+            continue;
+        }
+
+        entry.mTlvOffset         = static_cast<uint8_t>(reinterpret_cast<const uint8_t *>(prefixTlv) - mTlvs);
+        entry.mContextTlvOffset  = kInvalidIndex;
+        entry.mNextSamePrefix    = kInvalidIndex;
+        entry.mFirstRoute        = mNumRoutes;
+        entry.mNumExternalRoutes = 0;
+        entry.mNumDefaultRoutes  = 0;
+        entry.mIsOnMesh          = false;
+
+        while ((hasRouteTlv = hasRouteIterator.Iterate<HasRouteTlv>()) != nullptr)
+        {
+            for (const HasRouteEntry *route = hasRouteTlv->GetFirstEntry(); route <= hasRouteTlv->GetLastEntry();
+                 route                      = route->GetNext())
+            {
+                mRouteOffsets[mNumRoutes++] = static_cast<uint8_t>(reinterpret_cast<const uint8_t *>(route) - mTlvs);
+                entry.mNumExternalRoutes++;
+            }
+        }
+
+        while ((brTlv = brIterator.Iterate<BorderRouterTlv>()) != nullptr)
+        {
+            for (const BorderRouterEntry *route = brTlv->GetFirstEntry(); route <= brTlv->GetLastEntry();
+                 route                          = route->GetNext())
+            {
+                if (route->IsOnMesh())
+                {
+                    entry.mIsOnMesh = true;
+                }
+
+                if (route->IsDefaultRoute())
+                {
+                    mRouteOffsets[mNumRoutes++] =
+                        static_cast<uint8_t>(reinterpret_cast<const uint8_t *>(route) - mTlvs);
+                    entry.mNumDefaultRoutes++;
+                }
+            }
+        }
+
+        contextTlv = prefixTlv->FindSubTlv<ContextTlv>();
+
+        if (contextTlv != nullptr)
+        {
+            entry.mContextTlvOffset = static_cast<uint8_t>(reinterpret_cast<const uint8_t *>(contextTlv) - mTlvs);
+
+            if (mContextEntries[contextTlv->GetContextId()] == kInvalidIndex)
+            {
+                mContextEntries[contextTlv->GetContextId()] = mNumEntries;
+            }
+        }
+
+        Insert(mNumEntries++);
+    }
+}
+
+void LeaderBase::LookupIndex::Insert(uint8_t aEntryIndex)
+{
+    // Inserts an entry in the trie. Each node on the path from the
+    // root to a node has a shorter prefix which the node's prefix
+    // starts with. Nodes without an entry are only kept where the
+    // path branches.
+
+    const uint8_t *prefix    = GetPrefix(aEntryIndex);
+    uint8_t        length    = GetPrefixTlv(mEntries[aEntryIndex]).GetPrefixLength();
+    uint8_t        nodeIndex = kRootNode;
+
+    while (true)
+    {
+        Node          &node = mNodes[nodeIndex];
+        uint8_t        bit;
+        uint8_t        childIndex;
+        const uint8_t *childPrefix;
+        uint8_t        matchLength;
+        uint8_t        newIndex;
+
+        if (node.mLength == length)
+        {
+            // Append to the end of the list of entries with the same
+            // prefix, so that the list is kept in TLV order.
+
+            uint8_t *indexPtr = &node.mEntry;
+
+            while (*indexPtr != kInvalidIndex)
+            {
+                indexPtr = &mEntries[*indexPtr].mNextSamePrefix;
+            }
+
+            *indexPtr = aEntryIndex;
+            break;
+        }
+
+        bit        = GetBit(prefix, node.mLength);
+        childIndex = node.mChildren[bit];
+
+        if (childIndex == kInvalidIndex)
+        {
+            node.mChildren[bit] = AddNode(length, aEntryIndex, aEntryIndex);
+            break;
+        }
+
+        childPrefix = GetPrefix(mNodes[childIndex].mPrefixEntry);
+        matchLength = Min(length, mNodes[childIndex].mLength);
+        matchLength = Min(matchLength, Ip6::Prefix::MatchLength(prefix, childPrefix,
+                                                                Ip6::Prefix::SizeForLength(matchLength)));
+
+        if (matchLength == mNodes[childIndex].mLength)
+        {
+            nodeIndex = childIndex;
+            continue;
+        }
+
+        // The new prefix and the child's prefix diverge (or the new
+        // prefix is shorter), so we insert a new node between the
+        // node and its child at the common prefix length.
+
+        newIndex = AddNode(matchLength, aEntryIndex, (matchLength == length) ? aEntryIndex : kInvalidIndex);
+
+        mNodes[newIndex].mChildren[GetBit(childPrefix, matchLength)] = childIndex;
+
+        if (matchLength < length)
+        {
+            mNodes[newIndex].mChildren[GetBit(prefix, matchLength)] = AddNode(length, aEntryIndex, aEntryIndex);
+        }
+
+        node.mChildren[bit] = newIndex;
+        break;
+    }
+}
+
+uint8_t LeaderBase::LookupIndex::AddNode(uint8_t aLength, uint8_t aPrefixEntry, uint8_t aEntry)
+{
+    Node &node = mNodes[mNumNodes];
+
+    node.mLength      = aLength;
+    node.mPrefixEntry = aPrefixEntry;
+    node.mEntry       = aEntry;
+    node.mChildren[0] = kInvalidIndex;
+    node.mChildren[1] = kInvalidIndex;
+
+    return mNumNodes++;
+}
+
+void LeaderBase::LookupIndex::FindMatches(const Ip6::Address &aAddress, Matches &aMatches) const
+{
+    uint8_t nodeIndex = kRootNode;
+
+    aMatches.Clear();
+
+    while (nodeIndex != kInvalidIndex)
+    {
+        const Node &node = mNodes[nodeIndex];
+
+        if ((node.mLength > 0) && !aAddress.MatchesPrefix(GetPrefix(node.mPrefixEntry), node.mLength))
+        {
+            break;
+        }
+
+        for (uint8_t index = node.mEntry; index != kInvalidIndex; index = mEntries[index].mNextSamePrefix)
+        {
+            IgnoreError(aMatches.PushBack(index));
+        }
+
+        if (node.mLength == Ip6::Prefix::kMaxLength)
+        {
+            break;
+        }
+
+        nodeIndex = node.mChildren[GetBit(aAddress.GetBytes(), node.mLength)];
+    }
+}
+
+const LeaderBase::LookupIndex::Entry *LeaderBase::LookupIndex::GetContextEntry(uint8_t aContextId) const
+{
+    const Entry *entry = nullptr;
+
+    VerifyOrExit(aContextId < kNumContextIds);
+    VerifyOrExit(mContextEntries[aContextId] != kInvalidIndex);
+    entry = &mEntries[mContextEntries[aContextId]];
+
+exit:
+    return entry;
+}
+
+const PrefixTlv &LeaderBase::LookupIndex::GetPrefixTlv(const Entry &aEntry) const
+{
+    return *reinterpret_cast<const PrefixTlv *>(mTlvs + aEntry.mTlvOffset);
+}
+
+const ContextTlv &LeaderBase::LookupIndex::GetContextTlv(const Entry &aEntry) const
+{
+    return *reinterpret_cast<const ContextTlv *>(mTlvs + aEntry.mContextTlvOffset);
+}
+
+const HasRouteEntry &LeaderBase::LookupIndex::GetExternalRoute(const Entry &aEntry, uint8_t aIndex) const
+{
+    return *reinterpret_cast<const HasRouteEntry *>(mTlvs + mRouteOffsets[aEntry.mFirstRoute + aIndex]);
+}
+
+const BorderRouterEntry &LeaderBase::LookupIndex::GetDefaultRoute(const Entry &aEntry, uint8_t aIndex) const
+{
+    return *reinterpret_cast<const BorderRouterEntry *>(
+        mTlvs + mRouteOffsets[aEntry.mFirstRoute + aEntry.mNumExternalRoutes + aIndex]);
+}
+
+const uint8_t *LeaderBase::LookupIndex::GetPrefix(uint8_t aEntryIndex) const
+{
+    return GetPrefixTlv(mEntries[aEntryIndex]).GetPrefix();
+}
+
+uint8_t LeaderBase::LookupIndex::GetBit(const uint8_t *aPrefix, uint8_t aBitIndex)
+{
+    return (aPrefix[aBitIndex / CHAR_BIT] >> (CHAR_BIT - 1 - (aBitIndex % CHAR_BIT))) & 1;
+}
+
+#endif // OPENTHREAD_CONFIG_NETDATA_LOOKUP_INDEX_ENABLE
+
 } // namespace NetworkData
 } // namespace ot
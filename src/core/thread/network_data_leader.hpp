@@ -39,6 +39,7 @@
 #include <stdint.h>
 
 #include "coap/coap.hpp"
+#include "common/array.hpp"
 #include "common/const_cast.hpp"
 #include "common/timer.hpp"
 #include "net/ip6_address.hpp"
@@ -75,6 +76,9 @@ public:
     explicit LeaderBase(Instance &aInstance)
         : MutableNetworkData(aInstance, mTlvBuffer, 0, sizeof(mTlvBuffer))
         , mMaxLength(0)
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MESH_FORWARDER_FLOW_CACHE_ENABLE
+        , mGeneration(0)
+#endif
     {
         Reset();
     }
@@ -94,6 +98,19 @@ public:
      */
     uint8_t GetMaxLength(void) const { return mMaxLength; }
 
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MESH_FORWARDER_FLOW_CACHE_ENABLE
+    /**
+     * Returns the Network Data generation.
+     *
+     * The generation is incremented whenever the Network Data changes (including when it is reset). Unlike the
+     * Network Data version, it is tracked locally and always changes along with the Network Data content.
+     *
+     * @returns The Network Data generation.
+     *
+     */
+    uint32_t GetGeneration(void) const { return mGeneration; }
+#endif
+
     /**
      * Resets the tracked maximum Network Data Length.
      *
@@ -300,13 +317,101 @@ public:
 protected:
     void SignalNetDataChanged(void);
 
+    void InvalidateLookupIndex(void)
+    {
+#if OPENTHREAD_CONFIG_NETDATA_LOOKUP_INDEX_ENABLE
+        mLookupIndex.Invalidate();
+#endif
+    }
+
     uint8_t mStableVersion;
     uint8_t mVersion;
 
 private:
     using FilterIndexes = MeshCoP::SteeringData::HashBitIndexes;
 
+#if OPENTHREAD_CONFIG_NETDATA_LOOKUP_INDEX_ENABLE
+    // `LookupIndex` is compiled from the Prefix TLVs so that the
+    // per-packet lookups (route, context and on-mesh) do not need to
+    // parse the TLVs. It is invalidated whenever the TLVs change and
+    // is rebuilt on the next lookup. It keeps a binary path-compressed
+    // trie of the prefixes for longest prefix match, and an array
+    // mapping each 6LoWPAN Context ID to its Prefix TLV. Entries refer
+    // to the TLVs by their offset in the Network Data, and are kept in
+    // the TLV order.
+    class LookupIndex
+    {
+    public:
+        static constexpr uint8_t kInvalidIndex = 0xff;
+
+        LookupIndex(void)
+            : mIsStale(true)
+        {
+        }
+
+        struct Entry
+        {
+            uint8_t mTlvOffset;         // Offset of the Prefix TLV.
+            uint8_t mContextTlvOffset;  // Offset of the (first) Context sub-TLV, or `kInvalidIndex` if none.
+            uint8_t mNextSamePrefix;    // Next entry with the same prefix, or `kInvalidIndex` if none.
+            uint8_t mFirstRoute;        // Index in `mRouteOffsets` of the first route of the entry.
+            uint8_t mNumExternalRoutes; // Number of Has Route entries (which come first).
+            uint8_t mNumDefaultRoutes;  // Number of Border Router entries with default route flag.
+            bool    mIsOnMesh;          // Whether any Border Router entry has the on-mesh flag.
+        };
+
+        // Indexes of entries matching an address (in increasing prefix length order).
+        typedef Array<uint8_t, kMaxSize / sizeof(PrefixTlv)> Matches;
+
+        void Invalidate(void) { mIsStale = true; }
+        bool IsStale(void) const { return mIsStale; }
+        void Build(const LeaderBase &aLeader);
+        void FindMatches(const Ip6::Address &aAddress, Matches &aMatches) const;
+
+        uint8_t                  GetNumEntries(void) const { return mNumEntries; }
+        const Entry             &GetEntry(uint8_t aIndex) const { return mEntries[aIndex]; }
+        const Entry             *GetContextEntry(uint8_t aContextId) const;
+        const PrefixTlv         &GetPrefixTlv(const Entry &aEntry) const;
+        const ContextTlv        &GetContextTlv(const Entry &aEntry) const;
+        const HasRouteEntry     &GetExternalRoute(const Entry &aEntry, uint8_t aIndex) const;
+        const BorderRouterEntry &GetDefaultRoute(const Entry &aEntry, uint8_t aIndex) const;
+
+    private:
+        static constexpr uint8_t kMaxEntries    = kMaxSize / sizeof(PrefixTlv);
+        static constexpr uint8_t kMaxRoutes     = kMaxSize / sizeof(HasRouteEntry);
+        static constexpr uint8_t kMaxNodes      = 2 * kMaxEntries + 1;
+        static constexpr uint8_t kNumContextIds = 16;
+        static constexpr uint8_t kRootNode      = 0;
+
+        struct Node
+        {
+            uint8_t mLength;      // Prefix length (in bits) of the node.
+            uint8_t mPrefixEntry; // An entry whose prefix starts with the node's prefix.
+            uint8_t mEntry;       // First entry whose prefix is the node's prefix, or `kInvalidIndex` if none.
+            uint8_t mChildren[2]; // Child nodes by the bit after the node's prefix, or `kInvalidIndex`.
+        };
+
+        static uint8_t GetBit(const uint8_t *aPrefix, uint8_t aBitIndex);
+
+        const uint8_t *GetPrefix(uint8_t aEntryIndex) const;
+        uint8_t        AddNode(uint8_t aLength, uint8_t aPrefixEntry, uint8_t aEntry);
+        void           Insert(uint8_t aEntryIndex);
+
+        const uint8_t *mTlvs;
+        bool           mIsStale;
+        uint8_t        mNumEntries;
+        uint8_t        mNumRoutes;
+        uint8_t        mNumNodes;
+        Entry          mEntries[kMaxEntries];
+        uint8_t        mRouteOffsets[kMaxRoutes];
+        Node           mNodes[kMaxNodes];
+        uint8_t        mContextEntries[kNumContextIds];
+    };
+
+    const LookupIndex &GetLookupIndex(void) const;
+#else
     const PrefixTlv *FindNextMatchingPrefixTlv(const Ip6::Address &aAddress, const PrefixTlv *aPrevTlv) const;
+#endif
 
     void RemoveCommissioningData(void);
 
@@ -317,12 +422,22 @@ private:
                                                           uint16_t aSecondRloc) const;
 
     Error ExternalRouteLookup(uint8_t aDomainId, const Ip6::Address &aDestination, uint16_t &aRloc16) const;
+#if OPENTHREAD_CONFIG_NETDATA_LOOKUP_INDEX_ENABLE
+    Error DefaultRouteLookup(const LookupIndex::Entry &aEntry, uint16_t &aRloc16) const;
+#else
     Error DefaultRouteLookup(const PrefixTlv &aPrefix, uint16_t &aRloc16) const;
+#endif
     Error SteeringDataCheck(const FilterIndexes &aFilterIndexes) const;
     void  GetContextForMeshLocalPrefix(Lowpan::Context &aContext) const;
 
-    uint8_t mTlvBuffer[kMaxSize];
-    uint8_t mMaxLength;
+    uint8_t  mTlvBuffer[kMaxSize];
+    uint8_t  mMaxLength;
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MESH_FORWARDER_FLOW_CACHE_ENABLE
+    uint32_t mGeneration;
+#endif
+#if OPENTHREAD_CONFIG_NETDATA_LOOKUP_INDEX_ENABLE
+    mutable LookupIndex mLookupIndex;
+#endif
 };
 
 /**
@@ -118,7 +118,13 @@ void Leader::IncrementVersions(const ChangedFlags &aFlags)
 void Leader::IncrementVersions(bool aIncludeStable)
 {
 #if OPENTHREAD_CONFIG_BORDER_ROUTER_SIGNAL_NETWORK_DATA_FULL
-    VerifyOrExit(!mIsClone);
+    if (mIsClone)
+    {
+        // A clone does not signal the change, but its lookup index
+        // still needs to be invalidated.
+        InvalidateLookupIndex();
+        ExitNow();
+    }
 #endif
 
     if (aIncludeStable)
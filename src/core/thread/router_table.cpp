@@ -48,6 +48,9 @@ RouterTable::RouterTable(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mRouters(aInstance)
     , mChangedTask(aInstance)
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_FLOW_CACHE_ENABLE
+    , mGeneration(0)
+#endif
     , mRouterIdSequenceLastUpdated(0)
     , mRouterIdSequence(Random::NonCrypto::GetUint8())
 #if OPENTHREAD_CONFIG_REFERENCE_DEVICE_ENABLE
@@ -870,7 +873,13 @@ void RouterTable::RouterIdMap::HandleTimeTick(void)
     }
 }
 
-void RouterTable::SignalTableChanged(void) { mChangedTask.Post(); }
+void RouterTable::SignalTableChanged(void)
+{
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_FLOW_CACHE_ENABLE
+    mGeneration++;
+#endif
+    mChangedTask.Post();
+}
 
 void RouterTable::HandleTableChanged(void)
 {
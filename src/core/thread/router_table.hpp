@@ -192,6 +192,27 @@ public:
      */
     uint16_t GetNextHop(uint16_t aDestRloc16) const;
 
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_FLOW_CACHE_ENABLE
+    /**
+     * Returns the generation of the router table.
+     *
+     * The generation changes whenever the next hop towards a destination may change, i.e., when the routes, the
+     * allocated Router IDs, or the state or link quality of a neighbor change.
+     *
+     * @returns The generation of the router table.
+     *
+     */
+    uint32_t GetGeneration(void) const { return mGeneration; }
+
+    /**
+     * Increments the generation of the router table.
+     *
+     * Is called when the state or link quality of a neighbor changes.
+     *
+     */
+    void IncrementGeneration(void) { mGeneration++; }
+#endif
+
     /**
      * Determines the next hop and the path cost towards an RLOC16 destination.
      *
@@ -491,6 +512,9 @@ private:
     Array<Router, Mle::kMaxRouters> mRouters;
     ChangedTask                     mChangedTask;
     RouterIdMap                     mRouterIdMap;
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_FLOW_CACHE_ENABLE
+    uint32_t mGeneration;
+#endif
     TimeMilli                       mRouterIdSequenceLastUpdated;
     uint8_t                         mRouterIdSequence;
 #if OPENTHREAD_CONFIG_REFERENCE_DEVICE_ENABLE
@@ -54,10 +54,40 @@ void Neighbor::SetState(State aState)
     }
 #endif
 
+    UpdateChildTableIndexes();
+
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MESH_FORWARDER_FLOW_CACHE_ENABLE
+    Get<RouterTable>().IncrementGeneration();
+#endif
+
 exit:
     return;
 }
 
+void Neighbor::SetExtAddress(const Mac::ExtAddress &aAddress)
+{
+    mMacAddr = aAddress;
+    UpdateChildTableIndexes();
+}
+
+void Neighbor::SetRloc16(uint16_t aRloc16)
+{
+    mRloc16 = aRloc16;
+    UpdateChildTableIndexes();
+}
+
+void Neighbor::UpdateChildTableIndexes(void)
+{
+#if OPENTHREAD_FTD
+    ChildTable &childTable = Get<ChildTable>();
+
+    if (childTable.Contains(*this))
+    {
+        childTable.UpdateIndexes(*static_cast<Child *>(this));
+    }
+#endif
+}
+
 #if OPENTHREAD_CONFIG_UPTIME_ENABLE
 uint32_t Neighbor::GetConnectionTime(void) const
 {
@@ -336,6 +366,7 @@ void Child::Clear(void)
 
     memset(reinterpret_cast<void *>(this), 0, sizeof(Child));
     Init(instance);
+    UpdateChildTableIndexes();
 }
 
 void Child::ClearIp6Addresses(void)
@@ -346,6 +377,7 @@ void Child::ClearIp6Addresses(void)
     mMlrToRegisterMask.Clear();
     mMlrRegisteredMask.Clear();
 #endif
+    UpdateChildTableIndexes();
 }
 
 void Child::SetDeviceMode(Mle::DeviceMode aMode)
@@ -401,6 +433,11 @@ Error Child::AddIp6Address(const Ip6::Address &aAddress)
     error = kErrorNoBufs;
 
 exit:
+    if (error == kErrorNone)
+    {
+        UpdateChildTableIndexes();
+    }
+
     return error;
 }
 
@@ -443,6 +480,11 @@ Error Child::RemoveIp6Address(const Ip6::Address &aAddress)
     mIp6Address[kNumIp6Addresses - 1].Clear();
 
 exit:
+    if (error == kErrorNone)
+    {
+        UpdateChildTableIndexes();
+    }
+
     return error;
 }
 
@@ -614,6 +656,13 @@ bool Router::SetNextHopAndCost(uint8_t aNextHop, uint8_t aCost)
         changed = true;
     }
 
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MESH_FORWARDER_FLOW_CACHE_ENABLE
+    if (changed)
+    {
+        Get<RouterTable>().IncrementGeneration();
+    }
+#endif
+
     return changed;
 }
 
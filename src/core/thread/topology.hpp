@@ -120,6 +120,8 @@ public:
      */
     class AddressMatcher
     {
+        friend class ChildTable;
+
     public:
         /**
          * Initializes the `AddressMatcher` with a given MAC short address (RCOC16) and state filter.
@@ -372,21 +374,13 @@ public:
      */
     const Mac::ExtAddress &GetExtAddress(void) const { return mMacAddr; }
 
-    /**
-     * Returns the Extended Address.
-     *
-     * @returns A reference to the Extended Address.
-     *
-     */
-    Mac::ExtAddress &GetExtAddress(void) { return mMacAddr; }
-
     /**
      * Sets the Extended Address.
      *
      * @param[in]  aAddress  The Extended Address value to set.
      *
      */
-    void SetExtAddress(const Mac::ExtAddress &aAddress) { mMacAddr = aAddress; }
+    void SetExtAddress(const Mac::ExtAddress &aAddress);
 
     /**
      * Gets the key sequence value.
@@ -499,7 +493,7 @@ public:
      * @param[in]  aRloc16  The RLOC16 value.
      *
      */
-    void SetRloc16(uint16_t aRloc16) { mRloc16 = aRloc16; }
+    void SetRloc16(uint16_t aRloc16);
 
 #if OPENTHREAD_CONFIG_MULTI_RADIO
     /**
@@ -799,6 +793,15 @@ protected:
      */
     void Init(Instance &aInstance);
 
+    /**
+     * Updates the lookup indexes of `ChildTable` if the neighbor is an entry in the child table.
+     *
+     * Is called whenever the state, the RLOC16, the Extended Address, or (for a child) the registered IPv6 addresses
+     * are changed.
+     *
+     */
+    void UpdateChildTableIndexes(void);
+
 private:
     enum : uint32_t
     {
@@ -40,10 +40,323 @@
 
 #include "common/code_utils.hpp"
 #include "common/debug.hpp"
+#include "common/num_utils.hpp"
 
 namespace ot {
 namespace Utils {
 
+#if OPENTHREAD_CONFIG_HEAP_TLSF_ENABLE
+
+Heap::Heap(void)
+    : mFirstLevelBitmap(0)
+    , mFreeSize(0)
+    , mNumFreeBlocks(0)
+{
+    BlockHeader &first = HeaderAt(kFirstBlockOffset);
+    BlockHeader &guard = HeaderAt(kGuardBlockOffset);
+
+    memset(mFreeLists, 0xff, sizeof(mFreeLists));
+    memset(mSecondLevelBitmaps, 0, sizeof(mSecondLevelBitmaps));
+
+    first.mPrev = kNoOffset;
+    first.mSize = kFirstBlockSize;
+
+    // The guard block is never free, so it stops coalescing with the
+    // next block in `Free()`.
+    guard.mPrev = kFirstBlockOffset;
+    guard.mSize = 0;
+
+    InsertFreeBlock(kFirstBlockOffset, kFirstBlockSize);
+}
+
+void *Heap::CAlloc(size_t aCount, size_t aSize)
+{
+    void    *ret = nullptr;
+    uint16_t offset;
+    uint16_t blockSize;
+    uint16_t remainingSize;
+    size_t   size;
+
+    VerifyOrExit((aCount != 0) && (aSize != 0) && (aSize <= kCapacity / aCount));
+
+    size      = aCount * aSize;
+    blockSize = static_cast<uint16_t>((size + kHeaderSize + kAlignSize - 1) & ~static_cast<size_t>(kAlignSize - 1));
+    blockSize = (blockSize < kMinBlockSize) ? kMinBlockSize : blockSize;
+
+    offset = FindFreeBlock(blockSize);
+    VerifyOrExit(offset != kNoOffset);
+
+    RemoveFreeBlock(offset);
+
+    remainingSize = HeaderAt(offset).GetSize() - blockSize;
+
+    if (remainingSize >= kMinBlockSize)
+    {
+        uint16_t remainingOffset = offset + blockSize;
+
+        HeaderAt(offset).mSize                         = blockSize;
+        HeaderAt(remainingOffset).mPrev                = offset;
+        HeaderAt(remainingOffset + remainingSize).mPrev = remainingOffset;
+        InsertFreeBlock(remainingOffset, remainingSize);
+    }
+
+    ret = &mMemory.m8[offset + kHeaderSize];
+    memset(ret, 0, size);
+
+exit:
+    return ret;
+}
+
+void Heap::Free(void *aPointer)
+{
+    uint16_t offset;
+    uint16_t blockSize;
+    uint16_t neighbor;
+
+    VerifyOrExit(aPointer != nullptr);
+
+    offset    = static_cast<uint16_t>(reinterpret_cast<uint8_t *>(aPointer) - mMemory.m8) - kHeaderSize;
+    blockSize = HeaderAt(offset).GetSize();
+
+    OT_ASSERT(!HeaderAt(offset).IsFree());
+
+    // Coalesce with the next and the previous blocks if free.
+
+    neighbor = offset + blockSize;
+
+    if (HeaderAt(neighbor).IsFree())
+    {
+        blockSize += HeaderAt(neighbor).GetSize();
+        RemoveFreeBlock(neighbor);
+    }
+
+    neighbor = HeaderAt(offset).mPrev;
+
+    if ((neighbor != kNoOffset) && HeaderAt(neighbor).IsFree())
+    {
+        blockSize += HeaderAt(neighbor).GetSize();
+        RemoveFreeBlock(neighbor);
+        offset = neighbor;
+    }
+
+    HeaderAt(offset + blockSize).mPrev = offset;
+    InsertFreeBlock(offset, blockSize);
+
+exit:
+    return;
+}
+
+bool Heap::IsClean(void) const
+{
+    const BlockHeader &first = HeaderAt(kFirstBlockOffset);
+
+    return first.IsFree() && (first.GetSize() == kFirstBlockSize);
+}
+
+size_t Heap::GetFreeSize(void) const { return mFreeSize; }
+
+size_t Heap::GetLargestFreeBlockSize(void) const
+{
+    uint16_t largest = 0;
+    uint8_t  firstLevel;
+    uint8_t  secondLevel;
+
+    VerifyOrExit(mFirstLevelBitmap != 0);
+
+    // The largest free block is in the highest non-empty list, whose
+    // blocks can differ in size, so the list is walked.
+
+    firstLevel  = GetMsbIndex(mFirstLevelBitmap);
+    secondLevel = GetMsbIndex(mSecondLevelBitmaps[firstLevel]);
+
+    for (uint16_t offset = mFreeLists[firstLevel][secondLevel]; offset != kNoOffset;
+         offset          = HeaderAt(offset).mNextFree)
+    {
+        largest = Max(largest, HeaderAt(offset).GetSize());
+    }
+
+    largest -= kHeaderSize;
+
+exit:
+    return largest;
+}
+
+uint16_t Heap::GetNumFreeBlocks(void) const { return mNumFreeBlocks; }
+
+uint16_t Heap::FindFreeBlock(uint16_t aBlockSize) const
+{
+    uint16_t offset = kNoOffset;
+    uint32_t size   = aBlockSize;
+    uint8_t  firstLevel;
+    uint8_t  secondLevel;
+    uint32_t bitmap;
+
+    // Round up the size to the start of the next size class so that
+    // any block in the found list is large enough (good fit).
+
+    if (size >= kSmallBlockSize)
+    {
+        size += (1U << (GetMsbIndex(size) - kSecondLevelBits)) - 1;
+    }
+
+    MapSize(size, firstLevel, secondLevel);
+
+    if (firstLevel < kNumFirstLevels)
+    {
+        bitmap = mSecondLevelBitmaps[firstLevel] & (~0U << secondLevel);
+
+        if (bitmap == 0)
+        {
+            bitmap = mFirstLevelBitmap & (~0U << (firstLevel + 1));
+
+            if (bitmap != 0)
+            {
+                firstLevel = GetLsbIndex(bitmap);
+                bitmap     = mSecondLevelBitmaps[firstLevel];
+            }
+        }
+
+        if (bitmap != 0)
+        {
+            ExitNow(offset = mFreeLists[firstLevel][GetLsbIndex(bitmap)]);
+        }
+    }
+
+    // No list with blocks that are all large enough. Search the list
+    // of the size class of `aBlockSize` itself, which may still have
+    // a large enough block (matters only when the heap is nearly full).
+
+    MapSize(aBlockSize, firstLevel, secondLevel);
+
+    for (offset = mFreeLists[firstLevel][secondLevel]; offset != kNoOffset; offset = HeaderAt(offset).mNextFree)
+    {
+        if (HeaderAt(offset).GetSize() >= aBlockSize)
+        {
+            break;
+        }
+    }
+
+exit:
+    return offset;
+}
+
+void Heap::InsertFreeBlock(uint16_t aOffset, uint16_t aBlockSize)
+{
+    BlockHeader &block = HeaderAt(aOffset);
+    uint8_t      firstLevel;
+    uint8_t      secondLevel;
+    uint16_t    *head;
+
+    MapSize(aBlockSize, firstLevel, secondLevel);
+    head = &mFreeLists[firstLevel][secondLevel];
+
+    block.mSize     = aBlockSize | kFreeFlag;
+    block.mNextFree = *head;
+    block.mPrevFree = kNoOffset;
+
+    if (*head != kNoOffset)
+    {
+        HeaderAt(*head).mPrevFree = aOffset;
+    }
+
+    *head = aOffset;
+
+    mSecondLevelBitmaps[firstLevel] |= (1U << secondLevel);
+    mFirstLevelBitmap |= (1U << firstLevel);
+
+    mFreeSize += aBlockSize - kHeaderSize;
+    mNumFreeBlocks++;
+}
+
+void Heap::RemoveFreeBlock(uint16_t aOffset)
+{
+    BlockHeader &block = HeaderAt(aOffset);
+    uint8_t      firstLevel;
+    uint8_t      secondLevel;
+
+    MapSize(block.GetSize(), firstLevel, secondLevel);
+
+    if (block.mNextFree != kNoOffset)
+    {
+        HeaderAt(block.mNextFree).mPrevFree = block.mPrevFree;
+    }
+
+    if (block.mPrevFree != kNoOffset)
+    {
+        HeaderAt(block.mPrevFree).mNextFree = block.mNextFree;
+    }
+    else
+    {
+        mFreeLists[firstLevel][secondLevel] = block.mNextFree;
+
+        if (block.mNextFree == kNoOffset)
+        {
+            mSecondLevelBitmaps[firstLevel] &= ~(1U << secondLevel);
+
+            if (mSecondLevelBitmaps[firstLevel] == 0)
+            {
+                mFirstLevelBitmap &= ~(1U << firstLevel);
+            }
+        }
+    }
+
+    block.mSize = block.GetSize();
+
+    mFreeSize -= block.mSize - kHeaderSize;
+    mNumFreeBlocks--;
+}
+
+void Heap::MapSize(uint32_t aBlockSize, uint8_t &aFirstLevel, uint8_t &aSecondLevel)
+{
+    // Sizes below `kSmallBlockSize` are in first level zero, split
+    // linearly (by `kAlignSize`). A larger size with its most
+    // significant bit at index `msb` is in first level
+    // `msb - (kSecondLevelBits + kAlignShift) + 1` and the next
+    // `kSecondLevelBits` bits give its second level.
+
+    if (aBlockSize < kSmallBlockSize)
+    {
+        aFirstLevel  = 0;
+        aSecondLevel = static_cast<uint8_t>(aBlockSize >> kAlignShift);
+    }
+    else
+    {
+        uint8_t msb = GetMsbIndex(aBlockSize);
+
+        aFirstLevel  = msb - (kSecondLevelBits + kAlignShift) + 1;
+        aSecondLevel = static_cast<uint8_t>((aBlockSize >> (msb - kSecondLevelBits)) - kNumSecondLevels);
+    }
+}
+
+uint8_t Heap::GetMsbIndex(uint32_t aValue)
+{
+    uint8_t index = 0;
+
+    while (aValue >>= 1)
+    {
+        index++;
+    }
+
+    return index;
+}
+
+uint8_t Heap::GetLsbIndex(uint32_t aValue)
+{
+    uint8_t index = 0;
+
+    OT_ASSERT(aValue != 0);
+
+    while ((aValue & 1) == 0)
+    {
+        aValue >>= 1;
+        index++;
+    }
+
+    return index;
+}
+
+#else // OPENTHREAD_CONFIG_HEAP_TLSF_ENABLE
+
 Heap::Heap(void)
 {
     Block &super = BlockAt(kSuperBlockOffset);
@@ -217,6 +530,49 @@ void Heap::Free(void *aPointer)
     }
 }
 
+bool Heap::IsClean(void) const
+{
+    Heap        &self  = *AsNonConst(this);
+    const Block &super = self.BlockSuper();
+    const Block &first = self.BlockRight(super);
+    return super.GetNext() == self.BlockOffset(first) && first.GetSize() == kFirstBlockSize;
+}
+
+size_t Heap::GetFreeSize(void) const { return mMemory.mFreeSize; }
+
+size_t Heap::GetLargestFreeBlockSize(void) const
+{
+    // The free block list is sorted by size, so the largest free block
+    // is the last one before the guard block.
+
+    Heap        &self    = *AsNonConst(this);
+    const Block *block   = &self.BlockNext(self.BlockSuper());
+    uint16_t     largest = 0;
+
+    for (; block->IsFree(); block = &self.BlockNext(*block))
+    {
+        largest = block->GetSize();
+    }
+
+    return largest;
+}
+
+uint16_t Heap::GetNumFreeBlocks(void) const
+{
+    Heap        &self  = *AsNonConst(this);
+    const Block *block = &self.BlockNext(self.BlockSuper());
+    uint16_t     count = 0;
+
+    for (; block->IsFree(); block = &self.BlockNext(*block))
+    {
+        count++;
+    }
+
+    return count;
+}
+
+#endif // OPENTHREAD_CONFIG_HEAP_TLSF_ENABLE
+
 } // namespace Utils
 } // namespace ot
 
@@ -48,6 +48,8 @@
 namespace ot {
 namespace Utils {
 
+#if !OPENTHREAD_CONFIG_HEAP_TLSF_ENABLE
+
 /**
  * Represents a memory block.
  *
@@ -159,12 +161,15 @@ private:
     uint8_t mMemory[sizeof(uint16_t)];
 };
 
+#endif // !OPENTHREAD_CONFIG_HEAP_TLSF_ENABLE
+
 /**
  * Defines functionality to manipulate heap.
  *
  * This implementation is currently for mbedTLS.
  *
- * The memory is divided into blocks. The whole picture is as follows:
+ * By default, the memory is divided into blocks and free blocks are kept in a single list sorted by size (first-fit).
+ * The whole picture is as follows:
  *
  *     +--------------------------------------------------------------------------+
  *     |    unused      |    super   | block 1 | block 2 | ... | block n | guard  |
@@ -172,6 +177,19 @@ private:
  *     | kAlignSize - 2 | kAlignSize | 4 + s1  | 4 + s2  | ... | 4 + s4  |   2    |
  *     +--------------------------------------------------------------------------+
  *
+ * When `OPENTHREAD_CONFIG_HEAP_TLSF_ENABLE` is set, a two-level segregated fit (TLSF) allocator is used instead. Free
+ * blocks are kept in size-class lists (first level is the power of two range of the block size, second level evenly
+ * divides that range) whose non-empty ones are tracked by bitmaps, so both `CAlloc()` and `Free()` take constant time.
+ *
+ *     +-------------------------------------------------------------+
+ *     |     unused     | block 1 | block 2 | ... | block n | guard  |
+ *     +----------------+---------+---------+-----+---------+--------+
+ *     | kAlignSize - 4 |   s1    |   s2    | ... |   sn    |   4    |
+ *     +-------------------------------------------------------------+
+ *
+ * Each TLSF block starts with a 4-byte header (offset of the previous block and block size with a "free" flag). A free
+ * block also holds the offsets of the next and previous blocks in its size-class list right after its header.
+ *
  */
 class Heap : private NonCopyable
 {
@@ -207,24 +225,36 @@ public:
      * Returns whether the heap is clean.
      *
      */
-    bool IsClean(void) const
-    {
-        Heap        &self  = *AsNonConst(this);
-        const Block &super = self.BlockSuper();
-        const Block &first = self.BlockRight(super);
-        return super.GetNext() == self.BlockOffset(first) && first.GetSize() == kFirstBlockSize;
-    }
+    bool IsClean(void) const;
 
     /**
      * Returns the capacity of this heap.
      *
      */
-    size_t GetCapacity(void) const { return kFirstBlockSize; }
+    size_t GetCapacity(void) const { return kCapacity; }
 
     /**
      * Returns free space of this heap.
      */
-    size_t GetFreeSize(void) const { return mMemory.mFreeSize; }
+    size_t GetFreeSize(void) const;
+
+    /**
+     * Returns the size of the largest free block, i.e., the largest size which can currently be allocated.
+     *
+     * Together with `GetNumFreeBlocks()` this indicates how fragmented the free space of the heap is.
+     *
+     * @returns The size of the largest free block in bytes.
+     *
+     */
+    size_t GetLargestFreeBlockSize(void) const;
+
+    /**
+     * Returns the number of free blocks in this heap.
+     *
+     * @returns The number of free blocks.
+     *
+     */
+    uint16_t GetNumFreeBlocks(void) const;
 
 private:
 #if OPENTHREAD_CONFIG_TLS_ENABLE || OPENTHREAD_CONFIG_DTLS_ENABLE
@@ -232,15 +262,77 @@ private:
 #else
     static constexpr uint16_t kMemorySize = OPENTHREAD_CONFIG_HEAP_INTERNAL_SIZE_NO_DTLS;
 #endif
-    static constexpr uint16_t kAlignSize          = sizeof(void *);
+    static constexpr uint16_t kAlignSize = sizeof(void *);
+
+    static_assert(kMemorySize % kAlignSize == 0, "The heap memory size is not aligned to kAlignSize!");
+
+#if OPENTHREAD_CONFIG_HEAP_TLSF_ENABLE
+    static constexpr uint16_t kHeaderSize       = 2 * sizeof(uint16_t); // `mPrev` and `mSize` of `BlockHeader`.
+    static constexpr uint16_t kFreeLinksSize    = 2 * sizeof(uint16_t); // `mNextFree` and `mPrevFree`.
+    static constexpr uint16_t kMinBlockSize     = (kHeaderSize + kFreeLinksSize + kAlignSize - 1) & ~(kAlignSize - 1);
+    static constexpr uint16_t kFirstBlockOffset = kAlignSize - kHeaderSize;
+    static constexpr uint16_t kFirstBlockSize   = kMemorySize - kAlignSize;
+    static constexpr uint16_t kGuardBlockOffset = kMemorySize - kHeaderSize;
+    static constexpr uint16_t kCapacity         = kFirstBlockSize - kHeaderSize;
+    static constexpr uint16_t kNoOffset         = 0xffff;
+    static constexpr uint16_t kFreeFlag         = 1; // Flag in `mSize` indicating the block is free.
+    static constexpr uint8_t  kAlignShift       = (kAlignSize == 8) ? 3 : 2;
+    static constexpr uint8_t  kSecondLevelBits  = 3;
+    static constexpr uint8_t  kNumSecondLevels  = (1 << kSecondLevelBits);
+    static constexpr uint8_t  kNumFirstLevels   = 17 - kSecondLevelBits - kAlignShift; // Block sizes are 16-bit.
+    static constexpr uint16_t kSmallBlockSize   = (kNumSecondLevels << kAlignShift);  // Sizes in first level zero.
+
+    static_assert((kAlignSize == 4) || (kAlignSize == 8), "kAlignSize must be 4 or 8");
+    static_assert(kNumSecondLevels <= 8, "Second level bitmap is 8-bit");
+
+    struct BlockHeader
+    {
+        uint16_t mPrev;     // Offset of the previous (physical) block, `kNoOffset` for the first block.
+        uint16_t mSize;     // Size of the block including the header, with `kFreeFlag`.
+        uint16_t mNextFree; // Offset of the next block in the free list (used only when free).
+        uint16_t mPrevFree; // Offset of the previous block in the free list (used only when free).
+
+        uint16_t GetSize(void) const { return static_cast<uint16_t>(mSize & ~kFreeFlag); }
+        bool     IsFree(void) const { return (mSize & kFreeFlag) != 0; }
+    };
+
+    BlockHeader &HeaderAt(uint16_t aOffset) { return *reinterpret_cast<BlockHeader *>(&mMemory.m16[aOffset / 2]); }
+    const BlockHeader &HeaderAt(uint16_t aOffset) const
+    {
+        return *reinterpret_cast<const BlockHeader *>(&mMemory.m16[aOffset / 2]);
+    }
+
+    uint16_t FindFreeBlock(uint16_t aBlockSize) const;
+    void     InsertFreeBlock(uint16_t aOffset, uint16_t aBlockSize);
+    void     RemoveFreeBlock(uint16_t aOffset);
+
+    static void    MapSize(uint32_t aBlockSize, uint8_t &aFirstLevel, uint8_t &aSecondLevel);
+    static uint8_t GetMsbIndex(uint32_t aValue);
+    static uint8_t GetLsbIndex(uint32_t aValue);
+
+    uint16_t mFreeLists[kNumFirstLevels][kNumSecondLevels];
+    uint8_t  mSecondLevelBitmaps[kNumFirstLevels];
+    uint16_t mFirstLevelBitmap;
+    uint16_t mFreeSize;
+    uint16_t mNumFreeBlocks;
+
+    union
+    {
+        // Make sure memory is long aligned.
+        long     mLong[kMemorySize / sizeof(long)];
+        uint8_t  m8[kMemorySize];
+        uint16_t m16[kMemorySize / sizeof(uint16_t)];
+    } mMemory;
+
+#else  // OPENTHREAD_CONFIG_HEAP_TLSF_ENABLE
+
     static constexpr uint16_t kBlockRemainderSize = kAlignSize - sizeof(uint16_t) * 2;
     static constexpr uint16_t kSuperBlockSize     = kAlignSize - sizeof(Block);
     static constexpr uint16_t kFirstBlockSize     = kMemorySize - kAlignSize * 3 + kBlockRemainderSize;
     static constexpr uint16_t kSuperBlockOffset   = kAlignSize - sizeof(uint16_t);
     static constexpr uint16_t kFirstBlockOffset   = kAlignSize * 2 - sizeof(uint16_t);
     static constexpr uint16_t kGuardBlockOffset   = kMemorySize - sizeof(uint16_t);
-
-    static_assert(kMemorySize % kAlignSize == 0, "The heap memory size is not aligned to kAlignSize!");
+    static constexpr uint16_t kCapacity           = kFirstBlockSize;
 
     /**
      * Returns the block at offset @p aOffset.
@@ -343,6 +435,7 @@ private:
         uint8_t  m8[kMemorySize];
         uint16_t m16[kMemorySize / sizeof(uint16_t)];
     } mMemory;
+#endif // OPENTHREAD_CONFIG_HEAP_TLSF_ENABLE
 };
 
 } // namespace Utils
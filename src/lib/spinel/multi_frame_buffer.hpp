@@ -90,6 +90,32 @@ public:
                                          : OT_ERROR_NO_BUFS;
     }
 
+    /**
+     * Writes a sequence of bytes into the buffer and updates the write pointer (if space is available).
+     *
+     * Either all bytes are written, or none (when there is insufficient buffer space).
+     *
+     * @param[in]  aData    A pointer to the bytes to be written to the buffer.
+     * @param[in]  aLength  The number of bytes to write.
+     *
+     * @retval OT_ERROR_NONE     Successfully wrote the bytes and updated the pointer.
+     * @retval OT_ERROR_NO_BUFS  Insufficient buffer space to write the bytes.
+     *
+     */
+    otError WriteBytes(const uint8_t *aData, uint16_t aLength)
+    {
+        otError error = OT_ERROR_NONE;
+
+        VerifyOrExit(CanWrite(aLength), error = OT_ERROR_NO_BUFS);
+
+        memcpy(mWritePointer, aData, aLength);
+        mWritePointer += aLength;
+        mRemainingLength -= aLength;
+
+    exit:
+        return error;
+    }
+
     /**
      * Undoes the last @p aUndoLength writes, removing them from frame.
      *
@@ -66,4 +66,31 @@
 #ifndef OPENTHREAD_SPINEL_CONFIG_ABORT_ON_UNEXPECTED_RCP_RESET_ENABLE
 #define OPENTHREAD_SPINEL_CONFIG_ABORT_ON_UNEXPECTED_RCP_RESET_ENABLE 0
 #endif
+
+/**
+ * @def OPENTHREAD_SPINEL_CONFIG_HDLC_SIMD_ENABLE
+ *
+ * Define as 1 to use SSE2 instructions (when supported by the target) to find the runs of bytes which the HDLC-lite
+ * encoder and decoder can copy without escaping.
+ *
+ * When disabled (or when the target does not support SSE2), the runs are found a byte at a time. If the slicing-by-8
+ * FCS is disabled as well, the encoder and decoder handle a byte at a time.
+ *
+ */
+#ifndef OPENTHREAD_SPINEL_CONFIG_HDLC_SIMD_ENABLE
+#define OPENTHREAD_SPINEL_CONFIG_HDLC_SIMD_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_SPINEL_CONFIG_HDLC_FCS_SLICING_BY_8_ENABLE
+ *
+ * Define as 1 to calculate the HDLC-lite FCS eight bytes at a time (slicing-by-8).
+ *
+ * This adds 3.5 KB of constant lookup tables.
+ *
+ */
+#ifndef OPENTHREAD_SPINEL_CONFIG_HDLC_FCS_SLICING_BY_8_ENABLE
+#define OPENTHREAD_SPINEL_CONFIG_HDLC_FCS_SLICING_BY_8_ENABLE 0
+#endif
+
 #endif // OPENTHREAD_SPINEL_CONFIG_H_
@@ -103,6 +103,8 @@ namespace Spinel {
  */
 template <typename InterfaceType> class RadioSpinel
 {
+    friend class RadioSpinelTester;
+
 public:
     /**
      * Initializes the spinel based OpenThread transceiver.
@@ -552,6 +554,14 @@ public:
      */
     uint64_t GetTxRadioEndUs(void) const { return mTxRadioEndUs; }
 
+    /**
+     * Returns the timeout timepoint of the oldest outstanding asynchronous request.
+     *
+     * @returns The timeout timepoint of the oldest outstanding asynchronous request, or `UINT64_MAX` if there is none.
+     *
+     */
+    uint64_t GetAsyncRequestEndUs(void) const;
+
     /**
      * Processes any pending the I/O data.
      *
@@ -932,6 +942,7 @@ private:
         kVersionStringSize     = 128,  ///< Max size of version string.
         kCapsBufferSize        = 100,  ///< Max buffer size used to store `SPINEL_PROP_CAPS` value.
         kChannelMaskBufferSize = 32,   ///< Max buffer size used to store `SPINEL_PROP_PHY_CHAN_SUPPORTED` value.
+        kMaxAsyncRequests      = 8,    ///< Max number of outstanding asynchronous requests.
     };
 
     enum State
@@ -945,6 +956,24 @@ private:
 
     typedef otError (RadioSpinel::*ResponseHandler)(const uint8_t *aBuffer, uint16_t aLength);
 
+    /**
+     * Is called when the response of an asynchronous request is received.
+     *
+     * The handler is invoked from the frame receive path, possibly while a synchronous request is waiting for its own
+     * response, so it MUST NOT issue synchronous requests or call into the core stack.
+     *
+     */
+    typedef void (RadioSpinel::*AsyncResponseHandler)(spinel_prop_key_t aKey, otError aError);
+
+    struct AsyncRequest
+    {
+        spinel_tid_t         mTid;             ///< The transaction id, zero if the entry is free.
+        spinel_prop_key_t    mKey;             ///< The property key of the request.
+        uint32_t             mExpectedCommand; ///< Expected response command of the request.
+        uint64_t             mEndUs;           ///< The timepoint at which the request times out.
+        AsyncResponseHandler mHandler;         ///< The handler to call when the response is received.
+    };
+
     static void HandleReceivedFrame(void *aContext);
 
     void    ResetRcp(bool aResetRadio);
@@ -985,6 +1014,34 @@ private:
                                         const char       *aFormat,
                                         va_list           aArgs);
     otError WaitResponse(bool aHandleRcpTimeout = true);
+
+    /**
+     * Sends a spinel command without waiting for its response.
+     *
+     * The response is matched by transaction id and passed to @p aHandler. When all asynchronous request entries are
+     * in use, this method first waits for the outstanding requests to complete. The RCP processes commands in order,
+     * so a later synchronous request on the same property observes the result of an earlier asynchronous one.
+     *
+     */
+    otError RequestAsyncV(uint32_t             aExpectedCommand,
+                          uint32_t             aCommand,
+                          spinel_prop_key_t    aKey,
+                          AsyncResponseHandler aHandler,
+                          const char          *aFormat,
+                          va_list              aArgs);
+    otError SetAsync(spinel_prop_key_t aKey, AsyncResponseHandler aHandler, const char *aFormat, ...);
+    otError InsertAsync(spinel_prop_key_t aKey, AsyncResponseHandler aHandler, const char *aFormat, ...);
+    otError WaitAsyncResponses(void);
+    bool    HandleAsyncResponse(spinel_tid_t      aTid,
+                                uint32_t          aCommand,
+                                spinel_prop_key_t aKey,
+                                const uint8_t    *aBuffer,
+                                uint16_t          aLength);
+    void    ProcessAsyncRequests(void);
+    void    ClearAsyncRequests(void);
+    void    HandleAsyncSetDone(spinel_prop_key_t aKey, otError aError);
+    void    HandleAsyncCriticalSetDone(spinel_prop_key_t aKey, otError aError);
+
     otError SendCommand(uint32_t          aCommand,
                         spinel_prop_key_t aKey,
                         spinel_tid_t      aTid,
@@ -1027,7 +1084,7 @@ private:
     void RecoverFromRcpFailure(void);
 
 #if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
-    void RestoreProperties(void);
+    otError RestoreProperties(void);
 #endif
     void UpdateParseErrorCount(otError aError)
     {
@@ -1053,6 +1110,9 @@ private:
     uint32_t          mExpectedCommand; ///< Expected response command of current transaction.
     otError           mError;           ///< The result of current transaction.
 
+    AsyncRequest mAsyncRequests[kMaxAsyncRequests]; ///< Outstanding asynchronous requests.
+    uint8_t      mNumAsyncRequests;                 ///< Number of outstanding asynchronous requests.
+
     uint8_t       mRxPsdu[OT_RADIO_FRAME_MAX_SIZE];
     uint8_t       mTxPsdu[OT_RADIO_FRAME_MAX_SIZE];
     uint8_t       mAckPsdu[OT_RADIO_FRAME_MAX_SIZE];
@@ -1081,6 +1141,7 @@ private:
 
     bool    mResetRadioOnStartup : 1; ///< Whether should send reset command when init.
     int16_t mRcpFailureCount;         ///< Count of consecutive RCP failures.
+    int16_t mRcpRestoreFailureCount;  ///< Count of recovery attempts which failed to restore the RCP properties.
 
     // Properties set by core.
     uint8_t      mKeyIdMode;
@@ -176,6 +176,7 @@ RadioSpinel<InterfaceType>::RadioSpinel(void)
     , mPropertyFormat(nullptr)
     , mExpectedCommand(0)
     , mError(OT_ERROR_NONE)
+    , mNumAsyncRequests(0)
     , mTransmitFrame(nullptr)
     , mShortAddress(0)
     , mPanId(0xffff)
@@ -189,6 +190,7 @@ RadioSpinel<InterfaceType>::RadioSpinel(void)
     , mIsTimeSynced(false)
 #if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
     , mRcpFailureCount(0)
+    , mRcpRestoreFailureCount(0)
     , mSrcMatchShortEntryCount(0)
     , mSrcMatchExtEntryCount(0)
     , mMacKeySet(false)
@@ -210,6 +212,7 @@ RadioSpinel<InterfaceType>::RadioSpinel(void)
 {
     mVersion[0] = '\0';
     memset(&mRadioSpinelMetrics, 0, sizeof(mRadioSpinelMetrics));
+    ClearAsyncRequests();
 }
 
 template <typename InterfaceType>
@@ -596,7 +599,7 @@ void RadioSpinel<InterfaceType>::HandleResponse(const uint8_t *aBuffer, uint16_t
         FreeTid(mTxRadioTid);
         mTxRadioTid = 0;
     }
-    else
+    else if (!HandleAsyncResponse(SPINEL_HEADER_GET_TID(header), cmd, key, data, static_cast<uint16_t>(len)))
     {
         otLogWarnPlat("Unexpected Spinel transaction message: %u", SPINEL_HEADER_GET_TID(header));
         error = OT_ERROR_DROP;
@@ -951,6 +954,8 @@ template <typename InterfaceType> void RadioSpinel<InterfaceType>::Process(const
 
     ProcessRadioStateMachine();
     RecoverFromRcpFailure();
+    ProcessAsyncRequests();
+    RecoverFromRcpFailure();
     CalcRcpTimeOffset();
 }
 
@@ -1001,12 +1006,12 @@ otError RadioSpinel<InterfaceType>::SetMacKey(uint8_t                 aKeyIdMode
     OT_UNUSED_VARIABLE(aKeySize);
 #endif
 
-    SuccessOrExit(error = Set(SPINEL_PROP_RCP_MAC_KEY,
-                              SPINEL_DATATYPE_UINT8_S SPINEL_DATATYPE_UINT8_S SPINEL_DATATYPE_DATA_WLEN_S
-                                  SPINEL_DATATYPE_DATA_WLEN_S SPINEL_DATATYPE_DATA_WLEN_S,
-                              aKeyIdMode, aKeyId, aPrevKey->mKeyMaterial.mKey.m8, sizeof(otMacKey),
-                              aCurrKey->mKeyMaterial.mKey.m8, sizeof(otMacKey), aNextKey->mKeyMaterial.mKey.m8,
-                              sizeof(otMacKey)));
+    SuccessOrExit(error = SetAsync(SPINEL_PROP_RCP_MAC_KEY, &RadioSpinel::HandleAsyncCriticalSetDone,
+                                   SPINEL_DATATYPE_UINT8_S SPINEL_DATATYPE_UINT8_S SPINEL_DATATYPE_DATA_WLEN_S
+                                       SPINEL_DATATYPE_DATA_WLEN_S SPINEL_DATATYPE_DATA_WLEN_S,
+                                   aKeyIdMode, aKeyId, aPrevKey->mKeyMaterial.mKey.m8, sizeof(otMacKey),
+                                   aCurrKey->mKeyMaterial.mKey.m8, sizeof(otMacKey), aNextKey->mKeyMaterial.mKey.m8,
+                                   sizeof(otMacKey)));
 
 #if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
     mKeyIdMode = aKeyIdMode;
@@ -1026,8 +1031,8 @@ otError RadioSpinel<InterfaceType>::SetMacFrameCounter(uint32_t aMacFrameCounter
 {
     otError error;
 
-    SuccessOrExit(error = Set(SPINEL_PROP_RCP_MAC_FRAME_COUNTER, SPINEL_DATATYPE_UINT32_S SPINEL_DATATYPE_BOOL_S,
-                              aMacFrameCounter, aSetIfLarger));
+    SuccessOrExit(error = SetAsync(SPINEL_PROP_RCP_MAC_FRAME_COUNTER, &RadioSpinel::HandleAsyncCriticalSetDone,
+                                   SPINEL_DATATYPE_UINT32_S SPINEL_DATATYPE_BOOL_S, aMacFrameCounter, aSetIfLarger));
 
 exit:
     return error;
@@ -1352,9 +1357,13 @@ otError RadioSpinel<InterfaceType>::EnergyScan(uint8_t aScanChannel, uint16_t aS
     mEnergyScanning = true;
 #endif
 
-    SuccessOrExit(error = Set(SPINEL_PROP_MAC_SCAN_MASK, SPINEL_DATATYPE_DATA_S, &aScanChannel, sizeof(uint8_t)));
-    SuccessOrExit(error = Set(SPINEL_PROP_MAC_SCAN_PERIOD, SPINEL_DATATYPE_UINT16_S, aScanDuration));
-    SuccessOrExit(error = Set(SPINEL_PROP_MAC_SCAN_STATE, SPINEL_DATATYPE_UINT8_S, SPINEL_SCAN_STATE_ENERGY));
+    // The scan parameters are pipelined, the RCP applies them in order before starting the scan.
+    SuccessOrExit(error = SetAsync(SPINEL_PROP_MAC_SCAN_MASK, &RadioSpinel::HandleAsyncSetDone, SPINEL_DATATYPE_DATA_S,
+                                   &aScanChannel, sizeof(uint8_t)));
+    SuccessOrExit(error = SetAsync(SPINEL_PROP_MAC_SCAN_PERIOD, &RadioSpinel::HandleAsyncSetDone,
+                                   SPINEL_DATATYPE_UINT16_S, aScanDuration));
+    SuccessOrExit(error = SetAsync(SPINEL_PROP_MAC_SCAN_STATE, &RadioSpinel::HandleAsyncSetDone,
+                                   SPINEL_DATATYPE_UINT8_S, SPINEL_SCAN_STATE_ENERGY));
 
     mChannel = aScanChannel;
 
@@ -1511,6 +1520,223 @@ exit:
     return mError;
 }
 
+template <typename InterfaceType>
+otError RadioSpinel<InterfaceType>::SetAsync(spinel_prop_key_t    aKey,
+                                             AsyncResponseHandler aHandler,
+                                             const char          *aFormat,
+                                             ...)
+{
+    otError error;
+    va_list args;
+
+    va_start(args, aFormat);
+    error = RequestAsyncV(SPINEL_CMD_PROP_VALUE_IS, SPINEL_CMD_PROP_VALUE_SET, aKey, aHandler, aFormat, args);
+    va_end(args);
+
+    return error;
+}
+
+template <typename InterfaceType>
+otError RadioSpinel<InterfaceType>::InsertAsync(spinel_prop_key_t    aKey,
+                                                AsyncResponseHandler aHandler,
+                                                const char          *aFormat,
+                                                ...)
+{
+    otError error;
+    va_list args;
+
+    va_start(args, aFormat);
+    error = RequestAsyncV(SPINEL_CMD_PROP_VALUE_INSERTED, SPINEL_CMD_PROP_VALUE_INSERT, aKey, aHandler, aFormat, args);
+    va_end(args);
+
+    return error;
+}
+
+template <typename InterfaceType>
+otError RadioSpinel<InterfaceType>::RequestAsyncV(uint32_t             aExpectedCommand,
+                                                  uint32_t             aCommand,
+                                                  spinel_prop_key_t    aKey,
+                                                  AsyncResponseHandler aHandler,
+                                                  const char          *aFormat,
+                                                  va_list              aArgs)
+{
+    otError       error   = OT_ERROR_NONE;
+    AsyncRequest *request = nullptr;
+    spinel_tid_t  tid;
+
+    assert(aHandler != nullptr);
+
+    RecoverFromRcpFailure();
+
+    if (mNumAsyncRequests == kMaxAsyncRequests)
+    {
+        SuccessOrExit(error = WaitAsyncResponses());
+    }
+
+    for (AsyncRequest &entry : mAsyncRequests)
+    {
+        if (entry.mTid == 0)
+        {
+            request = &entry;
+            break;
+        }
+    }
+
+    assert(request != nullptr);
+
+    tid = GetNextTid();
+    VerifyOrExit(tid > 0, error = OT_ERROR_BUSY);
+
+    error = SendCommand(aCommand, aKey, tid, aFormat, aArgs);
+
+    if (error != OT_ERROR_NONE)
+    {
+        FreeTid(tid);
+        ExitNow();
+    }
+
+    request->mTid             = tid;
+    request->mKey             = aKey;
+    request->mExpectedCommand = aExpectedCommand;
+    request->mEndUs           = otPlatTimeGet() + kMaxWaitTime * US_PER_MS;
+    request->mHandler         = aHandler;
+    mNumAsyncRequests++;
+
+exit:
+    return error;
+}
+
+template <typename InterfaceType> otError RadioSpinel<InterfaceType>::WaitAsyncResponses(void)
+{
+    otError error = OT_ERROR_NONE;
+
+    while (mNumAsyncRequests > 0)
+    {
+        uint64_t end = GetAsyncRequestEndUs();
+        uint64_t now = otPlatTimeGet();
+
+        if ((end <= now) || (mSpinelInterface.WaitForFrame(end - now) != OT_ERROR_NONE))
+        {
+            otLogWarnPlat("Wait for async response timeout");
+            ClearAsyncRequests();
+            HandleRcpTimeout();
+            ExitNow(error = OT_ERROR_RESPONSE_TIMEOUT);
+        }
+    }
+
+exit:
+    return error;
+}
+
+template <typename InterfaceType>
+bool RadioSpinel<InterfaceType>::HandleAsyncResponse(spinel_tid_t      aTid,
+                                                     uint32_t          aCommand,
+                                                     spinel_prop_key_t aKey,
+                                                     const uint8_t    *aBuffer,
+                                                     uint16_t          aLength)
+{
+    bool                 handled = false;
+    AsyncRequest        *request = nullptr;
+    otError              error   = OT_ERROR_NONE;
+    spinel_prop_key_t    key;
+    AsyncResponseHandler handler;
+
+    for (AsyncRequest &entry : mAsyncRequests)
+    {
+        if (entry.mTid == aTid)
+        {
+            request = &entry;
+            break;
+        }
+    }
+
+    VerifyOrExit(request != nullptr);
+
+    if (aKey == SPINEL_PROP_LAST_STATUS)
+    {
+        spinel_status_t status;
+        spinel_ssize_t  unpacked = spinel_datatype_unpack(aBuffer, aLength, "i", &status);
+
+        error = (unpacked > 0) ? SpinelStatusToOtError(status) : OT_ERROR_PARSE;
+    }
+    else if (aKey != request->mKey || aCommand != request->mExpectedCommand)
+    {
+        error = OT_ERROR_DROP;
+    }
+
+    // Release the entry before calling the handler so that it may reuse it.
+    key           = request->mKey;
+    handler       = request->mHandler;
+    request->mTid = 0;
+    mNumAsyncRequests--;
+    FreeTid(aTid);
+    handled = true;
+
+    UpdateParseErrorCount(error);
+    (this->*handler)(key, error);
+
+exit:
+    return handled;
+}
+
+template <typename InterfaceType> void RadioSpinel<InterfaceType>::ProcessAsyncRequests(void)
+{
+    VerifyOrExit(mNumAsyncRequests > 0 && otPlatTimeGet() >= GetAsyncRequestEndUs());
+
+    otLogWarnPlat("Async response timeout");
+    ClearAsyncRequests();
+    HandleRcpTimeout();
+
+exit:
+    return;
+}
+
+template <typename InterfaceType> void RadioSpinel<InterfaceType>::ClearAsyncRequests(void)
+{
+    for (AsyncRequest &entry : mAsyncRequests)
+    {
+        if (entry.mTid != 0)
+        {
+            FreeTid(entry.mTid);
+        }
+
+        entry.mTid = 0;
+    }
+
+    mNumAsyncRequests = 0;
+}
+
+template <typename InterfaceType> uint64_t RadioSpinel<InterfaceType>::GetAsyncRequestEndUs(void) const
+{
+    uint64_t endUs = UINT64_MAX;
+
+    for (const AsyncRequest &entry : mAsyncRequests)
+    {
+        if (entry.mTid != 0 && entry.mEndUs < endUs)
+        {
+            endUs = entry.mEndUs;
+        }
+    }
+
+    return endUs;
+}
+
+template <typename InterfaceType>
+void RadioSpinel<InterfaceType>::HandleAsyncSetDone(spinel_prop_key_t aKey, otError aError)
+{
+    if (aError != OT_ERROR_NONE)
+    {
+        otLogWarnPlat("Async set of property %lu failed: %s", ToUlong(aKey), otThreadErrorToString(aError));
+    }
+}
+
+template <typename InterfaceType>
+void RadioSpinel<InterfaceType>::HandleAsyncCriticalSetDone(spinel_prop_key_t aKey, otError aError)
+{
+    HandleAsyncSetDone(aKey, aError);
+    SuccessOrDie(aError);
+}
+
 template <typename InterfaceType> spinel_tid_t RadioSpinel<InterfaceType>::GetNextTid(void)
 {
     spinel_tid_t tid = mCmdNextTid;
@@ -2078,6 +2304,7 @@ template <typename InterfaceType> void RadioSpinel<InterfaceType>::RecoverFromRc
 
     mState = kStateDisabled;
     mRxFrameBuffer.Clear();
+    ClearAsyncRequests();
     mCmdTidsInUse = 0;
     mCmdNextTid   = 1;
     mTxRadioTid   = 0;
@@ -2089,7 +2316,16 @@ template <typename InterfaceType> void RadioSpinel<InterfaceType>::RecoverFromRc
     SuccessOrDie(Set(SPINEL_PROP_PHY_ENABLED, SPINEL_DATATYPE_BOOL_S, true));
     mState = kStateSleep;
 
-    RestoreProperties();
+    if ((RestoreProperties() != OT_ERROR_NONE) || mRcpFailed)
+    {
+        // The RCP failed again while being restored. Keep the state being recovered so that the next attempt
+        // restores it, and keep the failure count so that repeated failures are bounded by `kMaxFailureCount`.
+        // The count is released once a later attempt completes the recovery.
+        otLogWarnPlat("Failed to restore RCP properties");
+        ++mRcpRestoreFailureCount;
+        mState = recoveringState;
+        ExitNow();
+    }
 
     switch (recoveringState)
     {
@@ -2113,7 +2349,8 @@ template <typename InterfaceType> void RadioSpinel<InterfaceType>::RecoverFromRc
         SuccessOrDie(EnergyScan(mScanChannel, mScanDuration));
     }
 
-    --mRcpFailureCount;
+    mRcpFailureCount -= 1 + mRcpRestoreFailureCount;
+    mRcpRestoreFailureCount = 0;
     otLogNotePlat("RCP recovery is done");
 
 exit:
@@ -2122,63 +2359,78 @@ exit:
 }
 
 #if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
-template <typename InterfaceType> void RadioSpinel<InterfaceType>::RestoreProperties(void)
+template <typename InterfaceType> otError RadioSpinel<InterfaceType>::RestoreProperties(void)
 {
+    otError               error = OT_ERROR_NONE;
     Settings::NetworkInfo networkInfo;
 
-    SuccessOrDie(Set(SPINEL_PROP_MAC_15_4_PANID, SPINEL_DATATYPE_UINT16_S, mPanId));
-    SuccessOrDie(Set(SPINEL_PROP_MAC_15_4_SADDR, SPINEL_DATATYPE_UINT16_S, mShortAddress));
-    SuccessOrDie(Set(SPINEL_PROP_MAC_15_4_LADDR, SPINEL_DATATYPE_EUI64_S, mExtendedAddress.m8));
-    SuccessOrDie(Set(SPINEL_PROP_PHY_CHAN, SPINEL_DATATYPE_UINT8_S, mChannel));
+    // The properties are pipelined, a failure reported in the response is fatal. A response timeout marks the RCP
+    // as failed again, in which case the recovery is retried.
+    SuccessOrExit(error = SetAsync(SPINEL_PROP_MAC_15_4_PANID, &RadioSpinel::HandleAsyncCriticalSetDone,
+                                   SPINEL_DATATYPE_UINT16_S, mPanId));
+    SuccessOrExit(error = SetAsync(SPINEL_PROP_MAC_15_4_SADDR, &RadioSpinel::HandleAsyncCriticalSetDone,
+                                   SPINEL_DATATYPE_UINT16_S, mShortAddress));
+    SuccessOrExit(error = SetAsync(SPINEL_PROP_MAC_15_4_LADDR, &RadioSpinel::HandleAsyncCriticalSetDone,
+                                   SPINEL_DATATYPE_EUI64_S, mExtendedAddress.m8));
+    SuccessOrExit(error = SetAsync(SPINEL_PROP_PHY_CHAN, &RadioSpinel::HandleAsyncCriticalSetDone,
+                                   SPINEL_DATATYPE_UINT8_S, mChannel));
 
     if (mMacKeySet)
     {
-        SuccessOrDie(Set(SPINEL_PROP_RCP_MAC_KEY,
-                         SPINEL_DATATYPE_UINT8_S SPINEL_DATATYPE_UINT8_S SPINEL_DATATYPE_DATA_WLEN_S
-                             SPINEL_DATATYPE_DATA_WLEN_S SPINEL_DATATYPE_DATA_WLEN_S,
-                         mKeyIdMode, mKeyId, mPrevKey.m8, sizeof(otMacKey), mCurrKey.m8, sizeof(otMacKey), mNextKey.m8,
-                         sizeof(otMacKey)));
+        SuccessOrExit(error = SetAsync(SPINEL_PROP_RCP_MAC_KEY, &RadioSpinel::HandleAsyncCriticalSetDone,
+                                       SPINEL_DATATYPE_UINT8_S SPINEL_DATATYPE_UINT8_S SPINEL_DATATYPE_DATA_WLEN_S
+                                           SPINEL_DATATYPE_DATA_WLEN_S SPINEL_DATATYPE_DATA_WLEN_S,
+                                       mKeyIdMode, mKeyId, mPrevKey.m8, sizeof(otMacKey), mCurrKey.m8,
+                                       sizeof(otMacKey), mNextKey.m8, sizeof(otMacKey)));
     }
 
     if (mInstance != nullptr)
     {
         SuccessOrDie(static_cast<Instance *>(mInstance)->template Get<Settings>().Read(networkInfo));
-        SuccessOrDie(
-            Set(SPINEL_PROP_RCP_MAC_FRAME_COUNTER, SPINEL_DATATYPE_UINT32_S, networkInfo.GetMacFrameCounter()));
+        SuccessOrExit(error = SetAsync(SPINEL_PROP_RCP_MAC_FRAME_COUNTER, &RadioSpinel::HandleAsyncCriticalSetDone,
+                                       SPINEL_DATATYPE_UINT32_S, networkInfo.GetMacFrameCounter()));
     }
 
     for (int i = 0; i < mSrcMatchShortEntryCount; ++i)
     {
-        SuccessOrDie(
-            Insert(SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES, SPINEL_DATATYPE_UINT16_S, mSrcMatchShortEntries[i]));
+        SuccessOrExit(error = InsertAsync(SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES,
+                                          &RadioSpinel::HandleAsyncCriticalSetDone, SPINEL_DATATYPE_UINT16_S,
+                                          mSrcMatchShortEntries[i]));
     }
 
     for (int i = 0; i < mSrcMatchExtEntryCount; ++i)
     {
-        SuccessOrDie(
-            Insert(SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES, SPINEL_DATATYPE_EUI64_S, mSrcMatchExtEntries[i].m8));
+        SuccessOrExit(error = InsertAsync(SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES,
+                                          &RadioSpinel::HandleAsyncCriticalSetDone, SPINEL_DATATYPE_EUI64_S,
+                                          mSrcMatchExtEntries[i].m8));
     }
 
     if (mCcaEnergyDetectThresholdSet)
     {
-        SuccessOrDie(Set(SPINEL_PROP_PHY_CCA_THRESHOLD, SPINEL_DATATYPE_INT8_S, mCcaEnergyDetectThreshold));
+        SuccessOrExit(error = SetAsync(SPINEL_PROP_PHY_CCA_THRESHOLD, &RadioSpinel::HandleAsyncCriticalSetDone,
+                                       SPINEL_DATATYPE_INT8_S, mCcaEnergyDetectThreshold));
     }
 
     if (mTransmitPowerSet)
     {
-        SuccessOrDie(Set(SPINEL_PROP_PHY_TX_POWER, SPINEL_DATATYPE_INT8_S, mTransmitPower));
+        SuccessOrExit(error = SetAsync(SPINEL_PROP_PHY_TX_POWER, &RadioSpinel::HandleAsyncCriticalSetDone,
+                                       SPINEL_DATATYPE_INT8_S, mTransmitPower));
     }
 
     if (mCoexEnabledSet)
     {
-        SuccessOrDie(Set(SPINEL_PROP_RADIO_COEX_ENABLE, SPINEL_DATATYPE_BOOL_S, mCoexEnabled));
+        SuccessOrExit(error = SetAsync(SPINEL_PROP_RADIO_COEX_ENABLE, &RadioSpinel::HandleAsyncCriticalSetDone,
+                                       SPINEL_DATATYPE_BOOL_S, mCoexEnabled));
     }
 
     if (mFemLnaGainSet)
     {
-        SuccessOrDie(Set(SPINEL_PROP_PHY_FEM_LNA_GAIN, SPINEL_DATATYPE_INT8_S, mFemLnaGain));
+        SuccessOrExit(error = SetAsync(SPINEL_PROP_PHY_FEM_LNA_GAIN, &RadioSpinel::HandleAsyncCriticalSetDone,
+                                       SPINEL_DATATYPE_INT8_S, mFemLnaGain));
     }
 
+    SuccessOrExit(error = WaitAsyncResponses());
+
 #if OPENTHREAD_POSIX_CONFIG_MAX_POWER_TABLE_ENABLE
     for (uint8_t channel = Radio::kChannelMin; channel <= Radio::kChannelMax; channel++)
     {
@@ -2187,9 +2439,9 @@ template <typename InterfaceType> void RadioSpinel<InterfaceType>::RestoreProper
         if (power != OT_RADIO_POWER_INVALID)
         {
             // Some old RCPs doesn't support max transmit power
-            otError error = SetChannelMaxTransmitPower(channel, power);
+            otError powerError = SetChannelMaxTransmitPower(channel, power);
 
-            if (error != OT_ERROR_NONE && error != OT_ERROR_NOT_FOUND)
+            if (powerError != OT_ERROR_NONE && powerError != OT_ERROR_NOT_FOUND)
             {
                 DieNow(OT_EXIT_FAILURE);
             }
@@ -2198,6 +2450,10 @@ template <typename InterfaceType> void RadioSpinel<InterfaceType>::RestoreProper
 #endif // OPENTHREAD_POSIX_CONFIG_MAX_POWER_TABLE_ENABLE
 
     CalcRcpTimeOffset();
+
+exit:
+    VerifyOrDie(error == OT_ERROR_NONE || mRcpFailed, OT_EXIT_FAILURE);
+    return error;
 }
 #endif // OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
 
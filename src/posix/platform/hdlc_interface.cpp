@@ -47,6 +47,11 @@
 #include <pty.h>
 #endif
 #endif
+#if OPENTHREAD_POSIX_CONFIG_RCP_IO_THREAD_ENABLE
+#include <poll.h>
+#include <signal.h>
+#include <sys/eventfd.h>
+#endif
 #include <stdarg.h>
 #include <stdlib.h>
 #include <sys/ioctl.h>
@@ -125,6 +130,15 @@
 
 #if OPENTHREAD_POSIX_CONFIG_RCP_BUS == OT_POSIX_RCP_BUS_UART
 
+#if OPENTHREAD_POSIX_CONFIG_RCP_IO_THREAD_ENABLE
+#if OPENTHREAD_POSIX_VIRTUAL_TIME
+#error "OPENTHREAD_POSIX_CONFIG_RCP_IO_THREAD_ENABLE is not supported with OPENTHREAD_POSIX_VIRTUAL_TIME"
+#endif
+#ifndef __linux__
+#error "OPENTHREAD_POSIX_CONFIG_RCP_IO_THREAD_ENABLE is only supported on Linux"
+#endif
+#endif
+
 namespace ot {
 namespace Posix {
 
@@ -134,9 +148,22 @@ HdlcInterface::HdlcInterface(ReceiveFrameCallback aCallback, void *aCallbackCont
     , mReceiveFrameBuffer(aFrameBuffer)
     , mSockFd(-1)
     , mBaudRate(0)
+#if OPENTHREAD_POSIX_CONFIG_RCP_IO_THREAD_ENABLE
+    , mIoThreadRunning(false)
+    , mRxEventFd(-1)
+    , mRxSpaceEventFd(-1)
+    , mStopEventFd(-1)
+    , mIoThreadWaiting(false)
+    , mIoThreadErrno(0)
+    , mHdlcDecoder(mIoFrameBuffer, HandleHdlcFrame, this)
+#else
     , mHdlcDecoder(aFrameBuffer, HandleHdlcFrame, this)
+#endif
     , mRadioUrl(nullptr)
 {
+#if OPENTHREAD_POSIX_CONFIG_RCP_IO_THREAD_ENABLE
+    memset(&mRxLatencyHistogram, 0, sizeof(mRxLatencyHistogram));
+#endif
     memset(&mInterfaceMetrics, 0, sizeof(mInterfaceMetrics));
     mInterfaceMetrics.mRcpInterfaceType = OT_POSIX_RCP_BUS_UART;
 }
@@ -170,16 +197,49 @@ otError HdlcInterface::Init(const Url::Url &aRadioUrl)
 
     mRadioUrl = &aRadioUrl;
 
+#if OPENTHREAD_POSIX_CONFIG_RCP_IO_THREAD_ENABLE
+    VerifyOrDie((mRxEventFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)) != -1, OT_EXIT_ERROR_ERRNO);
+    VerifyOrDie((mRxSpaceEventFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)) != -1, OT_EXIT_ERROR_ERRNO);
+    VerifyOrDie((mStopEventFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)) != -1, OT_EXIT_ERROR_ERRNO);
+    StartIoThread();
+#endif
+
 exit:
     return error;
 }
 
 HdlcInterface::~HdlcInterface(void) { Deinit(); }
 
-void HdlcInterface::Deinit(void) { CloseFile(); }
+void HdlcInterface::Deinit(void)
+{
+#if OPENTHREAD_POSIX_CONFIG_RCP_IO_THREAD_ENABLE
+    StopIoThread();
+
+    if (mRxEventFd != -1)
+    {
+        close(mRxEventFd);
+        mRxEventFd = -1;
+    }
+
+    if (mRxSpaceEventFd != -1)
+    {
+        close(mRxSpaceEventFd);
+        mRxSpaceEventFd = -1;
+    }
+
+    if (mStopEventFd != -1)
+    {
+        close(mStopEventFd);
+        mStopEventFd = -1;
+    }
+#endif
+
+    CloseFile();
+}
 
-void HdlcInterface::Read(void)
+otError HdlcInterface::Read(void)
 {
+    otError error = OT_ERROR_NONE;
     uint8_t buffer[kMaxFrameSize];
     ssize_t rval;
 
@@ -191,8 +251,10 @@ void HdlcInterface::Read(void)
     }
     else if ((rval < 0) && (errno != EAGAIN) && (errno != EINTR))
     {
-        DieNow(OT_EXIT_ERROR_ERRNO);
+        error = OT_ERROR_FAILED;
     }
+
+    return error;
 }
 
 void HdlcInterface::Decode(const uint8_t *aBuffer, uint16_t aLength) { mHdlcDecoder.Decode(aBuffer, aLength); }
@@ -212,8 +274,16 @@ otError HdlcInterface::SendFrame(const uint8_t *aFrame, uint16_t aLength)
 exit:
     if ((error == OT_ERROR_NONE) && IsSpinelResetCommand(aFrame, aLength))
     {
+#if OPENTHREAD_POSIX_CONFIG_RCP_IO_THREAD_ENABLE
+        // The decoder and the file are owned by the I/O thread while it runs.
+        StopIoThread();
+        mIoFrameBuffer.Clear();
+#endif
         mHdlcDecoder.Reset();
         error = ResetConnection();
+#if OPENTHREAD_POSIX_CONFIG_RCP_IO_THREAD_ENABLE
+        StartIoThread();
+#endif
     }
 
     return error;
@@ -291,6 +361,33 @@ otError HdlcInterface::WaitForFrame(uint64_t aTimeoutUs)
         assert(false);
         break;
     }
+#elif OPENTHREAD_POSIX_CONFIG_RCP_IO_THREAD_ENABLE
+    // Frames may already be queued when called while a frame is being handled, the eventfd is then already drained.
+    if (mRxRing.GetReadSlot() == nullptr)
+    {
+        fd_set readFds;
+        int    rval;
+
+        timeout.tv_sec  = static_cast<time_t>(aTimeoutUs / US_PER_S);
+        timeout.tv_usec = static_cast<suseconds_t>(aTimeoutUs % US_PER_S);
+
+        FD_ZERO(&readFds);
+        FD_SET(mRxEventFd, &readFds);
+
+        rval = select(mRxEventFd + 1, &readFds, nullptr, nullptr, &timeout);
+
+        if (rval == 0)
+        {
+            ExitNow(error = OT_ERROR_RESPONSE_TIMEOUT);
+        }
+        else if (rval < 0)
+        {
+            VerifyOrDie(errno == EINTR, OT_EXIT_ERROR_ERRNO);
+            ExitNow();
+        }
+    }
+
+    ProcessRxRing();
 #else  // OPENTHREAD_POSIX_VIRTUAL_TIME
     timeout.tv_sec = static_cast<time_t>(aTimeoutUs / US_PER_S);
     timeout.tv_usec = static_cast<suseconds_t>(aTimeoutUs % US_PER_S);
@@ -310,7 +407,7 @@ otError HdlcInterface::WaitForFrame(uint64_t aTimeoutUs)
     {
         if (FD_ISSET(mSockFd, &read_fds))
         {
-            Read();
+            VerifyOrDie(Read() == OT_ERROR_NONE, OT_EXIT_ERROR_ERRNO);
         }
         else if (FD_ISSET(mSockFd, &error_fds))
         {
@@ -341,12 +438,21 @@ void HdlcInterface::UpdateFdSet(void *aMainloopContext)
 
     assert(context != nullptr);
 
+#if OPENTHREAD_POSIX_CONFIG_RCP_IO_THREAD_ENABLE
+    FD_SET(mRxEventFd, &context->mReadFdSet);
+
+    if (context->mMaxFd < mRxEventFd)
+    {
+        context->mMaxFd = mRxEventFd;
+    }
+#else
     FD_SET(mSockFd, &context->mReadFdSet);
 
     if (context->mMaxFd < mSockFd)
     {
         context->mMaxFd = mSockFd;
     }
+#endif
 }
 
 void HdlcInterface::Process(const void *aMainloopContext)
@@ -368,11 +474,18 @@ void HdlcInterface::Process(const void *aMainloopContext)
 
     assert(context != nullptr);
 
+#if OPENTHREAD_POSIX_CONFIG_RCP_IO_THREAD_ENABLE
+    if (FD_ISSET(mRxEventFd, &context->mReadFdSet))
+    {
+        ProcessRxRing();
+    }
+#else
     if (FD_ISSET(mSockFd, &context->mReadFdSet))
     {
-        Read();
+        VerifyOrDie(Read() == OT_ERROR_NONE, OT_EXIT_ERROR_ERRNO);
     }
 #endif
+#endif
 }
 
 otError HdlcInterface::WaitForWritable(void)
@@ -695,6 +808,43 @@ void HdlcInterface::HandleHdlcFrame(void *aContext, otError aError)
 }
 
 void HdlcInterface::HandleHdlcFrame(otError aError)
+{
+#if OPENTHREAD_POSIX_CONFIG_RCP_IO_THREAD_ENABLE
+    // Called on the I/O thread, the frame is passed to the mainloop through `mRxRing`.
+    static const uint64_t kEvent = 1;
+    RxRing::Slot         *slot;
+
+    if ((aError == OT_ERROR_NONE) && (mIoFrameBuffer.GetLength() > sizeof(slot->mData)))
+    {
+        mRxRing.CountDropped();
+    }
+    else if ((slot = WaitForWriteSlot()) != nullptr)
+    {
+        slot->mTimestamp = otPlatTimeGet();
+        slot->mError     = aError;
+        slot->mLength    = 0;
+
+        if (aError == OT_ERROR_NONE)
+        {
+            slot->mLength = mIoFrameBuffer.GetLength();
+            memcpy(slot->mData, mIoFrameBuffer.GetFrame(), slot->mLength);
+        }
+
+        mRxRing.Commit();
+
+        if (write(mRxEventFd, &kEvent, sizeof(kEvent)) != sizeof(kEvent))
+        {
+            ReportIoThreadError(errno);
+        }
+    }
+
+    mIoFrameBuffer.Clear();
+#else
+    HandleReceivedFrame(aError);
+#endif
+}
+
+void HdlcInterface::HandleReceivedFrame(otError aError)
 {
     mInterfaceMetrics.mTransferredFrameCount++;
 
@@ -713,6 +863,210 @@ void HdlcInterface::HandleHdlcFrame(otError aError)
     }
 }
 
+#if OPENTHREAD_POSIX_CONFIG_RCP_IO_THREAD_ENABLE
+void HdlcInterface::StartIoThread(void)
+{
+    sigset_t allSignals;
+    sigset_t oldSignals;
+
+    VerifyOrExit(!mIoThreadRunning && mSockFd != -1);
+
+    mIoThreadErrno.store(0, std::memory_order_relaxed);
+
+    // Block all signals on the I/O thread so that they keep interrupting the mainloop.
+    sigfillset(&allSignals);
+    VerifyOrDie(pthread_sigmask(SIG_SETMASK, &allSignals, &oldSignals) == 0, OT_EXIT_FAILURE);
+    VerifyOrDie(pthread_create(&mIoThread, nullptr, IoThreadMain, this) == 0, OT_EXIT_FAILURE);
+    VerifyOrDie(pthread_sigmask(SIG_SETMASK, &oldSignals, nullptr) == 0, OT_EXIT_FAILURE);
+
+    mIoThreadRunning = true;
+
+exit:
+    return;
+}
+
+void HdlcInterface::StopIoThread(void)
+{
+    static const uint64_t kEvent = 1;
+    uint64_t              value;
+
+    VerifyOrExit(mIoThreadRunning);
+
+    VerifyOrDie(write(mStopEventFd, &kEvent, sizeof(kEvent)) == sizeof(kEvent), OT_EXIT_ERROR_ERRNO);
+    VerifyOrDie(pthread_join(mIoThread, nullptr) == 0, OT_EXIT_FAILURE);
+    IgnoreReturnValue(read(mStopEventFd, &value, sizeof(value)));
+
+    mIoThreadRunning = false;
+
+exit:
+    return;
+}
+
+void *HdlcInterface::IoThreadMain(void *aContext)
+{
+    static_cast<HdlcInterface *>(aContext)->RunIoThread();
+    return nullptr;
+}
+
+void HdlcInterface::RunIoThread(void)
+{
+    struct pollfd fds[] = {{mSockFd, POLLIN, 0}, {mStopEventFd, POLLIN, 0}};
+
+    // The I/O thread never exits the process, it stops on the first error and leaves it to the mainloop.
+    while (mIoThreadErrno.load(std::memory_order_relaxed) == 0)
+    {
+        int rval = poll(fds, OT_ARRAY_LENGTH(fds), -1);
+
+        if (rval < 0)
+        {
+            if (errno != EINTR)
+            {
+                ReportIoThreadError(errno);
+            }
+
+            continue;
+        }
+
+        if (fds[1].revents != 0)
+        {
+            break;
+        }
+
+        if ((fds[0].revents != 0) && (Read() != OT_ERROR_NONE))
+        {
+            ReportIoThreadError(errno);
+        }
+    }
+}
+
+HdlcInterface::RxRing::Slot *HdlcInterface::WaitForWriteSlot(void)
+{
+    struct pollfd fds[] = {{mRxSpaceEventFd, POLLIN, 0}, {mStopEventFd, POLLIN, 0}};
+    RxRing::Slot *slot;
+    uint64_t      value;
+
+    while ((slot = mRxRing.GetWriteSlot()) == nullptr)
+    {
+        // The flag is set before checking the ring again, so that either the check sees the slots released by the
+        // mainloop or the mainloop sees the flag and signals `mRxSpaceEventFd`.
+        mIoThreadWaiting.store(true, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        if ((slot = mRxRing.GetWriteSlot()) != nullptr)
+        {
+            break;
+        }
+
+        if (poll(fds, OT_ARRAY_LENGTH(fds), -1) < 0)
+        {
+            VerifyOrExit(errno == EINTR, ReportIoThreadError(errno));
+            continue;
+        }
+
+        // The stop event is left set, `RunIoThread()` exits on it once the current data is decoded.
+        VerifyOrExit(fds[1].revents == 0);
+
+        IgnoreReturnValue(read(mRxSpaceEventFd, &value, sizeof(value)));
+    }
+
+exit:
+    mIoThreadWaiting.store(false, std::memory_order_relaxed);
+    return slot;
+}
+
+void HdlcInterface::ReportIoThreadError(int aErrno)
+{
+    static const uint64_t kEvent = 1;
+
+    mIoThreadErrno.store(aErrno, std::memory_order_release);
+    IgnoreReturnValue(write(mRxEventFd, &kEvent, sizeof(kEvent)));
+}
+
+void HdlcInterface::ProcessRxRing(void)
+{
+    static const uint64_t kEvent = 1;
+    uint64_t              value;
+    uint32_t              dropped;
+    int                   ioThreadErrno;
+    const RxRing::Slot   *slot;
+
+    IgnoreReturnValue(read(mRxEventFd, &value, sizeof(value)));
+
+    if (mRxRing.GetQueuedCount() > mRxLatencyHistogram.mMaxQueuedFrames)
+    {
+        mRxLatencyHistogram.mMaxQueuedFrames = mRxRing.GetQueuedCount();
+    }
+
+    dropped = mRxRing.GetDroppedCount();
+
+    if (dropped != mRxLatencyHistogram.mDroppedFrames)
+    {
+        otLogWarnPlat("%u RCP frames too long for the receive ring dropped",
+                      static_cast<unsigned int>(dropped - mRxLatencyHistogram.mDroppedFrames));
+        mRxLatencyHistogram.mDroppedFrames = dropped;
+    }
+
+    // The slot is released before handling the frame, the handler may wait for and process more frames.
+    while ((slot = mRxRing.GetReadSlot()) != nullptr)
+    {
+        otError error = slot->mError;
+
+        if (error == OT_ERROR_NONE)
+        {
+            if (slot->mLength <= mReceiveFrameBuffer.GetFrameMaxLength())
+            {
+                memcpy(mReceiveFrameBuffer.GetFrame(), slot->mData, slot->mLength);
+                IgnoreError(mReceiveFrameBuffer.SetLength(slot->mLength));
+            }
+            else
+            {
+                error = OT_ERROR_NO_BUFS;
+            }
+        }
+
+        UpdateRxLatency(slot->mTimestamp);
+        mRxRing.Release();
+
+        // Resumes the I/O thread if it waits for a slot, see `WaitForWriteSlot()`.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        if (mIoThreadWaiting.exchange(false, std::memory_order_relaxed))
+        {
+            IgnoreReturnValue(write(mRxSpaceEventFd, &kEvent, sizeof(kEvent)));
+        }
+
+        HandleReceivedFrame(error);
+    }
+
+    // The frames decoded before the I/O thread failed are handled first.
+    ioThreadErrno = mIoThreadErrno.load(std::memory_order_acquire);
+
+    if (ioThreadErrno != 0)
+    {
+        errno = ioThreadErrno;
+        DieNow(OT_EXIT_ERROR_ERRNO);
+    }
+}
+
+void HdlcInterface::UpdateRxLatency(uint64_t aTimestamp)
+{
+    uint64_t latency = otPlatTimeGet() - aTimestamp;
+    uint8_t  index   = 0;
+
+    while (index < OT_SYS_RCP_RX_LATENCY_BUCKETS - 1 && (latency >> index) != 0)
+    {
+        index++;
+    }
+
+    mRxLatencyHistogram.mBuckets[index]++;
+
+    if (latency > mRxLatencyHistogram.mMaxLatencyUs)
+    {
+        mRxLatencyHistogram.mMaxLatencyUs = static_cast<uint32_t>(OT_MIN(latency, static_cast<uint64_t>(UINT32_MAX)));
+    }
+}
+#endif // OPENTHREAD_POSIX_CONFIG_RCP_IO_THREAD_ENABLE
+
 otError HdlcInterface::ResetConnection(void)
 {
     otError  error = OT_ERROR_NONE;
@@ -36,11 +36,21 @@
 
 #include "openthread-posix-config.h"
 #include "platform-posix.h"
+
+#if OPENTHREAD_POSIX_CONFIG_RCP_IO_THREAD_ENABLE
+#include <atomic>
+#include <pthread.h>
+#endif
+
 #include "lib/hdlc/hdlc.hpp"
 #include "lib/spinel/multi_frame_buffer.hpp"
 #include "lib/spinel/openthread-spinel-config.h"
 #include "lib/spinel/spinel_interface.hpp"
 
+#if OPENTHREAD_POSIX_CONFIG_RCP_IO_THREAD_ENABLE
+#include "spsc_frame_ring.hpp"
+#endif
+
 namespace ot {
 namespace Posix {
 
@@ -155,6 +165,16 @@ public:
      */
     const otRcpInterfaceMetrics *GetRcpInterfaceMetrics(void) const { return &mInterfaceMetrics; }
 
+#if OPENTHREAD_POSIX_CONFIG_RCP_IO_THREAD_ENABLE
+    /**
+     * Returns the latency histogram of frames received from the RCP.
+     *
+     * @returns The latency histogram of frames received from the RCP.
+     *
+     */
+    const otSysRcpRxLatencyHistogram *GetRxLatencyHistogram(void) const { return &mRxLatencyHistogram; }
+#endif
+
 private:
     /**
      * Is called when RCP is reset to recreate the connection with it.
@@ -168,8 +188,11 @@ private:
      * If a full HDLC frame is decoded while reading data, this method invokes the `HandleReceivedFrame()` (on the
      * `aCallback` object from constructor) to pass the received frame to be processed.
      *
+     * @retval OT_ERROR_NONE    Successfully read the data, or no data was available.
+     * @retval OT_ERROR_FAILED  Failed to read from the socket, `errno` indicates the error.
+     *
      */
-    void Read(void);
+    otError Read(void);
 
     /**
      * Waits for the socket file descriptor associated with the HDLC interface to become writable within
@@ -210,6 +233,49 @@ private:
 
     static void HandleHdlcFrame(void *aContext, otError aError);
     void        HandleHdlcFrame(otError aError);
+    void        HandleReceivedFrame(otError aError);
+
+#if OPENTHREAD_POSIX_CONFIG_RCP_IO_THREAD_ENABLE
+    typedef SpscFrameRing<OPENTHREAD_POSIX_CONFIG_RCP_IO_RING_SIZE, SPINEL_FRAME_BUFFER_SIZE> RxRing;
+
+    /**
+     * Starts the I/O thread which reads and decodes the data from the RCP.
+     *
+     */
+    void StartIoThread(void);
+
+    /**
+     * Stops the I/O thread and waits for it to exit.
+     *
+     */
+    void StopIoThread(void);
+
+    static void *IoThreadMain(void *aContext);
+    void         RunIoThread(void);
+
+    /**
+     * Waits on the I/O thread until the mainloop releases a slot of `mRxRing`, without reading from the RCP meanwhile.
+     *
+     * @returns A pointer to the slot, or `nullptr` if the I/O thread is stopped or failed.
+     *
+     */
+    RxRing::Slot *WaitForWriteSlot(void);
+
+    /**
+     * Reports a fatal error of the I/O thread to the mainloop, which exits from `ProcessRxRing()`.
+     *
+     * @param[in] aErrno  The `errno` of the failed call.
+     *
+     */
+    void ReportIoThreadError(int aErrno);
+
+    /**
+     * Passes the frames queued by the I/O thread to the `HandleReceivedFrame()` callback.
+     *
+     */
+    void ProcessRxRing(void);
+    void UpdateRxLatency(uint64_t aTimestamp);
+#endif
 
     /**
      * Opens file specified by aRadioUrl.
@@ -244,8 +310,24 @@ private:
     void                *mReceiveFrameContext;
     RxFrameBuffer       &mReceiveFrameBuffer;
 
-    int             mSockFd;
-    uint32_t        mBaudRate;
+    int      mSockFd;
+    uint32_t mBaudRate;
+
+#if OPENTHREAD_POSIX_CONFIG_RCP_IO_THREAD_ENABLE
+    // The I/O thread decodes into `mIoFrameBuffer`, copies the frames to `mRxRing` and signals `mRxEventFd`. While
+    // `mRxRing` is full it stops reading from the RCP and waits for the mainloop to signal `mRxSpaceEventFd`.
+    Spinel::FrameBuffer<SPINEL_FRAME_BUFFER_SIZE> mIoFrameBuffer;
+    RxRing                                        mRxRing;
+    pthread_t                                     mIoThread;
+    bool                                          mIoThreadRunning;
+    int                                           mRxEventFd;
+    int                                           mRxSpaceEventFd;
+    int                                           mStopEventFd;
+    std::atomic<bool>                             mIoThreadWaiting;
+    std::atomic<int>                              mIoThreadErrno;
+    otSysRcpRxLatencyHistogram                    mRxLatencyHistogram;
+#endif
+
     Hdlc::Decoder   mHdlcDecoder;
     const Url::Url *mRadioUrl;
 
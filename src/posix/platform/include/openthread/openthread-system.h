@@ -227,6 +227,63 @@ const otRcpInterfaceMetrics *otSysGetRcpInterfaceMetrics(void);
  */
 uint32_t otSysGetInfraNetifFlags(void);
 
+/**
+ * Represents the Thread network interface (TUN device) I/O counters.
+ *
+ */
+typedef struct otSysNetifCounters
+{
+    uint64_t mTunReadEvents;         ///< The number of TUN device readiness events processed.
+    uint64_t mTunReadPackets;        ///< The number of packets read from the TUN device.
+    uint32_t mTunMaxReadsPerEvent;   ///< The maximum number of packets read on a single readiness event.
+    uint64_t mTunWritePackets;       ///< The number of packets written to the TUN device.
+    uint64_t mTunWriteCopiesAvoided; ///< The number of packets written directly from the message buffers.
+} otSysNetifCounters;
+
+/**
+ * Returns the Thread network interface I/O counters.
+ *
+ * The average number of packets read on each TUN device readiness event is given by `mTunReadPackets` divided by
+ * `mTunReadEvents`.
+ *
+ * @returns The Thread network interface I/O counters.
+ *
+ */
+const otSysNetifCounters *otSysGetNetifCounters(void);
+
+/**
+ * Defines the number of buckets of the RCP receive latency histogram.
+ *
+ */
+#define OT_SYS_RCP_RX_LATENCY_BUCKETS 20
+
+/**
+ * Represents the latency of frames received from the RCP, from their arrival on the RCP I/O thread to their delivery
+ * to the stack on the mainloop.
+ *
+ * Bucket 0 counts the frames delivered in less than 1 microsecond, bucket `i` counts the frames delivered in
+ * [2^(i-1), 2^i) microseconds and the last bucket also counts all longer latencies.
+ *
+ */
+typedef struct otSysRcpRxLatencyHistogram
+{
+    uint32_t mBuckets[OT_SYS_RCP_RX_LATENCY_BUCKETS]; ///< The number of frames per latency bucket.
+    uint32_t mMaxLatencyUs;                           ///< The maximum latency (in microseconds).
+    uint32_t mDroppedFrames;                          ///< The number of frames dropped as too long for the ring.
+    uint16_t mMaxQueuedFrames;                        ///< The maximum number of frames queued for the mainloop.
+} otSysRcpRxLatencyHistogram;
+
+/**
+ * Returns the latency histogram of frames received from the RCP.
+ *
+ * The histogram is only available when the RCP is read on a dedicated I/O thread (see
+ * `OPENTHREAD_POSIX_CONFIG_RCP_IO_THREAD_ENABLE`).
+ *
+ * @returns The latency histogram, or `NULL` if not available.
+ *
+ */
+const otSysRcpRxLatencyHistogram *otSysGetRcpRxLatencyHistogram(void);
+
 typedef struct otSysInfraNetIfAddressCounters
 {
     uint32_t mLinkLocalAddresses;
@@ -409,7 +409,10 @@ void InfraNetif::SetUp(void)
 
     SuccessOrDie(otBorderRoutingInit(gInstance, mInfraIfIndex, platformInfraIfIsRunning()));
     SuccessOrDie(otBorderRoutingSetEnabled(gInstance, /* aEnabled */ true));
-    Mainloop::Manager::Get().Add(*this);
+    SuccessOrDie(Mainloop::Manager::Get().Watch(mIcmp6Watcher, mInfraIfIcmp6Socket, Mainloop::Watcher::kEventRead,
+                                                Mainloop::Watcher::kLevelTriggered));
+    SuccessOrDie(Mainloop::Manager::Get().Watch(mNetLinkWatcher, mNetLinkSocket, Mainloop::Watcher::kEventRead,
+                                                Mainloop::Watcher::kLevelTriggered));
 exit:
     return;
 }
@@ -418,7 +421,8 @@ void InfraNetif::TearDown(void)
 {
     VerifyOrExit(mInfraIfIndex != 0);
 
-    Mainloop::Manager::Get().Remove(*this);
+    Mainloop::Manager::Get().Unwatch(mIcmp6Watcher);
+    Mainloop::Manager::Get().Unwatch(mNetLinkWatcher);
 
 exit:
     return;
@@ -441,19 +445,18 @@ void InfraNetif::Deinit(void)
     mInfraIfIndex = 0;
 }
 
-void InfraNetif::Update(otSysMainloopContext &aContext)
+void InfraNetif::HandleIcmp6Events(void *aContext, uint8_t aEvents)
 {
-    VerifyOrExit(mInfraIfIcmp6Socket != -1);
-    VerifyOrExit(mNetLinkSocket != -1);
+    OT_UNUSED_VARIABLE(aEvents);
 
-    FD_SET(mInfraIfIcmp6Socket, &aContext.mReadFdSet);
-    aContext.mMaxFd = OT_MAX(aContext.mMaxFd, mInfraIfIcmp6Socket);
+    static_cast<InfraNetif *>(aContext)->ReceiveIcmp6Message();
+}
 
-    FD_SET(mNetLinkSocket, &aContext.mReadFdSet);
-    aContext.mMaxFd = OT_MAX(aContext.mMaxFd, mNetLinkSocket);
+void InfraNetif::HandleNetLinkEvents(void *aContext, uint8_t aEvents)
+{
+    OT_UNUSED_VARIABLE(aEvents);
 
-exit:
-    return;
+    static_cast<InfraNetif *>(aContext)->ReceiveNetLinkMessage();
 }
 
 void InfraNetif::ReceiveNetLinkMessage(void)
@@ -705,25 +708,6 @@ exit:
 }
 #endif // OPENTHREAD_POSIX_CONFIG_NAT64_AIL_PREFIX_ENABLE
 
-void InfraNetif::Process(const otSysMainloopContext &aContext)
-{
-    VerifyOrExit(mInfraIfIcmp6Socket != -1);
-    VerifyOrExit(mNetLinkSocket != -1);
-
-    if (FD_ISSET(mInfraIfIcmp6Socket, &aContext.mReadFdSet))
-    {
-        ReceiveIcmp6Message();
-    }
-
-    if (FD_ISSET(mNetLinkSocket, &aContext.mReadFdSet))
-    {
-        ReceiveNetLinkMessage();
-    }
-
-exit:
-    return;
-}
-
 InfraNetif &InfraNetif::Get(void)
 {
     static InfraNetif sInstance;
@@ -49,25 +49,9 @@ namespace Posix {
  * Manages infrastructure network interface.
  *
  */
-class InfraNetif : public Mainloop::Source, private NonCopyable
+class InfraNetif : private NonCopyable
 {
 public:
-    /**
-     * Updates the fd_set and timeout for mainloop.
-     *
-     * @param[in,out]   aContext    A reference to the mainloop context.
-     *
-     */
-    void Update(otSysMainloopContext &aContext) override;
-
-    /**
-     * Performs infrastructure network interface processing.
-     *
-     * @param[in]   aContext   A reference to the mainloop context.
-     *
-     */
-    void Process(const otSysMainloopContext &aContext) override;
-
     /**
      * Initializes the infrastructure network interface.
      *
@@ -181,11 +165,21 @@ private:
     static const otIp4Address kWellKnownIpv4OnlyAddress2; // 192.0.0.171
     static const uint8_t      kValidNat64PrefixLength[];
 
-    char     mInfraIfName[IFNAMSIZ];
-    uint32_t mInfraIfIndex       = 0;
-    int      mInfraIfIcmp6Socket = -1;
-    int      mNetLinkSocket      = -1;
-
+    InfraNetif(void)
+        : mIcmp6Watcher(HandleIcmp6Events, this)
+        , mNetLinkWatcher(HandleNetLinkEvents, this)
+    {
+    }
+
+    char              mInfraIfName[IFNAMSIZ];
+    uint32_t          mInfraIfIndex       = 0;
+    int               mInfraIfIcmp6Socket = -1;
+    int               mNetLinkSocket      = -1;
+    Mainloop::Watcher mIcmp6Watcher;
+    Mainloop::Watcher mNetLinkWatcher;
+
+    static void HandleIcmp6Events(void *aContext, uint8_t aEvents);
+    static void HandleNetLinkEvents(void *aContext, uint8_t aEvents);
     void        ReceiveNetLinkMessage(void);
     void        ReceiveIcmp6Message(void);
     bool        HasLinkLocalAddress(void) const;
@@ -26,11 +26,22 @@
  *  POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include "platform-posix.h"
+
 #include "posix/platform/mainloop.hpp"
 
 #include <assert.h>
+#include <errno.h>
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+#include <sys/epoll.h>
+#endif
 
 #include "core/common/code_utils.hpp"
+#include "lib/platform/exit_code.h"
+
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE && !defined(__linux__)
+#error "OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE requires Linux"
+#endif
 
 namespace ot {
 namespace Posix {
@@ -58,12 +69,148 @@ void Manager::Remove(Source &aSource)
     aSource.mNext = nullptr;
 }
 
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+
+Manager::Manager(void)
+    : mNumEpollEvents(0)
+{
+    mEpollFd = epoll_create1(EPOLL_CLOEXEC);
+    VerifyOrDie(mEpollFd != -1, OT_EXIT_ERROR_ERRNO);
+}
+
+static uint32_t EventsToEpoll(uint8_t aEvents, Watcher::Trigger aTrigger)
+{
+    uint32_t events = 0;
+
+    if (aEvents & Watcher::kEventRead)
+    {
+        events |= EPOLLIN;
+    }
+
+    if (aEvents & Watcher::kEventWrite)
+    {
+        events |= EPOLLOUT;
+    }
+
+    if (aTrigger == Watcher::kEdgeTriggered)
+    {
+        events |= EPOLLET;
+    }
+
+    return events;
+}
+
+static uint8_t EventsFromEpoll(uint32_t aEvents)
+{
+    uint8_t events = 0;
+
+    if (aEvents & (EPOLLIN | EPOLLHUP | EPOLLRDHUP))
+    {
+        events |= Watcher::kEventRead;
+    }
+
+    if (aEvents & EPOLLOUT)
+    {
+        events |= Watcher::kEventWrite;
+    }
+
+    if (aEvents & EPOLLERR)
+    {
+        events |= Watcher::kEventError;
+    }
+
+    return events;
+}
+
+otError Manager::Watch(Watcher &aWatcher, int aFd, uint8_t aEvents, Watcher::Trigger aTrigger)
+{
+    otError            error = OT_ERROR_NONE;
+    struct epoll_event event;
+
+    assert(!aWatcher.IsWatching());
+    VerifyOrExit(aFd >= 0, error = OT_ERROR_INVALID_ARGS);
+
+    event.events   = EventsToEpoll(aEvents, aTrigger);
+    event.data.ptr = &aWatcher;
+    VerifyOrExit(epoll_ctl(mEpollFd, EPOLL_CTL_ADD, aFd, &event) == 0, error = OT_ERROR_FAILED);
+
+    aWatcher.mFd      = aFd;
+    aWatcher.mEvents  = aEvents;
+    aWatcher.mTrigger = aTrigger;
+    aWatcher.mNext    = mWatchers;
+    mWatchers         = &aWatcher;
+
+exit:
+    return error;
+}
+
+otError Manager::SetEvents(Watcher &aWatcher, uint8_t aEvents)
+{
+    otError            error = OT_ERROR_NONE;
+    struct epoll_event event;
+
+    assert(aWatcher.IsWatching());
+    VerifyOrExit(aWatcher.mEvents != aEvents);
+
+    event.events   = EventsToEpoll(aEvents, aWatcher.mTrigger);
+    event.data.ptr = &aWatcher;
+    VerifyOrExit(epoll_ctl(mEpollFd, EPOLL_CTL_MOD, aWatcher.mFd, &event) == 0, error = OT_ERROR_FAILED);
+
+    aWatcher.mEvents = aEvents;
+
+exit:
+    return error;
+}
+
+void Manager::Unwatch(Watcher &aWatcher)
+{
+    VerifyOrExit(aWatcher.IsWatching());
+
+    for (Watcher **pnext = &mWatchers; *pnext != nullptr; pnext = &(*pnext)->mNext)
+    {
+        if (*pnext == &aWatcher)
+        {
+            *pnext = aWatcher.mNext;
+            break;
+        }
+    }
+
+    // Events already fetched for this watcher must not be dispatched.
+    for (int i = 0; i < mNumEpollEvents; i++)
+    {
+        if (mEpollEvents[i] == &aWatcher)
+        {
+            mEpollEvents[i] = nullptr;
+        }
+    }
+
+    if (epoll_ctl(mEpollFd, EPOLL_CTL_DEL, aWatcher.mFd, nullptr) == -1)
+    {
+        // The descriptor may have been closed already, which removes it from the epoll set.
+        VerifyOrDie(errno == EBADF || errno == ENOENT, OT_EXIT_ERROR_ERRNO);
+    }
+
+    aWatcher.mFd   = -1;
+    aWatcher.mNext = nullptr;
+
+exit:
+    return;
+}
+
 void Manager::Update(otSysMainloopContext &aContext)
 {
     for (Source *source = mSources; source != nullptr; source = source->mNext)
     {
         source->Update(aContext);
     }
+
+    // Every watcher is represented by the single epoll descriptor, so `select()` wakes up when any watcher is ready
+    // regardless of how many watchers are registered.
+    if (mWatchers != nullptr)
+    {
+        FD_SET(mEpollFd, &aContext.mReadFdSet);
+        aContext.mMaxFd = OT_MAX(aContext.mMaxFd, mEpollFd);
+    }
 }
 
 void Manager::Process(const otSysMainloopContext &aContext)
@@ -72,8 +219,155 @@ void Manager::Process(const otSysMainloopContext &aContext)
     {
         source->Process(aContext);
     }
+
+    if (FD_ISSET(mEpollFd, &aContext.mReadFdSet))
+    {
+        ProcessEpollEvents();
+    }
+}
+
+void Manager::ProcessEpollEvents(void)
+{
+    struct epoll_event events[kMaxEpollEvents];
+    int                count;
+
+    count = epoll_wait(mEpollFd, events, kMaxEpollEvents, /* timeout */ 0);
+    VerifyOrExit(count > 0);
+
+    for (int i = 0; i < count; i++)
+    {
+        mEpollEvents[i]      = static_cast<Watcher *>(events[i].data.ptr);
+        mEpollReadyEvents[i] = EventsFromEpoll(events[i].events);
+    }
+
+    mNumEpollEvents = count;
+
+    for (int i = 0; i < mNumEpollEvents; i++)
+    {
+        Watcher *watcher = mEpollEvents[i];
+
+        if (watcher != nullptr)
+        {
+            watcher->mHandler(watcher->mContext, mEpollReadyEvents[i]);
+        }
+    }
+
+    mNumEpollEvents = 0;
+
+exit:
+    return;
+}
+
+#else // OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+
+otError Manager::Watch(Watcher &aWatcher, int aFd, uint8_t aEvents, Watcher::Trigger aTrigger)
+{
+    otError error = OT_ERROR_NONE;
+
+    assert(!aWatcher.IsWatching());
+    VerifyOrExit(aFd >= 0 && aFd < FD_SETSIZE, error = OT_ERROR_INVALID_ARGS);
+
+    aWatcher.mFd      = aFd;
+    aWatcher.mEvents  = aEvents;
+    aWatcher.mTrigger = aTrigger;
+    aWatcher.mNext    = mWatchers;
+    mWatchers         = &aWatcher;
+
+exit:
+    return error;
+}
+
+otError Manager::SetEvents(Watcher &aWatcher, uint8_t aEvents)
+{
+    assert(aWatcher.IsWatching());
+    aWatcher.mEvents = aEvents;
+
+    return OT_ERROR_NONE;
 }
 
+void Manager::Unwatch(Watcher &aWatcher)
+{
+    // A handler may unwatch the watcher which is dispatched next.
+    if (mNextWatcher == &aWatcher)
+    {
+        mNextWatcher = aWatcher.mNext;
+    }
+
+    for (Watcher **pnext = &mWatchers; *pnext != nullptr; pnext = &(*pnext)->mNext)
+    {
+        if (*pnext == &aWatcher)
+        {
+            *pnext = aWatcher.mNext;
+            break;
+        }
+    }
+
+    aWatcher.mFd   = -1;
+    aWatcher.mNext = nullptr;
+}
+
+void Manager::Update(otSysMainloopContext &aContext)
+{
+    for (Source *source = mSources; source != nullptr; source = source->mNext)
+    {
+        source->Update(aContext);
+    }
+
+    for (Watcher *watcher = mWatchers; watcher != nullptr; watcher = watcher->mNext)
+    {
+        if (watcher->mEvents & Watcher::kEventRead)
+        {
+            FD_SET(watcher->mFd, &aContext.mReadFdSet);
+        }
+
+        if (watcher->mEvents & Watcher::kEventWrite)
+        {
+            FD_SET(watcher->mFd, &aContext.mWriteFdSet);
+        }
+
+        FD_SET(watcher->mFd, &aContext.mErrorFdSet);
+        aContext.mMaxFd = OT_MAX(aContext.mMaxFd, watcher->mFd);
+    }
+}
+
+void Manager::Process(const otSysMainloopContext &aContext)
+{
+    for (Source *source = mSources; source != nullptr; source = source->mNext)
+    {
+        source->Process(aContext);
+    }
+
+    for (Watcher *watcher = mWatchers; watcher != nullptr; watcher = mNextWatcher)
+    {
+        uint8_t events = 0;
+
+        // The handler may unwatch itself or other watchers.
+        mNextWatcher = watcher->mNext;
+
+        if (FD_ISSET(watcher->mFd, &aContext.mReadFdSet))
+        {
+            events |= Watcher::kEventRead;
+        }
+
+        if (FD_ISSET(watcher->mFd, &aContext.mWriteFdSet))
+        {
+            events |= Watcher::kEventWrite;
+        }
+
+        if (FD_ISSET(watcher->mFd, &aContext.mErrorFdSet))
+        {
+            events |= Watcher::kEventError;
+        }
+
+        if (events != 0)
+        {
+            watcher->mHandler(watcher->mContext, events);
+        }
+    }
+}
+
+#endif // OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+
 Manager &Manager::Get(void)
 {
     static Manager sInstance;
@@ -84,3 +378,281 @@ Manager &Manager::Get(void)
 } // namespace Mainloop
 } // namespace Posix
 } // namespace ot
+
+#ifndef SELF_TEST
+#define SELF_TEST 0
+#endif
+
+#if SELF_TEST
+
+#include <time.h>
+#include <unistd.h>
+
+using ot::Posix::Mainloop::Manager;
+using ot::Posix::Mainloop::Watcher;
+
+void otLogCritPlat(const char *aFormat, ...) { OT_UNUSED_VARIABLE(aFormat); }
+
+const char *otExitCodeToString(uint8_t aExitCode)
+{
+    OT_UNUSED_VARIABLE(aExitCode);
+    return "";
+}
+
+struct TestWatcher
+{
+    static void HandleEvents(void *aContext, uint8_t aEvents)
+    {
+        TestWatcher &watcher = *static_cast<TestWatcher *>(aContext);
+
+        watcher.mNumCalls++;
+        watcher.mEvents = aEvents;
+
+        if (watcher.mUnwatch != nullptr)
+        {
+            Manager::Get().Unwatch(*watcher.mUnwatch);
+        }
+    }
+
+    TestWatcher(void)
+        : mWatcher(HandleEvents, this)
+    {
+        VerifyOrDie(pipe(mPipe) == 0, OT_EXIT_ERROR_ERRNO);
+    }
+
+    ~TestWatcher(void)
+    {
+        Manager::Get().Unwatch(mWatcher);
+        close(mPipe[0]);
+        close(mPipe[1]);
+    }
+
+    void Write(void) { VerifyOrDie(write(mPipe[1], "x", 1) == 1, OT_EXIT_ERROR_ERRNO); }
+
+    void Drain(void)
+    {
+        char buffer[16];
+
+        VerifyOrDie(read(mPipe[0], buffer, sizeof(buffer)) > 0, OT_EXIT_ERROR_ERRNO);
+    }
+
+    Watcher      mWatcher;
+    int          mPipe[2];
+    unsigned int mNumCalls = 0;
+    uint8_t      mEvents   = 0;
+    Watcher     *mUnwatch  = nullptr;
+};
+
+static void runMainloopOnce(void)
+{
+    otSysMainloopContext context;
+
+    FD_ZERO(&context.mReadFdSet);
+    FD_ZERO(&context.mWriteFdSet);
+    FD_ZERO(&context.mErrorFdSet);
+    context.mMaxFd            = -1;
+    context.mTimeout.tv_sec   = 0;
+    context.mTimeout.tv_usec  = 0;
+
+    Manager::Get().Update(context);
+    VerifyOrDie(select(context.mMaxFd + 1, &context.mReadFdSet, &context.mWriteFdSet, &context.mErrorFdSet,
+                       &context.mTimeout) >= 0,
+                OT_EXIT_ERROR_ERRNO);
+    Manager::Get().Process(context);
+}
+
+static uint64_t getNowNsec(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return static_cast<uint64_t>(now.tv_sec) * 1000000000 + static_cast<uint64_t>(now.tv_nsec);
+}
+
+static void benchmark(void)
+{
+    const unsigned int kNumWatchers[] = {4, 64, 256};
+    const unsigned int kIterations    = 10000;
+
+    for (unsigned int numWatchers : kNumWatchers)
+    {
+        TestWatcher *watchers = new TestWatcher[numWatchers];
+        uint64_t     start;
+        uint64_t     idleTime;
+        uint64_t     busyTime;
+
+        for (unsigned int i = 0; i < numWatchers; i++)
+        {
+            assert(Manager::Get().Watch(watchers[i].mWatcher, watchers[i].mPipe[0], Watcher::kEventRead,
+                                        Watcher::kLevelTriggered) == OT_ERROR_NONE);
+        }
+
+        start = getNowNsec();
+        for (unsigned int i = 0; i < kIterations; i++)
+        {
+            runMainloopOnce();
+        }
+        idleTime = getNowNsec() - start;
+
+        // One watcher stays readable, so every iteration dispatches it.
+        watchers[0].Write();
+        start = getNowNsec();
+        for (unsigned int i = 0; i < kIterations; i++)
+        {
+            runMainloopOnce();
+        }
+        busyTime = getNowNsec() - start;
+        assert(watchers[0].mNumCalls == kIterations);
+
+        printf("%u watchers: idle %llu ns, busy %llu ns per iteration\n", numWatchers,
+               static_cast<unsigned long long>(idleTime / kIterations),
+               static_cast<unsigned long long>(busyTime / kIterations));
+
+        delete[] watchers;
+    }
+}
+
+int main(void)
+{
+    // verify a watcher is dispatched only while registered
+    {
+        TestWatcher watcher;
+
+        assert(Manager::Get().Watch(watcher.mWatcher, watcher.mPipe[0], Watcher::kEventRead,
+                                    Watcher::kLevelTriggered) == OT_ERROR_NONE);
+        assert(watcher.mWatcher.IsWatching());
+
+        runMainloopOnce();
+        assert(watcher.mNumCalls == 0);
+
+        watcher.Write();
+        runMainloopOnce();
+        assert(watcher.mNumCalls == 1);
+        assert(watcher.mEvents == Watcher::kEventRead);
+
+        // level triggered watchers are reported until drained
+        runMainloopOnce();
+        assert(watcher.mNumCalls == 2);
+        watcher.Drain();
+        runMainloopOnce();
+        assert(watcher.mNumCalls == 2);
+
+        Manager::Get().Unwatch(watcher.mWatcher);
+        assert(!watcher.mWatcher.IsWatching());
+        watcher.Write();
+        runMainloopOnce();
+        assert(watcher.mNumCalls == 2);
+
+        // unwatching twice is harmless
+        Manager::Get().Unwatch(watcher.mWatcher);
+    }
+
+    // verify write events
+    {
+        TestWatcher watcher;
+
+        assert(Manager::Get().Watch(watcher.mWatcher, watcher.mPipe[1], Watcher::kEventWrite,
+                                    Watcher::kLevelTriggered) == OT_ERROR_NONE);
+        runMainloopOnce();
+        assert(watcher.mNumCalls == 1);
+        assert(watcher.mEvents == Watcher::kEventWrite);
+
+        // verify the watched events can be changed
+        assert(Manager::Get().SetEvents(watcher.mWatcher, Watcher::kEventRead) == OT_ERROR_NONE);
+        runMainloopOnce();
+        assert(watcher.mNumCalls == 1);
+
+        assert(Manager::Get().SetEvents(watcher.mWatcher, Watcher::kEventWrite) == OT_ERROR_NONE);
+        runMainloopOnce();
+        assert(watcher.mNumCalls == 2);
+        assert(watcher.mEvents == Watcher::kEventWrite);
+    }
+
+    // verify a handler may unwatch itself and other ready watchers
+    {
+        TestWatcher watchers[3];
+
+        for (TestWatcher &watcher : watchers)
+        {
+            assert(Manager::Get().Watch(watcher.mWatcher, watcher.mPipe[0], Watcher::kEventRead,
+                                        Watcher::kLevelTriggered) == OT_ERROR_NONE);
+            watcher.Write();
+            watcher.mUnwatch = &watcher.mWatcher;
+        }
+
+        runMainloopOnce();
+
+        for (TestWatcher &watcher : watchers)
+        {
+            assert(watcher.mNumCalls == 1);
+            assert(!watcher.mWatcher.IsWatching());
+        }
+
+        runMainloopOnce();
+
+        for (TestWatcher &watcher : watchers)
+        {
+            assert(watcher.mNumCalls == 1);
+        }
+    }
+
+    {
+        TestWatcher watchers[2];
+
+        // whichever watcher is dispatched first unwatches the other one, which must not be dispatched anymore
+        watchers[0].mUnwatch = &watchers[1].mWatcher;
+        watchers[1].mUnwatch = &watchers[0].mWatcher;
+
+        for (TestWatcher &watcher : watchers)
+        {
+            assert(Manager::Get().Watch(watcher.mWatcher, watcher.mPipe[0], Watcher::kEventRead,
+                                        Watcher::kLevelTriggered) == OT_ERROR_NONE);
+            watcher.Write();
+        }
+
+        runMainloopOnce();
+        assert(watchers[0].mNumCalls + watchers[1].mNumCalls == 1);
+        assert(watchers[0].mWatcher.IsWatching() != watchers[1].mWatcher.IsWatching());
+    }
+
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+    // verify edge triggered watchers are reported once per change
+    {
+        TestWatcher watcher;
+
+        assert(Manager::Get().Watch(watcher.mWatcher, watcher.mPipe[0], Watcher::kEventRead,
+                                    Watcher::kEdgeTriggered) == OT_ERROR_NONE);
+        watcher.Write();
+        runMainloopOnce();
+        assert(watcher.mNumCalls == 1);
+        runMainloopOnce();
+        assert(watcher.mNumCalls == 1);
+        watcher.Write();
+        runMainloopOnce();
+        assert(watcher.mNumCalls == 2);
+    }
+#else
+    // verify descriptors which do not fit in an fd_set are rejected
+    {
+        TestWatcher watcher;
+
+        assert(Manager::Get().Watch(watcher.mWatcher, FD_SETSIZE, Watcher::kEventRead, Watcher::kLevelTriggered) ==
+               OT_ERROR_INVALID_ARGS);
+        assert(!watcher.mWatcher.IsWatching());
+    }
+#endif
+
+    {
+        TestWatcher watcher;
+
+        assert(Manager::Get().Watch(watcher.mWatcher, -1, Watcher::kEventRead, Watcher::kLevelTriggered) ==
+               OT_ERROR_INVALID_ARGS);
+        assert(!watcher.mWatcher.IsWatching());
+    }
+
+    benchmark();
+
+    return 0;
+}
+#endif
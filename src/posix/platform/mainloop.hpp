@@ -34,6 +34,11 @@
 #ifndef OT_POSIX_PLATFORM_MAINLOOP_HPP_
 #define OT_POSIX_PLATFORM_MAINLOOP_HPP_
 
+#include "openthread-posix-config.h"
+
+#include <stdint.h>
+
+#include <openthread/error.h>
 #include <openthread/openthread-system.h>
 
 namespace ot {
@@ -75,6 +80,73 @@ private:
     Source *mNext = nullptr;
 };
 
+/**
+ * Represents a persistent registration of a file descriptor in the mainloop.
+ *
+ * Unlike a `Source`, which re-registers its file descriptors in every `Update()`, a watcher is registered once with
+ * `Manager::Watch()` and stays registered until `Manager::Unwatch()`. With the epoll backend the registration is kept
+ * in the kernel, so idle watchers cost nothing per mainloop iteration.
+ *
+ */
+class Watcher
+{
+    friend class Manager;
+
+public:
+    static constexpr uint8_t kEventRead  = 1 << 0; ///< The file descriptor is readable.
+    static constexpr uint8_t kEventWrite = 1 << 1; ///< The file descriptor is writable.
+    static constexpr uint8_t kEventError = 1 << 2; ///< An error condition happened on the file descriptor.
+
+    /**
+     * Defines how readiness is reported.
+     *
+     */
+    enum Trigger : uint8_t
+    {
+        kLevelTriggered, ///< Events are reported as long as the file descriptor is ready.
+        kEdgeTriggered,  ///< Events are reported only when readiness changes. The handler MUST drain the descriptor.
+    };
+
+    /**
+     * Pointer is called when events are ready on the watched file descriptor.
+     *
+     * @param[in]  aContext  A pointer to the arbitrary context information.
+     * @param[in]  aEvents   A bit-mask of the ready events (`kEventRead`, `kEventWrite` and `kEventError`).
+     *
+     */
+    typedef void (*Handler)(void *aContext, uint8_t aEvents);
+
+    /**
+     * Initializes the watcher.
+     *
+     * @param[in]  aHandler  A pointer to the function called when events are ready.
+     * @param[in]  aContext  A pointer to the arbitrary context information passed to @p aHandler.
+     *
+     */
+    Watcher(Handler aHandler, void *aContext)
+        : mHandler(aHandler)
+        , mContext(aContext)
+    {
+    }
+
+    /**
+     * Indicates whether the watcher is registered in the mainloop.
+     *
+     * @retval TRUE   The watcher is registered.
+     * @retval FALSE  The watcher is not registered.
+     *
+     */
+    bool IsWatching(void) const { return mFd != -1; }
+
+private:
+    Handler  mHandler;
+    void    *mContext;
+    Watcher *mNext    = nullptr;
+    int      mFd      = -1;
+    uint8_t  mEvents  = 0;
+    Trigger  mTrigger = kLevelTriggered;
+};
+
 /**
  * Manages mainloop.
  *
@@ -114,6 +186,48 @@ public:
      */
     void Remove(Source &aSource);
 
+    /**
+     * Registers a file descriptor in the mainloop until `Unwatch()` is called.
+     *
+     * The file descriptor MUST NOT also be registered by a `Source` in `Update()`. Edge triggering is only honored by
+     * the epoll backend; with the select backend an edge triggered watcher behaves as level triggered, which is safe
+     * since the handler drains the descriptor anyway.
+     *
+     * @param[in]  aWatcher  A reference to the watcher, which MUST NOT be registered yet.
+     * @param[in]  aFd       The file descriptor to watch.
+     * @param[in]  aEvents   A bit-mask of the events to watch (`Watcher::kEventRead` and `Watcher::kEventWrite`).
+     *                       Errors are always reported.
+     * @param[in]  aTrigger  The trigger mode.
+     *
+     * @retval OT_ERROR_NONE          Successfully registered the file descriptor.
+     * @retval OT_ERROR_INVALID_ARGS  @p aFd cannot be watched.
+     * @retval OT_ERROR_FAILED        The epoll backend rejected the file descriptor.
+     *
+     */
+    otError Watch(Watcher &aWatcher, int aFd, uint8_t aEvents, Watcher::Trigger aTrigger);
+
+    /**
+     * Changes the events watched by a registered watcher.
+     *
+     * @param[in]  aWatcher  A reference to the watcher, which MUST be registered.
+     * @param[in]  aEvents   A bit-mask of the events to watch (`Watcher::kEventRead` and `Watcher::kEventWrite`).
+     *
+     * @retval OT_ERROR_NONE    Successfully changed the watched events.
+     * @retval OT_ERROR_FAILED  The epoll backend rejected the change.
+     *
+     */
+    otError SetEvents(Watcher &aWatcher, uint8_t aEvents);
+
+    /**
+     * Removes a watcher from the mainloop.
+     *
+     * Is safe to call from the handler of @p aWatcher. MUST be called before the watched file descriptor is closed.
+     *
+     * @param[in]  aWatcher  A reference to the watcher.
+     *
+     */
+    void Unwatch(Watcher &aWatcher);
+
     /**
      * Returns the Mainloop singleton.
      *
@@ -123,7 +237,24 @@ public:
     static Manager &Get(void);
 
 private:
-    Source *mSources = nullptr;
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+    static constexpr int kMaxEpollEvents = 16;
+
+    Manager(void);
+    void ProcessEpollEvents(void);
+
+    int      mEpollFd;
+    int      mNumEpollEvents;
+    Watcher *mEpollEvents[kMaxEpollEvents];
+    uint8_t  mEpollReadyEvents[kMaxEpollEvents];
+#else
+    Manager(void) = default;
+
+    Watcher *mNextWatcher = nullptr; // The next watcher to dispatch in `Process()`.
+#endif
+
+    Source  *mSources  = nullptr;
+    Watcher *mWatchers = nullptr;
 };
 
 } // namespace Mainloop
@@ -86,6 +86,7 @@
 #include <sys/socket.h>
 #include <sys/stat.h>
 #include <sys/types.h>
+#include <sys/uio.h>
 #include <unistd.h>
 
 #if defined(__APPLE__) || defined(__NetBSD__) || defined(__FreeBSD__)
@@ -151,12 +152,15 @@ extern int
 
 #include "common/code_utils.hpp"
 #include "common/debug.hpp"
+#include "common/message.hpp"
 #include "net/ip6_address.hpp"
 
 #include "resolver.hpp"
 
 unsigned int gNetifIndex = 0;
 char         gNetifName[IFNAMSIZ];
+
+static otSysNetifCounters sNetifCounters;
 #if OPENTHREAD_CONFIG_NAT64_TRANSLATOR_ENABLE
 static otIp4Cidr sActiveNat64Cidr;
 #endif
@@ -165,13 +169,18 @@ const char *otSysGetThreadNetifName(void) { return gNetifName; }
 
 unsigned int otSysGetThreadNetifIndex(void) { return gNetifIndex; }
 
+const otSysNetifCounters *otSysGetNetifCounters(void) { return &sNetifCounters; }
+
 #if OPENTHREAD_CONFIG_PLATFORM_NETIF_ENABLE
 #if OPENTHREAD_POSIX_CONFIG_FIREWALL_ENABLE
 #include "firewall.hpp"
 #endif
 #include "posix/platform/ip6_utils.hpp"
+#include "posix/platform/mainloop.hpp"
 
 using namespace ot::Posix::Ip6Utils;
+using ot::Posix::Mainloop::Manager;
+using ot::Posix::Mainloop::Watcher;
 
 #ifndef OPENTHREAD_POSIX_TUN_DEVICE
 
@@ -251,6 +260,15 @@ static int sNetlinkFd = -1; ///< Used to receive netlink events.
 #if OPENTHREAD_POSIX_USE_MLD_MONITOR
 static int sMLDMonitorFd = -1; ///< Used to receive MLD events.
 #endif
+
+static void    handleTunEvents(void *aContext, uint8_t aEvents);
+static void    handleNetlinkEvents(void *aContext, uint8_t aEvents);
+static Watcher sTunWatcher(handleTunEvents, nullptr);
+static Watcher sNetlinkWatcher(handleNetlinkEvents, nullptr);
+#if OPENTHREAD_POSIX_USE_MLD_MONITOR
+static void    handleMLDEvents(void *aContext, uint8_t aEvents);
+static Watcher sMLDWatcher(handleMLDEvents, nullptr);
+#endif
 #if OPENTHREAD_POSIX_USE_MLD_MONITOR
 // ff02::16
 static const otIp6Address kMLDv2MulticastAddress = {
@@ -283,7 +301,8 @@ enum
 };
 #endif
 
-static constexpr size_t kMaxIp6Size = OPENTHREAD_CONFIG_IP6_MAX_DATAGRAM_LENGTH;
+static constexpr size_t   kMaxIp6Size          = OPENTHREAD_CONFIG_IP6_MAX_DATAGRAM_LENGTH;
+static constexpr uint32_t kMaxTunReadsPerEvent = OPENTHREAD_POSIX_CONFIG_TUN_MAX_READS_PER_EVENT;
 #if defined(RTM_NEWLINK) && defined(RTM_DELLINK)
 static bool sIsSyncingState = false;
 #endif
@@ -981,14 +1000,27 @@ static void processReceive(otMessage *aMessage, void *aContext)
 {
     OT_UNUSED_VARIABLE(aContext);
 
-    char     packet[kMaxIp6Size + 4];
-    otError  error     = OT_ERROR_NONE;
-    uint16_t length    = otMessageGetLength(aMessage);
-    size_t   offset    = 0;
-    uint16_t maxLength = sizeof(packet) - 4;
+    // The message is written to the TUN device directly from its
+    // buffers. It is copied into `packet` only if it spans more
+    // buffers than `kMaxTunWriteChunks`.
+
+    static constexpr uint16_t kMaxTunWriteChunks = 16;
+
+    char                            packet[kMaxIp6Size];
+    ot::Data<ot::kWithUint16Length> chunks[kMaxTunWriteChunks];
+    struct iovec                    iov[kMaxTunWriteChunks + 1];
+    int                             iovCount  = 0;
+    uint16_t                        numChunks = kMaxTunWriteChunks;
+    otError                         error     = OT_ERROR_NONE;
+    uint16_t                        length    = otMessageGetLength(aMessage);
+    ssize_t                         totalLength;
 #if defined(__APPLE__) || defined(__NetBSD__) || defined(__FreeBSD__)
     // BSD tunnel drivers use (for legacy reasons) a 4-byte header to determine the address family of the packet
-    offset += 4;
+    static const uint8_t kTunHeader[4] = {0, 0, (PF_INET6 << 8) & 0xFF, (PF_INET6 << 0) & 0xFF};
+
+    iov[iovCount].iov_base = const_cast<uint8_t *>(kTunHeader);
+    iov[iovCount].iov_len  = sizeof(kTunHeader);
+    iovCount++;
 #endif
 
     assert(gInstance == aContext);
@@ -996,22 +1028,41 @@ static void processReceive(otMessage *aMessage, void *aContext)
 
     VerifyOrExit(sTunFd > 0);
 
-    VerifyOrExit(otMessageRead(aMessage, 0, &packet[offset], maxLength) == length, error = OT_ERROR_NO_BUFS);
+    totalLength = length;
+
+    if (ot::AsCoreType(aMessage).GetDataChunks(0, length, chunks, numChunks) == ot::kErrorNone)
+    {
+        for (uint16_t i = 0; i < numChunks; i++)
+        {
+            iov[iovCount].iov_base = const_cast<uint8_t *>(chunks[i].GetBytes());
+            iov[iovCount].iov_len  = chunks[i].GetLength();
+            iovCount++;
+        }
+
+        sNetifCounters.mTunWriteCopiesAvoided++;
+    }
+    else
+    {
+        VerifyOrExit(otMessageRead(aMessage, 0, packet, sizeof(packet)) == length, error = OT_ERROR_NO_BUFS);
+
+        iov[iovCount].iov_base = packet;
+        iov[iovCount].iov_len  = length;
+        iovCount++;
+    }
 
 #if OPENTHREAD_POSIX_LOG_TUN_PACKETS
     otLogInfoPlat("[netif] Packet from NCP (%u bytes)", static_cast<uint16_t>(length));
-    otDumpInfoPlat("", &packet[offset], length);
+    otMessageRead(aMessage, 0, packet, sizeof(packet));
+    otDumpInfoPlat("", packet, length);
 #endif
 
 #if defined(__APPLE__) || defined(__NetBSD__) || defined(__FreeBSD__)
-    packet[0] = 0;
-    packet[1] = 0;
-    packet[2] = (PF_INET6 << 8) & 0xFF;
-    packet[3] = (PF_INET6 << 0) & 0xFF;
-    length += 4;
+    totalLength += sizeof(kTunHeader);
 #endif
 
-    VerifyOrExit(write(sTunFd, packet, length) == length, perror("write"); error = OT_ERROR_FAILED);
+    VerifyOrExit(writev(sTunFd, iov, iovCount) == totalLength, perror("writev"); error = OT_ERROR_FAILED);
+
+    sNetifCounters.mTunWritePackets++;
 
 exit:
     otMessageFree(aMessage);
@@ -1087,7 +1138,16 @@ exit:
 }
 #endif // OPENTHREAD_CONFIG_BORDER_ROUTING_DHCP6_PD_ENABLE
 
-static void processTransmit(otInstance *aInstance)
+/**
+ * Reads a packet from the TUN device and sends it to the Thread stack.
+ *
+ * @param[in]  aInstance  The OpenThread instance.
+ * @param[out] aIsRead    Set to TRUE if a packet was read from the TUN device, FALSE otherwise.
+ *
+ * @returns The error sending the packet.
+ *
+ */
+static otError processTransmitPacket(otInstance *aInstance, bool &aIsRead)
 {
     otMessage *message = nullptr;
     ssize_t    rval;
@@ -1098,11 +1158,14 @@ static void processTransmit(otInstance *aInstance)
     bool isIp4 = false;
 #endif
 
-    assert(gInstance == aInstance);
+    aIsRead = false;
 
     rval = read(sTunFd, packet, sizeof(packet));
+    VerifyOrExit((rval >= 0) || ((errno != EAGAIN) && (errno != EWOULDBLOCK)));
     VerifyOrExit(rval > 0, error = OT_ERROR_FAILED);
 
+    aIsRead = true;
+
 #if defined(__APPLE__) || defined(__NetBSD__) || defined(__FreeBSD__)
     // BSD tunnel drivers have (for legacy reasons), may have a 4-byte header on them
     if ((rval >= 4) && (packet[0] == 0) && (packet[1] == 0))
@@ -1164,6 +1227,39 @@ exit:
             otLogWarnPlat("[netif] Failed to transmit, error:%s", otThreadErrorToString(error));
         }
     }
+
+    return error;
+}
+
+static void processTransmit(otInstance *aInstance)
+{
+    uint32_t numPackets = 0;
+    otError  error;
+
+    assert(gInstance == aInstance);
+
+    // Drain the packets queued on the TUN device, up to a limit so
+    // that other events are not starved. Stop early if out of
+    // message buffers, leaving the remaining packets queued on the
+    // device.
+
+    do
+    {
+        bool isRead;
+
+        error = processTransmitPacket(aInstance, isRead);
+        VerifyOrExit(isRead);
+        numPackets++;
+    } while ((numPackets < kMaxTunReadsPerEvent) && (error != OT_ERROR_NO_BUFS));
+
+exit:
+    sNetifCounters.mTunReadEvents++;
+    sNetifCounters.mTunReadPackets += numPackets;
+
+    if (numPackets > sNetifCounters.mTunMaxReadsPerEvent)
+    {
+        sNetifCounters.mTunMaxReadsPerEvent = numPackets;
+    }
 }
 
 static void logAddrEvent(bool isAdd, const ot::Ip6::Address &aAddress, otError error)
@@ -2033,9 +2129,22 @@ void platformNetifSetUp(void)
 #if OPENTHREAD_CONFIG_DNS_UPSTREAM_QUERY_ENABLE
     gResolver.Init();
 #endif
+
+    SuccessOrDie(Manager::Get().Watch(sTunWatcher, sTunFd, Watcher::kEventRead, Watcher::kLevelTriggered));
+    SuccessOrDie(Manager::Get().Watch(sNetlinkWatcher, sNetlinkFd, Watcher::kEventRead, Watcher::kLevelTriggered));
+#if OPENTHREAD_POSIX_USE_MLD_MONITOR
+    SuccessOrDie(Manager::Get().Watch(sMLDWatcher, sMLDMonitorFd, Watcher::kEventRead, Watcher::kLevelTriggered));
+#endif
 }
 
-void platformNetifTearDown(void) {}
+void platformNetifTearDown(void)
+{
+    Manager::Get().Unwatch(sTunWatcher);
+    Manager::Get().Unwatch(sNetlinkWatcher);
+#if OPENTHREAD_POSIX_USE_MLD_MONITOR
+    Manager::Get().Unwatch(sMLDWatcher);
+#endif
+}
 
 void platformNetifDeinit(void)
 {
@@ -2072,92 +2181,81 @@ void platformNetifDeinit(void)
     gNetifIndex = 0;
 }
 
-void platformNetifUpdateFdSet(otSysMainloopContext *aContext)
+static void handleTunEvents(void *aContext, uint8_t aEvents)
 {
-    VerifyOrExit(gNetifIndex > 0);
-
-    assert(aContext != nullptr);
-    assert(sTunFd >= 0);
-    assert(sNetlinkFd >= 0);
-    assert(sIpFd >= 0);
-
-    FD_SET(sTunFd, &aContext->mReadFdSet);
-    FD_SET(sTunFd, &aContext->mErrorFdSet);
-    FD_SET(sNetlinkFd, &aContext->mReadFdSet);
-    FD_SET(sNetlinkFd, &aContext->mErrorFdSet);
-#if OPENTHREAD_POSIX_USE_MLD_MONITOR
-    FD_SET(sMLDMonitorFd, &aContext->mReadFdSet);
-    FD_SET(sMLDMonitorFd, &aContext->mErrorFdSet);
-#endif
-
-#if OPENTHREAD_CONFIG_DNS_UPSTREAM_QUERY_ENABLE
-    gResolver.UpdateFdSet(*aContext);
-#endif
-
-    if (sTunFd > aContext->mMaxFd)
-    {
-        aContext->mMaxFd = sTunFd;
-    }
+    OT_UNUSED_VARIABLE(aContext);
 
-    if (sNetlinkFd > aContext->mMaxFd)
+    if (aEvents & Watcher::kEventError)
     {
-        aContext->mMaxFd = sNetlinkFd;
+        close(sTunFd);
+        DieNow(OT_EXIT_FAILURE);
     }
 
-#if OPENTHREAD_POSIX_USE_MLD_MONITOR
-    if (sMLDMonitorFd > aContext->mMaxFd)
+    if (aEvents & Watcher::kEventRead)
     {
-        aContext->mMaxFd = sMLDMonitorFd;
+        processTransmit(gInstance);
     }
-#endif
-exit:
-    return;
 }
 
-void platformNetifProcess(const otSysMainloopContext *aContext)
+static void handleNetlinkEvents(void *aContext, uint8_t aEvents)
 {
-    assert(aContext != nullptr);
-    VerifyOrExit(gNetifIndex > 0);
+    OT_UNUSED_VARIABLE(aContext);
 
-    if (FD_ISSET(sTunFd, &aContext->mErrorFdSet))
+    if (aEvents & Watcher::kEventError)
     {
-        close(sTunFd);
+        close(sNetlinkFd);
         DieNow(OT_EXIT_FAILURE);
     }
 
-    if (FD_ISSET(sNetlinkFd, &aContext->mErrorFdSet))
+    if (aEvents & Watcher::kEventRead)
     {
-        close(sNetlinkFd);
-        DieNow(OT_EXIT_FAILURE);
+        processNetlinkEvent(gInstance);
     }
+}
 
 #if OPENTHREAD_POSIX_USE_MLD_MONITOR
-    if (FD_ISSET(sMLDMonitorFd, &aContext->mErrorFdSet))
+static void handleMLDEvents(void *aContext, uint8_t aEvents)
+{
+    OT_UNUSED_VARIABLE(aContext);
+
+    if (aEvents & Watcher::kEventError)
     {
         close(sMLDMonitorFd);
         DieNow(OT_EXIT_FAILURE);
     }
-#endif
 
-    if (FD_ISSET(sTunFd, &aContext->mReadFdSet))
+    if (aEvents & Watcher::kEventRead)
     {
-        processTransmit(gInstance);
+        processMLDEvent(gInstance);
     }
+}
+#endif
 
-    if (FD_ISSET(sNetlinkFd, &aContext->mReadFdSet))
-    {
-        processNetlinkEvent(gInstance);
-    }
+void platformNetifUpdateFdSet(otSysMainloopContext *aContext)
+{
+    assert(aContext != nullptr);
+    VerifyOrExit(gNetifIndex > 0);
 
-#if OPENTHREAD_POSIX_USE_MLD_MONITOR
-    if (FD_ISSET(sMLDMonitorFd, &aContext->mReadFdSet))
-    {
-        processMLDEvent(gInstance);
-    }
+    // The TUN, netlink and MLD monitor descriptors are watched by the mainloop, see `platformNetifSetUp()`.
+#if OPENTHREAD_CONFIG_DNS_UPSTREAM_QUERY_ENABLE
+    gResolver.UpdateFdSet(*aContext);
+#else
+    OT_UNUSED_VARIABLE(aContext);
 #endif
 
+exit:
+    return;
+}
+
+void platformNetifProcess(const otSysMainloopContext *aContext)
+{
+    assert(aContext != nullptr);
+    VerifyOrExit(gNetifIndex > 0);
+
 #if OPENTHREAD_CONFIG_DNS_UPSTREAM_QUERY_ENABLE
     gResolver.Process(*aContext);
+#else
+    OT_UNUSED_VARIABLE(aContext);
 #endif
 
 exit:
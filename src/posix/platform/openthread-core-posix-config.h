@@ -319,4 +319,55 @@
 #define OPENTHREAD_CONFIG_PLATFORM_POWER_CALIBRATION_ENABLE 1
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_IP6_CHECKSUM_SIMD_ENABLE
+ *
+ * Define as 1 to use SIMD instructions (when supported by the host) to calculate message checksums.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_IP6_CHECKSUM_SIMD_ENABLE
+#define OPENTHREAD_CONFIG_IP6_CHECKSUM_SIMD_ENABLE 1
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_IP6_UDP_PORT_INDEX_BUCKETS
+ *
+ * The number of hash buckets used to index the open UDP sockets by their local port.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_IP6_UDP_PORT_INDEX_BUCKETS
+#define OPENTHREAD_CONFIG_IP6_UDP_PORT_INDEX_BUCKETS 64
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_IP6_MULTICAST_INDEX_BUCKETS
+ *
+ * The number of hash buckets used to index the multicast addresses subscribed on a network interface.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_IP6_MULTICAST_INDEX_BUCKETS
+#define OPENTHREAD_CONFIG_IP6_MULTICAST_INDEX_BUCKETS 64
+#endif
+
+/**
+ * @def OPENTHREAD_SPINEL_CONFIG_HDLC_SIMD_ENABLE
+ *
+ * Define as 1 to use SSE2 instructions (when supported by the host) to find the runs of bytes which the HDLC-lite
+ * encoder and decoder can copy without escaping.
+ *
+ */
+#ifndef OPENTHREAD_SPINEL_CONFIG_HDLC_SIMD_ENABLE
+#define OPENTHREAD_SPINEL_CONFIG_HDLC_SIMD_ENABLE 1
+#endif
+
+/**
+ * @def OPENTHREAD_SPINEL_CONFIG_HDLC_FCS_SLICING_BY_8_ENABLE
+ *
+ * Define as 1 to calculate the HDLC-lite FCS eight bytes at a time (slicing-by-8).
+ *
+ */
+#ifndef OPENTHREAD_SPINEL_CONFIG_HDLC_FCS_SLICING_BY_8_ENABLE
+#define OPENTHREAD_SPINEL_CONFIG_HDLC_FCS_SLICING_BY_8_ENABLE 1
+#endif
+
 #endif // OPENTHREAD_CORE_POSIX_CONFIG_H_
@@ -308,6 +308,35 @@
 #define OPENTHREAD_POSIX_CONFIG_TREL_UDP_PORT 0
 #endif
 
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_TREL_BATCH_SIZE
+ *
+ * The maximum number of TREL packets received with a single `recvmmsg()` or sent with a single `sendmmsg()`.
+ * Define as 1 to receive and send one packet per system call.
+ *
+ * Batching requires Linux. It only pays off when several packets are pending per mainloop iteration; with sparse
+ * traffic it is slower than one packet per system call, so it is disabled by default.
+ *
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_TREL_BATCH_SIZE
+#define OPENTHREAD_POSIX_CONFIG_TREL_BATCH_SIZE 1
+#endif
+
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_UDP_RX_BATCH_SIZE
+ *
+ * The maximum number of datagrams received with a single `recvmmsg()` on a platform UDP socket.
+ * Define as 1 to receive one datagram per system call.
+ *
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_UDP_RX_BATCH_SIZE
+#ifdef __linux__
+#define OPENTHREAD_POSIX_CONFIG_UDP_RX_BATCH_SIZE 4
+#else
+#define OPENTHREAD_POSIX_CONFIG_UDP_RX_BATCH_SIZE 1
+#endif
+#endif
+
 /**
  * @def OPENTHREAD_POSIX_CONFIG_NAT64_CIDR
  *
@@ -383,4 +412,53 @@
 #ifndef OPENTHREAD_POSIX_CONFIG_RCP_TIME_SYNC_INTERVAL
 #define OPENTHREAD_POSIX_CONFIG_RCP_TIME_SYNC_INTERVAL (60 * 1000 * 1000)
 #endif
+
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_TUN_MAX_READS_PER_EVENT
+ *
+ * Define the maximum number of packets read from the TUN device when it becomes readable, before returning to the
+ * mainloop.
+ *
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_TUN_MAX_READS_PER_EVENT
+#define OPENTHREAD_POSIX_CONFIG_TUN_MAX_READS_PER_EVENT 32
+#endif
+
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_RCP_IO_THREAD_ENABLE
+ *
+ * Define as 1 to read and HDLC-decode the data from the RCP UART on a dedicated I/O thread. Decoded frames are passed
+ * to the mainloop through a lock-free ring and an eventfd, so that long running tasklets do not delay draining the
+ * UART.
+ *
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_RCP_IO_THREAD_ENABLE
+#define OPENTHREAD_POSIX_CONFIG_RCP_IO_THREAD_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_RCP_IO_RING_SIZE
+ *
+ * Define the number of decoded frames the RCP I/O thread can queue for the mainloop. While the queue is full, the I/O
+ * thread stops reading from the RCP. MUST be a power of two.
+ *
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_RCP_IO_RING_SIZE
+#define OPENTHREAD_POSIX_CONFIG_RCP_IO_RING_SIZE 32
+#endif
+
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+ *
+ * Define as 1 to keep the file descriptors of mainloop watchers registered in an epoll set, which is polled by the
+ * mainloop as a single file descriptor. Sources using the `otSysMainloopContext` fd_sets are not affected.
+ *
+ * The Thread network interface (TUN, netlink and MLD monitor), platform UDP, TREL and infrastructure network interface
+ * file descriptors are watchers. The daemon, DNS upstream resolver and RCP interface file descriptors are still added
+ * to the fd_sets, so they remain limited to `FD_SETSIZE`.
+ *
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+#define OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE 0
+#endif
 #endif // OPENTHREAD_PLATFORM_CONFIG_H_
@@ -330,6 +330,11 @@ void platformRadioUpdateFdSet(otSysMainloopContext *aContext)
         }
     }
 
+    if (sRadioSpinel.GetAsyncRequestEndUs() < deadline)
+    {
+        deadline = sRadioSpinel.GetAsyncRequestEndUs();
+    }
+
     if (now < deadline)
     {
         uint64_t remain = deadline - now;
@@ -910,3 +915,12 @@ const otRcpInterfaceMetrics *otSysGetRcpInterfaceMetrics(void)
 {
     return sRadioSpinel.GetSpinelInterface().GetRcpInterfaceMetrics();
 }
+
+const otSysRcpRxLatencyHistogram *otSysGetRcpRxLatencyHistogram(void)
+{
+#if OPENTHREAD_POSIX_CONFIG_RCP_BUS == OT_POSIX_RCP_BUS_UART && OPENTHREAD_POSIX_CONFIG_RCP_IO_THREAD_ENABLE
+    return sRadioSpinel.GetSpinelInterface().GetRxLatencyHistogram();
+#else
+    return nullptr;
+#endif
+}
@@ -41,7 +41,10 @@
 #include <stddef.h>
 #include <stdio.h>
 #include <string.h>
+#include <stdlib.h>
 #include <sys/stat.h>
+#include <sys/uio.h>
+#include <time.h>
 #include <unistd.h>
 
 #include <openthread/logging.h>
@@ -54,14 +57,61 @@
 
 #include "common/code_utils.hpp"
 #include "common/encoding.hpp"
+#include "common/hash_index.hpp"
 #include "posix/platform/settings.hpp"
 
 #include "system.hpp"
 
-static const size_t kMaxFileNameSize = sizeof(OPENTHREAD_CONFIG_POSIX_SETTINGS_PATH) + 32;
+/*
+ * The settings file is an append-only log. It starts with `kLogMagic` followed by a sequence of records, each made of a
+ * `RecordHeader` and (for add and set records) the setting value. Every write appends a single record to the log. An
+ * in-memory index (sorted by key, preserving the order of values of the same key) maps each setting value to its
+ * offset in the file, so reads do not scan the file.
+ *
+ * The records carry a checksum so a record torn by a crash during an append is detected and dropped when the log is
+ * replayed on init. When the stale records take more space than the live ones, the log is compacted by writing the
+ * live values into the swap file, which then atomically replaces the data file.
+ */
+
+static const size_t   kMaxFileNameSize   = sizeof(OPENTHREAD_CONFIG_POSIX_SETTINGS_PATH) + 32;
+static const uint32_t kLogMagic          = 0x4c53544f; // "OTSL"
+static const uint32_t kCompactionMinSize = 4096;
+static const uint16_t kDeleteAllIndex    = 0xffff;
+
+enum RecordType : uint8_t
+{
+    kRecordTypeAdd    = 1, // Adds a value to the key.
+    kRecordTypeSet    = 2, // Deletes all values of the key and adds a value to it.
+    kRecordTypeDelete = 3, // Deletes the value at `mIndex` (or all values if `kDeleteAllIndex`) of the key.
+};
+
+struct RecordHeader
+{
+    uint32_t mChecksum; // Checksum over the rest of the header and the value.
+    uint16_t mKey;      // Setting key.
+    uint16_t mLength;   // Value length (zero for delete records).
+    uint16_t mIndex;    // Value index (delete records only).
+    uint8_t  mType;     // Record type (`RecordType`).
+    uint8_t  mReserved; // Reserved, set to zero.
+};
+
+static_assert(sizeof(RecordHeader) == 12, "RecordHeader must not contain padding");
+
+struct IndexEntry
+{
+    uint16_t mKey;    // Setting key.
+    uint16_t mLength; // Value length.
+    uint32_t mOffset; // Offset of the value in the settings file.
+};
 
 static int sSettingsFd = -1;
 
+static IndexEntry *sIndex         = nullptr;
+static uint32_t    sIndexLength   = 0;
+static uint32_t    sIndexCapacity = 0;
+static uint32_t    sLogSize       = 0; // Offset where the next record is appended.
+static uint32_t    sLiveSize      = 0; // Size of the log after compaction.
+
 #if OPENTHREAD_POSIX_CONFIG_SECURE_SETTINGS_ENABLE
 static const uint16_t *sSensitiveKeys       = nullptr;
 static uint16_t        sSensitiveKeysLength = 0;
@@ -106,56 +156,358 @@ static int swapOpen(otInstance *aInstance)
     return fd;
 }
 
+static void swapPersist(otInstance *aInstance, int aFd)
+{
+    char swapFile[kMaxFileNameSize];
+    char dataFile[kMaxFileNameSize];
+
+    getSettingsFileName(aInstance, swapFile, true);
+    getSettingsFileName(aInstance, dataFile, false);
+
+    VerifyOrDie(0 == close(sSettingsFd), OT_EXIT_ERROR_ERRNO);
+    VerifyOrDie(0 == fsync(aFd), OT_EXIT_ERROR_ERRNO);
+    VerifyOrDie(0 == rename(swapFile, dataFile), OT_EXIT_ERROR_ERRNO);
+
+    sSettingsFd = aFd;
+}
+
+static uint32_t calculateChecksum(const RecordHeader &aHeader, const uint8_t *aValue)
+{
+    // FNV-1a hash over the header (excluding the checksum field)
+    // followed by the value.
+
+    typedef ot::HashIndex<1> Hash;
+
+    const uint8_t *header = reinterpret_cast<const uint8_t *>(&aHeader) + sizeof(aHeader.mChecksum);
+
+    return Hash::CalculateHash(aValue, aHeader.mLength,
+                               Hash::CalculateHash(header, sizeof(aHeader) - sizeof(aHeader.mChecksum)));
+}
+
+static void initRecordHeader(RecordHeader  &aHeader,
+                             RecordType     aType,
+                             uint16_t       aKey,
+                             uint16_t       aIndex,
+                             const uint8_t *aValue,
+                             uint16_t       aValueLength)
+{
+    memset(&aHeader, 0, sizeof(aHeader));
+    aHeader.mType     = aType;
+    aHeader.mKey      = aKey;
+    aHeader.mIndex    = aIndex;
+    aHeader.mLength   = aValueLength;
+    aHeader.mChecksum = calculateChecksum(aHeader, aValue);
+}
+
+static void writeAll(int aFd, const void *aBuffer, size_t aLength)
+{
+    ssize_t rval = write(aFd, aBuffer, aLength);
+
+    VerifyOrDie(rval >= 0, OT_EXIT_ERROR_ERRNO);
+    VerifyOrDie(static_cast<size_t>(rval) == aLength, OT_EXIT_FAILURE);
+}
+
 /**
- * Reads @p aLength bytes from the data file and appends to the swap file.
+ * Returns the position of the first entry in the index with a key not less than @p aKey.
  *
- * @param[in]   aFd     The file descriptor of the current swap file.
- * @param[in]   aLength Number of bytes to copy.
+ */
+static uint32_t indexLowerBound(uint16_t aKey)
+{
+    uint32_t low  = 0;
+    uint32_t high = sIndexLength;
+
+    while (low < high)
+    {
+        uint32_t mid = low + (high - low) / 2;
+
+        if (sIndex[mid].mKey < aKey)
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+
+    return low;
+}
+
+/**
+ * Returns the position following the last entry in the index with key @p aKey (starting the search at @p aStart).
  *
  */
-static void swapWrite(otInstance *aInstance, int aFd, uint16_t aLength)
+static uint32_t indexUpperBound(uint16_t aKey, uint32_t aStart)
 {
-    OT_UNUSED_VARIABLE(aInstance);
+    while ((aStart < sIndexLength) && (sIndex[aStart].mKey == aKey))
+    {
+        aStart++;
+    }
 
-    const size_t kBlockSize = 512;
-    uint8_t      buffer[kBlockSize];
+    return aStart;
+}
 
-    while (aLength > 0)
+static void indexInsert(uint32_t aPosition, uint16_t aKey, uint16_t aLength, uint32_t aOffset)
+{
+    if (sIndexLength == sIndexCapacity)
     {
-        uint16_t count = aLength >= sizeof(buffer) ? sizeof(buffer) : aLength;
-        ssize_t  rval  = read(sSettingsFd, buffer, count);
+        uint32_t    capacity = (sIndexCapacity == 0) ? 16 : sIndexCapacity * 2;
+        IndexEntry *index    = static_cast<IndexEntry *>(realloc(sIndex, capacity * sizeof(IndexEntry)));
 
-        VerifyOrDie(rval > 0, OT_EXIT_FAILURE);
-        count = static_cast<uint16_t>(rval);
-        rval  = write(aFd, buffer, count);
-        assert(rval == count);
-        VerifyOrDie(rval == count, OT_EXIT_FAILURE);
-        aLength -= count;
+        VerifyOrDie(index != nullptr, OT_EXIT_FAILURE);
+        sIndex         = index;
+        sIndexCapacity = capacity;
     }
+
+    memmove(&sIndex[aPosition + 1], &sIndex[aPosition], (sIndexLength - aPosition) * sizeof(IndexEntry));
+
+    sIndex[aPosition].mKey    = aKey;
+    sIndex[aPosition].mLength = aLength;
+    sIndex[aPosition].mOffset = aOffset;
+    sIndexLength++;
+
+    sLiveSize += sizeof(RecordHeader) + aLength;
 }
 
-static void swapPersist(otInstance *aInstance, int aFd)
+static void indexRemove(uint32_t aPosition, uint32_t aCount)
 {
-    char swapFile[kMaxFileNameSize];
-    char dataFile[kMaxFileNameSize];
+    for (uint32_t i = aPosition; i < aPosition + aCount; i++)
+    {
+        sLiveSize -= sizeof(RecordHeader) + sIndex[i].mLength;
+    }
 
-    getSettingsFileName(aInstance, swapFile, true);
-    getSettingsFileName(aInstance, dataFile, false);
+    memmove(&sIndex[aPosition], &sIndex[aPosition + aCount], (sIndexLength - aPosition - aCount) * sizeof(IndexEntry));
+    sIndexLength -= aCount;
+}
 
-    VerifyOrDie(0 == close(sSettingsFd), OT_EXIT_ERROR_ERRNO);
-    VerifyOrDie(0 == fsync(aFd), OT_EXIT_ERROR_ERRNO);
-    VerifyOrDie(0 == rename(swapFile, dataFile), OT_EXIT_ERROR_ERRNO);
+static void indexClear(void)
+{
+    free(sIndex);
+    sIndex         = nullptr;
+    sIndexLength   = 0;
+    sIndexCapacity = 0;
+    sLiveSize      = sizeof(kLogMagic);
+}
 
-    sSettingsFd = aFd;
+/**
+ * Applies a record to the in-memory index.
+ *
+ * @param[in]  aHeader       The record header.
+ * @param[in]  aValueOffset  The offset of the record value in the settings file.
+ *
+ * @retval OT_ERROR_NONE        The record was applied successfully.
+ * @retval OT_ERROR_NOT_FOUND   The value to delete was not found.
+ * @retval OT_ERROR_PARSE       The record type is not valid.
+ *
+ */
+static otError indexApplyRecord(const RecordHeader &aHeader, uint32_t aValueOffset)
+{
+    otError  error = OT_ERROR_NONE;
+    uint32_t start = indexLowerBound(aHeader.mKey);
+    uint32_t end   = indexUpperBound(aHeader.mKey, start);
+
+    switch (aHeader.mType)
+    {
+    case kRecordTypeSet:
+        indexRemove(start, end - start);
+        end = start;
+
+        OT_FALL_THROUGH;
+
+    case kRecordTypeAdd:
+        indexInsert(end, aHeader.mKey, aHeader.mLength, aValueOffset);
+        break;
+
+    case kRecordTypeDelete:
+        VerifyOrExit(aHeader.mLength == 0, error = OT_ERROR_PARSE);
+
+        if (aHeader.mIndex == kDeleteAllIndex)
+        {
+            VerifyOrExit(end > start, error = OT_ERROR_NOT_FOUND);
+            indexRemove(start, end - start);
+        }
+        else
+        {
+            VerifyOrExit(aHeader.mIndex < end - start, error = OT_ERROR_NOT_FOUND);
+            indexRemove(start + aHeader.mIndex, 1);
+        }
+
+        break;
+
+    default:
+        error = OT_ERROR_PARSE;
+        break;
+    }
+
+exit:
+    return error;
+}
+
+/**
+ * Rewrites the settings file with only the values in the in-memory index.
+ *
+ */
+static void logCompact(otInstance *aInstance)
+{
+    int      swapFd = swapOpen(aInstance);
+    uint32_t offset = sizeof(kLogMagic);
+    uint8_t *value  = nullptr;
+
+    writeAll(swapFd, &kLogMagic, sizeof(kLogMagic));
+
+    for (uint32_t i = 0; i < sIndexLength; i++)
+    {
+        IndexEntry  &entry = sIndex[i];
+        RecordHeader header;
+
+        if (entry.mLength > 0)
+        {
+            value = static_cast<uint8_t *>(realloc(value, entry.mLength));
+            VerifyOrDie(value != nullptr, OT_EXIT_FAILURE);
+            VerifyOrDie(pread(sSettingsFd, value, entry.mLength, entry.mOffset) == entry.mLength, OT_EXIT_FAILURE);
+        }
+
+        initRecordHeader(header, kRecordTypeAdd, entry.mKey, 0, value, entry.mLength);
+        writeAll(swapFd, &header, sizeof(header));
+        writeAll(swapFd, value, entry.mLength);
+
+        entry.mOffset = offset + sizeof(header);
+        offset += sizeof(header) + entry.mLength;
+    }
+
+    free(value);
+
+    swapPersist(aInstance, swapFd);
+
+    sLogSize = offset;
+    assert(sLogSize == sLiveSize);
+}
+
+static void logCompactIfNeeded(otInstance *aInstance)
+{
+    if ((sLogSize >= kCompactionMinSize) && (sLogSize - sLiveSize > sLiveSize))
+    {
+        logCompact(aInstance);
+    }
+}
+
+/**
+ * Appends a record to the settings file and applies it to the in-memory index.
+ *
+ */
+static void logAppend(otInstance    *aInstance,
+                      RecordType     aType,
+                      uint16_t       aKey,
+                      uint16_t       aIndex,
+                      const uint8_t *aValue,
+                      uint16_t       aValueLength)
+{
+    RecordHeader header;
+    struct iovec iov[2];
+    ssize_t      rval;
+
+    initRecordHeader(header, aType, aKey, aIndex, aValue, aValueLength);
+
+    iov[0].iov_base = &header;
+    iov[0].iov_len  = sizeof(header);
+    iov[1].iov_base = const_cast<uint8_t *>(aValue);
+    iov[1].iov_len  = aValueLength;
+
+    VerifyOrDie(lseek(sSettingsFd, sLogSize, SEEK_SET) == static_cast<off_t>(sLogSize), OT_EXIT_ERROR_ERRNO);
+    rval = writev(sSettingsFd, iov, 2);
+    VerifyOrDie(rval >= 0, OT_EXIT_ERROR_ERRNO);
+    VerifyOrDie(static_cast<size_t>(rval) == sizeof(header) + aValueLength, OT_EXIT_FAILURE);
+    VerifyOrDie(fsync(sSettingsFd) == 0, OT_EXIT_ERROR_ERRNO);
+
+    VerifyOrDie(indexApplyRecord(header, sLogSize + sizeof(header)) == OT_ERROR_NONE, OT_EXIT_FAILURE);
+    sLogSize += sizeof(header) + aValueLength;
+
+    logCompactIfNeeded(aInstance);
+}
+
+/**
+ * Resets the settings file to an empty log.
+ *
+ */
+static void logReset(void)
+{
+    indexClear();
+
+    VerifyOrDie(0 == ftruncate(sSettingsFd, 0), OT_EXIT_ERROR_ERRNO);
+    VerifyOrDie(0 == lseek(sSettingsFd, 0, SEEK_SET), OT_EXIT_ERROR_ERRNO);
+    writeAll(sSettingsFd, &kLogMagic, sizeof(kLogMagic));
+    VerifyOrDie(0 == fsync(sSettingsFd), OT_EXIT_ERROR_ERRNO);
+
+    sLogSize = sizeof(kLogMagic);
+}
+
+/**
+ * Replays the records of the settings file (in @p aBuffer) into the in-memory index.
+ *
+ * Stops at the first record which is incomplete or fails the checksum (e.g., when the device crashed while appending
+ * it) and truncates the file to drop it along with anything that follows.
+ *
+ */
+static void logReplay(const uint8_t *aBuffer, uint32_t aSize)
+{
+    uint32_t offset = sizeof(kLogMagic);
+
+    while (aSize - offset >= sizeof(RecordHeader))
+    {
+        RecordHeader header;
+
+        memcpy(&header, &aBuffer[offset], sizeof(header));
+
+        VerifyOrExit(header.mLength <= aSize - offset - sizeof(header));
+        VerifyOrExit(header.mChecksum == calculateChecksum(header, &aBuffer[offset + sizeof(header)]));
+        VerifyOrExit(indexApplyRecord(header, offset + sizeof(header)) == OT_ERROR_NONE);
+
+        offset += sizeof(header) + header.mLength;
+    }
+
+exit:
+    if (offset != aSize)
+    {
+        otLogWarnPlat("Dropping %" PRIu32 " bytes of incomplete or corrupted settings", aSize - offset);
+        VerifyOrDie(0 == ftruncate(sSettingsFd, offset), OT_EXIT_ERROR_ERRNO);
+    }
+
+    sLogSize = offset;
 }
 
-static void swapDiscard(otInstance *aInstance, int aFd)
+/**
+ * Loads a settings file in the legacy format (a sequence of key, length and value without any header) into the
+ * in-memory index.
+ *
+ * @retval OT_ERROR_NONE   The settings file was loaded successfully.
+ * @retval OT_ERROR_PARSE  The settings file is corrupted.
+ *
+ */
+static otError legacyLoad(const uint8_t *aBuffer, uint32_t aSize)
 {
-    char swapFileName[kMaxFileNameSize];
+    otError  error  = OT_ERROR_NONE;
+    uint32_t offset = 0;
+
+    while (offset < aSize)
+    {
+        RecordHeader header;
+
+        VerifyOrExit(aSize - offset >= sizeof(header.mKey) + sizeof(header.mLength), error = OT_ERROR_PARSE);
+
+        memset(&header, 0, sizeof(header));
+        header.mType = kRecordTypeAdd;
+        memcpy(&header.mKey, &aBuffer[offset], sizeof(header.mKey));
+        offset += sizeof(header.mKey);
+        memcpy(&header.mLength, &aBuffer[offset], sizeof(header.mLength));
+        offset += sizeof(header.mLength);
+
+        VerifyOrExit(header.mLength <= aSize - offset, error = OT_ERROR_PARSE);
+        SuccessOrExit(error = indexApplyRecord(header, offset));
+        offset += header.mLength;
+    }
 
-    VerifyOrDie(0 == close(aFd), OT_EXIT_ERROR_ERRNO);
-    getSettingsFileName(aInstance, swapFileName, true);
-    VerifyOrDie(0 == unlink(swapFileName), OT_EXIT_ERROR_ERRNO);
+exit:
+    return error;
 }
 
 void otPlatSettingsInit(otInstance *aInstance, const uint16_t *aSensitiveKeys, uint16_t aSensitiveKeysLength)
@@ -165,7 +517,9 @@ void otPlatSettingsInit(otInstance *aInstance, const uint16_t *aSensitiveKeys, u
     OT_UNUSED_VARIABLE(aSensitiveKeysLength);
 #endif
 
-    otError error = OT_ERROR_NONE;
+    uint8_t *buffer = nullptr;
+    uint32_t magic  = 0;
+    off_t    size;
 
 #if OPENTHREAD_POSIX_CONFIG_SECURE_SETTINGS_ENABLE
     sSensitiveKeys       = aSensitiveKeys;
@@ -193,31 +547,47 @@ void otPlatSettingsInit(otInstance *aInstance, const uint16_t *aSensitiveKeys, u
 
     VerifyOrDie(sSettingsFd != -1, OT_EXIT_ERROR_ERRNO);
 
-    for (off_t size = lseek(sSettingsFd, 0, SEEK_END), offset = lseek(sSettingsFd, 0, SEEK_SET); offset < size;)
-    {
-        uint16_t key;
-        uint16_t length;
-        ssize_t  rval;
+    indexClear();
+
+    size = lseek(sSettingsFd, 0, SEEK_END);
+    VerifyOrDie(size >= 0 && size <= UINT32_MAX, OT_EXIT_ERROR_ERRNO);
 
-        rval = read(sSettingsFd, &key, sizeof(key));
-        VerifyOrExit(rval == sizeof(key), error = OT_ERROR_PARSE);
+    if (size > 0)
+    {
+        buffer = static_cast<uint8_t *>(malloc(static_cast<size_t>(size)));
+        VerifyOrDie(buffer != nullptr, OT_EXIT_FAILURE);
+        VerifyOrDie(pread(sSettingsFd, buffer, static_cast<size_t>(size), 0) == size, OT_EXIT_ERROR_ERRNO);
+    }
 
-        rval = read(sSettingsFd, &length, sizeof(length));
-        VerifyOrExit(rval == sizeof(length), error = OT_ERROR_PARSE);
+    if (size >= static_cast<off_t>(sizeof(magic)))
+    {
+        memcpy(&magic, buffer, sizeof(magic));
+    }
 
-        offset += sizeof(key) + sizeof(length) + length;
-        VerifyOrExit(offset == lseek(sSettingsFd, length, SEEK_CUR), error = OT_ERROR_PARSE);
+    if (magic == kLogMagic)
+    {
+        logReplay(buffer, static_cast<uint32_t>(size));
+        logCompactIfNeeded(aInstance);
+    }
+    else if ((size > 0) && (legacyLoad(buffer, static_cast<uint32_t>(size)) == OT_ERROR_NONE))
+    {
+        // Convert a settings file in the legacy format to a log.
+        sLogSize = static_cast<uint32_t>(size);
+        logCompact(aInstance);
+    }
+    else
+    {
+        logReset();
     }
 
+    free(buffer);
+
 #if OPENTHREAD_POSIX_CONFIG_SECURE_SETTINGS_ENABLE
     otPosixSecureSettingsInit(aInstance);
 #endif
 
 exit:
-    if (error == OT_ERROR_PARSE)
-    {
-        VerifyOrDie(ftruncate(sSettingsFd, 0) == 0, OT_EXIT_ERROR_ERRNO);
-    }
+    return;
 }
 
 void otPlatSettingsDeinit(otInstance *aInstance)
@@ -230,8 +600,11 @@ void otPlatSettingsDeinit(otInstance *aInstance)
     otPosixSecureSettingsDeinit(aInstance);
 #endif
 
+    indexClear();
+
     VerifyOrExit(sSettingsFd != -1);
     VerifyOrDie(close(sSettingsFd) == 0, OT_EXIT_ERROR_ERRNO);
+    sSettingsFd = -1;
 
 exit:
     return;
@@ -323,7 +696,7 @@ void otPlatSettingsWipe(otInstance *aInstance)
     otPosixSecureSettingsWipe(aInstance);
 #endif
 
-    VerifyOrDie(0 == ftruncate(sSettingsFd, 0), OT_EXIT_ERROR_ERRNO);
+    logReset();
 }
 
 namespace ot {
@@ -333,52 +706,25 @@ otError PlatformSettingsGet(otInstance *aInstance, uint16_t aKey, int aIndex, ui
 {
     OT_UNUSED_VARIABLE(aInstance);
 
-    otError     error  = OT_ERROR_NOT_FOUND;
-    const off_t size   = lseek(sSettingsFd, 0, SEEK_END);
-    off_t       offset = lseek(sSettingsFd, 0, SEEK_SET);
-
-    VerifyOrExit(offset == 0 && size >= 0, error = OT_ERROR_PARSE);
-
-    while (offset < size)
-    {
-        uint16_t key;
-        uint16_t length;
-        ssize_t  rval;
+    otError           error = OT_ERROR_NOT_FOUND;
+    uint32_t          start = indexLowerBound(aKey);
+    const IndexEntry *entry;
 
-        rval = read(sSettingsFd, &key, sizeof(key));
-        VerifyOrExit(rval == sizeof(key), error = OT_ERROR_PARSE);
+    VerifyOrExit(aIndex >= 0 && static_cast<uint32_t>(aIndex) < indexUpperBound(aKey, start) - start);
 
-        rval = read(sSettingsFd, &length, sizeof(length));
-        VerifyOrExit(rval == sizeof(length), error = OT_ERROR_PARSE);
+    entry = &sIndex[start + static_cast<uint32_t>(aIndex)];
+    error = OT_ERROR_NONE;
 
-        if (key == aKey)
+    if (aValueLength)
+    {
+        if (aValue)
         {
-            if (aIndex == 0)
-            {
-                error = OT_ERROR_NONE;
-
-                if (aValueLength)
-                {
-                    if (aValue)
-                    {
-                        uint16_t readLength = (length <= *aValueLength ? length : *aValueLength);
-
-                        VerifyOrExit(read(sSettingsFd, aValue, readLength) == readLength, error = OT_ERROR_PARSE);
-                    }
-
-                    *aValueLength = length;
-                }
-
-                break;
-            }
-            else
-            {
-                --aIndex;
-            }
+            uint16_t readLength = (entry->mLength <= *aValueLength ? entry->mLength : *aValueLength);
+
+            VerifyOrExit(pread(sSettingsFd, aValue, readLength, entry->mOffset) == readLength, error = OT_ERROR_PARSE);
         }
 
-        offset += sizeof(key) + sizeof(length) + length;
-        VerifyOrExit(offset == lseek(sSettingsFd, length, SEEK_CUR), error = OT_ERROR_PARSE);
+        *aValueLength = entry->mLength;
     }
 
 exit:
@@ -387,119 +733,40 @@ exit:
 
 void PlatformSettingsSet(otInstance *aInstance, uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength)
 {
-    int swapFd = -1;
-
-    switch (PlatformSettingsDelete(aInstance, aKey, -1, &swapFd))
-    {
-    case OT_ERROR_NONE:
-    case OT_ERROR_NOT_FOUND:
-        break;
-
-    default:
-        assert(false);
-        break;
-    }
-
-    VerifyOrDie(write(swapFd, &aKey, sizeof(aKey)) == sizeof(aKey) &&
-                    write(swapFd, &aValueLength, sizeof(aValueLength)) == sizeof(aValueLength) &&
-                    write(swapFd, aValue, aValueLength) == aValueLength,
-                OT_EXIT_FAILURE);
-
-    swapPersist(aInstance, swapFd);
+    logAppend(aInstance, kRecordTypeSet, aKey, 0, aValue, aValueLength);
 }
 
 void PlatformSettingsAdd(otInstance *aInstance, uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength)
 {
-    off_t size   = lseek(sSettingsFd, 0, SEEK_END);
-    int   swapFd = swapOpen(aInstance);
-
-    if (size > 0)
-    {
-        VerifyOrDie(0 == lseek(sSettingsFd, 0, SEEK_SET), OT_EXIT_ERROR_ERRNO);
-        swapWrite(aInstance, swapFd, static_cast<uint16_t>(size));
-    }
-
-    VerifyOrDie(write(swapFd, &aKey, sizeof(aKey)) == sizeof(aKey) &&
-                    write(swapFd, &aValueLength, sizeof(aValueLength)) == sizeof(aValueLength) &&
-                    write(swapFd, aValue, aValueLength) == aValueLength,
-                OT_EXIT_FAILURE);
-
-    swapPersist(aInstance, swapFd);
+    logAppend(aInstance, kRecordTypeAdd, aKey, 0, aValue, aValueLength);
 }
 
 otError PlatformSettingsDelete(otInstance *aInstance, uint16_t aKey, int aIndex, int *aSwapFd)
 {
-    otError error  = OT_ERROR_NOT_FOUND;
-    off_t   size   = lseek(sSettingsFd, 0, SEEK_END);
-    off_t   offset = lseek(sSettingsFd, 0, SEEK_SET);
-    int     swapFd = swapOpen(aInstance);
-
-    assert(swapFd != -1);
-    assert(offset == 0);
-    VerifyOrExit(offset == 0 && size >= 0, error = OT_ERROR_PARSE);
+    otError  error = OT_ERROR_NONE;
+    uint32_t start = indexLowerBound(aKey);
+    uint32_t count = indexUpperBound(aKey, start) - start;
 
-    while (offset < size)
-    {
-        uint16_t key;
-        uint16_t length;
-        ssize_t  rval;
-
-        rval = read(sSettingsFd, &key, sizeof(key));
-        VerifyOrExit(rval == sizeof(key), error = OT_ERROR_PARSE);
-
-        rval = read(sSettingsFd, &length, sizeof(length));
-        VerifyOrExit(rval == sizeof(length), error = OT_ERROR_PARSE);
-
-        offset += sizeof(key) + sizeof(length) + length;
-
-        if (aKey == key)
-        {
-            if (aIndex == 0)
-            {
-                VerifyOrExit(offset == lseek(sSettingsFd, length, SEEK_CUR), error = OT_ERROR_PARSE);
-                swapWrite(aInstance, swapFd, static_cast<uint16_t>(size - offset));
-                error = OT_ERROR_NONE;
-                break;
-            }
-            else if (aIndex == -1)
-            {
-                VerifyOrExit(offset == lseek(sSettingsFd, length, SEEK_CUR), error = OT_ERROR_PARSE);
-                error = OT_ERROR_NONE;
-                continue;
-            }
-            else
-            {
-                --aIndex;
-            }
-        }
-
-        rval = write(swapFd, &key, sizeof(key));
-        assert(rval == sizeof(key));
-        VerifyOrDie(rval == sizeof(key), OT_EXIT_FAILURE);
-
-        rval = write(swapFd, &length, sizeof(length));
-        assert(rval == sizeof(length));
-        VerifyOrDie(rval == sizeof(length), OT_EXIT_FAILURE);
-
-        swapWrite(aInstance, swapFd, length);
-    }
-
-exit:
-    VerifyOrDie(error != OT_ERROR_PARSE, OT_EXIT_FAILURE);
+    // The delete is always appended to the settings log, no swap file
+    // is generated.
 
     if (aSwapFd != nullptr)
     {
-        *aSwapFd = swapFd;
+        *aSwapFd = -1;
     }
-    else if (error == OT_ERROR_NONE)
+
+    if (aIndex == -1)
     {
-        swapPersist(aInstance, swapFd);
+        VerifyOrExit(count > 0, error = OT_ERROR_NOT_FOUND);
+        logAppend(aInstance, kRecordTypeDelete, aKey, kDeleteAllIndex, nullptr, 0);
     }
-    else if (error == OT_ERROR_NOT_FOUND)
+    else
     {
-        swapDiscard(aInstance, swapFd);
+        VerifyOrExit(aIndex >= 0 && static_cast<uint32_t>(aIndex) < count, error = OT_ERROR_NOT_FOUND);
+        logAppend(aInstance, kRecordTypeDelete, aKey, static_cast<uint16_t>(aIndex), nullptr, 0);
     }
 
+exit:
     return error;
 }
 
@@ -527,6 +794,8 @@ void PlatformSettingsGetSensitiveKeys(otInstance *aInstance, const uint16_t **aK
 
 void otLogCritPlat(const char *aFormat, ...) { OT_UNUSED_VARIABLE(aFormat); }
 
+void otLogWarnPlat(const char *aFormat, ...) { OT_UNUSED_VARIABLE(aFormat); }
+
 const char *otExitCodeToString(uint8_t aExitCode)
 {
     OT_UNUSED_VARIABLE(aExitCode);
@@ -543,6 +812,81 @@ void otPlatRadioGetIeeeEui64(otInstance *aInstance, uint8_t *aIeeeEui64)
 // Stub implementation for testing
 bool IsSystemDryRun(void) { return false; }
 
+static uint64_t getNowUsec(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return static_cast<uint64_t>(now.tv_sec) * 1000000 + static_cast<uint64_t>(now.tv_nsec) / 1000;
+}
+
+static off_t getSettingsFileSize(void) { return lseek(sSettingsFd, 0, SEEK_END); }
+
+static void appendToSettingsFile(const void *aBuffer, size_t aLength)
+{
+    VerifyOrDie(lseek(sSettingsFd, 0, SEEK_END) >= 0, OT_EXIT_ERROR_ERRNO);
+    writeAll(sSettingsFd, aBuffer, aLength);
+}
+
+static void benchmark(otInstance *aInstance)
+{
+    const uint16_t kNumKeys = 1000;
+    uint8_t        value[32];
+    uint64_t       start;
+    uint64_t       addTime;
+    uint64_t       getTime;
+    uint64_t       setTime;
+    uint64_t       initTime;
+    uint64_t       deleteTime;
+
+    memset(value, 0x5a, sizeof(value));
+
+    otPlatSettingsWipe(aInstance);
+
+    start = getNowUsec();
+    for (uint16_t key = 0; key < kNumKeys; key++)
+    {
+        assert(otPlatSettingsAdd(aInstance, key, value, sizeof(value)) == OT_ERROR_NONE);
+    }
+    addTime = getNowUsec() - start;
+
+    start = getNowUsec();
+    for (uint16_t key = 0; key < kNumKeys; key++)
+    {
+        uint16_t length = sizeof(value);
+
+        assert(otPlatSettingsGet(aInstance, key, 0, value, &length) == OT_ERROR_NONE);
+        assert(length == sizeof(value));
+    }
+    getTime = getNowUsec() - start;
+
+    start = getNowUsec();
+    for (uint16_t key = 0; key < kNumKeys; key++)
+    {
+        assert(otPlatSettingsSet(aInstance, key, value, sizeof(value) / 2) == OT_ERROR_NONE);
+    }
+    setTime = getNowUsec() - start;
+
+    start = getNowUsec();
+    otPlatSettingsDeinit(aInstance);
+    otPlatSettingsInit(aInstance, nullptr, 0);
+    initTime = getNowUsec() - start;
+
+    start = getNowUsec();
+    for (uint16_t key = 0; key < kNumKeys; key++)
+    {
+        assert(otPlatSettingsDelete(aInstance, key, 0) == OT_ERROR_NONE);
+    }
+    deleteTime = getNowUsec() - start;
+
+    printf("Settings benchmark with %u keys (per operation): add %" PRIu64 "us, get %" PRIu64 "us, set %" PRIu64
+           "us, delete %" PRIu64 "us, init %" PRIu64 "us\n",
+           kNumKeys, addTime / kNumKeys, getTime / kNumKeys, setTime / kNumKeys, deleteTime / kNumKeys, initTime);
+
+    otPlatSettingsWipe(aInstance);
+}
+
 int main()
 {
     otInstance *instance = nullptr;
@@ -678,6 +1022,98 @@ int main()
         assert(otPlatSettingsGet(instance, 0, 0, nullptr, nullptr) == OT_ERROR_NOT_FOUND);
     }
     otPlatSettingsWipe(instance);
+
+    // verify records persist across re-initialization
+    assert(otPlatSettingsAdd(instance, 0, data, sizeof(data)) == OT_ERROR_NONE);
+    assert(otPlatSettingsSet(instance, 1, data, sizeof(data) / 2) == OT_ERROR_NONE);
+    assert(otPlatSettingsAdd(instance, 0, data, sizeof(data) / 3) == OT_ERROR_NONE);
+    assert(otPlatSettingsDelete(instance, 0, 0) == OT_ERROR_NONE);
+    otPlatSettingsDeinit(instance);
+    otPlatSettingsInit(instance, nullptr, 0);
+    {
+        uint8_t  value[sizeof(data)];
+        uint16_t length = sizeof(value);
+
+        assert(otPlatSettingsGet(instance, 0, 0, value, &length) == OT_ERROR_NONE);
+        assert(length == sizeof(data) / 3);
+        assert(0 == memcmp(value, data, length));
+        assert(otPlatSettingsGet(instance, 0, 1, nullptr, nullptr) == OT_ERROR_NOT_FOUND);
+
+        length = sizeof(value);
+        assert(otPlatSettingsGet(instance, 1, 0, value, &length) == OT_ERROR_NONE);
+        assert(length == sizeof(data) / 2);
+        assert(0 == memcmp(value, data, length));
+    }
+
+    // verify incomplete and corrupted records (e.g., a crash while appending) are dropped
+    {
+        off_t        size = getSettingsFileSize();
+        RecordHeader header;
+        uint8_t      value[sizeof(data)];
+        uint16_t     length = sizeof(value);
+
+        initRecordHeader(header, kRecordTypeSet, 1, 0, data, sizeof(data));
+        appendToSettingsFile(&header, sizeof(header));
+        appendToSettingsFile(data, sizeof(data) / 2);
+        otPlatSettingsDeinit(instance);
+        otPlatSettingsInit(instance, nullptr, 0);
+        assert(getSettingsFileSize() == size);
+
+        header.mChecksum ^= 1;
+        appendToSettingsFile(&header, sizeof(header));
+        appendToSettingsFile(data, sizeof(data));
+        otPlatSettingsDeinit(instance);
+        otPlatSettingsInit(instance, nullptr, 0);
+        assert(getSettingsFileSize() == size);
+
+        assert(otPlatSettingsGet(instance, 1, 0, value, &length) == OT_ERROR_NONE);
+        assert(length == sizeof(data) / 2);
+        assert(0 == memcmp(value, data, length));
+    }
+    otPlatSettingsWipe(instance);
+
+    // verify a settings file in the legacy format is converted
+    {
+        const uint16_t kLegacyRecords[][2] = {{3, sizeof(data)}, {4, sizeof(data) / 2}, {3, sizeof(data) / 3}};
+        uint8_t        value[sizeof(data)];
+        uint16_t       length = sizeof(value);
+        uint32_t       magic;
+
+        VerifyOrDie(0 == ftruncate(sSettingsFd, 0), OT_EXIT_ERROR_ERRNO);
+
+        for (const uint16_t *record : kLegacyRecords)
+        {
+            appendToSettingsFile(record, sizeof(uint16_t) * 2);
+            appendToSettingsFile(data, record[1]);
+        }
+
+        otPlatSettingsDeinit(instance);
+        otPlatSettingsInit(instance, nullptr, 0);
+
+        assert(pread(sSettingsFd, &magic, sizeof(magic), 0) == sizeof(magic));
+        assert(magic == kLogMagic);
+
+        assert(otPlatSettingsGet(instance, 3, 1, value, &length) == OT_ERROR_NONE);
+        assert(length == sizeof(data) / 3);
+        assert(0 == memcmp(value, data, length));
+
+        length = sizeof(value);
+        assert(otPlatSettingsGet(instance, 4, 0, value, &length) == OT_ERROR_NONE);
+        assert(length == sizeof(data) / 2);
+        assert(0 == memcmp(value, data, length));
+    }
+    otPlatSettingsWipe(instance);
+
+    // verify the log is compacted
+    for (int i = 0; i < 1000; i++)
+    {
+        assert(otPlatSettingsSet(instance, 0, data, sizeof(data)) == OT_ERROR_NONE);
+    }
+    assert(getSettingsFileSize() < static_cast<off_t>(kCompactionMinSize + sizeof(RecordHeader) + sizeof(data)));
+    otPlatSettingsWipe(instance);
+
+    benchmark(instance);
+
     otPlatSettingsDeinit(instance);
 
     return 0;
@@ -70,7 +70,7 @@ void PlatformSettingsSet(otInstance *aInstance, uint16_t aKey, const uint8_t *aV
 void PlatformSettingsAdd(otInstance *aInstance, uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength);
 
 /**
- * Removes a setting either from swap file or persisted file.
+ * Removes a setting from the persisted file.
  *
  * @param[in]  aInstance  The OpenThread instance structure.
  * @param[in]  aKey       The key associated with the requested setting.
@@ -78,8 +78,8 @@ void PlatformSettingsAdd(otInstance *aInstance, uint16_t aKey, const uint8_t *aV
  * @param[out] aSwapFd    A optional pointer to receive file descriptor of the generated swap file descriptor.
  *
  * @note
- *   If @p aSwapFd is null, operate deleting on the setting file.
- *   If @p aSwapFd is not null, operate on the swap file, and aSwapFd will point to the swap file descriptor.
+ *   The settings file is an append-only log, so the removal is always appended to it and no swap file is generated.
+ *   If @p aSwapFd is not null, it is set to -1.
  *
  * @retval OT_ERROR_NONE        The given key and index was found and removed successfully.
  * @retval OT_ERROR_NOT_FOUND   The given key or index was not found in the setting store.
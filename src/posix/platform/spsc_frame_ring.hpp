@@ -0,0 +1,159 @@
+/*
+ *  Copyright (c) 2023, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for a lock-free single-producer single-consumer frame ring.
+ */
+
+#ifndef POSIX_PLATFORM_SPSC_FRAME_RING_HPP_
+#define POSIX_PLATFORM_SPSC_FRAME_RING_HPP_
+
+#include <atomic>
+#include <stdint.h>
+
+#include <openthread/error.h>
+
+namespace ot {
+namespace Posix {
+
+/**
+ * Implements a lock-free ring of frames shared between exactly one producer thread and one consumer thread.
+ *
+ * The producer fills the slot returned by `GetWriteSlot()` and publishes it with `Commit()`. The consumer reads the
+ * slot returned by `GetReadSlot()` and hands it back with `Release()`. Each index is only written by one side, so no
+ * lock is needed.
+ *
+ * @tparam kNumSlots  The number of slots, MUST be a power of two.
+ * @tparam kSlotSize  The maximum frame length of a slot.
+ *
+ */
+template <uint16_t kNumSlots, uint16_t kSlotSize> class SpscFrameRing
+{
+    friend class SpscFrameRingTester;
+
+    static_assert(kNumSlots > 0 && (kNumSlots & (kNumSlots - 1)) == 0, "kNumSlots MUST be a power of two");
+
+public:
+    /**
+     * Represents a slot of the ring.
+     *
+     */
+    struct Slot
+    {
+        uint64_t mTimestamp;       ///< The time the frame was received (in microseconds).
+        otError  mError;           ///< The error of the frame, the frame data is only valid if `OT_ERROR_NONE`.
+        uint16_t mLength;          ///< The length of the frame.
+        uint8_t  mData[kSlotSize]; ///< The frame data.
+    };
+
+    /**
+     * Initializes the ring as empty.
+     *
+     */
+    SpscFrameRing(void)
+        : mHead(0)
+        , mTail(0)
+        , mDroppedCount(0)
+    {
+    }
+
+    /**
+     * Returns the slot to fill with the next frame. Only called by the producer.
+     *
+     * @returns A pointer to the slot, or `nullptr` if the ring is full.
+     *
+     */
+    Slot *GetWriteSlot(void)
+    {
+        uint32_t head = mHead.load(std::memory_order_relaxed);
+
+        return (head - mTail.load(std::memory_order_acquire) < kNumSlots) ? &mSlots[head % kNumSlots] : nullptr;
+    }
+
+    /**
+     * Publishes the slot returned by `GetWriteSlot()` to the consumer. Only called by the producer.
+     *
+     */
+    void Commit(void) { mHead.store(mHead.load(std::memory_order_relaxed) + 1, std::memory_order_release); }
+
+    /**
+     * Counts a frame the producer dropped, e.g., because it does not fit in a slot.
+     *
+     */
+    void CountDropped(void) { mDroppedCount.fetch_add(1, std::memory_order_relaxed); }
+
+    /**
+     * Returns the oldest published slot. Only called by the consumer.
+     *
+     * @returns A pointer to the slot, or `nullptr` if the ring is empty.
+     *
+     */
+    const Slot *GetReadSlot(void) const
+    {
+        uint32_t tail = mTail.load(std::memory_order_relaxed);
+
+        return (mHead.load(std::memory_order_acquire) != tail) ? &mSlots[tail % kNumSlots] : nullptr;
+    }
+
+    /**
+     * Hands the slot returned by `GetReadSlot()` back to the producer. Only called by the consumer.
+     *
+     */
+    void Release(void) { mTail.store(mTail.load(std::memory_order_relaxed) + 1, std::memory_order_release); }
+
+    /**
+     * Returns the number of published slots not yet released.
+     *
+     * @returns The number of queued frames.
+     *
+     */
+    uint16_t GetQueuedCount(void) const
+    {
+        return static_cast<uint16_t>(mHead.load(std::memory_order_acquire) - mTail.load(std::memory_order_acquire));
+    }
+
+    /**
+     * Returns the number of frames counted by `CountDropped()`.
+     *
+     * @returns The number of dropped frames.
+     *
+     */
+    uint32_t GetDroppedCount(void) const { return mDroppedCount.load(std::memory_order_relaxed); }
+
+private:
+    std::atomic<uint32_t> mHead;
+    std::atomic<uint32_t> mTail;
+    std::atomic<uint32_t> mDroppedCount;
+    Slot                  mSlots[kNumSlots];
+};
+
+} // namespace Posix
+} // namespace ot
+
+#endif // POSIX_PLATFORM_SPSC_FRAME_RING_HPP_
@@ -45,6 +45,7 @@
 #include <openthread/logging.h>
 #include <openthread/platform/trel.h>
 
+#include "mainloop.hpp"
 #include "radio_url.hpp"
 #include "system.hpp"
 #include "common/code_utils.hpp"
@@ -52,7 +53,12 @@
 #if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
 
 #define TREL_MAX_PACKET_SIZE 1400
-#define TREL_PACKET_POOL_SIZE 5
+#define TREL_BATCH_SIZE OPENTHREAD_POSIX_CONFIG_TREL_BATCH_SIZE
+#define TREL_PACKET_POOL_SIZE (TREL_BATCH_SIZE + 4)
+
+#if TREL_BATCH_SIZE > 1 && !defined(__linux__)
+#error "OPENTHREAD_POSIX_CONFIG_TREL_BATCH_SIZE > 1 requires recvmmsg() and sendmmsg()"
+#endif
 
 typedef struct TxPacket
 {
@@ -62,16 +68,19 @@ typedef struct TxPacket
     otSockAddr       mDestSockAddr;
 } TxPacket;
 
-static uint8_t   sRxPacketBuffer[TREL_MAX_PACKET_SIZE];
-static uint16_t  sRxPacketLength;
+static uint8_t   sRxPacketBuffers[TREL_BATCH_SIZE][TREL_MAX_PACKET_SIZE];
 static TxPacket  sTxPacketPool[TREL_PACKET_POOL_SIZE];
 static TxPacket *sFreeTxPacketHead;  // A singly linked list of free/available `TxPacket` from pool.
 static TxPacket *sTxPacketQueueTail; // A circular linked list for queued tx packets.
 
-static char sInterfaceName[IFNAMSIZ + 1];
-static bool sInitialized = false;
-static bool sEnabled     = false;
-static int  sSocket      = -1;
+static void HandleSocketEvents(void *aContext, uint8_t aEvents);
+
+static char                         sInterfaceName[IFNAMSIZ + 1];
+static bool                         sInitialized = false;
+static bool                         sEnabled     = false;
+static int                          sSocket      = -1;
+static otInstance                  *sInstance    = nullptr;
+static ot::Posix::Mainloop::Watcher sWatcher(HandleSocketEvents, nullptr);
 
 static const char *Ip6AddrToString(const void *aAddress)
 {
@@ -156,6 +165,33 @@ static void PrepareSocket(uint16_t &aUdpPort)
     aUdpPort = ntohs(sockAddr.sin6_port);
 }
 
+static void ToSockAddrIn6(const otSockAddr &aSockAddr, struct sockaddr_in6 &aSockAddrIn6)
+{
+    memset(&aSockAddrIn6, 0, sizeof(aSockAddrIn6));
+    aSockAddrIn6.sin6_family = AF_INET6;
+    aSockAddrIn6.sin6_port   = htons(aSockAddr.mPort);
+    memcpy(&aSockAddrIn6.sin6_addr, &aSockAddr.mAddress, sizeof(otIp6Address));
+}
+
+static otError SendErrnoToError(int aErrno)
+{
+    otError error;
+
+    switch (aErrno)
+    {
+    case ENETUNREACH:
+    case ENETDOWN:
+    case EHOSTUNREACH:
+        error = OT_ERROR_ABORT;
+        break;
+
+    default:
+        error = OT_ERROR_INVALID_STATE;
+    }
+
+    return error;
+}
+
 static otError SendPacket(const uint8_t *aBuffer, uint16_t aLength, const otSockAddr *aDestSockAddr)
 {
     otError             error = OT_ERROR_NONE;
@@ -164,28 +200,14 @@ static otError SendPacket(const uint8_t *aBuffer, uint16_t aLength, const otSock
 
     VerifyOrExit(sSocket >= 0, error = OT_ERROR_INVALID_STATE);
 
-    memset(&sockAddr, 0, sizeof(sockAddr));
-    sockAddr.sin6_family = AF_INET6;
-    sockAddr.sin6_port   = htons(aDestSockAddr->mPort);
-    memcpy(&sockAddr.sin6_addr, &aDestSockAddr->mAddress, sizeof(otIp6Address));
+    ToSockAddrIn6(*aDestSockAddr, sockAddr);
 
     ret = sendto(sSocket, aBuffer, aLength, 0, (struct sockaddr *)&sockAddr, sizeof(sockAddr));
 
     if (ret != aLength)
     {
         otLogDebgPlat("[trel] SendPacket() -- sendto() failed errno %d", errno);
-
-        switch (errno)
-        {
-        case ENETUNREACH:
-        case ENETDOWN:
-        case EHOSTUNREACH:
-            error = OT_ERROR_ABORT;
-            break;
-
-        default:
-            error = OT_ERROR_INVALID_STATE;
-        }
+        error = SendErrnoToError(errno);
     }
 
 exit:
@@ -195,34 +217,74 @@ exit:
     return error;
 }
 
-static void ReceivePacket(int aSocket, otInstance *aInstance)
+static void HandleReceivedPacket(otInstance                *aInstance,
+                                 uint8_t                   *aBuffer,
+                                 uint16_t                   aLength,
+                                 const struct sockaddr_in6 &aSockAddr)
 {
-    struct sockaddr_in6 sockAddr;
-    socklen_t           sockAddrLen = sizeof(sockAddr);
-    ssize_t             ret;
+    otLogDebgPlat("[trel] ReceivePacket() - received from [%s]:%d, id:%d, pkt:%s",
+                  Ip6AddrToString(&aSockAddr.sin6_addr), ntohs(aSockAddr.sin6_port), aSockAddr.sin6_scope_id,
+                  BufferToString(aBuffer, aLength));
 
-    memset(&sockAddr, 0, sizeof(sockAddr));
+    // A previous packet of the same batch may have disabled TREL.
+    if (sEnabled)
+    {
+        otPlatTrelHandleReceived(aInstance, aBuffer, aLength);
+    }
+}
 
-    ret = recvfrom(aSocket, (char *)sRxPacketBuffer, sizeof(sRxPacketBuffer), 0, (struct sockaddr *)&sockAddr,
-                   &sockAddrLen);
-    VerifyOrDie(ret >= 0, OT_EXIT_ERROR_ERRNO);
+#if TREL_BATCH_SIZE > 1
+
+static void ReceivePackets(int aSocket, otInstance *aInstance)
+{
+    struct sockaddr_in6 sockAddrs[TREL_BATCH_SIZE];
+    struct iovec        iovecs[TREL_BATCH_SIZE];
+    struct mmsghdr      msgs[TREL_BATCH_SIZE];
+    int                 count;
 
-    sRxPacketLength = (uint16_t)(ret);
+    memset(msgs, 0, sizeof(msgs));
+    memset(sockAddrs, 0, sizeof(sockAddrs));
 
-    if (sRxPacketLength > sizeof(sRxPacketBuffer))
+    for (int i = 0; i < TREL_BATCH_SIZE; i++)
     {
-        sRxPacketLength = sizeof(sRxPacketLength);
+        iovecs[i].iov_base = sRxPacketBuffers[i];
+        iovecs[i].iov_len  = sizeof(sRxPacketBuffers[i]);
+
+        msgs[i].msg_hdr.msg_name    = &sockAddrs[i];
+        msgs[i].msg_hdr.msg_namelen = sizeof(sockAddrs[i]);
+        msgs[i].msg_hdr.msg_iov     = &iovecs[i];
+        msgs[i].msg_hdr.msg_iovlen  = 1;
     }
 
-    otLogDebgPlat("[trel] ReceivePacket() - received from [%s]:%d, id:%d, pkt:%s", Ip6AddrToString(&sockAddr.sin6_addr),
-                  ntohs(sockAddr.sin6_port), sockAddr.sin6_scope_id, BufferToString(sRxPacketBuffer, sRxPacketLength));
+    // Drain up to `TREL_BATCH_SIZE` queued packets with a single system call.
+    count = recvmmsg(aSocket, msgs, TREL_BATCH_SIZE, MSG_DONTWAIT, nullptr);
+    VerifyOrDie(count >= 0, OT_EXIT_ERROR_ERRNO);
 
-    if (sEnabled)
+    for (int i = 0; i < count; i++)
     {
-        otPlatTrelHandleReceived(aInstance, sRxPacketBuffer, sRxPacketLength);
+        HandleReceivedPacket(aInstance, sRxPacketBuffers[i], static_cast<uint16_t>(msgs[i].msg_len), sockAddrs[i]);
     }
 }
 
+#else // TREL_BATCH_SIZE > 1
+
+static void ReceivePackets(int aSocket, otInstance *aInstance)
+{
+    struct sockaddr_in6 sockAddr;
+    socklen_t           sockAddrLen = sizeof(sockAddr);
+    ssize_t             ret;
+
+    memset(&sockAddr, 0, sizeof(sockAddr));
+
+    ret = recvfrom(aSocket, (char *)sRxPacketBuffers[0], sizeof(sRxPacketBuffers[0]), 0, (struct sockaddr *)&sockAddr,
+                   &sockAddrLen);
+    VerifyOrDie(ret >= 0, OT_EXIT_ERROR_ERRNO);
+
+    HandleReceivedPacket(aInstance, sRxPacketBuffers[0], static_cast<uint16_t>(ret), sockAddr);
+}
+
+#endif // TREL_BATCH_SIZE > 1
+
 static void InitPacketQueue(void)
 {
     sTxPacketQueueTail = NULL;
@@ -239,37 +301,127 @@ static void InitPacketQueue(void)
     }
 }
 
+static void DequeuePacket(void)
+{
+    TxPacket *packet = sTxPacketQueueTail->mNext; // tail->mNext is the head of the list.
+
+    // Remove the `packet` from the packet queue (circular
+    // linked list).
+
+    if (packet == sTxPacketQueueTail)
+    {
+        sTxPacketQueueTail = NULL;
+    }
+    else
+    {
+        sTxPacketQueueTail->mNext = packet->mNext;
+    }
+
+    // Add the `packet` to the free packet singly linked list.
+
+    packet->mNext     = sFreeTxPacketHead;
+    sFreeTxPacketHead = packet;
+}
+
+#if TREL_BATCH_SIZE > 1
+
 static void SendQueuedPackets(void)
 {
+    struct sockaddr_in6 sockAddrs[TREL_BATCH_SIZE];
+    struct iovec        iovecs[TREL_BATCH_SIZE];
+    struct mmsghdr      msgs[TREL_BATCH_SIZE];
+
+    VerifyOrExit(sSocket >= 0);
+
     while (sTxPacketQueueTail != NULL)
     {
-        TxPacket *packet = sTxPacketQueueTail->mNext; // tail->mNext is the head of the list.
+        TxPacket *head   = sTxPacketQueueTail->mNext;
+        TxPacket *packet = head;
+        int       count  = 0;
+        int       sent;
 
-        if (SendPacket(packet->mBuffer, packet->mLength, &packet->mDestSockAddr) == OT_ERROR_INVALID_STATE)
+        memset(msgs, 0, sizeof(msgs));
+
+        do
         {
-            otLogDebgPlat("[trel] SendQueuedPackets() - SendPacket() would block");
-            break;
-        }
+            ToSockAddrIn6(packet->mDestSockAddr, sockAddrs[count]);
+            iovecs[count].iov_base = packet->mBuffer;
+            iovecs[count].iov_len  = packet->mLength;
 
-        // Remove the `packet` from the packet queue (circular
-        // linked list).
+            msgs[count].msg_hdr.msg_name    = &sockAddrs[count];
+            msgs[count].msg_hdr.msg_namelen = sizeof(sockAddrs[count]);
+            msgs[count].msg_hdr.msg_iov     = &iovecs[count];
+            msgs[count].msg_hdr.msg_iovlen  = 1;
 
-        if (packet == sTxPacketQueueTail)
+            count++;
+            packet = packet->mNext;
+        } while (count < TREL_BATCH_SIZE && packet != head);
+
+        sent = sendmmsg(sSocket, msgs, static_cast<unsigned int>(count), 0);
+
+        if (sent < 0)
         {
-            sTxPacketQueueTail = NULL;
+            // `sendmmsg()` only fails when the first packet cannot be sent. An error for a later packet is reported
+            // by the next call, with that packet at the head of the queue.
+            otError error = SendErrnoToError(errno);
+
+            otLogDebgPlat("[trel] SendQueuedPackets() -- sendmmsg() failed errno %d", errno);
+            otLogDebgPlat("[trel] SendPacket([%s]:%u) err:%s pkt:%s", Ip6AddrToString(&head->mDestSockAddr.mAddress),
+                          head->mDestSockAddr.mPort, otThreadErrorToString(error),
+                          BufferToString(head->mBuffer, head->mLength));
+
+            if (error == OT_ERROR_INVALID_STATE)
+            {
+                otLogDebgPlat("[trel] SendQueuedPackets() - SendPacket() would block");
+                break;
+            }
+
+            // The network is unreachable, drop the packet.
+            sent = 1;
         }
         else
         {
-            sTxPacketQueueTail->mNext = packet->mNext;
+            packet = head;
+
+            for (int i = 0; i < sent; i++)
+            {
+                otLogDebgPlat("[trel] SendPacket([%s]:%u) err:%s pkt:%s",
+                              Ip6AddrToString(&packet->mDestSockAddr.mAddress), packet->mDestSockAddr.mPort,
+                              otThreadErrorToString(OT_ERROR_NONE), BufferToString(packet->mBuffer, packet->mLength));
+                packet = packet->mNext;
+            }
         }
 
-        // Add the `packet` to the free packet singly linked list.
+        for (int i = 0; i < sent; i++)
+        {
+            DequeuePacket();
+        }
+    }
 
-        packet->mNext     = sFreeTxPacketHead;
-        sFreeTxPacketHead = packet;
+exit:
+    return;
+}
+
+#else // TREL_BATCH_SIZE > 1
+
+static void SendQueuedPackets(void)
+{
+    while (sTxPacketQueueTail != NULL)
+    {
+        TxPacket *packet = sTxPacketQueueTail->mNext; // tail->mNext is the head of the list.
+
+        if (SendPacket(packet->mBuffer, packet->mLength, &packet->mDestSockAddr) == OT_ERROR_INVALID_STATE)
+        {
+            otLogDebgPlat("[trel] SendQueuedPackets() - SendPacket() would block");
+            break;
+        }
+
+        DequeuePacket();
     }
 }
 
+#endif // TREL_BATCH_SIZE > 1
+
 static void EnqueuePacket(const uint8_t *aBuffer, uint16_t aLength, const otSockAddr *aDestSockAddr)
 {
     TxPacket *packet;
@@ -306,6 +458,35 @@ exit:
     return;
 }
 
+static void UpdateWatchedEvents(void)
+{
+    uint8_t events = ot::Posix::Mainloop::Watcher::kEventRead;
+
+    // The socket is almost always writable, so it is only watched for writing while packets are queued.
+    if (sTxPacketQueueTail != NULL)
+    {
+        events |= ot::Posix::Mainloop::Watcher::kEventWrite;
+    }
+
+    SuccessOrDie(ot::Posix::Mainloop::Manager::Get().SetEvents(sWatcher, events));
+}
+
+static void HandleSocketEvents(void *aContext, uint8_t aEvents)
+{
+    OT_UNUSED_VARIABLE(aContext);
+
+    if (aEvents & ot::Posix::Mainloop::Watcher::kEventWrite)
+    {
+        SendQueuedPackets();
+        UpdateWatchedEvents();
+    }
+
+    if (aEvents & ot::Posix::Mainloop::Watcher::kEventRead)
+    {
+        ReceivePackets(sSocket, sInstance);
+    }
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 // trelDnssd
 //
@@ -409,8 +590,6 @@ OT_TOOL_WEAK void trelDnssdProcess(otInstance *aInstance, const otSysMainloopCon
 
 void otPlatTrelEnable(otInstance *aInstance, uint16_t *aUdpPort)
 {
-    OT_UNUSED_VARIABLE(aInstance);
-
     VerifyOrExit(!IsSystemDryRun());
 
     assert(sInitialized);
@@ -418,9 +597,12 @@ void otPlatTrelEnable(otInstance *aInstance, uint16_t *aUdpPort)
     VerifyOrExit(!sEnabled);
 
     PrepareSocket(*aUdpPort);
+    SuccessOrDie(ot::Posix::Mainloop::Manager::Get().Watch(sWatcher, sSocket, ot::Posix::Mainloop::Watcher::kEventRead,
+                                                           ot::Posix::Mainloop::Watcher::kLevelTriggered));
     trelDnssdStartBrowse();
 
-    sEnabled = true;
+    sInstance = aInstance;
+    sEnabled  = true;
 
 exit:
     return;
@@ -435,6 +617,7 @@ void otPlatTrelDisable(otInstance *aInstance)
     assert(sInitialized);
     VerifyOrExit(sEnabled);
 
+    ot::Posix::Mainloop::Manager::Get().Unwatch(sWatcher);
     close(sSocket);
     sSocket = -1;
     trelDnssdStopBrowse();
@@ -469,6 +652,7 @@ void otPlatTrelSend(otInstance       *aInstance,
         (SendPacket(aUdpPayload, aUdpPayloadLen, aDestSockAddr) == OT_ERROR_INVALID_STATE))
     {
         EnqueuePacket(aUdpPayload, aUdpPayloadLen, aDestSockAddr);
+        UpdateWatchedEvents();
     }
 
 exit:
@@ -527,18 +711,7 @@ void platformTrelUpdateFdSet(otSysMainloopContext *aContext)
 
     VerifyOrExit(sEnabled);
 
-    FD_SET(sSocket, &aContext->mReadFdSet);
-
-    if (sTxPacketQueueTail != nullptr)
-    {
-        FD_SET(sSocket, &aContext->mWriteFdSet);
-    }
-
-    if (aContext->mMaxFd < sSocket)
-    {
-        aContext->mMaxFd = sSocket;
-    }
-
+    // The TREL socket itself is watched by the mainloop, see `HandleSocketEvents()`.
     trelDnssdUpdateFdSet(aContext);
 
 exit:
@@ -549,20 +722,283 @@ void platformTrelProcess(otInstance *aInstance, const otSysMainloopContext *aCon
 {
     VerifyOrExit(sEnabled);
 
-    if (FD_ISSET(sSocket, &aContext->mWriteFdSet))
+    trelDnssdProcess(aInstance, aContext);
+
+exit:
+    return;
+}
+
+#endif // #if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
+
+#ifndef SELF_TEST
+#define SELF_TEST 0
+#endif
+
+#if SELF_TEST && OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
+
+#include <time.h>
+
+// The socket calls used for transmission are replaced by scripted results.
+
+struct SendResult
+{
+    int mReturn; // The number of packets sent, or -1.
+    int mErrno;
+};
+
+static const SendResult *sSendResults;
+static int               sNumSendResults;
+static int               sNumSendCalls;
+static uint8_t           sSentIds[8][TREL_BATCH_SIZE]; // The first payload byte of each packet passed per call.
+static int               sNumSentIds[8];
+static unsigned int      sNumReceived;
+
+extern "C" ssize_t sendto(int, const void *, size_t, int, const struct sockaddr *, socklen_t)
+{
+    errno = EAGAIN;
+    return -1;
+}
+
+extern "C" int sendmmsg(int, struct mmsghdr *aMsgs, unsigned int aCount, int)
+{
+    assert(sNumSendCalls < sNumSendResults);
+    assert(aCount <= TREL_BATCH_SIZE);
+
+    const SendResult &result = sSendResults[sNumSendCalls];
+
+    for (unsigned int i = 0; i < aCount; i++)
     {
-        SendQueuedPackets();
+        sSentIds[sNumSendCalls][i] = static_cast<uint8_t *>(aMsgs[i].msg_hdr.msg_iov[0].iov_base)[0];
+    }
+
+    sNumSentIds[sNumSendCalls] = static_cast<int>(aCount);
+    sNumSendCalls++;
+    errno = result.mErrno;
+
+    return result.mReturn;
+}
+
+void otLogCritPlat(const char *aFormat, ...) { OT_UNUSED_VARIABLE(aFormat); }
+
+void otLogWarnPlat(const char *aFormat, ...) { OT_UNUSED_VARIABLE(aFormat); }
+
+void otLogDebgPlat(const char *aFormat, ...) { OT_UNUSED_VARIABLE(aFormat); }
+
+const char *otThreadErrorToString(otError aError)
+{
+    OT_UNUSED_VARIABLE(aError);
+    return "";
+}
+
+const char *otExitCodeToString(uint8_t aExitCode)
+{
+    OT_UNUSED_VARIABLE(aExitCode);
+    return "";
+}
+
+void otPlatTrelHandleReceived(otInstance *aInstance, uint8_t *aBuffer, uint16_t aLength)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+    OT_UNUSED_VARIABLE(aBuffer);
+    OT_UNUSED_VARIABLE(aLength);
+
+    sNumReceived++;
+}
+
+bool IsSystemDryRun(void) { return false; }
+
+int SocketWithCloseExec(int aDomain, int aType, int aProtocol, SocketBlockOption aBlockOption)
+{
+    OT_UNUSED_VARIABLE(aBlockOption);
+
+    return socket(aDomain, aType | SOCK_CLOEXEC | SOCK_NONBLOCK, aProtocol);
+}
+
+static void runMainloopOnce(void)
+{
+    otSysMainloopContext context;
+
+    FD_ZERO(&context.mReadFdSet);
+    FD_ZERO(&context.mWriteFdSet);
+    FD_ZERO(&context.mErrorFdSet);
+    context.mMaxFd           = -1;
+    context.mTimeout.tv_sec  = 0;
+    context.mTimeout.tv_usec = 0;
+
+    ot::Posix::Mainloop::Manager::Get().Update(context);
+    platformTrelUpdateFdSet(&context);
+    VerifyOrDie(select(context.mMaxFd + 1, &context.mReadFdSet, &context.mWriteFdSet, &context.mErrorFdSet,
+                       &context.mTimeout) >= 0,
+                OT_EXIT_ERROR_ERRNO);
+    ot::Posix::Mainloop::Manager::Get().Process(context);
+    platformTrelProcess(nullptr, &context);
+}
+
+#if TREL_BATCH_SIZE > 1
+static void verifySent(int aCall, const uint8_t *aIds, int aNumIds)
+{
+    assert(sNumSentIds[aCall] == aNumIds);
+    assert(memcmp(sSentIds[aCall], aIds, static_cast<size_t>(aNumIds)) == 0);
+}
+
+static void flushQueue(const SendResult *aResults, int aNumResults)
+{
+    sSendResults    = aResults;
+    sNumSendResults = aNumResults;
+    sNumSendCalls   = 0;
+
+    runMainloopOnce();
+
+    assert(sNumSendCalls == aNumResults);
+}
+
+static void testSendQueue(void)
+{
+    static_assert(TREL_BATCH_SIZE >= 4, "the test requires a batch size of at least 4");
+
+    const uint8_t kNumPackets = 5;
+    uint16_t      port        = 0;
+    otSockAddr    destSockAddr;
+
+    memset(&destSockAddr, 0, sizeof(destSockAddr));
+    destSockAddr.mPort = 1;
+
+    platformTrelInit(nullptr);
+    otPlatTrelEnable(nullptr, &port);
+
+    // `sendto()` would block, so all packets are queued.
+    for (uint8_t id = 0; id < kNumPackets; id++)
+    {
+        otPlatTrelSend(nullptr, &id, sizeof(id), &destSockAddr);
     }
 
-    if (FD_ISSET(sSocket, &aContext->mReadFdSet))
+    // verify partially sent batches, dropped and blocked packets
     {
-        ReceivePacket(sSocket, aInstance);
+        // Two packets are sent, the third one is unreachable and dropped, the fourth one would block.
+        const SendResult kResults[] = {{2, 0}, {-1, ENETUNREACH}, {-1, EAGAIN}};
+        const uint8_t    kFirst[]   = {0, 1, 2, 3, 4};
+        const uint8_t    kSecond[]  = {2, 3, 4};
+        const uint8_t    kThird[]   = {3, 4};
+
+        flushQueue(kResults, OT_ARRAY_LENGTH(kResults));
+        verifySent(0, kFirst, OT_MIN(TREL_BATCH_SIZE, 5));
+        verifySent(1, kSecond, 3);
+        verifySent(2, kThird, 2);
+        assert(sTxPacketQueueTail != nullptr);
     }
 
-    trelDnssdProcess(aInstance, aContext);
+    // verify the blocked packets are sent in order once the socket is writable
+    {
+        const SendResult kResults[] = {{2, 0}};
+        const uint8_t    kIds[]     = {3, 4};
 
-exit:
-    return;
+        flushQueue(kResults, OT_ARRAY_LENGTH(kResults));
+        verifySent(0, kIds, 2);
+        assert(sTxPacketQueueTail == nullptr);
+    }
+
+    // verify the socket is no longer watched for writing once the queue is empty
+    flushQueue(nullptr, 0);
+
+    // verify all pool entries were returned to the free list
+    {
+        uint16_t numFree = 0;
+
+        for (TxPacket *packet = sFreeTxPacketHead; packet != nullptr; packet = packet->mNext)
+        {
+            numFree++;
+        }
+
+        assert(numFree == TREL_PACKET_POOL_SIZE);
+    }
+
+    platformTrelDeinit();
 }
+#endif // TREL_BATCH_SIZE > 1
 
-#endif // #if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
+static uint64_t getNowNsec(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return static_cast<uint64_t>(now.tv_sec) * 1000000000 + static_cast<uint64_t>(now.tv_nsec);
+}
+
+/**
+ * Measures the receive cost per packet over loopback, with a given number of packets pending per mainloop iteration.
+ *
+ * Comparing the output of builds with different `OPENTHREAD_POSIX_CONFIG_TREL_BATCH_SIZE` shows whether batching pays
+ * off for a traffic pattern.
+ *
+ */
+static void benchmark(void)
+{
+    const unsigned int  kPendingPackets[] = {1, 8, 32};
+    const unsigned int  kNumPackets       = 32000;
+    const uint8_t       kPayload[100]     = {0};
+    uint16_t            port              = 0;
+    struct sockaddr_in6 sockAddr;
+    int                 sender;
+
+    platformTrelInit(nullptr);
+    otPlatTrelEnable(nullptr, &port);
+
+    memset(&sockAddr, 0, sizeof(sockAddr));
+    sockAddr.sin6_family = AF_INET6;
+    sockAddr.sin6_addr   = in6addr_loopback;
+    sockAddr.sin6_port   = htons(port);
+
+    // `sendto()` is replaced above, so the sender is connected and uses `write()`.
+    sender = socket(AF_INET6, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+    VerifyOrDie(sender >= 0, OT_EXIT_ERROR_ERRNO);
+    VerifyOrDie(connect(sender, reinterpret_cast<struct sockaddr *>(&sockAddr), sizeof(sockAddr)) == 0,
+                OT_EXIT_ERROR_ERRNO);
+
+    for (unsigned int pending : kPendingPackets)
+    {
+        unsigned int numIterations = 0;
+        uint64_t     start;
+        uint64_t     elapsed;
+
+        sNumReceived = 0;
+        start        = getNowNsec();
+
+        while (sNumReceived < kNumPackets)
+        {
+            unsigned int target = sNumReceived + pending;
+
+            for (unsigned int i = 0; i < pending; i++)
+            {
+                VerifyOrDie(write(sender, kPayload, sizeof(kPayload)) == static_cast<ssize_t>(sizeof(kPayload)),
+                            OT_EXIT_ERROR_ERRNO);
+            }
+
+            while (sNumReceived < target)
+            {
+                runMainloopOnce();
+                numIterations++;
+            }
+        }
+
+        elapsed = getNowNsec() - start;
+        assert(sNumReceived == kNumPackets);
+
+        printf("batch size %d, %u pending packets: %llu ns per packet, %u mainloop iterations\n", TREL_BATCH_SIZE,
+               pending, static_cast<unsigned long long>(elapsed / kNumPackets), numIterations);
+    }
+
+    close(sender);
+    platformTrelDeinit();
+}
+
+int main(void)
+{
+#if TREL_BATCH_SIZE > 1
+    testSendQueue();
+#endif
+    benchmark();
+
+    return 0;
+}
+#endif // SELF_TEST && OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
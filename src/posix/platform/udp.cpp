@@ -42,6 +42,7 @@
 #include <arpa/inet.h>
 #include <assert.h>
 #include <net/if.h>
+#include <new>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -65,9 +66,27 @@ namespace {
 
 constexpr size_t kMaxUdpSize = 1280;
 
-void *FdToHandle(int aFd) { return reinterpret_cast<void *>(aFd); }
+void HandleSocketEvents(void *aContext, uint8_t aEvents);
 
-int FdFromHandle(void *aHandle) { return static_cast<int>(reinterpret_cast<long>(aHandle)); }
+/**
+ * Holds a platform UDP socket, `otUdpSocket::mHandle` points to it.
+ *
+ */
+struct SocketHandle
+{
+    SocketHandle(int aFd, otUdpSocket &aSocket)
+        : mFd(aFd)
+        , mSocket(&aSocket)
+        , mWatcher(HandleSocketEvents, this)
+    {
+    }
+
+    int                          mFd;
+    otUdpSocket                 *mSocket;
+    ot::Posix::Mainloop::Watcher mWatcher;
+};
+
+int FdFromHandle(void *aHandle) { return static_cast<SocketHandle *>(aHandle)->mFd; }
 
 bool IsLinkLocal(const struct in6_addr &aAddress) { return aAddress.s6_addr[0] == 0xfe && aAddress.s6_addr[1] == 0x80; }
 
@@ -165,30 +184,48 @@ exit:
     return error;
 }
 
-otError receivePacket(int aFd, uint8_t *aPayload, uint16_t &aLength, otMessageInfo &aMessageInfo)
+/**
+ * Holds one datagram of the receive batch.
+ *
+ */
+struct RxPacket
 {
-    struct sockaddr_in6 peerAddr;
-    uint8_t             control[kMaxUdpSize];
-    struct iovec        iov;
-    struct msghdr       msg;
-    ssize_t             rval;
+    uint8_t             mPayload[kMaxUdpSize];
+    uint8_t             mControl[kMaxUdpSize];
+    struct sockaddr_in6 mPeerAddr;
+    struct iovec        mIovec;
+    uint16_t            mLength;
+    otMessageInfo       mMessageInfo;
+};
+
+constexpr int kRxBatchSize = OPENTHREAD_POSIX_CONFIG_UDP_RX_BATCH_SIZE;
+
+static_assert(kRxBatchSize >= 1, "OPENTHREAD_POSIX_CONFIG_UDP_RX_BATCH_SIZE must be at least 1");
+#if OPENTHREAD_POSIX_CONFIG_UDP_RX_BATCH_SIZE > 1 && !defined(__linux__)
+#error "OPENTHREAD_POSIX_CONFIG_UDP_RX_BATCH_SIZE > 1 requires recvmmsg()"
+#endif
 
-    iov.iov_base = aPayload;
-    iov.iov_len  = aLength;
+RxPacket sRxPackets[kRxBatchSize];
 
-    msg.msg_name       = &peerAddr;
-    msg.msg_namelen    = sizeof(peerAddr);
-    msg.msg_control    = control;
-    msg.msg_controllen = sizeof(control);
-    msg.msg_iov        = &iov;
-    msg.msg_iovlen     = 1;
-    msg.msg_flags      = 0;
+void prepareRxMessage(RxPacket &aPacket, struct msghdr &aMsg)
+{
+    aPacket.mIovec.iov_base = aPacket.mPayload;
+    aPacket.mIovec.iov_len  = sizeof(aPacket.mPayload);
+
+    aMsg.msg_name       = &aPacket.mPeerAddr;
+    aMsg.msg_namelen    = sizeof(aPacket.mPeerAddr);
+    aMsg.msg_control    = aPacket.mControl;
+    aMsg.msg_controllen = sizeof(aPacket.mControl);
+    aMsg.msg_iov        = &aPacket.mIovec;
+    aMsg.msg_iovlen     = 1;
+    aMsg.msg_flags      = 0;
+}
 
-    rval = recvmsg(aFd, &msg, 0);
-    VerifyOrExit(rval > 0, perror("recvmsg"));
-    aLength = static_cast<uint16_t>(rval);
+void parseRxMessage(struct msghdr &aMsg, RxPacket &aPacket)
+{
+    otMessageInfo &messageInfo = aPacket.mMessageInfo;
 
-    for (struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msg); cmsg != nullptr; cmsg = CMSG_NXTHDR(&msg, cmsg))
+    for (struct cmsghdr *cmsg = CMSG_FIRSTHDR(&aMsg); cmsg != nullptr; cmsg = CMSG_NXTHDR(&aMsg, cmsg))
     {
         if (cmsg->cmsg_level == IPPROTO_IPV6)
         {
@@ -197,7 +234,7 @@ otError receivePacket(int aFd, uint8_t *aPayload, uint16_t &aLength, otMessageIn
                 int hoplimit;
 
                 memcpy(&hoplimit, CMSG_DATA(cmsg), sizeof(hoplimit));
-                aMessageInfo.mHopLimit = static_cast<uint8_t>(hoplimit);
+                messageInfo.mHopLimit = static_cast<uint8_t>(hoplimit);
             }
             else if (cmsg->cmsg_type == IPV6_PKTINFO)
             {
@@ -205,50 +242,179 @@ otError receivePacket(int aFd, uint8_t *aPayload, uint16_t &aLength, otMessageIn
 
                 memcpy(&pktinfo, CMSG_DATA(cmsg), sizeof(pktinfo));
 
-                aMessageInfo.mIsHostInterface = (pktinfo.ipi6_ifindex != gNetifIndex);
-                memcpy(&aMessageInfo.mSockAddr, &pktinfo.ipi6_addr, sizeof(aMessageInfo.mSockAddr));
+                messageInfo.mIsHostInterface = (pktinfo.ipi6_ifindex != gNetifIndex);
+                memcpy(&messageInfo.mSockAddr, &pktinfo.ipi6_addr, sizeof(messageInfo.mSockAddr));
             }
         }
     }
 
-    aMessageInfo.mPeerPort = ntohs(peerAddr.sin6_port);
-    memcpy(&aMessageInfo.mPeerAddr, &peerAddr.sin6_addr, sizeof(aMessageInfo.mPeerAddr));
+    messageInfo.mPeerPort = ntohs(aPacket.mPeerAddr.sin6_port);
+    memcpy(&messageInfo.mPeerAddr, &aPacket.mPeerAddr.sin6_addr, sizeof(messageInfo.mPeerAddr));
+}
+
+/**
+ * Receives up to `kRxBatchSize` datagrams into `sRxPackets`.
+ *
+ * @returns The number of datagrams received.
+ *
+ */
+int receivePackets(int aFd, uint16_t aSockPort)
+{
+    struct msghdr *msgs[kRxBatchSize];
+    int            count = 0;
+
+#if OPENTHREAD_POSIX_CONFIG_UDP_RX_BATCH_SIZE > 1
+    struct mmsghdr mmsgs[kRxBatchSize];
+    int            rval;
+
+    for (int i = 0; i < kRxBatchSize; i++)
+    {
+        msgs[i] = &mmsgs[i].msg_hdr;
+        prepareRxMessage(sRxPackets[i], *msgs[i]);
+    }
+
+    rval = recvmmsg(aFd, mmsgs, kRxBatchSize, 0, nullptr);
+    VerifyOrExit(rval > 0, perror("recvmmsg"));
+    count = rval;
+
+    for (int i = 0; i < count; i++)
+    {
+        sRxPackets[i].mLength = static_cast<uint16_t>(mmsgs[i].msg_len);
+    }
+#else
+    struct msghdr msg;
+    ssize_t       rval;
+
+    msgs[0] = &msg;
+    prepareRxMessage(sRxPackets[0], msg);
+
+    rval = recvmsg(aFd, &msg, 0);
+    VerifyOrExit(rval > 0, perror("recvmsg"));
+    count                 = 1;
+    sRxPackets[0].mLength = static_cast<uint16_t>(rval);
+#endif
+
+    for (int i = 0; i < count; i++)
+    {
+        memset(&sRxPackets[i].mMessageInfo, 0, sizeof(sRxPackets[i].mMessageInfo));
+        sRxPackets[i].mMessageInfo.mSockPort = aSockPort;
+        parseRxMessage(*msgs[i], sRxPackets[i]);
+    }
 
 exit:
-    return rval > 0 ? OT_ERROR_NONE : OT_ERROR_FAILED;
+    return count;
+}
+
+bool isSocketOpen(const otUdpSocket *aUdpSocket, const SocketHandle *aHandle)
+{
+    bool isOpen = false;
+
+    for (otUdpSocket *socket = otUdpGetSockets(gInstance); socket != nullptr; socket = socket->mNext)
+    {
+        if (socket == aUdpSocket)
+        {
+            isOpen = (socket->mHandle == aHandle);
+            break;
+        }
+    }
+
+    return isOpen;
+}
+
+void HandleSocketEvents(void *aContext, uint8_t aEvents)
+{
+    otMessageSettings   msgSettings = {false, OT_MESSAGE_PRIORITY_NORMAL};
+    const SocketHandle *handle      = static_cast<const SocketHandle *>(aContext);
+    otUdpSocket        *socket      = handle->mSocket;
+    int                 count;
+
+    OT_UNUSED_VARIABLE(aEvents);
+
+    count = receivePackets(handle->mFd, socket->mSockName.mPort);
+
+    for (int i = 0; i < count; i++)
+    {
+        RxPacket  &packet  = sRxPackets[i];
+        otMessage *message = nullptr;
+
+        // The handler of a previous datagram may have closed the socket, which frees `handle`.
+        if (i > 0 && !isSocketOpen(socket, handle))
+        {
+            break;
+        }
+
+        if (packet.mLength == 0)
+        {
+            continue;
+        }
+
+        message = otUdpNewMessage(gInstance, &msgSettings);
+
+        if (message == nullptr)
+        {
+            continue;
+        }
+
+        if (otMessageAppend(message, packet.mPayload, packet.mLength) != OT_ERROR_NONE)
+        {
+            otMessageFree(message);
+            continue;
+        }
+
+        socket->mHandler(socket->mContext, message, &packet.mMessageInfo);
+        otMessageFree(message);
+    }
 }
 
 } // namespace
 
 otError otPlatUdpSocket(otUdpSocket *aUdpSocket)
 {
-    otError error = OT_ERROR_NONE;
-    int     fd;
+    otError       error  = OT_ERROR_NONE;
+    SocketHandle *handle = nullptr;
+    int           fd;
 
     assert(aUdpSocket->mHandle == nullptr);
 
     fd = SocketWithCloseExec(AF_INET6, SOCK_DGRAM, IPPROTO_UDP, kSocketNonBlock);
     VerifyOrExit(fd >= 0, error = OT_ERROR_FAILED);
 
-    aUdpSocket->mHandle = FdToHandle(fd);
+    handle = new (std::nothrow) SocketHandle(fd, *aUdpSocket);
+    VerifyOrExit(handle != nullptr, error = OT_ERROR_NO_BUFS);
+
+    aUdpSocket->mHandle = handle;
+    SuccessOrExit(error = ot::Posix::Udp::Get().Watch(*aUdpSocket));
 
 exit:
+    if (error != OT_ERROR_NONE)
+    {
+        aUdpSocket->mHandle = nullptr;
+        delete handle;
+
+        if (fd >= 0)
+        {
+            close(fd);
+        }
+    }
+
     return error;
 }
 
 otError otPlatUdpClose(otUdpSocket *aUdpSocket)
 {
-    otError error = OT_ERROR_NONE;
-    int     fd;
+    otError       error = OT_ERROR_NONE;
+    SocketHandle *handle;
 
     // Only call `close()` on platform UDP sockets.
     // Platform UDP sockets always have valid `mHandle` upon creation.
     VerifyOrExit(aUdpSocket->mHandle != nullptr);
 
-    fd = FdFromHandle(aUdpSocket->mHandle);
-    VerifyOrExit(0 == close(fd), error = OT_ERROR_FAILED);
+    handle = static_cast<SocketHandle *>(aUdpSocket->mHandle);
+    ot::Posix::Mainloop::Manager::Get().Unwatch(handle->mWatcher);
+    VerifyOrExit(0 == close(handle->mFd), error = OT_ERROR_FAILED);
 
     aUdpSocket->mHandle = nullptr;
+    delete handle;
 
 exit:
     return error;
@@ -534,32 +700,6 @@ exit:
 namespace ot {
 namespace Posix {
 
-void Udp::Update(otSysMainloopContext &aContext)
-{
-    VerifyOrExit(gNetifIndex != 0);
-
-    for (otUdpSocket *socket = otUdpGetSockets(gInstance); socket != nullptr; socket = socket->mNext)
-    {
-        int fd;
-
-        if (socket->mHandle == nullptr)
-        {
-            continue;
-        }
-
-        fd = FdFromHandle(socket->mHandle);
-        FD_SET(fd, &aContext.mReadFdSet);
-
-        if (aContext.mMaxFd < fd)
-        {
-            aContext.mMaxFd = fd;
-        }
-    }
-
-exit:
-    return;
-}
-
 void Udp::Init(const char *aIfName)
 {
     if (aIfName == nullptr)
@@ -579,9 +719,44 @@ void Udp::Init(const char *aIfName)
     assert(gNetifIndex != 0);
 }
 
-void Udp::SetUp(void) { Mainloop::Manager::Get().Add(*this); }
+void Udp::SetUp(void)
+{
+    mIsUp = true;
+
+    for (otUdpSocket *socket = otUdpGetSockets(gInstance); socket != nullptr; socket = socket->mNext)
+    {
+        if (socket->mHandle != nullptr)
+        {
+            SuccessOrDie(Watch(*socket));
+        }
+    }
+}
+
+void Udp::TearDown(void)
+{
+    for (otUdpSocket *socket = otUdpGetSockets(gInstance); socket != nullptr; socket = socket->mNext)
+    {
+        if (socket->mHandle != nullptr)
+        {
+            Mainloop::Manager::Get().Unwatch(static_cast<SocketHandle *>(socket->mHandle)->mWatcher);
+        }
+    }
+
+    mIsUp = false;
+}
 
-void Udp::TearDown(void) { Mainloop::Manager::Get().Remove(*this); }
+otError Udp::Watch(otUdpSocket &aSocket)
+{
+    otError       error  = OT_ERROR_NONE;
+    SocketHandle *handle = static_cast<SocketHandle *>(aSocket.mHandle);
+
+    VerifyOrExit(mIsUp);
+    error = Mainloop::Manager::Get().Watch(handle->mWatcher, handle->mFd, Mainloop::Watcher::kEventRead,
+                                           Mainloop::Watcher::kLevelTriggered);
+
+exit:
+    return error;
+}
 
 void Udp::Deinit(void)
 {
@@ -595,52 +770,204 @@ Udp &Udp::Get(void)
     return sInstance;
 }
 
-void Udp::Process(const otSysMainloopContext &aContext)
+} // namespace Posix
+} // namespace ot
+#endif // #if OPENTHREAD_CONFIG_PLATFORM_UDP_ENABLE
+
+#ifndef SELF_TEST
+#define SELF_TEST 0
+#endif
+
+#if SELF_TEST && OPENTHREAD_CONFIG_PLATFORM_UDP_ENABLE
+
+char         gNetifName[IFNAMSIZ];
+unsigned int gNetifIndex         = 1;
+unsigned int gBackboneNetifIndex = 0;
+otInstance  *gInstance           = nullptr;
+
+static otUdpSocket *sSockets;
+static uint8_t      sMessage;
+static int          sNumReceived;
+static bool         sCloseOnReceive;
+
+void otLogCritPlat(const char *aFormat, ...) { OT_UNUSED_VARIABLE(aFormat); }
+
+void otLogWarnPlat(const char *aFormat, ...) { OT_UNUSED_VARIABLE(aFormat); }
+
+const char *otExitCodeToString(uint8_t aExitCode)
 {
-    otMessageSettings msgSettings = {false, OT_MESSAGE_PRIORITY_NORMAL};
+    OT_UNUSED_VARIABLE(aExitCode);
+    return "";
+}
 
-    for (otUdpSocket *socket = otUdpGetSockets(gInstance); socket != nullptr; socket = socket->mNext)
-    {
-        int fd = FdFromHandle(socket->mHandle);
+otUdpSocket *otUdpGetSockets(otInstance *aInstance)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+    return sSockets;
+}
 
-        if (fd > 0 && FD_ISSET(fd, &aContext.mReadFdSet))
-        {
-            otMessageInfo messageInfo;
-            otMessage    *message = nullptr;
-            uint8_t       payload[kMaxUdpSize];
-            uint16_t      length = sizeof(payload);
+otMessage *otUdpNewMessage(otInstance *aInstance, const otMessageSettings *aSettings)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+    OT_UNUSED_VARIABLE(aSettings);
+    return reinterpret_cast<otMessage *>(&sMessage);
+}
 
-            memset(&messageInfo, 0, sizeof(messageInfo));
-            messageInfo.mSockPort = socket->mSockName.mPort;
+otError otMessageAppend(otMessage *aMessage, const void *aBuf, uint16_t aLength)
+{
+    OT_UNUSED_VARIABLE(aMessage);
+    OT_UNUSED_VARIABLE(aBuf);
+    OT_UNUSED_VARIABLE(aLength);
+    return OT_ERROR_NONE;
+}
 
-            if (OT_ERROR_NONE != receivePacket(fd, payload, length, messageInfo))
-            {
-                continue;
-            }
+void otMessageFree(otMessage *aMessage) { OT_UNUSED_VARIABLE(aMessage); }
 
-            message = otUdpNewMessage(gInstance, &msgSettings);
+uint16_t otMessageGetLength(const otMessage *aMessage)
+{
+    OT_UNUSED_VARIABLE(aMessage);
+    return 0;
+}
 
-            if (message == nullptr)
-            {
-                continue;
-            }
+uint16_t otMessageRead(const otMessage *aMessage, uint16_t aOffset, void *aBuf, uint16_t aLength)
+{
+    OT_UNUSED_VARIABLE(aMessage);
+    OT_UNUSED_VARIABLE(aOffset);
+    OT_UNUSED_VARIABLE(aBuf);
+    OT_UNUSED_VARIABLE(aLength);
+    return 0;
+}
 
-            if (otMessageAppend(message, payload, length) != OT_ERROR_NONE)
-            {
-                otMessageFree(message);
-                continue;
-            }
+int SocketWithCloseExec(int aDomain, int aType, int aProtocol, SocketBlockOption aBlockOption)
+{
+    OT_UNUSED_VARIABLE(aBlockOption);
 
-            socket->mHandler(socket->mContext, message, &messageInfo);
-            otMessageFree(message);
-            // only process one socket a time
-            break;
-        }
+    return socket(aDomain, aType | SOCK_CLOEXEC | SOCK_NONBLOCK, aProtocol);
+}
+
+static void handleReceive(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo)
+{
+    OT_UNUSED_VARIABLE(aMessage);
+    OT_UNUSED_VARIABLE(aMessageInfo);
+
+    sNumReceived++;
+
+    if (sCloseOnReceive)
+    {
+        assert(otPlatUdpClose(static_cast<otUdpSocket *>(aContext)) == OT_ERROR_NONE);
     }
+}
+
+static void runMainloopOnce(void)
+{
+    otSysMainloopContext context;
+
+    FD_ZERO(&context.mReadFdSet);
+    FD_ZERO(&context.mWriteFdSet);
+    FD_ZERO(&context.mErrorFdSet);
+    context.mMaxFd           = -1;
+    context.mTimeout.tv_sec  = 0;
+    context.mTimeout.tv_usec = 0;
+
+    ot::Posix::Mainloop::Manager::Get().Update(context);
+    VerifyOrDie(select(context.mMaxFd + 1, &context.mReadFdSet, &context.mWriteFdSet, &context.mErrorFdSet,
+                       &context.mTimeout) >= 0,
+                OT_EXIT_ERROR_ERRNO);
+    ot::Posix::Mainloop::Manager::Get().Process(context);
+}
 
-    return;
+static void openSocket(otUdpSocket &aSocket, struct sockaddr_in6 &aSockAddr)
+{
+    socklen_t sockAddrLen = sizeof(aSockAddr);
+
+    memset(&aSocket, 0, sizeof(aSocket));
+    aSocket.mHandler = handleReceive;
+    aSocket.mContext = &aSocket;
+    assert(otPlatUdpSocket(&aSocket) == OT_ERROR_NONE);
+    sSockets = &aSocket;
+
+    memset(&aSockAddr, 0, sizeof(aSockAddr));
+    aSockAddr.sin6_family = AF_INET6;
+    aSockAddr.sin6_addr   = in6addr_loopback;
+    assert(bind(FdFromHandle(aSocket.mHandle), reinterpret_cast<struct sockaddr *>(&aSockAddr), sizeof(aSockAddr)) ==
+           0);
+    assert(getsockname(FdFromHandle(aSocket.mHandle), reinterpret_cast<struct sockaddr *>(&aSockAddr),
+                       &sockAddrLen) == 0);
 }
 
-} // namespace Posix
-} // namespace ot
-#endif // #if OPENTHREAD_CONFIG_PLATFORM_UDP_ENABLE
+static void sendDatagrams(const struct sockaddr_in6 &aSockAddr, int aNumDatagrams)
+{
+    int sender = socket(AF_INET6, SOCK_DGRAM, 0);
+
+    assert(sender >= 0);
+
+    for (int i = 0; i < aNumDatagrams; i++)
+    {
+        assert(sendto(sender, &i, sizeof(i), 0, reinterpret_cast<const struct sockaddr *>(&aSockAddr),
+                      sizeof(aSockAddr)) == sizeof(i));
+    }
+
+    close(sender);
+}
+
+static void closeSocket(otUdpSocket &aSocket)
+{
+    otPlatUdpClose(&aSocket);
+    sSockets = nullptr;
+}
+
+static void receiveDatagrams(otUdpSocket &aSocket, bool aCloseOnReceive, int aNumDatagrams)
+{
+    struct sockaddr_in6 sockAddr;
+
+    openSocket(aSocket, sockAddr);
+    sendDatagrams(sockAddr, aNumDatagrams);
+
+    sNumReceived    = 0;
+    sCloseOnReceive = aCloseOnReceive;
+    runMainloopOnce();
+
+    closeSocket(aSocket);
+}
+
+int main(void)
+{
+    static_assert(kRxBatchSize >= 3, "the test requires a batch size of at least 3");
+
+    otUdpSocket         socket;
+    struct sockaddr_in6 sockAddr;
+
+    ot::Posix::Udp::Get().SetUp();
+
+    // verify a batch of datagrams is delivered with a single mainloop iteration
+    receiveDatagrams(socket, /* aCloseOnReceive */ false, 3);
+    assert(sNumReceived == 3);
+
+    // verify delivery stops once the handler closes the socket
+    receiveDatagrams(socket, /* aCloseOnReceive */ true, 3);
+    assert(sNumReceived == 1);
+    assert(socket.mHandle == nullptr);
+
+    // verify sockets are only watched while the driver is set up
+    ot::Posix::Udp::Get().TearDown();
+    openSocket(socket, sockAddr);
+    sendDatagrams(sockAddr, 1);
+    sNumReceived    = 0;
+    sCloseOnReceive = false;
+    runMainloopOnce();
+    assert(sNumReceived == 0);
+
+    ot::Posix::Udp::Get().SetUp();
+    runMainloopOnce();
+    assert(sNumReceived == 1);
+
+    closeSocket(socket);
+    sendDatagrams(sockAddr, 1);
+    runMainloopOnce();
+    assert(sNumReceived == 1);
+
+    ot::Posix::Udp::Get().TearDown();
+
+    return 0;
+}
+#endif // SELF_TEST && OPENTHREAD_CONFIG_PLATFORM_UDP_ENABLE
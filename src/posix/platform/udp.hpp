@@ -28,23 +28,27 @@
 #ifndef OT_POSIX_PLATFORM_UDP_HPP_
 #define OT_POSIX_PLATFORM_UDP_HPP_
 
+#include <openthread/udp.h>
+
 #include "core/common/non_copyable.hpp"
 #include "posix/platform/mainloop.hpp"
 
 namespace ot {
 namespace Posix {
 
-class Udp : public Mainloop::Source, private NonCopyable
+class Udp : private NonCopyable
 {
 public:
     static Udp &Get(void);
 
-    void Init(const char *aIfName);
-    void SetUp(void);
-    void TearDown(void);
-    void Deinit(void);
-    void Update(otSysMainloopContext &aContext) override;
-    void Process(const otSysMainloopContext &aContext) override;
+    void    Init(const char *aIfName);
+    void    SetUp(void);
+    void    TearDown(void);
+    void    Deinit(void);
+    otError Watch(otUdpSocket &aSocket);
+
+private:
+    bool mIsUp = false;
 };
 
 } // namespace Posix
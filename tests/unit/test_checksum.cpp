@@ -464,18 +464,233 @@ public:
         VerifyOrQuit(checksum.GetValue() == kTestVectorChecksum);
         VerifyOrQuit(checksum.GetValue() == CalculateChecksum(kTestVector, sizeof(kTestVector)), );
     }
+
+    static void AddDataBytewise(Checksum &aChecksum, const uint8_t *aBuffer, uint16_t aLength)
+    {
+        for (uint16_t i = 0; i < aLength; i++)
+        {
+            aChecksum.AddUint8(aBuffer[i]);
+        }
+    }
+
+    static void TestAddDataEquivalence(void)
+    {
+        // Verify that `AddData()` matches the byte-wise one's
+        // complement sum for every length up to `kMaxLength`, at
+        // every buffer alignment and starting at both even and odd
+        // checksum byte index, using random, all-zero and all-ones
+        // data (the latter exercises the carry handling).
+
+        static constexpr uint16_t kMaxLength       = 1500;
+        static constexpr uint8_t  kMaxAlignment    = 16;
+        static constexpr uint8_t  kNumDataKinds    = 3;
+        static constexpr uint8_t  kFirstByte       = 0xa5;
+        static constexpr uint16_t kNumStartIndexes = 2;
+
+        Instance *instance = static_cast<Instance *>(testInitInstance());
+        uint8_t   buffer[kMaxLength + kMaxAlignment];
+
+        printf("TestAddDataEquivalence\n");
+
+        VerifyOrQuit(instance != nullptr);
+
+        for (uint8_t kind = 0; kind < kNumDataKinds; kind++)
+        {
+            switch (kind)
+            {
+            case 0:
+                Random::NonCrypto::FillBuffer(buffer, sizeof(buffer));
+                break;
+            case 1:
+                memset(buffer, 0, sizeof(buffer));
+                break;
+            default:
+                memset(buffer, 0xff, sizeof(buffer));
+                break;
+            }
+
+            for (uint8_t alignment = 0; alignment < kMaxAlignment; alignment++)
+            {
+                for (uint16_t length = 0; length <= kMaxLength; length++)
+                {
+                    for (uint16_t startIndex = 0; startIndex < kNumStartIndexes; startIndex++)
+                    {
+                        Checksum checksum;
+                        Checksum expected;
+
+                        // A one-byte prefix makes `AddData()` start at
+                        // an odd checksum byte index.
+
+                        if (startIndex > 0)
+                        {
+                            checksum.AddUint8(kFirstByte);
+                            expected.AddUint8(kFirstByte);
+                        }
+
+                        checksum.AddData(&buffer[alignment], length);
+                        AddDataBytewise(expected, &buffer[alignment], length);
+
+                        VerifyOrQuit(checksum.GetValue() == expected.GetValue());
+                        VerifyOrQuit(checksum.mAtOddIndex == expected.mAtOddIndex);
+                    }
+                }
+            }
+        }
+
+        testFreeInstance(instance);
+    }
+
+    static void TestAddDataSplit(void)
+    {
+        // Verify that splitting the data at any position (as done
+        // at `Message` buffer boundaries) gives the same checksum.
+
+        static constexpr uint16_t kLength = 300;
+
+        Instance *instance = static_cast<Instance *>(testInitInstance());
+        uint8_t   buffer[kLength];
+        Checksum  expected;
+
+        printf("TestAddDataSplit\n");
+
+        VerifyOrQuit(instance != nullptr);
+
+        Random::NonCrypto::FillBuffer(buffer, sizeof(buffer));
+        AddDataBytewise(expected, buffer, kLength);
+
+        for (uint16_t first = 0; first <= kLength; first++)
+        {
+            for (uint16_t second = first; second <= kLength; second++)
+            {
+                Checksum checksum;
+
+                checksum.AddData(&buffer[0], first);
+                checksum.AddData(&buffer[first], second - first);
+                checksum.AddData(&buffer[second], kLength - second);
+
+                VerifyOrQuit(checksum.GetValue() == expected.GetValue());
+            }
+        }
+
+        testFreeInstance(instance);
+    }
+
+    static void TestAddDataPerformance(void)
+    {
+        static constexpr uint16_t kLength        = 1280;
+        static constexpr uint32_t kNumIterations = 20000;
+
+        Instance *instance = static_cast<Instance *>(testInitInstance());
+        uint8_t   buffer[kLength];
+        Checksum  checksum;
+        Checksum  expected;
+        uint64_t  startTime;
+        uint64_t  wordDuration;
+        uint64_t  byteDuration;
+
+        VerifyOrQuit(instance != nullptr);
+
+        Random::NonCrypto::FillBuffer(buffer, sizeof(buffer));
+
+        startTime = GetMonotonicNsec();
+
+        for (uint32_t iter = 0; iter < kNumIterations; iter++)
+        {
+            checksum.AddData(buffer, kLength);
+        }
+
+        wordDuration = GetMonotonicNsec() - startTime;
+
+        startTime = GetMonotonicNsec();
+
+        for (uint32_t iter = 0; iter < kNumIterations; iter++)
+        {
+            AddDataBytewise(expected, buffer, kLength);
+        }
+
+        byteDuration = GetMonotonicNsec() - startTime;
+
+        VerifyOrQuit(checksum.GetValue() == expected.GetValue());
+
+        printf("TestAddDataPerformance: %u-byte buffer (%s)\n", kLength,
+               OPENTHREAD_CONFIG_IP6_CHECKSUM_SIMD_ENABLE ? "SIMD enabled" : "SIMD disabled");
+        printf("  AddData() %llu ns, byte-wise %llu ns (%llu MB/s vs %llu MB/s)\n",
+               static_cast<unsigned long long>(wordDuration / kNumIterations),
+               static_cast<unsigned long long>(byteDuration / kNumIterations),
+               static_cast<unsigned long long>(1000ull * kLength * kNumIterations / Max<uint64_t>(wordDuration, 1)),
+               static_cast<unsigned long long>(1000ull * kLength * kNumIterations / Max<uint64_t>(byteDuration, 1)));
+
+        testFreeInstance(instance);
+    }
 };
 
+void TestMessageChecksumChunkBoundaries(void)
+{
+    // Verify the checksum over messages whose payload starts at
+    // every (odd and even) position relative to the message buffer
+    // boundaries, by varying the reserved header size.
+
+    constexpr uint16_t kMaxReserved = 64;
+    constexpr uint16_t kPayloadSize = kBufferSize * 2 + 13;
+
+    const char *kSourceAddress = "fd00:1122:3344:5566:7788:99aa:bbcc:ddee";
+    const char *kDestAddress   = "fd01:2345:6789:abcd:ef01:2345:6789:abcd";
+
+    Instance        *instance = static_cast<Instance *>(testInitInstance());
+    Ip6::MessageInfo messageInfo;
+    uint8_t          payload[kPayloadSize];
+
+    printf("TestMessageChecksumChunkBoundaries\n");
+
+    VerifyOrQuit(instance != nullptr);
+
+    SuccessOrQuit(messageInfo.GetSockAddr().FromString(kSourceAddress));
+    SuccessOrQuit(messageInfo.GetPeerAddr().FromString(kDestAddress));
+
+    for (uint16_t reserved = 0; reserved <= kMaxReserved; reserved++)
+    {
+        for (uint16_t size = sizeof(Ip6::Udp::Header); size <= kPayloadSize; size += 7)
+        {
+            Message *message = instance->Get<MessagePool>().Allocate(Message::kTypeIp6, reserved);
+
+            VerifyOrQuit(message != nullptr);
+
+            Random::NonCrypto::FillBuffer(payload, size);
+            SuccessOrQuit(message->AppendBytes(payload, size));
+
+            Checksum::UpdateMessageChecksum(*message, messageInfo.GetSockAddr(), messageInfo.GetPeerAddr(),
+                                            Ip6::kProtoUdp);
+
+            VerifyOrQuit(CalculateChecksum(messageInfo.GetSockAddr(), messageInfo.GetPeerAddr(), Ip6::kProtoUdp,
+                                           *message) == 0xffff);
+            SuccessOrQuit(Checksum::VerifyMessageChecksum(*message, messageInfo, Ip6::kProtoUdp));
+
+            message->Free();
+        }
+    }
+
+    testFreeInstance(instance);
+}
+
 } // namespace ot
 
 int main(void)
 {
     ot::ChecksumTester::TestExampleVector();
+    ot::ChecksumTester::TestAddDataEquivalence();
+    ot::ChecksumTester::TestAddDataSplit();
+    ot::TestMessageChecksumChunkBoundaries();
     ot::TestUdpMessageChecksum();
     ot::TestIcmp6MessageChecksum();
     ot::TestTcp4MessageChecksum();
     ot::TestUdp4MessageChecksum();
     ot::TestIcmp4MessageChecksum();
+
+    if (IsBenchmarkEnabled())
+    {
+        ot::ChecksumTester::TestAddDataPerformance();
+    }
+
     printf("All tests passed\n");
     return 0;
 }
@@ -30,7 +30,7 @@
 
 #include <openthread/config.h>
 
-#include "test_util.h"
+#include "test_util.hpp"
 #include "common/array.hpp"
 #include "common/code_utils.hpp"
 #include "common/instance.hpp"
@@ -393,11 +393,294 @@ void TestChildTable(void)
     testFreeInstance(sInstance);
 }
 
+static uint16_t ChildRloc16(uint16_t aIndex) { return 0x8000 + aIndex + 1; }
+
+static Mac::ExtAddress ChildExtAddress(uint16_t aIndex)
+{
+    Mac::ExtAddress extAddress;
+
+    extAddress.Clear();
+    extAddress.m8[0] = 0x12;
+    extAddress.m8[6] = static_cast<uint8_t>(aIndex >> 8);
+    extAddress.m8[7] = static_cast<uint8_t>(aIndex & 0xff);
+
+    return extAddress;
+}
+
+static Ip6::Address ChildIp6Address(uint16_t aIndex)
+{
+    Ip6::Address address;
+
+    SuccessOrQuit(address.FromString("2001:db8::"));
+    address.mFields.m16[7] = HostSwap16(aIndex + 1);
+
+    return address;
+}
+
+// Adds `kMaxChildren` valid children, each with one registered IPv6
+// address. Children with an even index are sleepy.
+static void AddAllChildren(ChildTable &aTable)
+{
+    aTable.Clear();
+
+    for (uint16_t i = 0; i < kMaxChildren; i++)
+    {
+        Child *child = aTable.GetNewChild();
+
+        VerifyOrQuit(child != nullptr, "GetNewChild() failed");
+
+        child->SetDeviceMode(Mle::DeviceMode((i % 2) ? Mle::DeviceMode::kModeRxOnWhenIdle : 0));
+        child->SetRloc16(ChildRloc16(i));
+        child->SetExtAddress(ChildExtAddress(i));
+        SuccessOrQuit(child->AddIp6Address(ChildIp6Address(i)));
+        child->SetState(Child::kStateValid);
+    }
+}
+
+void TestChildTableIndexes(void)
+{
+    ChildTable *table;
+    Child      *child;
+
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != nullptr);
+
+    table = &sInstance->Get<ChildTable>();
+
+    printf("Test ChildTable lookup indexes");
+
+    AddAllChildren(*table);
+
+    for (uint16_t i = 0; i < kMaxChildren; i++)
+    {
+        child = table->GetChildAtIndex(i);
+
+        VerifyOrQuit(table->FindChild(ChildRloc16(i), Child::kInStateValid) == child);
+        VerifyOrQuit(table->FindChild(ChildExtAddress(i), Child::kInStateValid) == child);
+        VerifyOrQuit(table->FindChild(ChildIp6Address(i), Child::kInStateValid) == child);
+        VerifyOrQuit(table->FindChild(ChildIp6Address(i), Child::kInStateAny) == child);
+        VerifyOrQuit(table->HasSleepyChildWithAddress(ChildIp6Address(i)) == ((i % 2) == 0));
+    }
+
+    VerifyOrQuit(table->FindChild(ChildRloc16(kMaxChildren), Child::kInStateValid) == nullptr);
+    VerifyOrQuit(table->FindChild(ChildExtAddress(kMaxChildren), Child::kInStateValid) == nullptr);
+    VerifyOrQuit(table->FindChild(ChildIp6Address(kMaxChildren), Child::kInStateValid) == nullptr);
+    VerifyOrQuit(table->FindChild(ChildRloc16(0), Child::kInStateChildIdRequest) == nullptr);
+
+    // Change the RLOC16, extended address and IPv6 address of a child
+    // and verify that the indexes are updated.
+
+    child = table->GetChildAtIndex(0);
+
+    child->SetRloc16(ChildRloc16(kMaxChildren));
+    VerifyOrQuit(table->FindChild(ChildRloc16(0), Child::kInStateValid) == nullptr);
+    VerifyOrQuit(table->FindChild(ChildRloc16(kMaxChildren), Child::kInStateValid) == child);
+
+    child->SetExtAddress(ChildExtAddress(kMaxChildren));
+    VerifyOrQuit(table->FindChild(ChildExtAddress(0), Child::kInStateValid) == nullptr);
+    VerifyOrQuit(table->FindChild(ChildExtAddress(kMaxChildren), Child::kInStateValid) == child);
+
+    SuccessOrQuit(child->AddIp6Address(ChildIp6Address(kMaxChildren)));
+    VerifyOrQuit(table->FindChild(ChildIp6Address(0), Child::kInStateValid) == child);
+    VerifyOrQuit(table->FindChild(ChildIp6Address(kMaxChildren), Child::kInStateValid) == child);
+
+    SuccessOrQuit(child->RemoveIp6Address(ChildIp6Address(0)));
+    VerifyOrQuit(table->FindChild(ChildIp6Address(0), Child::kInStateValid) == nullptr);
+    VerifyOrQuit(table->FindChild(ChildIp6Address(kMaxChildren), Child::kInStateValid) == child);
+    VerifyOrQuit(table->HasSleepyChildWithAddress(ChildIp6Address(kMaxChildren)));
+
+    child->ClearIp6Addresses();
+    VerifyOrQuit(table->FindChild(ChildIp6Address(kMaxChildren), Child::kInStateValid) == nullptr);
+    VerifyOrQuit(!table->HasSleepyChildWithAddress(ChildIp6Address(kMaxChildren)));
+
+    // Verify that a child in `kStateInvalid` is only found using a
+    // filter which accepts the invalid state.
+
+    child->SetState(Child::kStateInvalid);
+    VerifyOrQuit(table->FindChild(ChildRloc16(kMaxChildren), Child::kInStateAnyExceptInvalid) == nullptr);
+    VerifyOrQuit(table->FindChild(ChildExtAddress(kMaxChildren), Child::kInStateAnyExceptInvalid) == nullptr);
+    VerifyOrQuit(table->FindChild(ChildRloc16(kMaxChildren), Child::kInStateAny) == child);
+    VerifyOrQuit(table->FindChild(ChildExtAddress(kMaxChildren), Child::kInStateInvalid) == child);
+
+    child->SetState(Child::kStateValid);
+    VerifyOrQuit(table->FindChild(ChildRloc16(kMaxChildren), Child::kInStateValid) == child);
+    VerifyOrQuit(table->FindChild(ChildExtAddress(kMaxChildren), Child::kInStateValid) == child);
+
+    // Verify that `Child::Clear()` and `ChildTable::Clear()` remove the
+    // entries from the indexes.
+
+    child->Clear();
+    VerifyOrQuit(table->FindChild(ChildRloc16(kMaxChildren), Child::kInStateAnyExceptInvalid) == nullptr);
+    VerifyOrQuit(table->FindChild(ChildExtAddress(kMaxChildren), Child::kInStateAnyExceptInvalid) == nullptr);
+
+    table->Clear();
+
+    for (uint16_t i = 0; i < kMaxChildren; i++)
+    {
+        VerifyOrQuit(table->FindChild(ChildRloc16(i), Child::kInStateAnyExceptInvalid) == nullptr);
+        VerifyOrQuit(table->FindChild(ChildExtAddress(i), Child::kInStateAnyExceptInvalid) == nullptr);
+    }
+
+    VerifyOrQuit(table->FindChild(ChildIp6Address(1), Child::kInStateAnyExceptInvalid) == nullptr);
+
+    printf(" -- PASS\n");
+
+    testFreeInstance(sInstance);
+}
+
+void TestChildTableLookupPerformance(void)
+{
+    // Compares the indexed lookups of `ChildTable` with a linear scan
+    // of the table (which the lookups used before) on a full table.
+
+    static constexpr uint16_t kNumRounds = 200;
+
+    ChildTable *table;
+    uint64_t    startTime;
+    uint64_t    indexedTime[3];
+    uint64_t    linearTime[3];
+    uint32_t    numLookups = 0;
+    uint32_t    numFound   = 0;
+
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != nullptr);
+
+    table = &sInstance->Get<ChildTable>();
+    AddAllChildren(*table);
+
+    printf("\nTest ChildTable lookup performance with %u children\n", kMaxChildren);
+
+    // Each round looks up all children and the same number of
+    // non-existing ones (`i + kMaxChildren`).
+
+    startTime = GetMonotonicNsec();
+
+    for (uint16_t round = 0; round < kNumRounds; round++)
+    {
+        for (uint16_t i = 0; i < 2 * kMaxChildren; i++)
+        {
+            numFound += (table->FindChild(ChildRloc16(i), Child::kInStateValidOrRestoring) != nullptr);
+        }
+    }
+
+    indexedTime[0] = GetMonotonicNsec() - startTime;
+    startTime      = GetMonotonicNsec();
+
+    for (uint16_t round = 0; round < kNumRounds; round++)
+    {
+        for (uint16_t i = 0; i < 2 * kMaxChildren; i++)
+        {
+            numFound += (table->FindChild(ChildExtAddress(i), Child::kInStateValidOrRestoring) != nullptr);
+        }
+    }
+
+    indexedTime[1] = GetMonotonicNsec() - startTime;
+    startTime      = GetMonotonicNsec();
+
+    for (uint16_t round = 0; round < kNumRounds; round++)
+    {
+        for (uint16_t i = 0; i < 2 * kMaxChildren; i++)
+        {
+            numFound += table->HasSleepyChildWithAddress(ChildIp6Address(i));
+        }
+    }
+
+    indexedTime[2] = GetMonotonicNsec() - startTime;
+
+    VerifyOrQuit(numFound == kNumRounds * (2 * kMaxChildren + kMaxChildren / 2));
+    numFound = 0;
+
+    startTime = GetMonotonicNsec();
+
+    for (uint16_t round = 0; round < kNumRounds; round++)
+    {
+        for (uint16_t i = 0; i < 2 * kMaxChildren; i++)
+        {
+            Child::AddressMatcher matcher(ChildRloc16(i), Child::kInStateValidOrRestoring);
+
+            for (Child &child : table->Iterate(Child::kInStateAny))
+            {
+                if (child.Matches(matcher))
+                {
+                    numFound++;
+                    break;
+                }
+            }
+        }
+    }
+
+    linearTime[0] = GetMonotonicNsec() - startTime;
+    startTime     = GetMonotonicNsec();
+
+    for (uint16_t round = 0; round < kNumRounds; round++)
+    {
+        for (uint16_t i = 0; i < 2 * kMaxChildren; i++)
+        {
+            Mac::ExtAddress       extAddress = ChildExtAddress(i);
+            Child::AddressMatcher matcher(extAddress, Child::kInStateValidOrRestoring);
+
+            for (Child &child : table->Iterate(Child::kInStateAny))
+            {
+                if (child.Matches(matcher))
+                {
+                    numFound++;
+                    break;
+                }
+            }
+        }
+    }
+
+    linearTime[1] = GetMonotonicNsec() - startTime;
+    startTime     = GetMonotonicNsec();
+
+    for (uint16_t round = 0; round < kNumRounds; round++)
+    {
+        for (uint16_t i = 0; i < 2 * kMaxChildren; i++)
+        {
+            Ip6::Address address = ChildIp6Address(i);
+
+            for (Child &child : table->Iterate(Child::kInStateValidOrRestoring))
+            {
+                if (!child.IsRxOnWhenIdle() && child.HasIp6Address(address))
+                {
+                    numFound++;
+                    break;
+                }
+            }
+        }
+    }
+
+    linearTime[2] = GetMonotonicNsec() - startTime;
+
+    VerifyOrQuit(numFound == kNumRounds * (2 * kMaxChildren + kMaxChildren / 2));
+
+    numLookups = static_cast<uint32_t>(kNumRounds) * 2 * kMaxChildren;
+
+    printf("  FindChild(rloc16)           indexed %6llu ns/lookup, linear %6llu ns/lookup\n",
+           static_cast<unsigned long long>(indexedTime[0] / numLookups),
+           static_cast<unsigned long long>(linearTime[0] / numLookups));
+    printf("  FindChild(ExtAddress)       indexed %6llu ns/lookup, linear %6llu ns/lookup\n",
+           static_cast<unsigned long long>(indexedTime[1] / numLookups),
+           static_cast<unsigned long long>(linearTime[1] / numLookups));
+    printf("  HasSleepyChildWithAddress() indexed %6llu ns/lookup, linear %6llu ns/lookup\n",
+           static_cast<unsigned long long>(indexedTime[2] / numLookups),
+           static_cast<unsigned long long>(linearTime[2] / numLookups));
+
+    testFreeInstance(sInstance);
+}
+
 } // namespace ot
 
 int main(void)
 {
     ot::TestChildTable();
+    ot::TestChildTableIndexes();
+
+    if (IsBenchmarkEnabled())
+    {
+        ot::TestChildTableLookupPerformance();
+    }
+
     printf("\nAll tests passed.\n");
     return 0;
 }
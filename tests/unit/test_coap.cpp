@@ -0,0 +1,602 @@
+/*
+ *  Copyright (c) 2023, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "coap/coap.hpp"
+#include "common/instance.hpp"
+#include "common/message.hpp"
+#include "common/random.hpp"
+
+#include "test_platform.h"
+#include "test_util.hpp"
+
+namespace ot {
+
+static constexpr uint16_t kPeerPort = 5683;
+
+static Instance *sInstance;
+
+// Request context passed to the response handler.
+struct Transaction
+{
+    uint16_t mMessageId;
+    uint8_t  mToken[Coap::Message::kMaxTokenLength];
+    uint8_t  mTokenLength;
+    bool     mDone;
+    Error    mResult;
+};
+
+static void HandleResponse(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo, Error aResult)
+{
+    Transaction *transaction = static_cast<Transaction *>(aContext);
+
+    OT_UNUSED_VARIABLE(aMessage);
+    OT_UNUSED_VARIABLE(aMessageInfo);
+
+    VerifyOrQuit(!transaction->mDone, "response handler called twice for the same request");
+    transaction->mDone   = true;
+    transaction->mResult = aResult;
+}
+
+// CoAP agent which records the sent messages (instead of sending them
+// over UDP) and allows received messages to be fed directly.
+class TestCoap : public Coap::CoapBase
+{
+public:
+    explicit TestCoap(Instance &aInstance)
+        : CoapBase(aInstance, &TestCoap::HandleSend)
+        , mNumSent(0)
+        , mLastMessageId(0)
+        , mLastTokenLength(0)
+        , mLastType(0)
+    {
+    }
+
+    using CoapBase::Receive;
+
+    uint32_t mNumSent;
+    uint16_t mLastMessageId;
+    uint8_t  mLastToken[Coap::Message::kMaxTokenLength];
+    uint8_t  mLastTokenLength;
+    uint8_t  mLastType;
+
+private:
+    static Error HandleSend(CoapBase &aCoapBase, ot::Message &aMessage, const Ip6::MessageInfo &aMessageInfo)
+    {
+        TestCoap            &coap    = static_cast<TestCoap &>(aCoapBase);
+        const Coap::Message &message = AsCoapMessage(&aMessage);
+
+        OT_UNUSED_VARIABLE(aMessageInfo);
+
+        coap.mNumSent++;
+        coap.mLastMessageId   = message.GetMessageId();
+        coap.mLastTokenLength = message.GetTokenLength();
+        coap.mLastType        = message.GetType();
+        memcpy(coap.mLastToken, message.GetToken(), message.GetTokenLength());
+
+        aMessage.Free();
+
+        return kErrorNone;
+    }
+};
+
+static void PrepareMessageInfo(Ip6::MessageInfo &aMessageInfo, const Ip6::Address &aPeer, uint16_t aPort = kPeerPort)
+{
+    aMessageInfo.Clear();
+    aMessageInfo.SetPeerAddr(aPeer);
+    aMessageInfo.SetPeerPort(aPort);
+}
+
+static void SendRequest(TestCoap           &aCoap,
+                        Coap::Type          aType,
+                        const Ip6::Address &aPeer,
+                        Transaction        &aTransaction)
+{
+    Coap::Message   *message = aCoap.NewMessage();
+    Ip6::MessageInfo messageInfo;
+
+    VerifyOrQuit(message != nullptr);
+    message->Init(aType, Coap::kCodePost);
+    SuccessOrQuit(message->GenerateRandomToken(Coap::Message::kDefaultTokenLength));
+    SuccessOrQuit(message->AppendUriPathOptions("t"));
+
+    PrepareMessageInfo(messageInfo, aPeer);
+    SuccessOrQuit(aCoap.SendMessage(*message, messageInfo, HandleResponse, &aTransaction));
+
+    aTransaction.mMessageId   = aCoap.mLastMessageId;
+    aTransaction.mTokenLength = aCoap.mLastTokenLength;
+    memcpy(aTransaction.mToken, aCoap.mLastToken, aCoap.mLastTokenLength);
+    aTransaction.mDone   = false;
+    aTransaction.mResult = kErrorNone;
+}
+
+static void ReceiveMessage(TestCoap           &aCoap,
+                           Coap::Type          aType,
+                           Coap::Code          aCode,
+                           uint16_t            aMessageId,
+                           const uint8_t      *aToken,
+                           uint8_t             aTokenLength,
+                           const Ip6::Address &aPeer,
+                           uint16_t            aPort = kPeerPort)
+{
+    Coap::Message   *message = aCoap.NewMessage();
+    Ip6::MessageInfo messageInfo;
+
+    VerifyOrQuit(message != nullptr);
+    message->Init(aType, aCode);
+    message->SetMessageId(aMessageId);
+    SuccessOrQuit(message->SetToken(aToken, aTokenLength));
+    message->Finish();
+
+    PrepareMessageInfo(messageInfo, aPeer, aPort);
+    aCoap.Receive(*message, messageInfo);
+
+    message->Free();
+}
+
+static void ReceiveAck(TestCoap &aCoap, const Transaction &aTransaction, const Ip6::Address &aPeer)
+{
+    ReceiveMessage(aCoap, Coap::kTypeAck, Coap::kCodeChanged, aTransaction.mMessageId, aTransaction.mToken,
+                   aTransaction.mTokenLength, aPeer);
+}
+
+static void ShuffleOrder(uint16_t *aOrder, uint16_t aLength)
+{
+    for (uint16_t i = 0; i < aLength; i++)
+    {
+        aOrder[i] = i;
+    }
+
+    for (uint16_t i = aLength; i > 1; i--)
+    {
+        uint16_t j   = Random::NonCrypto::GetUint16InRange(0, i);
+        uint16_t tmp = aOrder[i - 1];
+
+        aOrder[i - 1] = aOrder[j];
+        aOrder[j]     = tmp;
+    }
+}
+
+void TestCoapRequestMatching(void)
+{
+    static constexpr uint16_t kNumRequests = OPENTHREAD_CONFIG_COAP_MAX_INDEXED_REQUESTS;
+
+    TestCoap     *coap;
+    Ip6::Address  peerA;
+    Ip6::Address  peerB;
+    Ip6::Address  multicast;
+    Transaction   transactions[kNumRequests];
+    Transaction   multicastTransaction;
+    uint16_t      order[kNumRequests];
+    uint16_t      numRequests;
+
+    printf("\nTestCoapRequestMatching");
+
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != nullptr);
+
+    coap = new TestCoap(*sInstance);
+
+    SuccessOrQuit(peerA.FromString("fd00::1"));
+    SuccessOrQuit(peerB.FromString("fd00::2"));
+    SuccessOrQuit(multicast.FromString("ff03::1"));
+
+    for (numRequests = 2; numRequests <= kNumRequests; numRequests += (kNumRequests - 2))
+    {
+        uint32_t scans;
+
+        coap->ResetMatchCounters();
+
+        for (uint16_t i = 0; i < numRequests; i++)
+        {
+            SendRequest(*coap, Coap::kTypeConfirmable, (i % 2) ? peerB : peerA, transactions[i]);
+        }
+
+        VerifyOrQuit(coap->GetRequestMessages().GetHead() != nullptr);
+
+        // Acks from a wrong peer address or port, or with unknown
+        // message ID, must not match any request.
+
+        ReceiveAck(*coap, transactions[0], peerB);
+        ReceiveAck(*coap, transactions[1], peerA);
+        ReceiveMessage(*coap, Coap::kTypeAck, Coap::kCodeChanged, transactions[0].mMessageId, transactions[0].mToken,
+                       transactions[0].mTokenLength, peerA, kPeerPort + 1);
+        ReceiveMessage(*coap, Coap::kTypeAck, Coap::kCodeChanged, transactions[numRequests - 1].mMessageId + 1,
+                       nullptr, 0, peerA);
+
+        for (uint16_t i = 0; i < numRequests; i++)
+        {
+            VerifyOrQuit(!transactions[i].mDone);
+        }
+
+        VerifyOrQuit(coap->GetMatchCounters().mRequestMisses == 4);
+        VerifyOrQuit(coap->GetMatchCounters().mRequestMatches == 0);
+
+        // Acks in random order match their own request.
+
+        ShuffleOrder(order, numRequests);
+
+        for (uint16_t i = 0; i < numRequests; i++)
+        {
+            Transaction &transaction = transactions[order[i]];
+
+            ReceiveAck(*coap, transaction, (order[i] % 2) ? peerB : peerA);
+            VerifyOrQuit(transaction.mDone);
+            VerifyOrQuit(transaction.mResult == kErrorNone);
+
+            for (uint16_t j = i + 1; j < numRequests; j++)
+            {
+                VerifyOrQuit(!transactions[order[j]].mDone);
+            }
+        }
+
+        VerifyOrQuit(coap->GetRequestMessages().GetHead() == nullptr);
+        VerifyOrQuit(coap->GetMatchCounters().mRequestMatches == numRequests);
+
+        scans = coap->GetMatchCounters().mRequestScans;
+        VerifyOrQuit(scans == 0);
+
+        printf("\n  %2u requests: matches %lu, misses %lu, scans %lu", numRequests,
+               ToUlong(coap->GetMatchCounters().mRequestMatches), ToUlong(coap->GetMatchCounters().mRequestMisses),
+               ToUlong(scans));
+    }
+
+    // Separate response: empty ack followed by a confirmable response
+    // matched by token.
+
+    SendRequest(*coap, Coap::kTypeConfirmable, peerA, transactions[0]);
+    ReceiveMessage(*coap, Coap::kTypeAck, Coap::kCodeEmpty, transactions[0].mMessageId, nullptr, 0, peerA);
+    VerifyOrQuit(!transactions[0].mDone);
+    ReceiveMessage(*coap, Coap::kTypeConfirmable, Coap::kCodeChanged, 0x1234, transactions[0].mToken,
+                   transactions[0].mTokenLength, peerA);
+    VerifyOrQuit(transactions[0].mDone);
+    VerifyOrQuit(coap->GetRequestMessages().GetHead() == nullptr);
+
+    // Multicast request: response from any peer is matched by token.
+
+    SendRequest(*coap, Coap::kTypeNonConfirmable, multicast, multicastTransaction);
+    ReceiveMessage(*coap, Coap::kTypeNonConfirmable, Coap::kCodeChanged, 0x4321, multicastTransaction.mToken,
+                   multicastTransaction.mTokenLength, peerB);
+    VerifyOrQuit(multicastTransaction.mDone);
+
+    // A multicast request stays pending to allow multiple responses.
+    multicastTransaction.mDone = false;
+    ReceiveMessage(*coap, Coap::kTypeNonConfirmable, Coap::kCodeChanged, 0x4322, multicastTransaction.mToken,
+                   multicastTransaction.mTokenLength, peerA);
+    VerifyOrQuit(multicastTransaction.mDone);
+    VerifyOrQuit(coap->GetRequestMessages().GetHead() != nullptr);
+
+    multicastTransaction.mDone = false;
+    SuccessOrQuit(coap->AbortTransaction(HandleResponse, &multicastTransaction));
+    VerifyOrQuit(multicastTransaction.mDone && multicastTransaction.mResult == kErrorAbort);
+    VerifyOrQuit(coap->GetRequestMessages().GetHead() == nullptr);
+
+    // Abort with pending requests (index must be cleaned up).
+
+    for (uint16_t i = 0; i < 4; i++)
+    {
+        SendRequest(*coap, Coap::kTypeConfirmable, peerA, transactions[i]);
+    }
+
+    coap->ClearRequestsAndResponses();
+    VerifyOrQuit(coap->GetRequestMessages().GetHead() == nullptr);
+
+    for (uint16_t i = 0; i < 4; i++)
+    {
+        SendRequest(*coap, Coap::kTypeConfirmable, peerA, transactions[i]);
+    }
+
+    for (uint16_t i = 0; i < 4; i++)
+    {
+        ReceiveAck(*coap, transactions[i], peerA);
+        VerifyOrQuit(transactions[i].mDone);
+    }
+
+    // More requests than the index can track are sent. The ones which
+    // do not fit are matched by a linear scan until they are removed.
+
+    {
+        static constexpr uint16_t kMaxIndexed  = OPENTHREAD_CONFIG_COAP_MAX_INDEXED_REQUESTS;
+        static constexpr uint16_t kMaxRequests = kMaxIndexed + 4;
+
+        Transaction poolTransactions[kMaxRequests];
+        uint16_t    numPending = 0;
+        uint16_t    numUnindexed;
+
+        coap->ResetMatchCounters();
+
+        while (numPending < kMaxRequests)
+        {
+            Coap::Message   *message = coap->NewMessage();
+            Ip6::MessageInfo messageInfo;
+
+            if (message == nullptr)
+            {
+                break;
+            }
+
+            message->Init(Coap::kTypeConfirmable, Coap::kCodePost);
+            SuccessOrQuit(message->GenerateRandomToken(Coap::Message::kDefaultTokenLength));
+            PrepareMessageInfo(messageInfo, peerA);
+
+            if (coap->SendMessage(*message, messageInfo, HandleResponse, &poolTransactions[numPending]) != kErrorNone)
+            {
+                message->Free();
+                break;
+            }
+
+            poolTransactions[numPending].mMessageId   = coap->mLastMessageId;
+            poolTransactions[numPending].mTokenLength = coap->mLastTokenLength;
+            memcpy(poolTransactions[numPending].mToken, coap->mLastToken, coap->mLastTokenLength);
+            poolTransactions[numPending].mDone = false;
+            numPending++;
+        }
+
+        VerifyOrQuit(numPending > 0);
+        numUnindexed = (numPending > kMaxIndexed) ? numPending - kMaxIndexed : 0;
+
+        // The newest (unindexed) requests are acked first, each one is
+        // found by a scan. The remaining ones are found in the index.
+
+        for (uint16_t i = numPending; i > 0; i--)
+        {
+            ReceiveAck(*coap, poolTransactions[i - 1], peerA);
+            VerifyOrQuit(poolTransactions[i - 1].mDone);
+        }
+
+        VerifyOrQuit(coap->GetRequestMessages().GetHead() == nullptr);
+        VerifyOrQuit(coap->GetMatchCounters().mRequestMatches == numPending);
+        VerifyOrQuit(coap->GetMatchCounters().mRequestScans == numUnindexed);
+
+        printf("\n  %u requests (%u indexed): %u scans", numPending, numPending - numUnindexed, numUnindexed);
+    }
+
+    delete coap;
+    testFreeInstance(sInstance);
+
+    printf("\n -- PASS\n");
+}
+
+void TestCoapResponseCache(void)
+{
+    static const uint8_t kToken[] = {0xa1, 0xb2};
+
+    TestCoap    *coap;
+    Ip6::Address peerA;
+    Ip6::Address peerB;
+    uint32_t     numSent;
+
+    printf("\nTestCoapResponseCache");
+
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != nullptr);
+
+    coap = new TestCoap(*sInstance);
+
+    SuccessOrQuit(peerA.FromString("fd00::1"));
+    SuccessOrQuit(peerB.FromString("fd00::2"));
+
+    // Each new confirmable request gets a (cached) "Not Found" ack as
+    // there is no resource.
+
+    for (uint16_t id = 0; id < OPENTHREAD_CONFIG_COAP_SERVER_MAX_CACHED_RESPONSES; id++)
+    {
+        ReceiveMessage(*coap, Coap::kTypeConfirmable, Coap::kCodeGet, 0x100 + id, kToken, sizeof(kToken), peerA);
+        VerifyOrQuit(coap->mLastType == Coap::kTypeAck);
+        VerifyOrQuit(coap->mLastMessageId == 0x100 + id);
+    }
+
+    VerifyOrQuit(coap->GetMatchCounters().mResponseMisses == OPENTHREAD_CONFIG_COAP_SERVER_MAX_CACHED_RESPONSES);
+    VerifyOrQuit(coap->GetMatchCounters().mResponseMatches == 0);
+
+    // Duplicates are answered from the cache.
+
+    for (uint16_t id = 0; id < OPENTHREAD_CONFIG_COAP_SERVER_MAX_CACHED_RESPONSES; id++)
+    {
+        numSent = coap->mNumSent;
+        ReceiveMessage(*coap, Coap::kTypeConfirmable, Coap::kCodeGet, 0x100 + id, kToken, sizeof(kToken), peerA);
+        VerifyOrQuit(coap->mNumSent == numSent + 1);
+        VerifyOrQuit(coap->mLastMessageId == 0x100 + id);
+    }
+
+    VerifyOrQuit(coap->GetMatchCounters().mResponseMatches == OPENTHREAD_CONFIG_COAP_SERVER_MAX_CACHED_RESPONSES);
+
+    // Same message ID from another peer or port is not a duplicate.
+
+    ReceiveMessage(*coap, Coap::kTypeConfirmable, Coap::kCodeGet, 0x100, kToken, sizeof(kToken), peerB);
+    ReceiveMessage(*coap, Coap::kTypeConfirmable, Coap::kCodeGet, 0x100, kToken, sizeof(kToken), peerA,
+                   kPeerPort + 1);
+    VerifyOrQuit(coap->GetMatchCounters().mResponseMisses == OPENTHREAD_CONFIG_COAP_SERVER_MAX_CACHED_RESPONSES + 2);
+
+    // The cache is full, so the two new responses evicted the two
+    // oldest ones.
+
+    coap->ResetMatchCounters();
+    ReceiveMessage(*coap, Coap::kTypeConfirmable, Coap::kCodeGet, 0x102, kToken, sizeof(kToken), peerA);
+    VerifyOrQuit(coap->GetMatchCounters().mResponseMatches == 1);
+    ReceiveMessage(*coap, Coap::kTypeConfirmable, Coap::kCodeGet, 0x100, kToken, sizeof(kToken), peerA);
+    VerifyOrQuit(coap->GetMatchCounters().mResponseMisses == 1);
+
+    coap->ClearRequestsAndResponses();
+    VerifyOrQuit(coap->GetCachedResponses().GetHead() == nullptr);
+
+    coap->ResetMatchCounters();
+    ReceiveMessage(*coap, Coap::kTypeConfirmable, Coap::kCodeGet, 0x100, kToken, sizeof(kToken), peerA);
+    VerifyOrQuit(coap->GetMatchCounters().mResponseMisses == 1);
+    ReceiveMessage(*coap, Coap::kTypeConfirmable, Coap::kCodeGet, 0x100, kToken, sizeof(kToken), peerA);
+    VerifyOrQuit(coap->GetMatchCounters().mResponseMatches == 1);
+
+    delete coap;
+    testFreeInstance(sInstance);
+
+    printf("\n -- PASS\n");
+}
+
+void TestCoapMessageSlots(void)
+{
+    static constexpr uint16_t kNumSlots = 8;
+
+    Coap::MessageSlots<kNumSlots> slots;
+    bool                          isAllocated[kNumSlots];
+    uint16_t                      slot;
+
+    printf("\nTestCoapMessageSlots");
+
+    memset(isAllocated, 0, sizeof(isAllocated));
+
+    for (uint16_t i = 0; i < kNumSlots; i++)
+    {
+        slot = slots.Allocate();
+        VerifyOrQuit(slot < kNumSlots);
+        VerifyOrQuit(!isAllocated[slot]);
+        isAllocated[slot] = true;
+    }
+
+    VerifyOrQuit(slots.Allocate() == slots.kInvalidSlot);
+
+    // Freed slots are reused, and freeing `kInvalidSlot` does nothing.
+
+    slots.Free(3);
+    slots.Free(5);
+    slots.Free(slots.kInvalidSlot);
+
+    slot = slots.Allocate();
+    VerifyOrQuit(slot == 3 || slot == 5);
+    VerifyOrQuit(slots.Allocate() == 8 - slot);
+    VerifyOrQuit(slots.Allocate() == slots.kInvalidSlot);
+
+    slots.Clear();
+
+    for (uint16_t i = 0; i < kNumSlots; i++)
+    {
+        VerifyOrQuit(slots.Allocate() != slots.kInvalidSlot);
+    }
+
+    VerifyOrQuit(slots.Allocate() == slots.kInvalidSlot);
+
+    printf(" -- PASS\n");
+}
+
+static void CoapTransactionPerformance(uint16_t aWindow)
+{
+    // Drives many transactions through the CoAP agent while keeping
+    // `aWindow` of them outstanding and completing them in random
+    // order.
+
+    static constexpr uint32_t kNumTransactions = 20000;
+    static constexpr uint16_t kMaxWindow       = OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS;
+
+    TestCoap    *coap;
+    Ip6::Address peers[4];
+    Transaction  transactions[kMaxWindow];
+    uint16_t     peerIndexes[kMaxWindow];
+    uint64_t     startTime;
+    uint64_t     duration;
+
+    VerifyOrQuit(aWindow <= kMaxWindow);
+
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != nullptr);
+
+    coap = new TestCoap(*sInstance);
+
+    for (uint16_t i = 0; i < GetArrayLength(peers); i++)
+    {
+        peers[i].Clear();
+        peers[i].mFields.m8[0]  = 0xfd;
+        peers[i].mFields.m8[15] = static_cast<uint8_t>(i + 1);
+    }
+
+    for (uint16_t i = 0; i < aWindow; i++)
+    {
+        peerIndexes[i] = i % GetArrayLength(peers);
+        SendRequest(*coap, Coap::kTypeConfirmable, peers[peerIndexes[i]], transactions[i]);
+    }
+
+    startTime = GetMonotonicNsec();
+
+    for (uint32_t count = 0; count < kNumTransactions; count++)
+    {
+        uint16_t index = Random::NonCrypto::GetUint16InRange(0, aWindow);
+
+        ReceiveAck(*coap, transactions[index], peers[peerIndexes[index]]);
+        VerifyOrQuit(transactions[index].mDone);
+
+        peerIndexes[index] = Random::NonCrypto::GetUint16InRange(0, GetArrayLength(peers));
+        SendRequest(*coap, Coap::kTypeConfirmable, peers[peerIndexes[index]], transactions[index]);
+    }
+
+    duration = GetMonotonicNsec() - startTime;
+
+    VerifyOrQuit(coap->GetMatchCounters().mRequestMatches == kNumTransactions);
+    VerifyOrQuit(coap->GetMatchCounters().mRequestScans == 0);
+
+    printf("\n  %lu transactions (%2u outstanding): %lu ns per transaction", ToUlong(kNumTransactions), aWindow,
+           ToUlong(static_cast<uint32_t>(duration / kNumTransactions)));
+
+    coap->ClearRequestsAndResponses();
+
+    delete coap;
+    testFreeInstance(sInstance);
+}
+
+void TestCoapPerformance(void)
+{
+    // Each outstanding request holds a message buffer, and sending a
+    // request or receiving an ack needs a few more.
+
+    static constexpr uint16_t kMaxWindow = OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS - 4;
+
+    printf("\nTestCoapPerformance");
+
+    CoapTransactionPerformance(1);
+    CoapTransactionPerformance(kMaxWindow / 4);
+    CoapTransactionPerformance(kMaxWindow / 2);
+    CoapTransactionPerformance(kMaxWindow);
+
+    printf("\n -- PASS\n");
+}
+
+} // namespace ot
+
+int main(void)
+{
+    ot::TestCoapRequestMatching();
+    ot::TestCoapResponseCache();
+    ot::TestCoapMessageSlots();
+
+    if (IsBenchmarkEnabled())
+    {
+        ot::TestCoapPerformance();
+    }
+
+    printf("\nAll tests passed.\n");
+    return 0;
+}
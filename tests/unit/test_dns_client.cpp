@@ -110,7 +110,7 @@ uint32_t otPlatAlarmMilliGetNow(void) { return sNow; }
 
 //----------------------------------------------------------------------------------------------------------------------
 
-Array<void *, 500> sHeapAllocatedPtrs;
+Array<void *, 10000> sHeapAllocatedPtrs;
 
 #if OPENTHREAD_CONFIG_HEAP_EXTERNAL_ENABLE
 void *otPlatCAlloc(size_t aNum, size_t aSize)
@@ -403,6 +403,79 @@ exit:
 
 //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 
+static constexpr uint16_t kMaxSharedHosts = 4;
+
+struct SharedBrowseInfo
+{
+    void Reset(void) { memset(this, 0, sizeof(*this)); }
+
+    uint16_t mCallbackCount;
+    Error    mError;
+    uint16_t mNumInstances;
+    uint16_t mNumHostAddresses[kMaxSharedHosts];
+};
+
+static SharedBrowseInfo sSharedBrowseInfo;
+
+void SharedBrowseCallback(otError aError, const otDnsBrowseResponse *aResponse, void *aContext)
+{
+    // Counts the instances and the AAAA records of each of the hosts
+    // "host0" to "host<kMaxSharedHosts-1>" in the browse response.
+
+    const Dns::Client::BrowseResponse &response = AsCoreType(aResponse);
+    char                               hostName[Dns::Name::kMaxNameSize];
+
+    VerifyOrQuit(aContext == sInstance);
+
+    sSharedBrowseInfo.mCallbackCount++;
+    sSharedBrowseInfo.mError = aError;
+
+    SuccessOrExit(aError);
+
+    for (uint16_t index = 0;; index++)
+    {
+        char  instLabel[Dns::Name::kMaxLabelSize];
+        Error error;
+
+        error = response.GetServiceInstance(index, instLabel, sizeof(instLabel));
+
+        if (error == kErrorNotFound)
+        {
+            sSharedBrowseInfo.mNumInstances = index;
+            break;
+        }
+
+        SuccessOrQuit(error);
+    }
+
+    for (uint16_t hostIndex = 0; hostIndex < kMaxSharedHosts; hostIndex++)
+    {
+        snprintf(hostName, sizeof(hostName), "host%u.default.service.arpa.", hostIndex);
+
+        for (uint16_t index = 0;; index++)
+        {
+            Ip6::Address address;
+            uint32_t     ttl;
+            Error        error;
+
+            error = response.GetHostAddress(hostName, index, address, ttl);
+
+            if (error == kErrorNotFound)
+            {
+                sSharedBrowseInfo.mNumHostAddresses[hostIndex] = index;
+                break;
+            }
+
+            SuccessOrQuit(error);
+        }
+    }
+
+exit:
+    return;
+}
+
+//- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
 static constexpr uint8_t  kMaxHostAddresses = 10;
 static constexpr uint16_t kMaxTxtBuffer     = 256;
 
@@ -898,12 +971,242 @@ void TestDnsClient(void)
     Log("End of TestDnsClient");
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+
+void TestDnsClientWithManySrpServices(void)
+{
+    // Registers many services (10 services per host, two instances
+    // per service type) on the SRP server and measures the DNS-SD
+    // server resolving browse and service queries against them. The
+    // first `kNumSharedHosts` hosts also register two instances of a
+    // shared service type, to check that a browse response includes
+    // the addresses of each host only once.
+
+#if OPENTHREAD_CONFIG_HEAP_EXTERNAL_ENABLE
+    static constexpr uint16_t kNumHosts = 100;
+#else
+    // The internal heap (limited to 64 KB) cannot hold 1000 services.
+    static constexpr uint16_t kNumHosts = 15;
+#endif
+    static constexpr uint16_t kNumServicesPerHost = 10;
+    static constexpr uint16_t kNumServices        = kNumHosts * kNumServicesPerHost;
+    static constexpr uint16_t kNumServiceTypes    = kNumServices / 2;
+    static constexpr uint16_t kNumQueries         = 200;
+    static constexpr uint16_t kMaxNameLength      = 40;
+    static constexpr uint16_t kNumSharedHosts     = (kNumHosts < kMaxSharedHosts) ? kNumHosts : kMaxSharedHosts;
+    static constexpr uint16_t kNumSharedServices  = 2;
+
+    Srp::Server             *srpServer;
+    Srp::Client             *srpClient;
+    Dns::Client             *dnsClient;
+    Dns::Client::QueryConfig queryConfig;
+    Srp::Client::Service     services[kNumServicesPerHost + kNumSharedServices];
+    char                     serviceNames[kNumServicesPerHost][kMaxNameLength];
+    char                     instanceLabels[kNumServicesPerHost + kNumSharedServices][kMaxNameLength];
+    char                     hostName[kMaxNameLength];
+    char                     fullName[Dns::Name::kMaxNameSize];
+    const Srp::Server::Host *host;
+    uint16_t                 numHosts;
+    uint16_t                 numServices;
+    uint64_t                 startTime;
+    uint64_t                 browseDuration;
+    uint64_t                 resolveDuration;
+
+    Log("--------------------------------------------------------------------------------------------");
+    Log("TestDnsClientWithManySrpServices");
+
+    InitTest();
+
+    srpServer = &sInstance->Get<Srp::Server>();
+    srpClient = &sInstance->Get<Srp::Client>();
+    dnsClient = &sInstance->Get<Dns::Client>();
+
+    SuccessOrQuit(srpServer->SetAddressMode(Srp::Server::kAddressModeUnicast));
+    srpServer->SetEnabled(true);
+    AdvanceTime(10000);
+    VerifyOrQuit(srpServer->GetState() == Srp::Server::kStateRunning);
+
+    srpClient->EnableAutoStartMode(nullptr, nullptr);
+    AdvanceTime(2000);
+    VerifyOrQuit(srpClient->IsRunning());
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Register all hosts and services. The SRP client registers one host
+    // at a time, and then clears it locally (without removing it from
+    // the server) before registering the next one.
+
+    for (uint16_t hostIndex = 0; hostIndex < kNumHosts; hostIndex++)
+    {
+        snprintf(hostName, sizeof(hostName), "host%u", hostIndex);
+        SuccessOrQuit(srpClient->SetHostName(hostName));
+        SuccessOrQuit(srpClient->EnableAutoHostAddress());
+
+        for (uint16_t i = 0; i < kNumServicesPerHost; i++)
+        {
+            uint16_t serviceIndex = hostIndex * kNumServicesPerHost + i;
+
+            snprintf(serviceNames[i], kMaxNameLength, "_bench%u._udp", serviceIndex % kNumServiceTypes);
+            snprintf(instanceLabels[i], kMaxNameLength, "instance%u", serviceIndex);
+
+            memset(&services[i], 0, sizeof(services[i]));
+            services[i].mName         = serviceNames[i];
+            services[i].mInstanceName = instanceLabels[i];
+            services[i].mPort         = 1000 + serviceIndex;
+
+            SuccessOrQuit(srpClient->AddService(services[i]));
+        }
+
+        numServices = kNumServicesPerHost;
+
+        if (hostIndex < kNumSharedHosts)
+        {
+            for (uint16_t i = 0; i < kNumSharedServices; i++, numServices++)
+            {
+                snprintf(instanceLabels[numServices], kMaxNameLength, "shared%u-%u", hostIndex, i);
+
+                memset(&services[numServices], 0, sizeof(services[numServices]));
+                services[numServices].mName         = "_shared._udp";
+                services[numServices].mInstanceName = instanceLabels[numServices];
+                services[numServices].mPort         = 2000 + i;
+
+                SuccessOrQuit(srpClient->AddService(services[numServices]));
+            }
+        }
+
+        // The client may register the services over several updates
+        // (single service mode) when they do not fit in one message.
+
+        for (uint16_t i = 0, wait = 0; i < numServices;)
+        {
+            if (services[i].GetState() == Srp::Client::kRegistered)
+            {
+                i++;
+                continue;
+            }
+
+            VerifyOrQuit(wait++ < 60);
+            AdvanceTime(1000);
+        }
+
+        srpClient->ClearHostAndServices();
+    }
+
+    numHosts    = 0;
+    numServices = 0;
+
+    for (host = srpServer->GetNextHost(nullptr); host != nullptr; host = srpServer->GetNextHost(host))
+    {
+        const Srp::Server::Service *service = nullptr;
+
+        numHosts++;
+
+        while ((service = host->FindNextService(service, Srp::Server::kFlagsBaseTypeServiceOnly)) != nullptr)
+        {
+            numServices++;
+        }
+    }
+
+    Log("Registered %u hosts with %u services", numHosts, numServices);
+    VerifyOrQuit(numHosts == kNumHosts);
+    VerifyOrQuit(numServices == kNumServices + kNumSharedHosts * kNumSharedServices);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Browse for the shared service type and check that the AAAA
+    // records of each host are included once.
+
+    sSharedBrowseInfo.Reset();
+    SuccessOrQuit(dnsClient->Browse("_shared._udp.default.service.arpa.", SharedBrowseCallback, sInstance));
+    AdvanceTime(100);
+    VerifyOrQuit(sSharedBrowseInfo.mCallbackCount == 1);
+    SuccessOrQuit(sSharedBrowseInfo.mError);
+    VerifyOrQuit(sSharedBrowseInfo.mNumInstances == kNumSharedHosts * kNumSharedServices);
+
+    for (host = srpServer->GetNextHost(nullptr); host != nullptr; host = srpServer->GetNextHost(host))
+    {
+        uint16_t hostIndex;
+        uint8_t  numAddresses;
+
+        VerifyOrQuit(sscanf(host->GetFullName(), "host%hu.", &hostIndex) == 1);
+
+        if (hostIndex >= kNumSharedHosts)
+        {
+            continue;
+        }
+
+        IgnoreReturnValue(host->GetAddresses(numAddresses));
+        VerifyOrQuit(numAddresses > 0);
+        VerifyOrQuit(sSharedBrowseInfo.mNumHostAddresses[hostIndex] == numAddresses);
+    }
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Browse for service types (PTR queries with SRV, TXT and AAAA
+    // records in the additional section).
+
+    startTime = GetMonotonicNsec();
+
+    for (uint16_t query = 0; query < kNumQueries; query++)
+    {
+        snprintf(fullName, sizeof(fullName), "_bench%u._udp.default.service.arpa.", (query * 7) % kNumServiceTypes);
+
+        sBrowseInfo.Reset();
+        SuccessOrQuit(dnsClient->Browse(fullName, BrowseCallback, sInstance));
+        AdvanceTime(100);
+        VerifyOrQuit(sBrowseInfo.mCallbackCount == 1);
+        SuccessOrQuit(sBrowseInfo.mError);
+        VerifyOrQuit(sBrowseInfo.mNumInstances == kNumServices / kNumServiceTypes);
+    }
+
+    browseDuration = GetMonotonicNsec() - startTime;
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Resolve service instances (SRV and TXT queries with AAAA records
+    // in the additional section).
+
+    queryConfig.Clear();
+    queryConfig.mServiceMode = static_cast<otDnsServiceMode>(Dns::Client::QueryConfig::kServiceModeSrvTxt);
+
+    startTime = GetMonotonicNsec();
+
+    for (uint16_t query = 0; query < kNumQueries; query++)
+    {
+        uint16_t serviceIndex = (query * 13) % kNumServices;
+
+        snprintf(fullName, sizeof(fullName), "_bench%u._udp.default.service.arpa.", serviceIndex % kNumServiceTypes);
+        snprintf(instanceLabels[0], kMaxNameLength, "instance%u", serviceIndex);
+
+        sResolveServiceInfo.Reset();
+        SuccessOrQuit(dnsClient->ResolveService(instanceLabels[0], fullName, ServiceCallback, sInstance, &queryConfig));
+        AdvanceTime(100);
+        VerifyOrQuit(sResolveServiceInfo.mCallbackCount == 1);
+        SuccessOrQuit(sResolveServiceInfo.mError);
+        VerifyOrQuit(sResolveServiceInfo.mInfo.mPort == 1000 + serviceIndex);
+        VerifyOrQuit(sResolveServiceInfo.mNumHostAddresses > 0);
+    }
+
+    resolveDuration = GetMonotonicNsec() - startTime;
+
+    Log("Browse: %u queries, %lu usec per query", kNumQueries,
+        ToUlong(static_cast<uint32_t>(browseDuration / kNumQueries / 1000)));
+    Log("ResolveService: %u queries, %lu usec per query", kNumQueries,
+        ToUlong(static_cast<uint32_t>(resolveDuration / kNumQueries / 1000)));
+
+    srpServer->SetEnabled(false);
+    AdvanceTime(100);
+
+    FinalizeTest();
+
+    VerifyOrQuit(sHeapAllocatedPtrs.IsEmpty());
+
+    Log("End of TestDnsClientWithManySrpServices");
+}
+
 #endif // ENABLE_DNS_TEST
 
 int main(void)
 {
 #if ENABLE_DNS_TEST
     TestDnsClient();
+    TestDnsClientWithManySrpServices();
     printf("All tests passed\n");
 #else
     printf("DNS_CLIENT or DSNSSD_SERVER feature is not enabled\n");
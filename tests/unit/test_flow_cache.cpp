@@ -0,0 +1,480 @@
+/*
+ *  Copyright (c) 2023, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <openthread/config.h>
+
+#include <stdio.h>
+#include <string.h>
+
+#include "test_platform.h"
+#include "test_util.hpp"
+
+#include <openthread/dataset_ftd.h>
+#include <openthread/thread.h>
+#include <openthread/thread_ftd.h>
+
+#include "common/instance.hpp"
+#include "common/time.hpp"
+#include "net/udp6.hpp"
+#include "thread/address_resolver.hpp"
+#include "thread/child_table.hpp"
+#include "thread/mesh_forwarder.hpp"
+#include "thread/router_table.hpp"
+
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MESH_FORWARDER_FLOW_CACHE_ENABLE && !OPENTHREAD_CONFIG_TIME_SYNC_ENABLE && \
+    !OPENTHREAD_PLATFORM_POSIX
+#define ENABLE_FLOW_CACHE_TEST 1
+#else
+#define ENABLE_FLOW_CACHE_TEST 0
+#endif
+
+#if ENABLE_FLOW_CACHE_TEST
+
+namespace ot {
+
+static constexpr uint16_t kNumChildren  = 8;
+static constexpr uint16_t kPort         = 1234;
+static constexpr uint32_t kChildTimeout = 3600; // In seconds.
+static constexpr uint16_t kMaxTxWait    = 1000; // In milliseconds.
+
+static Instance *sInstance;
+
+static uint32_t sNow = 0;
+static uint32_t sAlarmTime;
+static bool     sAlarmOn = false;
+
+static otRadioFrame sRadioTxFrame;
+static uint8_t      sRadioTxFramePsdu[OT_RADIO_FRAME_MAX_SIZE];
+static bool         sRadioTxOngoing     = false;
+static uint32_t     sNumTxUnicastFrames = 0;
+static uint16_t     sLastTxDest         = Mac::kShortAddrInvalid;
+
+static Ip6::Udp::Socket *sSocket;
+static Child            *sChildren[kNumChildren];
+
+//----------------------------------------------------------------------------------------------------------------------
+// `otPlatRadio` and `otPlatAlarm`
+
+extern "C" {
+
+otRadioCaps otPlatRadioGetCaps(otInstance *) { return OT_RADIO_CAPS_ACK_TIMEOUT | OT_RADIO_CAPS_CSMA_BACKOFF; }
+
+otError otPlatRadioTransmit(otInstance *, otRadioFrame *)
+{
+    sRadioTxOngoing = true;
+
+    return OT_ERROR_NONE;
+}
+
+otRadioFrame *otPlatRadioGetTransmitBuffer(otInstance *) { return &sRadioTxFrame; }
+
+void otPlatAlarmMilliStop(otInstance *) { sAlarmOn = false; }
+
+void otPlatAlarmMilliStartAt(otInstance *, uint32_t aT0, uint32_t aDt)
+{
+    sAlarmOn   = true;
+    sAlarmTime = aT0 + aDt;
+}
+
+uint32_t otPlatAlarmMilliGetNow(void) { return sNow; }
+
+} // extern "C"
+
+//---------------------------------------------------------------------------------------------------------------------
+
+static void ProcessRadioTxAndTasklets(void)
+{
+    do
+    {
+        if (sRadioTxOngoing)
+        {
+            Mac::Address dest;
+
+            sRadioTxOngoing = false;
+
+            // Track the unicast frames only, i.e., skip MLE Advertisements.
+            SuccessOrQuit(static_cast<Mac::TxFrame &>(sRadioTxFrame).GetDstAddr(dest));
+
+            if (dest.IsShort() && (dest.GetShort() != Mac::kShortAddrBroadcast))
+            {
+                sNumTxUnicastFrames++;
+                sLastTxDest = dest.GetShort();
+            }
+
+            otPlatRadioTxStarted(sInstance, &sRadioTxFrame);
+            otPlatRadioTxDone(sInstance, &sRadioTxFrame, nullptr, OT_ERROR_NONE);
+        }
+
+        otTaskletsProcess(sInstance);
+    } while (otTaskletsArePending(sInstance));
+}
+
+static void AdvanceTime(uint32_t aDuration)
+{
+    uint32_t time = sNow + aDuration;
+
+    while (sAlarmOn && TimeMilli(sAlarmTime) <= TimeMilli(time))
+    {
+        ProcessRadioTxAndTasklets();
+        sNow = sAlarmTime;
+        otPlatAlarmMilliFired(sInstance);
+    }
+
+    ProcessRadioTxAndTasklets();
+    sNow = time;
+}
+
+static Ip6::Address GetMeshLocalAddress(uint64_t aIid)
+{
+    Ip6::Address address;
+
+    address.SetPrefix(sInstance->Get<Mle::MleRouter>().GetMeshLocalPrefix());
+
+    for (uint8_t i = 0; i < sizeof(uint64_t); i++)
+    {
+        address.mFields.m8[15 - i] = static_cast<uint8_t>(aIid >> (8 * i));
+    }
+
+    return address;
+}
+
+static Ip6::Address GetChildEid(uint16_t aIndex) { return GetMeshLocalAddress(0x1000 + aIndex); }
+
+static Ip6::Address GetResolvedEid(uint16_t aIndex) { return GetMeshLocalAddress(0x2000 + aIndex); }
+
+static Ip6::Address GetChildRloc(uint16_t aIndex)
+{
+    Ip6::Address address = sInstance->Get<Mle::MleRouter>().GetMeshLocal16();
+
+    address.GetIid().SetLocator(sChildren[aIndex]->GetRloc16());
+
+    return address;
+}
+
+static Child *AddChild(uint16_t aIndex)
+{
+    Child          *child = sInstance->Get<ChildTable>().GetNewChild();
+    Mac::ExtAddress extAddress;
+    Mle::DeviceMode mode(Mle::DeviceMode::kModeRxOnWhenIdle | Mle::DeviceMode::kModeFullThreadDevice |
+                         Mle::DeviceMode::kModeFullNetworkData);
+    Ip6::Address    eid = GetChildEid(aIndex);
+
+    VerifyOrQuit(child != nullptr);
+
+    memset(&extAddress, 0, sizeof(extAddress));
+    extAddress.m8[7] = static_cast<uint8_t>(aIndex + 1);
+
+    child->SetExtAddress(extAddress);
+    child->SetRloc16(sInstance->Get<Mle::MleRouter>().GetRloc16() + aIndex + 1);
+    child->SetDeviceMode(mode);
+    child->SetTimeout(kChildTimeout);
+    child->SetLastHeard(TimerMilli::GetNow());
+    child->SetState(Neighbor::kStateValid);
+    SuccessOrQuit(child->AddIp6Address(eid));
+
+    return child;
+}
+
+static void InitTest(void)
+{
+    otOperationalDataset     dataset;
+    otOperationalDatasetTlvs datasetTlvs;
+
+    sNow      = 0;
+    sAlarmOn  = false;
+    sInstance = static_cast<Instance *>(testInitInstance());
+
+    memset(&sRadioTxFrame, 0, sizeof(sRadioTxFrame));
+    sRadioTxFrame.mPsdu = sRadioTxFramePsdu;
+    sRadioTxOngoing     = false;
+
+    SuccessOrQuit(otDatasetCreateNewNetwork(sInstance, &dataset));
+    SuccessOrQuit(otDatasetConvertToTlvs(&dataset, &datasetTlvs));
+    SuccessOrQuit(otDatasetSetActiveTlvs(sInstance, &datasetTlvs));
+
+    SuccessOrQuit(otIp6SetEnabled(sInstance, true));
+    SuccessOrQuit(otThreadSetEnabled(sInstance, true));
+
+    AdvanceTime(10000);
+
+    VerifyOrQuit(otThreadGetDeviceRole(sInstance) == OT_DEVICE_ROLE_LEADER);
+
+    for (uint16_t i = 0; i < kNumChildren; i++)
+    {
+        sChildren[i] = AddChild(i);
+
+        // Snoop a mapping of an EID to the child into the address cache.
+        sInstance->Get<AddressResolver>().UpdateSnoopedCacheEntry(GetResolvedEid(i), sChildren[i]->GetRloc16(),
+                                                                 sInstance->Get<Mle::MleRouter>().GetRloc16());
+    }
+
+    sSocket = new Ip6::Udp::Socket(*sInstance);
+    SuccessOrQuit(sSocket->Open(nullptr, nullptr));
+    SuccessOrQuit(sSocket->Bind(kPort));
+
+    AdvanceTime(1000);
+}
+
+static void FinalizeTest(void)
+{
+    SuccessOrQuit(sSocket->Close());
+    delete sSocket;
+
+    SuccessOrQuit(otIp6SetEnabled(sInstance, false));
+    SuccessOrQuit(otThreadSetEnabled(sInstance, false));
+    VerifyOrQuit(sInstance->Get<MessagePool>().GetFreeBufferCount() ==
+                 sInstance->Get<MessagePool>().GetTotalBufferCount());
+    SuccessOrQuit(otInstanceErasePersistentInfo(sInstance));
+    testFreeInstance(sInstance);
+}
+
+// Sends a UDP datagram to a given destination and returns the short
+// address the frame was transmitted to.
+static uint16_t Send(const Ip6::Address &aDestination)
+{
+    Message         *message = sSocket->NewMessage();
+    Ip6::MessageInfo messageInfo;
+    uint32_t         numTxFrames = sNumTxUnicastFrames;
+
+    VerifyOrQuit(message != nullptr);
+    SuccessOrQuit(message->SetLength(16));
+
+    messageInfo.SetPeerAddr(aDestination);
+    messageInfo.SetPeerPort(kPort);
+
+    SuccessOrQuit(sSocket->SendTo(*message, messageInfo));
+    ProcessRadioTxAndTasklets();
+
+    // Other frames (e.g., MLE Advertisements) may be sent first.
+    for (uint16_t count = 0; sNumTxUnicastFrames == numTxFrames; count++)
+    {
+        VerifyOrQuit(count < kMaxTxWait);
+        AdvanceTime(1);
+    }
+
+    VerifyOrQuit(sNumTxUnicastFrames == numTxFrames + 1);
+
+    return sLastTxDest;
+}
+
+static const otFlowCacheCounters &GetCounters(void) { return *otThreadGetFlowCacheCounters(sInstance); }
+
+static void VerifyCounters(uint32_t aHits, uint32_t aMisses, uint32_t aStale)
+{
+    VerifyOrQuit(GetCounters().mHits == aHits);
+    VerifyOrQuit(GetCounters().mMisses == aMisses);
+    VerifyOrQuit(GetCounters().mStale == aStale);
+}
+
+// Clears the flow cache and sends two messages to a destination: the
+// first one misses and populates the cache, the second one hits.
+static void PopulateFlow(const Ip6::Address &aDestination, const Child &aChild)
+{
+    sInstance->Get<MeshForwarder>().ClearFlowCache();
+    otThreadResetFlowCacheCounters(sInstance);
+
+    VerifyOrQuit(Send(aDestination) == aChild.GetRloc16());
+    VerifyCounters(0, 1, 0);
+    VerifyOrQuit(Send(aDestination) == aChild.GetRloc16());
+    VerifyCounters(1, 1, 0);
+}
+
+void TestFlowCache(void)
+{
+    printf("\nTestFlowCache");
+
+    InitTest();
+
+    // Frames are sent to the child whether it is addressed by RLOC,
+    // by one of its registered addresses, or by an EID resolved from
+    // the address cache, both when the flow cache misses and hits.
+
+    PopulateFlow(GetChildRloc(0), *sChildren[0]);
+    PopulateFlow(GetChildEid(1), *sChildren[1]);
+    PopulateFlow(GetResolvedEid(2), *sChildren[2]);
+
+    // A child table change invalidates the entry.
+
+    PopulateFlow(GetChildRloc(0), *sChildren[0]);
+    sChildren[3]->SetState(Neighbor::kStateInvalid);
+
+    VerifyOrQuit(Send(GetChildRloc(0)) == sChildren[0]->GetRloc16());
+    VerifyCounters(1, 2, 1);
+    VerifyOrQuit(Send(GetChildRloc(0)) == sChildren[0]->GetRloc16());
+    VerifyCounters(2, 2, 1);
+
+    // An address cache change invalidates the entry.
+
+    PopulateFlow(GetResolvedEid(2), *sChildren[2]);
+    sInstance->Get<AddressResolver>().UpdateSnoopedCacheEntry(GetResolvedEid(2), sChildren[5]->GetRloc16(),
+                                                             sInstance->Get<Mle::MleRouter>().GetRloc16());
+
+    VerifyOrQuit(Send(GetResolvedEid(2)) == sChildren[5]->GetRloc16());
+    VerifyCounters(1, 2, 1);
+    VerifyOrQuit(Send(GetResolvedEid(2)) == sChildren[5]->GetRloc16());
+    VerifyCounters(2, 2, 1);
+
+    // Moving a registered address to another child moves the flow.
+
+    PopulateFlow(GetChildEid(1), *sChildren[1]);
+    sChildren[1]->ClearIp6Addresses();
+    sChildren[4]->ClearIp6Addresses();
+    SuccessOrQuit(sChildren[4]->AddIp6Address(GetChildEid(1)));
+
+    VerifyOrQuit(Send(GetChildEid(1)) == sChildren[4]->GetRloc16());
+    VerifyCounters(1, 2, 1);
+    VerifyOrQuit(Send(GetChildEid(1)) == sChildren[4]->GetRloc16());
+    VerifyCounters(2, 2, 1);
+
+    // A router table change invalidates the entry.
+
+    PopulateFlow(GetChildEid(1), *sChildren[4]);
+    sInstance->Get<RouterTable>().IncrementGeneration();
+
+    VerifyOrQuit(Send(GetChildEid(1)) == sChildren[4]->GetRloc16());
+    VerifyCounters(1, 2, 1);
+
+    // Clearing the cache removes the entry.
+
+    sInstance->Get<MeshForwarder>().ClearFlowCache();
+
+    VerifyOrQuit(Send(GetChildEid(1)) == sChildren[4]->GetRloc16());
+    VerifyCounters(1, 3, 1);
+
+    otThreadResetFlowCacheCounters(sInstance);
+    VerifyCounters(0, 0, 0);
+
+    FinalizeTest();
+
+    printf("\n -- PASS\n");
+}
+
+void TestFlowCachePerformance(void)
+{
+    // Sends bursts of messages round-robin to the children, addressed
+    // by RLOC, by registered address and by EID resolved from the
+    // address cache, and compares the time spent per message when the
+    // flow cache is used against when every lookup misses (by bumping
+    // the router table generation before each message).
+
+    static constexpr uint32_t kNumRounds   = 500;
+    static constexpr uint16_t kNumFlows    = 3 * kNumChildren;
+    static constexpr uint16_t kBurstLength = 4;
+    static constexpr uint32_t kNumMessages = kNumRounds * kNumFlows * kBurstLength;
+
+    Ip6::Address destinations[kNumFlows];
+    uint64_t     startTime;
+    uint64_t     hitDuration;
+    uint64_t     missDuration;
+
+    printf("\nTestFlowCachePerformance");
+
+    InitTest();
+
+    for (uint16_t i = 0; i < kNumChildren; i++)
+    {
+        destinations[3 * i]     = GetChildRloc(i);
+        destinations[3 * i + 1] = GetChildEid(i);
+        destinations[3 * i + 2] = GetResolvedEid(i);
+    }
+
+    otThreadResetFlowCacheCounters(sInstance);
+
+    startTime = GetMonotonicNsec();
+
+    for (uint32_t round = 0; round < kNumRounds; round++)
+    {
+        for (uint16_t i = 0; i < kNumFlows; i++)
+        {
+            for (uint16_t burst = 0; burst < kBurstLength; burst++)
+            {
+                VerifyOrQuit(Send(destinations[i]) == sChildren[i / 3]->GetRloc16());
+            }
+        }
+    }
+
+    hitDuration = GetMonotonicNsec() - startTime;
+
+    // Destinations may share a cache entry, so the first message of a
+    // burst may miss.
+    VerifyOrQuit(GetCounters().mHits + GetCounters().mMisses == kNumMessages);
+    VerifyOrQuit(GetCounters().mHits >= kNumMessages / kBurstLength * (kBurstLength - 1));
+
+    printf("\n  %u flows, %lu messages: hit rate %lu%%", kNumFlows, ToUlong(kNumMessages),
+           ToUlong(GetCounters().mHits * 100 / kNumMessages));
+
+    otThreadResetFlowCacheCounters(sInstance);
+
+    startTime = GetMonotonicNsec();
+
+    for (uint32_t round = 0; round < kNumRounds; round++)
+    {
+        for (uint16_t i = 0; i < kNumFlows; i++)
+        {
+            for (uint16_t burst = 0; burst < kBurstLength; burst++)
+            {
+                sInstance->Get<RouterTable>().IncrementGeneration();
+                VerifyOrQuit(Send(destinations[i]) == sChildren[i / 3]->GetRloc16());
+            }
+        }
+    }
+
+    missDuration = GetMonotonicNsec() - startTime;
+
+    VerifyOrQuit(GetCounters().mHits == 0);
+
+    printf("\n  flow cache %lu ns, no flow cache %lu ns per message",
+           ToUlong(static_cast<uint32_t>(hitDuration / kNumMessages)),
+           ToUlong(static_cast<uint32_t>(missDuration / kNumMessages)));
+
+    FinalizeTest();
+
+    printf("\n -- PASS\n");
+}
+
+} // namespace ot
+
+#endif // ENABLE_FLOW_CACHE_TEST
+
+int main(void)
+{
+#if ENABLE_FLOW_CACHE_TEST
+    ot::TestFlowCache();
+
+    if (IsBenchmarkEnabled())
+    {
+        ot::TestFlowCachePerformance();
+    }
+
+    printf("\nAll tests passed.\n");
+#else
+    printf("\nFlow cache is not enabled - test skipped.\n");
+#endif
+
+    return 0;
+}
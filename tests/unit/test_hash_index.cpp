@@ -0,0 +1,195 @@
+/*
+ *  Copyright (c) 2023, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string.h>
+
+#include "test_platform.h"
+
+#include <openthread/config.h>
+
+#include "common/hash_index.hpp"
+
+#include "test_util.h"
+
+namespace ot {
+
+enum : uint16_t
+{
+    kNumEntries = 16,
+    kNumBuckets = 5,
+};
+
+typedef HashIndex<kNumEntries, kNumBuckets> TestHashIndex;
+
+static uint32_t sKeys[kNumEntries];
+
+static uint32_t HashOf(uint16_t aIndex) { return TestHashIndex::CalculateHash(&sKeys[aIndex], sizeof(sKeys[aIndex])); }
+
+static uint16_t Find(const TestHashIndex &aHashIndex, uint32_t aKey)
+{
+    uint32_t hash  = TestHashIndex::CalculateHash(&aKey, sizeof(aKey));
+    uint16_t index = aHashIndex.GetFirst(hash);
+
+    while ((index != TestHashIndex::kInvalidIndex) && (sKeys[index] != aKey))
+    {
+        index = aHashIndex.GetNext(index);
+    }
+
+    return index;
+}
+
+static uint16_t CountEntries(const TestHashIndex &aHashIndex)
+{
+    uint16_t count = 0;
+
+    // All hash values map to one of `kNumBuckets` buckets, so use
+    // `0..kNumBuckets-1` as hash values to visit every bucket.
+
+    for (uint32_t hash = 0; hash < kNumBuckets; hash++)
+    {
+        for (uint16_t index = aHashIndex.GetFirst(hash); index != TestHashIndex::kInvalidIndex;
+             index          = aHashIndex.GetNext(index))
+        {
+            VerifyOrQuit(index < kNumEntries);
+            VerifyOrQuit(HashOf(index) % kNumBuckets == hash);
+            count++;
+        }
+    }
+
+    return count;
+}
+
+void TestHashIndexCalculateHash(void)
+{
+    static const char kString[] = "openthread";
+
+    uint8_t bytes[sizeof(kString)];
+
+    printf("\nTestHashIndexCalculateHash()");
+
+    // Known FNV-1a (32-bit) values.
+    VerifyOrQuit(TestHashIndex::CalculateHash(nullptr, 0) == 0x811c9dc5);
+    VerifyOrQuit(TestHashIndex::CalculateHash("a", 1) == 0xe40c292c);
+    VerifyOrQuit(TestHashIndex::CalculateHash("foobar", 6) == 0xbf9cf968);
+
+    memcpy(bytes, kString, sizeof(bytes));
+    VerifyOrQuit(TestHashIndex::CalculateHash(bytes, sizeof(bytes)) ==
+                 TestHashIndex::CalculateHash(kString, sizeof(kString)));
+
+    bytes[0]++;
+    VerifyOrQuit(TestHashIndex::CalculateHash(bytes, sizeof(bytes)) !=
+                 TestHashIndex::CalculateHash(kString, sizeof(kString)));
+
+    printf(" -- PASS\n");
+}
+
+void TestHashIndexAddRemove(void)
+{
+    TestHashIndex hashIndex;
+
+    printf("TestHashIndexAddRemove()");
+
+    for (uint16_t i = 0; i < kNumEntries; i++)
+    {
+        sKeys[i] = 1000 + 7 * i;
+        VerifyOrQuit(Find(hashIndex, sKeys[i]) == TestHashIndex::kInvalidIndex);
+    }
+
+    VerifyOrQuit(CountEntries(hashIndex) == 0);
+
+    for (uint16_t i = 0; i < kNumEntries; i++)
+    {
+        VerifyOrQuit(!hashIndex.Contains(i));
+        hashIndex.Add(i, HashOf(i));
+        VerifyOrQuit(hashIndex.Contains(i));
+        VerifyOrQuit(CountEntries(hashIndex) == i + 1);
+
+        for (uint16_t j = 0; j < kNumEntries; j++)
+        {
+            VerifyOrQuit(Find(hashIndex, sKeys[j]) == ((j <= i) ? j : TestHashIndex::kInvalidIndex));
+        }
+    }
+
+    // Remove even entries (from a mix of positions in bucket chains).
+
+    for (uint16_t i = 0; i < kNumEntries; i += 2)
+    {
+        hashIndex.Remove(i);
+    }
+
+    VerifyOrQuit(CountEntries(hashIndex) == kNumEntries / 2);
+
+    for (uint16_t i = 0; i < kNumEntries; i++)
+    {
+        VerifyOrQuit(Find(hashIndex, sKeys[i]) == ((i % 2) ? i : TestHashIndex::kInvalidIndex));
+    }
+
+    // Removing an index not in the hash index is a no-op.
+
+    hashIndex.Remove(0);
+    VerifyOrQuit(CountEntries(hashIndex) == kNumEntries / 2);
+
+    // Re-add an index with a new key.
+
+    sKeys[0] = 5555;
+    hashIndex.Add(0, HashOf(0));
+    VerifyOrQuit(Find(hashIndex, 5555) == 0);
+    VerifyOrQuit(CountEntries(hashIndex) == kNumEntries / 2 + 1);
+
+    // Change the key of an added index, then remove it (without the
+    // old hash) and add it again with the new key.
+
+    sKeys[1] = 7777;
+    hashIndex.Remove(1);
+    VerifyOrQuit(!hashIndex.Contains(1));
+    hashIndex.Add(1, HashOf(1));
+    VerifyOrQuit(Find(hashIndex, 7777) == 1);
+    VerifyOrQuit(CountEntries(hashIndex) == kNumEntries / 2 + 1);
+
+    hashIndex.Clear();
+    VerifyOrQuit(CountEntries(hashIndex) == 0);
+    VerifyOrQuit(!hashIndex.Contains(1));
+
+    for (uint16_t i = 0; i < kNumEntries; i++)
+    {
+        VerifyOrQuit(Find(hashIndex, sKeys[i]) == TestHashIndex::kInvalidIndex);
+    }
+
+    printf(" -- PASS\n");
+}
+
+} // namespace ot
+
+int main(void)
+{
+    ot::TestHashIndexCalculateHash();
+    ot::TestHashIndexAddRemove();
+
+    printf("\nAll tests passed.\n");
+    return 0;
+}
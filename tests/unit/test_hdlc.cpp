@@ -30,10 +30,12 @@
 
 #include "common/code_utils.hpp"
 #include "common/instance.hpp"
+#include "common/num_utils.hpp"
 #include "lib/hdlc/hdlc.hpp"
 #include "lib/spinel/multi_frame_buffer.hpp"
+#include "lib/spinel/openthread-spinel-config.h"
 
-#include "test_util.h"
+#include "test_util.hpp"
 
 namespace ot {
 namespace Ncp {
@@ -642,6 +644,521 @@ void TestFuzzEncoderDecoder(void)
     printf(" -- PASS\n");
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+// Reference (byte-at-a-time) HDLC-lite encoder and decoder, used to verify that `Hdlc::Encoder` and `Hdlc::Decoder`
+// produce byte-exact results and as the baseline for the benchmark.
+
+static uint16_t sReferenceFcsTable[256];
+
+static void InitReferenceFcsTable(void)
+{
+    for (uint16_t i = 0; i < 256; i++)
+    {
+        uint16_t fcs = i;
+
+        for (uint8_t bit = 0; bit < 8; bit++)
+        {
+            fcs = (fcs & 1) ? ((fcs >> 1) ^ 0x8408) : (fcs >> 1);
+        }
+
+        sReferenceFcsTable[i] = fcs;
+    }
+}
+
+static uint16_t ReferenceUpdateFcs(uint16_t aFcs, uint8_t aByte)
+{
+    return (aFcs >> 8) ^ sReferenceFcsTable[(aFcs ^ aByte) & 0xff];
+}
+
+static bool ReferenceNeedsEscape(uint8_t aByte)
+{
+    return (aByte == kFlagXOn) || (aByte == kFlagXOff) || (aByte == kEscapeSequence) || (aByte == kFlagSequence) ||
+           (aByte == kFlagSpecial);
+}
+
+static otError ReferenceEncodeByte(uint8_t aByte, uint16_t &aFcs, Spinel::FrameWritePointer &aWritePointer)
+{
+    otError error = OT_ERROR_NONE;
+
+    if (ReferenceNeedsEscape(aByte))
+    {
+        VerifyOrExit(aWritePointer.CanWrite(2), error = OT_ERROR_NO_BUFS);
+        IgnoreError(aWritePointer.WriteByte(kEscapeSequence));
+        IgnoreError(aWritePointer.WriteByte(aByte ^ 0x20));
+    }
+    else
+    {
+        SuccessOrExit(error = aWritePointer.WriteByte(aByte));
+    }
+
+    aFcs = ReferenceUpdateFcs(aFcs, aByte);
+
+exit:
+    return error;
+}
+
+static otError ReferenceEncodeFrame(const uint8_t *aFrame, uint16_t aLength, Spinel::FrameWritePointer &aWritePointer)
+{
+    otError  error    = OT_ERROR_NONE;
+    uint16_t fcs      = 0xffff;
+    uint16_t dummyFcs = 0;
+
+    SuccessOrExit(error = aWritePointer.WriteByte(kFlagSequence));
+
+    for (uint16_t i = 0; i < aLength; i++)
+    {
+        SuccessOrExit(error = ReferenceEncodeByte(aFrame[i], fcs, aWritePointer));
+    }
+
+    fcs ^= 0xffff;
+    SuccessOrExit(error = ReferenceEncodeByte(fcs & 0xff, dummyFcs, aWritePointer));
+    SuccessOrExit(error = ReferenceEncodeByte(fcs >> 8, dummyFcs, aWritePointer));
+    error = aWritePointer.WriteByte(kFlagSequence);
+
+exit:
+    return error;
+}
+
+class ReferenceDecoder
+{
+public:
+    ReferenceDecoder(Spinel::FrameWritePointer &aWritePointer, Hdlc::Decoder::FrameHandler aHandler, void *aContext)
+        : mWritePointer(aWritePointer)
+        , mFrameHandler(aHandler)
+        , mContext(aContext)
+        , mState(kStateNoSync)
+        , mFcs(0)
+        , mDecodedLength(0)
+    {
+    }
+
+    void Reset(void)
+    {
+        mState         = kStateNoSync;
+        mFcs           = 0;
+        mDecodedLength = 0;
+    }
+
+    void Decode(const uint8_t *aData, uint16_t aLength)
+    {
+        while (aLength--)
+        {
+            uint8_t byte = *aData++;
+
+            switch (mState)
+            {
+            case kStateNoSync:
+                if (byte == kFlagSequence)
+                {
+                    mState         = kStateSync;
+                    mDecodedLength = 0;
+                    mFcs           = 0xffff;
+                }
+                break;
+
+            case kStateSync:
+                if (byte == kEscapeSequence)
+                {
+                    mState = kStateEscaped;
+                }
+                else if (byte == kFlagSequence)
+                {
+                    if (mDecodedLength > 0)
+                    {
+                        otError error = OT_ERROR_PARSE;
+
+                        if ((mDecodedLength >= 2) && (mFcs == 0xf0b8))
+                        {
+                            mWritePointer.UndoLastWrites(2);
+                            error = OT_ERROR_NONE;
+                        }
+
+                        mFrameHandler(mContext, error);
+                    }
+
+                    mDecodedLength = 0;
+                    mFcs           = 0xffff;
+                }
+                else
+                {
+                    WriteDecodedByte(byte);
+                }
+                break;
+
+            case kStateEscaped:
+                if (WriteDecodedByte(byte ^ 0x20))
+                {
+                    mState = kStateSync;
+                }
+                break;
+            }
+        }
+    }
+
+private:
+    enum State : uint8_t
+    {
+        kStateNoSync,
+        kStateSync,
+        kStateEscaped,
+    };
+
+    bool WriteDecodedByte(uint8_t aByte)
+    {
+        bool written = (mWritePointer.WriteByte(aByte) == OT_ERROR_NONE);
+
+        if (written)
+        {
+            mFcs = ReferenceUpdateFcs(mFcs, aByte);
+            mDecodedLength++;
+        }
+        else
+        {
+            mFrameHandler(mContext, OT_ERROR_NO_BUFS);
+            mState = kStateNoSync;
+        }
+
+        return written;
+    }
+
+    Spinel::FrameWritePointer  &mWritePointer;
+    Hdlc::Decoder::FrameHandler mFrameHandler;
+    void                       *mContext;
+    State                       mState;
+    uint16_t                    mFcs;
+    uint16_t                    mDecodedLength;
+};
+
+// Records every decoded frame (error and content) so that the output of two decoders can be compared.
+struct DecoderLog
+{
+    static constexpr uint16_t kLogSize = 8 * kBufferSize;
+
+    void Clear(void) { mLength = 0; }
+
+    void Append(const uint8_t *aData, uint16_t aLength)
+    {
+        VerifyOrQuit(mLength + aLength <= kLogSize, "DecoderLog is full");
+        memcpy(&mLog[mLength], aData, aLength);
+        mLength += aLength;
+    }
+
+    bool operator==(const DecoderLog &aOther) const
+    {
+        return (mLength == aOther.mLength) && (memcmp(mLog, aOther.mLog, mLength) == 0);
+    }
+
+    Spinel::FrameBuffer<kBufferSize> *mBuffer;
+    uint16_t                          mLength;
+    uint8_t                           mLog[kLogSize];
+};
+
+void LogDecodedFrame(void *aContext, otError aError)
+{
+    DecoderLog &log = *static_cast<DecoderLog *>(aContext);
+    uint8_t     header[3];
+
+    header[0] = static_cast<uint8_t>(aError);
+    header[1] = static_cast<uint8_t>(log.mBuffer->GetLength() & 0xff);
+    header[2] = static_cast<uint8_t>(log.mBuffer->GetLength() >> 8);
+
+    log.Append(header, sizeof(header));
+    log.Append(log.mBuffer->GetFrame(), log.mBuffer->GetLength());
+    log.mBuffer->Clear();
+}
+
+// Generates a random frame. `aSpecialPercent` is the probability (in percent) of each byte being an HDLC special byte.
+static uint16_t GenerateFrame(uint8_t *aFrame, uint16_t aMaxLength, uint8_t aSpecialPercent)
+{
+    uint16_t length = static_cast<uint16_t>(GetRandom(aMaxLength + 1));
+
+    for (uint16_t i = 0; i < length; i++)
+    {
+        if (GetRandom(100) < aSpecialPercent)
+        {
+            aFrame[i] = sHdlcSpecials[GetRandom(sizeof(sHdlcSpecials))];
+        }
+        else
+        {
+            aFrame[i] = static_cast<uint8_t>(GetRandom(256));
+        }
+    }
+
+    return length;
+}
+
+// Fills a frame buffer so that only `aAvailable` bytes remain available.
+static void ReserveBuffer(Spinel::FrameBuffer<kBufferSize> &aBuffer, uint16_t aAvailable)
+{
+    aBuffer.Clear();
+
+    while (aBuffer.CanWrite(aAvailable + 1))
+    {
+        SuccessOrQuit(aBuffer.WriteByte(0xa5));
+    }
+}
+
+void TestEncoderEquivalence(void)
+{
+    static const uint8_t kSpecialPercents[] = {0, 2, 10, 50, 100};
+
+    uint8_t                          frame[kMaxFrameLength];
+    Spinel::FrameBuffer<kBufferSize> encoderBuffer;
+    Spinel::FrameBuffer<kBufferSize> referenceBuffer;
+    Hdlc::Encoder                    encoder(encoderBuffer);
+
+    printf("Testing Hdlc::Encoder output against byte-at-a-time reference encoder");
+
+    for (uint32_t iter = 0; iter < kFuzzTestIteration; iter++)
+    {
+        uint16_t length    = GenerateFrame(frame, kMaxFrameLength, kSpecialPercents[iter % sizeof(kSpecialPercents)]);
+        uint16_t available = kBufferSize;
+        uint16_t offset    = 0;
+        otError  error;
+        otError  referenceError;
+
+        // Every fourth iteration, limit the space in both buffers to
+        // exercise the out-of-buffer behavior.
+
+        if ((iter % 4) == 3)
+        {
+            available = static_cast<uint16_t>(GetRandom(2 * length + 8));
+        }
+
+        ReserveBuffer(encoderBuffer, available);
+        ReserveBuffer(referenceBuffer, available);
+
+        referenceError = ReferenceEncodeFrame(frame, length, referenceBuffer);
+
+        // Feed the frame to the encoder in randomly sized pieces,
+        // mixing single byte and multi-byte `Encode()` calls.
+
+        error = encoder.BeginFrame();
+
+        while ((error == OT_ERROR_NONE) && (offset < length))
+        {
+            uint16_t pieceLength = static_cast<uint16_t>(GetRandom(length - offset) + 1);
+            uint16_t oldLength   = encoderBuffer.GetLength();
+
+            if (pieceLength == 1)
+            {
+                error = encoder.Encode(frame[offset]);
+            }
+            else
+            {
+                error = encoder.Encode(&frame[offset], pieceLength);
+            }
+
+            if (error != OT_ERROR_NONE)
+            {
+                VerifyOrQuit(error == OT_ERROR_NO_BUFS);
+                VerifyOrQuit(encoderBuffer.GetLength() == oldLength, "Encode() failure did not restore the buffer");
+            }
+
+            offset += pieceLength;
+        }
+
+        if (error == OT_ERROR_NONE)
+        {
+            error = encoder.EndFrame();
+        }
+
+        VerifyOrQuit(error == referenceError, "Encoder error does not match the reference encoder");
+
+        if (error == OT_ERROR_NONE)
+        {
+            VerifyOrQuit(encoderBuffer.GetLength() == referenceBuffer.GetLength());
+            VerifyOrQuit(memcmp(encoderBuffer.GetFrame(), referenceBuffer.GetFrame(), encoderBuffer.GetLength()) == 0,
+                         "Encoded frame does not match the reference encoder");
+        }
+    }
+
+    printf(" -- PASS\n");
+}
+
+void TestDecoderEquivalence(void)
+{
+    static constexpr uint16_t kStreamSize = 4 * kBufferSize;
+
+    uint8_t                          frame[kMaxFrameLength];
+    uint8_t                          stream[kStreamSize];
+    Spinel::FrameBuffer<kBufferSize> encoderBuffer;
+    Spinel::FrameBuffer<kBufferSize> decoderBuffer;
+    Spinel::FrameBuffer<kBufferSize> referenceBuffer;
+    Hdlc::Encoder                    encoder(encoderBuffer);
+    DecoderLog                       log;
+    DecoderLog                       referenceLog;
+    Hdlc::Decoder                    decoder(decoderBuffer, LogDecodedFrame, &log);
+    ReferenceDecoder                 referenceDecoder(referenceBuffer, LogDecodedFrame, &referenceLog);
+
+    printf("Testing Hdlc::Decoder output against byte-at-a-time reference decoder");
+
+    log.mBuffer          = &decoderBuffer;
+    referenceLog.mBuffer = &referenceBuffer;
+
+    for (uint32_t iter = 0; iter < kFuzzTestIteration / 10; iter++)
+    {
+        uint16_t streamLength = 0;
+        uint16_t offset       = 0;
+        uint16_t available    = kBufferSize;
+
+        // Build a stream of several encoded frames, some of them
+        // corrupted, with random junk in between.
+
+        while (true)
+        {
+            uint16_t length = GenerateFrame(frame, kMaxFrameLength / 2, (iter % 3 == 0) ? 0 : 10);
+
+            encoderBuffer.Clear();
+            SuccessOrQuit(encoder.BeginFrame());
+            SuccessOrQuit(encoder.Encode(frame, length));
+            SuccessOrQuit(encoder.EndFrame());
+
+            if (streamLength + encoderBuffer.GetLength() + 8 > kStreamSize)
+            {
+                break;
+            }
+
+            memcpy(&stream[streamLength], encoderBuffer.GetFrame(), encoderBuffer.GetLength());
+
+            if (GetRandom(4) == 0)
+            {
+                // Corrupt a random byte (possibly turning it into an HDLC Flag or Escape).
+                stream[streamLength + GetRandom(encoderBuffer.GetLength())] = (GetRandom(2) == 0)
+                                                                                  ? static_cast<uint8_t>(GetRandom(256))
+                                                                                  : sHdlcSpecials[GetRandom(6)];
+            }
+
+            streamLength += encoderBuffer.GetLength();
+
+            for (uint16_t junk = static_cast<uint16_t>(GetRandom(8)); junk > 0; junk--)
+            {
+                stream[streamLength++] = static_cast<uint8_t>(GetRandom(256));
+            }
+        }
+
+        // Every fourth iteration, limit the space in both decoder
+        // buffers to exercise the out-of-buffer behavior.
+
+        if ((iter % 4) == 3)
+        {
+            available = static_cast<uint16_t>(GetRandom(kMaxFrameLength / 2));
+        }
+
+        ReserveBuffer(decoderBuffer, available);
+        ReserveBuffer(referenceBuffer, available);
+        log.Clear();
+        referenceLog.Clear();
+        decoder.Reset();
+        referenceDecoder.Reset();
+
+        referenceDecoder.Decode(stream, streamLength);
+
+        // Feed the stream to the decoder in randomly sized pieces.
+
+        while (offset < streamLength)
+        {
+            uint16_t pieceLength = static_cast<uint16_t>(GetRandom(streamLength - offset) + 1);
+
+            if (GetRandom(2) == 0)
+            {
+                pieceLength = static_cast<uint16_t>(GetRandom(Min<uint16_t>(streamLength - offset, 16)) + 1);
+            }
+
+            decoder.Decode(&stream[offset], pieceLength);
+            offset += pieceLength;
+        }
+
+        VerifyOrQuit(log.mLength > 0);
+        VerifyOrQuit(log == referenceLog, "Decoded frames do not match the reference decoder");
+        VerifyOrQuit(decoderBuffer.GetLength() == referenceBuffer.GetLength());
+        VerifyOrQuit(memcmp(decoderBuffer.GetFrame(), referenceBuffer.GetFrame(), decoderBuffer.GetLength()) == 0);
+    }
+
+    printf(" -- PASS\n");
+}
+
+void TestEncoderDecoderPerformance(void)
+{
+    static constexpr uint16_t kFrameLengths[] = {127, 1280};
+    static constexpr uint32_t kNumBytes       = 20 * 1000 * 1000;
+
+    uint8_t                          frame[1280];
+    Spinel::FrameBuffer<kBufferSize> encoderBuffer;
+    Spinel::FrameBuffer<kBufferSize> decoderBuffer;
+    Hdlc::Encoder                    encoder(encoderBuffer);
+    DecoderContext                   decoderContext;
+    Hdlc::Decoder                    decoder(decoderBuffer, ProcessDecodedFrame, &decoderContext);
+    ReferenceDecoder                 referenceDecoder(decoderBuffer, ProcessDecodedFrame, &decoderContext);
+
+    printf("TestEncoderDecoderPerformance -- %s, %s\n",
+           OPENTHREAD_SPINEL_CONFIG_HDLC_SIMD_ENABLE ? "SIMD enabled" : "SIMD disabled",
+           OPENTHREAD_SPINEL_CONFIG_HDLC_FCS_SLICING_BY_8_ENABLE ? "slicing-by-8 FCS" : "byte-at-a-time FCS");
+
+    for (uint16_t frameLength : kFrameLengths)
+    {
+        uint32_t numRounds = kNumBytes / frameLength;
+        uint64_t startTime;
+        uint64_t times[4];
+
+        // Random data has about 2% bytes needing escape.
+
+        for (uint16_t i = 0; i < frameLength; i++)
+        {
+            frame[i] = static_cast<uint8_t>(GetRandom(256));
+        }
+
+        startTime = GetMonotonicNsec();
+
+        for (uint32_t round = 0; round < numRounds; round++)
+        {
+            encoderBuffer.Clear();
+            IgnoreError(ReferenceEncodeFrame(frame, frameLength, encoderBuffer));
+        }
+
+        times[0]  = GetMonotonicNsec() - startTime;
+        startTime = GetMonotonicNsec();
+
+        for (uint32_t round = 0; round < numRounds; round++)
+        {
+            encoderBuffer.Clear();
+            SuccessOrQuit(encoder.BeginFrame());
+            SuccessOrQuit(encoder.Encode(frame, frameLength));
+            SuccessOrQuit(encoder.EndFrame());
+        }
+
+        times[1]  = GetMonotonicNsec() - startTime;
+        startTime = GetMonotonicNsec();
+
+        for (uint32_t round = 0; round < numRounds; round++)
+        {
+            decoderBuffer.Clear();
+            referenceDecoder.Decode(encoderBuffer.GetFrame(), encoderBuffer.GetLength());
+        }
+
+        times[2]  = GetMonotonicNsec() - startTime;
+        startTime = GetMonotonicNsec();
+
+        for (uint32_t round = 0; round < numRounds; round++)
+        {
+            decoderBuffer.Clear();
+            decoder.Decode(encoderBuffer.GetFrame(), encoderBuffer.GetLength());
+        }
+
+        times[3] = GetMonotonicNsec() - startTime;
+
+        VerifyOrQuit(decoderContext.mError == OT_ERROR_NONE);
+        VerifyOrQuit(decoderBuffer.GetLength() == frameLength);
+        VerifyOrQuit(memcmp(decoderBuffer.GetFrame(), frame, frameLength) == 0);
+
+        printf("  %4u-byte frames: encode %5.2f -> %5.2f ns/byte, decode %5.2f -> %5.2f ns/byte\n", frameLength,
+               static_cast<double>(times[0]) / (numRounds * frameLength),
+               static_cast<double>(times[1]) / (numRounds * frameLength),
+               static_cast<double>(times[2]) / (numRounds * frameLength),
+               static_cast<double>(times[3]) / (numRounds * frameLength));
+    }
+}
+
 } // namespace Ncp
 } // namespace ot
 
@@ -651,6 +1168,15 @@ int main(void)
     ot::Ncp::TestSpinelMultiFrameBuffer();
     ot::Ncp::TestEncoderDecoder();
     ot::Ncp::TestFuzzEncoderDecoder();
+    ot::Ncp::InitReferenceFcsTable();
+    ot::Ncp::TestEncoderEquivalence();
+    ot::Ncp::TestDecoderEquivalence();
+
+    if (IsBenchmarkEnabled())
+    {
+        ot::Ncp::TestEncoderDecoderPerformance();
+    }
+
     printf("\nAll tests passed.\n");
     return 0;
 }
@@ -36,7 +36,7 @@
 #include "crypto/aes_ccm.hpp"
 
 #include "test_platform.h"
-#include "test_util.h"
+#include "test_util.hpp"
 
 #if !OPENTHREAD_CONFIG_HEAP_EXTERNAL_ENABLE
 
@@ -50,6 +50,9 @@ void TestAllocateSingle(void)
 
     const size_t totalSize = heap.GetFreeSize();
 
+    VerifyOrQuit(heap.IsClean() && totalSize == heap.GetCapacity());
+    VerifyOrQuit(heap.GetNumFreeBlocks() == 1 && heap.GetLargestFreeBlockSize() == heap.GetCapacity());
+
     {
         void *p = heap.CAlloc(1, 0);
         VerifyOrQuit(p == nullptr && totalSize == heap.GetFreeSize(), "TestAllocateSingle allocate 1 x 0 byte failed!");
@@ -65,10 +68,14 @@ void TestAllocateSingle(void)
         printf("%s allocating %zu bytes...\n", __func__, size);
         void *p = heap.CAlloc(1, size);
         VerifyOrQuit(p != nullptr && !heap.IsClean() && heap.GetFreeSize() + size <= totalSize, "allocating failed!");
+        VerifyOrQuit(heap.GetNumFreeBlocks() <= 1 && heap.GetLargestFreeBlockSize() == heap.GetFreeSize());
         memset(p, 0xff, size);
         heap.Free(p);
         VerifyOrQuit(heap.IsClean() && heap.GetFreeSize() == totalSize, "freeing failed!\n");
     }
+
+    VerifyOrQuit(heap.CAlloc(1, heap.GetCapacity() + 1) == nullptr);
+    VerifyOrQuit(heap.IsClean());
 }
 
 /**
@@ -140,6 +147,9 @@ void TestAllocateRandomly(size_t aSizeLimit, unsigned int aSeed)
         }
     } while (true);
 
+    VerifyOrQuit(heap.GetLargestFreeBlockSize() <= heap.GetFreeSize());
+    VerifyOrQuit((heap.GetNumFreeBlocks() == 0) == (heap.GetFreeSize() == 0));
+
     last = head.mNext;
 
     while (last)
@@ -167,10 +177,126 @@ void TestAllocateMultiple(void)
     }
 }
 
+/**
+ * Stress tests the heap with a long run of random allocations and frees of mixed sizes and reports the time per
+ * operation, the number of failed allocations and the fragmentation of the free space.
+ *
+ * Most allocations are small (e.g., `HeapString` and `HeapData` of SRP names and TXT data), some are medium-sized and
+ * a few are large (e.g., mbedTLS buffers during DTLS handshakes).
+ *
+ */
+void TestAllocateStress(void)
+{
+    static constexpr uint16_t kMaxSlots      = 256;
+    static constexpr uint32_t kNumOperations = 200000;
+
+    ot::Utils::Heap heap;
+    void           *slots[kMaxSlots];
+    size_t          sizes[kMaxSlots];
+    uint16_t        numSlots;
+    size_t          largeSizeLimit;
+    uint32_t        numAllocs        = 0;
+    uint32_t        numFailedAllocs  = 0;
+    size_t          minLargestFree   = heap.GetCapacity();
+    uint16_t        maxNumFreeBlocks = 1;
+    uint64_t        startTime;
+    uint64_t        duration;
+
+    memset(slots, 0, sizeof(slots));
+    memset(sizes, 0, sizeof(sizes));
+
+    // On average half of the slots are allocated, use enough slots to
+    // keep roughly half of the heap in use.
+
+    numSlots = static_cast<uint16_t>(heap.GetCapacity() / 256);
+    numSlots = (numSlots > kMaxSlots) ? kMaxSlots : numSlots;
+
+    largeSizeLimit = heap.GetCapacity() / 8;
+    largeSizeLimit = (largeSizeLimit > 2048) ? 2048 : largeSizeLimit;
+
+    srand(0);
+
+    startTime = GetMonotonicNsec();
+
+    for (uint32_t op = 0; op < kNumOperations; op++)
+    {
+        uint16_t index = static_cast<uint16_t>(static_cast<unsigned int>(rand()) % numSlots);
+
+        if (slots[index] != nullptr)
+        {
+            heap.Free(slots[index]);
+            slots[index] = nullptr;
+        }
+        else
+        {
+            unsigned int kind = static_cast<unsigned int>(rand()) % 100;
+            size_t       size;
+
+            if (kind < 70)
+            {
+                size = 8 + static_cast<size_t>(rand()) % 56;
+            }
+            else if (kind < 95)
+            {
+                size = 64 + static_cast<size_t>(rand()) % 448;
+            }
+            else
+            {
+                size = 512 + static_cast<size_t>(rand()) % (largeSizeLimit - 511);
+            }
+
+            numAllocs++;
+            slots[index] = heap.CAlloc(1, size);
+            sizes[index] = size;
+
+            if (slots[index] == nullptr)
+            {
+                numFailedAllocs++;
+            }
+        }
+
+        if ((op % 1024) == 0)
+        {
+            size_t   largestFree   = heap.GetLargestFreeBlockSize();
+            uint16_t numFreeBlocks = heap.GetNumFreeBlocks();
+
+            minLargestFree   = (largestFree < minLargestFree) ? largestFree : minLargestFree;
+            maxNumFreeBlocks = (numFreeBlocks > maxNumFreeBlocks) ? numFreeBlocks : maxNumFreeBlocks;
+        }
+    }
+
+    duration = GetMonotonicNsec() - startTime;
+
+    printf("TestAllocateStress: %s heap, capacity %zu bytes\n",
+           OPENTHREAD_CONFIG_HEAP_TLSF_ENABLE ? "TLSF" : "first-fit", heap.GetCapacity());
+    printf("  %lu ops, %llu ns/op, %lu/%lu allocations failed\n",
+           static_cast<unsigned long>(kNumOperations), static_cast<unsigned long long>(duration / kNumOperations),
+           static_cast<unsigned long>(numFailedAllocs), static_cast<unsigned long>(numAllocs));
+    printf("  at end: free %zu bytes in %u blocks, largest free block %zu bytes\n", heap.GetFreeSize(),
+           heap.GetNumFreeBlocks(), heap.GetLargestFreeBlockSize());
+    printf("  during run: min largest free block %zu bytes, max free blocks %u\n", minLargestFree, maxNumFreeBlocks);
+
+    for (uint16_t index = 0; index < numSlots; index++)
+    {
+        if (slots[index] != nullptr)
+        {
+            uint8_t *bytes = static_cast<uint8_t *>(slots[index]);
+
+            // The memory was zeroed on allocation.
+            VerifyOrQuit(bytes[0] == 0 && bytes[sizes[index] - 1] == 0);
+            heap.Free(slots[index]);
+        }
+    }
+
+    VerifyOrQuit(heap.IsClean() && heap.GetFreeSize() == heap.GetCapacity(), "heap not clean after freeing all!");
+    VerifyOrQuit(heap.GetNumFreeBlocks() == 1 && heap.GetLargestFreeBlockSize() == heap.GetCapacity());
+}
+
 void RunTimerTests(void)
 {
     TestAllocateSingle();
     TestAllocateMultiple();
+    TestAllocateStress();
 }
 
 #endif // !OPENTHREAD_CONFIG_HEAP_EXTERNAL_ENABLE
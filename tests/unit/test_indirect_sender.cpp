@@ -0,0 +1,262 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "test_platform.h"
+
+#include <openthread/config.h>
+
+#include "test_util.hpp"
+#include "common/array.hpp"
+#include "common/code_utils.hpp"
+#include "common/instance.hpp"
+#include "common/message.hpp"
+#include "thread/indirect_sender.hpp"
+
+namespace ot {
+
+static Instance *sInstance;
+
+// The messages used by the tests are kept in a local `PriorityQueue`
+// (standing in for the `MeshForwarder` send queue), which provides
+// the expected order of the per-child indirect queues.
+
+class IndirectSenderTester
+{
+public:
+    static void Add(Message &aMessage, uint16_t aChildIndex)
+    {
+        aMessage.SetChildMask(aChildIndex);
+        Get().AddToChildQueue(aMessage, aChildIndex);
+    }
+
+    static void Remove(Message &aMessage, uint16_t aChildIndex)
+    {
+        aMessage.ClearChildMask(aChildIndex);
+        Get().RemoveFromChildQueue(aMessage, aChildIndex);
+    }
+
+    static Message *Pop(uint16_t aChildIndex)
+    {
+        Message *message = Get().PopFromChildQueue(aChildIndex);
+
+        if (message != nullptr)
+        {
+            message->ClearChildMask(aChildIndex);
+        }
+
+        return message;
+    }
+
+    static Message *Find(uint16_t aChildIndex)
+    {
+        return Get().FindIndirectMessage(*sInstance->Get<ChildTable>().GetChildAtIndex(aChildIndex));
+    }
+
+    static void VerifyChildQueue(uint16_t aChildIndex, const PriorityQueue &aSendQueue)
+    {
+        const IndirectSender::QueueEntry *entry = Get().mChildQueues[aChildIndex].GetHead();
+
+        VerifyOrQuit(!Get().mQueueOverflowMask.Get(aChildIndex));
+
+        for (const Message &message : aSendQueue)
+        {
+            if (!message.GetChildMask(aChildIndex))
+            {
+                continue;
+            }
+
+            VerifyOrQuit(entry != nullptr, "child queue is missing a message");
+            VerifyOrQuit(entry->mMessage == &message, "child queue order does not match the send queue");
+            entry = entry->GetNext();
+        }
+
+        VerifyOrQuit(entry == nullptr, "child queue has an extra message");
+    }
+
+    static void Clear(void) { Get().ClearAllChildQueues(); }
+
+private:
+    static IndirectSender &Get(void) { return sInstance->Get<IndirectSender>(); }
+};
+
+static constexpr uint16_t kNumChildren = 4;
+static constexpr uint16_t kNumMessages = 12;
+
+static void VerifyAllChildQueues(const PriorityQueue &aSendQueue)
+{
+    for (uint16_t childIndex = 0; childIndex < kNumChildren; childIndex++)
+    {
+        IndirectSenderTester::VerifyChildQueue(childIndex, aSendQueue);
+    }
+}
+
+void TestIndirectSenderChildQueues(void)
+{
+    static const Message::Priority kPriorities[] = {
+        Message::kPriorityNormal, Message::kPriorityLow, Message::kPriorityHigh, Message::kPriorityNet,
+    };
+
+    MessagePool  *messagePool;
+    PriorityQueue sendQueue;
+    Message      *messages[kNumMessages];
+
+    printf("TestIndirectSenderChildQueues()");
+
+    sInstance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(sInstance != nullptr);
+
+    messagePool = &sInstance->Get<MessagePool>();
+
+    static_assert(kNumChildren <= OPENTHREAD_CONFIG_MLE_MAX_CHILDREN, "kNumChildren is larger than max children");
+
+    // Queue messages of mixed priorities, each for a different subset
+    // of children (message `i` goes to child `c` when bit `c` of `i + 1`
+    // is set), in the same order as they enter the send queue.
+
+    for (uint16_t i = 0; i < kNumMessages; i++)
+    {
+        messages[i] = messagePool->Allocate(Message::kTypeIp6);
+        VerifyOrQuit(messages[i] != nullptr);
+        SuccessOrQuit(messages[i]->SetPriority(kPriorities[i % GetArrayLength(kPriorities)]));
+        sendQueue.Enqueue(*messages[i]);
+
+        for (uint16_t childIndex = 0; childIndex < kNumChildren; childIndex++)
+        {
+            if ((i + 1) & (1 << childIndex))
+            {
+                IndirectSenderTester::Add(*messages[i], childIndex);
+            }
+        }
+    }
+
+    VerifyAllChildQueues(sendQueue);
+
+    for (uint16_t childIndex = 0; childIndex < kNumChildren; childIndex++)
+    {
+        Message *expected = nullptr;
+
+        for (Message &message : sendQueue)
+        {
+            if (message.GetChildMask(childIndex))
+            {
+                expected = &message;
+                break;
+            }
+        }
+
+        VerifyOrQuit(IndirectSenderTester::Find(childIndex) == expected);
+    }
+
+    // Remove a message from one child only.
+
+    VerifyOrQuit(messages[2]->GetChildMask(0) && messages[2]->GetChildMask(1));
+    IndirectSenderTester::Remove(*messages[2], 1);
+    VerifyOrQuit(!messages[2]->GetChildMask(1));
+    VerifyAllChildQueues(sendQueue);
+
+    // Remove a message from all children and from the send queue.
+
+    sInstance->Get<IndirectSender>().RemoveMessageFromAllSleepyChildren(*messages[6]);
+    VerifyOrQuit(!messages[6]->IsChildPending());
+    sendQueue.DequeueAndFree(*messages[6]);
+    messages[6] = nullptr;
+    VerifyAllChildQueues(sendQueue);
+
+    // Change the priority of queued messages, the child queues must
+    // follow the new send queue order.
+
+    SuccessOrQuit(messages[0]->SetPriority(Message::kPriorityNet));
+    VerifyAllChildQueues(sendQueue);
+
+    SuccessOrQuit(messages[3]->SetPriority(Message::kPriorityLow));
+    VerifyAllChildQueues(sendQueue);
+
+    SuccessOrQuit(messages[10]->SetPriority(Message::kPriorityNormal));
+    VerifyAllChildQueues(sendQueue);
+
+    // Pop all messages of one child, they must come out in the send
+    // queue order.
+
+    while (true)
+    {
+        Message *expected = nullptr;
+        Message *message;
+
+        for (Message &msg : sendQueue)
+        {
+            if (msg.GetChildMask(3))
+            {
+                expected = &msg;
+                break;
+            }
+        }
+
+        message = IndirectSenderTester::Pop(3);
+        VerifyOrQuit(message == expected);
+
+        if (message == nullptr)
+        {
+            break;
+        }
+
+        VerifyAllChildQueues(sendQueue);
+    }
+
+    VerifyOrQuit(IndirectSenderTester::Find(3) == nullptr);
+
+    // Remove the remaining messages from all children.
+
+    for (Message *message : messages)
+    {
+        if (message != nullptr)
+        {
+            sInstance->Get<IndirectSender>().RemoveMessageFromAllSleepyChildren(*message);
+        }
+    }
+
+    for (uint16_t childIndex = 0; childIndex < kNumChildren; childIndex++)
+    {
+        VerifyOrQuit(IndirectSenderTester::Find(childIndex) == nullptr);
+        IndirectSenderTester::VerifyChildQueue(childIndex, sendQueue);
+    }
+
+    IndirectSenderTester::Clear();
+    sendQueue.DequeueAndFreeAll();
+    testFreeInstance(sInstance);
+
+    printf(" -- PASS\n");
+}
+
+} // namespace ot
+
+int main(void)
+{
+    ot::TestIndirectSenderChildQueues();
+    printf("All tests passed\n");
+    return 0;
+}
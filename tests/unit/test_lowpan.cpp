@@ -210,7 +210,7 @@ static void Test(TestIphcVector &aVector, bool aCompress, bool aDecompress)
 
             if (ecn != Ip6::kEcnNotCapable)
             {
-                sLowpan->MarkCompressedEcn(*compressedMsg, /*a aOffset */ 0);
+                SuccessOrQuit(sLowpan->MarkCompressedEcn(*compressedMsg, /*a aOffset */ 0));
                 ecn = sLowpan->DecompressEcn(*compressedMsg, /* aOffset */ 0);
                 VerifyOrQuit(ecn == Ip6::kEcnMarked);
                 printf("ECN is updated to %d\n", ecn);
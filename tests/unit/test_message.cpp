@@ -31,6 +31,7 @@
 #include "common/instance.hpp"
 #include "common/message.hpp"
 #include "common/random.hpp"
+#include "common/tlvs.hpp"
 
 #include "test_platform.h"
 #include "test_util.hpp"
@@ -398,12 +399,561 @@ void TestAppender(void)
     testFreeInstance(instance);
 }
 
+void TestMessageDataChunks(void)
+{
+    static constexpr uint16_t kMessageSize = kBufferSize * 3 + 24;
+    static constexpr uint16_t kMaxChunks   = 8;
+
+    Instance               *instance;
+    Message                *message;
+    uint8_t                 writeBuffer[kMessageSize];
+    uint8_t                 readBuffer[kMessageSize];
+    Data<kWithUint16Length> chunks[kMaxChunks];
+    uint16_t                numChunks;
+
+    printf("TestMessageDataChunks\n");
+
+    instance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(instance != nullptr);
+
+    Random::NonCrypto::FillBuffer(writeBuffer, kMessageSize);
+
+    VerifyOrQuit((message = instance->Get<MessagePool>().Allocate(Message::kTypeIp6)) != nullptr);
+    SuccessOrQuit(message->AppendBytes(writeBuffer, kMessageSize));
+
+    for (uint16_t offset = 0; offset <= kMessageSize; offset += 7)
+    {
+        for (uint16_t length = 0; length <= kMessageSize - offset; length += 13)
+        {
+            uint16_t readLength = 0;
+
+            numChunks = kMaxChunks;
+            SuccessOrQuit(message->GetDataChunks(offset, length, chunks, numChunks));
+            VerifyOrQuit(numChunks <= message->GetBufferCount());
+
+            for (uint16_t i = 0; i < numChunks; i++)
+            {
+                VerifyOrQuit(chunks[i].GetLength() > 0);
+                chunks[i].CopyBytesTo(&readBuffer[readLength]);
+                readLength += chunks[i].GetLength();
+            }
+
+            VerifyOrQuit(readLength == length);
+            VerifyOrQuit(memcmp(readBuffer, &writeBuffer[offset], length) == 0);
+        }
+    }
+
+    numChunks = kMaxChunks;
+    VerifyOrQuit(message->GetDataChunks(1, kMessageSize, chunks, numChunks) == kErrorParse);
+
+    numChunks = 1;
+    VerifyOrQuit(message->GetDataChunks(0, kMessageSize, chunks, numChunks) == kErrorNoBufs);
+
+    message->Free();
+    testFreeInstance(instance);
+}
+
+void TestMessageSequentialRead(void)
+{
+    static constexpr uint16_t kMessageSize   = 1280;
+    static constexpr uint16_t kReadLength    = 2;
+    static constexpr uint16_t kNumIterations = 2000;
+    static constexpr uint8_t  kLastTlvType   = 0xfe;
+
+    typedef UintTlvInfo<0, uint8_t>            FillerTlv;
+    typedef UintTlvInfo<kLastTlvType, uint8_t> LastTlv;
+
+    Instance    *instance;
+    MessagePool *messagePool;
+    Message     *message;
+    uint8_t      writeBuffer[kMessageSize];
+    uint8_t      readBuffer[kMessageSize];
+    uint64_t     startTime;
+    uint64_t     duration;
+    uint16_t     offset;
+    uint16_t     length;
+
+    printf("TestMessageSequentialRead\n");
+
+    instance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(instance != nullptr);
+
+    messagePool = &instance->Get<MessagePool>();
+
+    Random::NonCrypto::FillBuffer(writeBuffer, kMessageSize);
+
+    VerifyOrQuit((message = messagePool->Allocate(Message::kTypeIp6)) != nullptr);
+    SuccessOrQuit(message->AppendBytes(writeBuffer, kMessageSize));
+    VerifyOrQuit(message->GetBufferCount() > 2);
+
+    // Validate reads at random offsets (moving both forward and
+    // backward) while the buffer chain is modified.
+
+    for (uint16_t iter = 0; iter < kNumIterations; iter++)
+    {
+        offset = Random::NonCrypto::GetUint16InRange(0, kMessageSize);
+        length = Random::NonCrypto::GetUint16InRange(0, kMessageSize - offset + 1);
+
+        SuccessOrQuit(message->Read(offset, readBuffer, length));
+        VerifyOrQuit(memcmp(readBuffer, &writeBuffer[offset], length) == 0);
+        VerifyOrQuit(message->CompareBytes(offset, &writeBuffer[offset], length));
+
+        switch (iter % 8)
+        {
+        case 1:
+            // Shrink the message (freeing buffers) and then grow it
+            // back (allocating new buffers).
+            SuccessOrQuit(message->SetLength(offset));
+            SuccessOrQuit(message->SetLength(kMessageSize));
+            message->WriteBytes(offset, &writeBuffer[offset], kMessageSize - offset);
+            break;
+
+        case 3:
+            // Remove a header and prepend it back (inserting new
+            // buffers at the head of the chain).
+            message->RemoveHeader(length);
+            SuccessOrQuit(message->PrependBytes(writeBuffer, length));
+            break;
+
+        case 5:
+            message->WriteBytes(offset, &writeBuffer[offset], length);
+            break;
+
+        default:
+            break;
+        }
+
+        VerifyOrQuit(message->GetLength() == kMessageSize);
+    }
+
+    // Measure small sequential reads (as done by parsers) over
+    // the whole message.
+
+    startTime = GetMonotonicNsec();
+
+    for (uint16_t iter = 0; iter < kNumIterations; iter++)
+    {
+        for (offset = 0; offset < kMessageSize; offset += kReadLength)
+        {
+            SuccessOrQuit(message->Read(offset, readBuffer, kReadLength));
+        }
+    }
+
+    duration = GetMonotonicNsec() - startTime;
+
+    printf("  %u-byte message in %u buffers, sequential %u-byte reads: %llu ns/read\n", kMessageSize,
+           message->GetBufferCount(), kReadLength,
+           static_cast<unsigned long long>(duration / (kNumIterations * (kMessageSize / kReadLength))));
+
+    message->Free();
+
+    // Measure `Tlv::FindTlv()` over a message filled with small TLVs.
+
+    VerifyOrQuit((message = messagePool->Allocate(Message::kTypeIp6)) != nullptr);
+
+    while (message->GetLength() + sizeof(Tlv) * 2 + 1 <= kMessageSize)
+    {
+        SuccessOrQuit(Tlv::Append<FillerTlv>(*message, static_cast<uint8_t>(0)));
+    }
+
+    SuccessOrQuit(Tlv::Append<LastTlv>(*message, static_cast<uint8_t>(0)));
+
+    startTime = GetMonotonicNsec();
+
+    for (uint16_t iter = 0; iter < kNumIterations; iter++)
+    {
+        SuccessOrQuit(Tlv::FindTlvValueOffset(*message, kLastTlvType, offset, length));
+    }
+
+    duration = GetMonotonicNsec() - startTime;
+
+    VerifyOrQuit(offset == message->GetLength() - sizeof(uint8_t));
+    VerifyOrQuit(length == sizeof(uint8_t));
+
+    printf("  FindTlv over %u TLVs: %llu ns/search\n", (message->GetLength() - message->GetOffset()) / 3,
+           static_cast<unsigned long long>(duration / kNumIterations));
+
+    message->Free();
+    testFreeInstance(instance);
+}
+
+
+void TestMessageClone(void)
+{
+    // Clones messages and changes them (and the originals) in random
+    // ways, checking the content of every message against its
+    // expected content and (if enabled) the accounting of the
+    // buffers shared between them.
+
+    static constexpr uint16_t kMaxMessages   = 5;
+    static constexpr uint16_t kMaxSize       = 500;
+    static constexpr uint16_t kMaxHeaderSize = 40;
+    static constexpr uint16_t kNumIterations = 5000;
+
+    struct TestMessage
+    {
+        Message *mMessage;
+        uint16_t mLength;
+        uint16_t mRemovedLength; // Limits the growth of the reserved header (and of the buffers used).
+        uint8_t  mContent[kMaxSize + kMaxHeaderSize];
+    };
+
+    Instance    *instance;
+    MessagePool *messagePool;
+    TestMessage  messages[kMaxMessages];
+    uint8_t      buffer[kMaxSize + kMaxHeaderSize];
+    uint16_t     numFreeBuffers;
+
+    printf("TestMessageClone\n");
+
+    instance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(instance != nullptr);
+
+    messagePool    = &instance->Get<MessagePool>();
+    numFreeBuffers = messagePool->GetFreeBufferCount();
+
+    memset(messages, 0, sizeof(messages));
+
+    for (uint16_t iter = 0; iter < kNumIterations; iter++)
+    {
+        TestMessage &test   = messages[Random::NonCrypto::GetUint16InRange(0, kMaxMessages)];
+        TestMessage &other  = messages[Random::NonCrypto::GetUint16InRange(0, kMaxMessages)];
+        uint16_t     offset = Random::NonCrypto::GetUint16InRange(0, test.mLength + 1);
+        uint16_t     length = Random::NonCrypto::GetUint16InRange(0, test.mLength - offset + 1);
+
+        if (test.mMessage == nullptr)
+        {
+            if ((other.mMessage != nullptr) && (&other != &test))
+            {
+                length = Random::NonCrypto::GetUint16InRange(0, other.mLength + 1);
+
+                VerifyOrQuit((test.mMessage = other.mMessage->Clone(length)) != nullptr);
+                memcpy(test.mContent, other.mContent, length);
+                test.mRemovedLength = other.mRemovedLength;
+            }
+            else
+            {
+                length = Random::NonCrypto::GetUint16InRange(0, kMaxSize + 1);
+
+                VerifyOrQuit((test.mMessage = messagePool->Allocate(Message::kTypeIp6)) != nullptr);
+                Random::NonCrypto::FillBuffer(test.mContent, length);
+                SuccessOrQuit(test.mMessage->AppendBytes(test.mContent, length));
+                test.mRemovedLength = 0;
+            }
+
+            test.mLength = length;
+        }
+        else
+        {
+            switch (iter % 5)
+            {
+            case 0:
+                test.mMessage->Free();
+                test.mMessage = nullptr;
+                test.mLength  = 0;
+                break;
+
+            case 1:
+                Random::NonCrypto::FillBuffer(&test.mContent[offset], length);
+                SuccessOrQuit(test.mMessage->WriteBytes(offset, &test.mContent[offset], length));
+                break;
+
+            case 2:
+                length = Random::NonCrypto::GetUint16InRange(0, kMaxSize + 1);
+                SuccessOrQuit(test.mMessage->SetLength(length));
+
+                if (length > test.mLength)
+                {
+                    Random::NonCrypto::FillBuffer(&test.mContent[test.mLength], length - test.mLength);
+                    SuccessOrQuit(
+                        test.mMessage->WriteBytes(test.mLength, &test.mContent[test.mLength], length - test.mLength));
+                }
+
+                test.mLength = length;
+                break;
+
+            case 3:
+                length = Random::NonCrypto::GetUint16InRange(0, kMaxHeaderSize + 1);
+                VerifyOrQuit(test.mLength + length <= sizeof(test.mContent));
+
+                Random::NonCrypto::FillBuffer(buffer, length);
+                SuccessOrQuit(test.mMessage->PrependBytes(buffer, length));
+                memmove(&test.mContent[length], test.mContent, test.mLength);
+                memcpy(test.mContent, buffer, length);
+                test.mLength += length;
+                test.mRemovedLength -= Min(test.mRemovedLength, length);
+
+                if (test.mLength > kMaxSize)
+                {
+                    SuccessOrQuit(test.mMessage->SetLength(kMaxSize));
+                    test.mLength = kMaxSize;
+                }
+                break;
+
+            case 4:
+                offset = Min<uint16_t>(offset, kMaxHeaderSize - test.mRemovedLength);
+                test.mRemovedLength += offset;
+                test.mMessage->RemoveHeader(offset);
+                memmove(test.mContent, &test.mContent[offset], test.mLength - offset);
+                test.mLength -= offset;
+                break;
+            }
+        }
+
+        for (TestMessage &message : messages)
+        {
+            VerifyOrQuit((message.mMessage != nullptr) || (message.mLength == 0));
+            VerifyOrQuit((message.mMessage == nullptr) || (message.mMessage->GetLength() == message.mLength));
+            VerifyOrQuit((message.mMessage == nullptr) ||
+                         message.mMessage->CompareBytes(0, message.mContent, message.mLength));
+        }
+
+#if OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFERS_ENABLE
+        {
+            // Without sharing, each message would use its own non-head
+            // buffers, the difference with the buffers in use is the
+            // number of shared buffers.
+
+            uint16_t numUsedBuffers = numFreeBuffers - messagePool->GetFreeBufferCount();
+            uint16_t numBuffers     = 0;
+
+            for (TestMessage &message : messages)
+            {
+                if (message.mMessage != nullptr)
+                {
+                    numBuffers += message.mMessage->GetBufferCount() - 1;
+                    numUsedBuffers--;
+                }
+            }
+
+            VerifyOrQuit(messagePool->GetSharedBufferCount() == numBuffers - numUsedBuffers);
+        }
+#endif
+    }
+
+    for (TestMessage &message : messages)
+    {
+        if (message.mMessage != nullptr)
+        {
+            message.mMessage->Free();
+        }
+    }
+
+    VerifyOrQuit(messagePool->GetFreeBufferCount() == numFreeBuffers);
+#if OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFERS_ENABLE
+    VerifyOrQuit(messagePool->GetSharedBufferCount() == 0);
+#endif
+
+    testFreeInstance(instance);
+}
+
+void TestMessageCloneFanOut(void)
+{
+    // Clones a message (as done when it is retransmitted or
+    // delivered to several receivers) and measures the cost of
+    // `Clone()` against copying the message into a new one.
+
+    static constexpr uint16_t kMessageSize   = 600;
+    static constexpr uint16_t kHeaderSize    = 48;
+    static constexpr uint16_t kNumClones     = 8;
+    static constexpr uint16_t kNumIterations = 2000;
+
+    Instance            *instance;
+    MessagePool         *messagePool;
+    Message             *message;
+    Message             *clones[kNumClones];
+    Instance::BufferInfo bufferInfo;
+    uint8_t              writeBuffer[kMessageSize];
+    uint8_t              readBuffer[kMessageSize];
+    uint8_t              byte;
+    uint16_t             numFreeBuffers;
+    uint16_t             numCloneBuffers;
+    uint64_t             startTime;
+    uint64_t             cloneDuration = 0;
+    uint64_t             copyDuration  = 0;
+
+    printf("TestMessageCloneFanOut\n");
+
+    instance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(instance != nullptr);
+
+    messagePool = &instance->Get<MessagePool>();
+
+    Random::NonCrypto::FillBuffer(writeBuffer, kMessageSize);
+
+    VerifyOrQuit((message = messagePool->Allocate(Message::kTypeIp6, kHeaderSize)) != nullptr);
+    SuccessOrQuit(message->AppendBytes(writeBuffer, kMessageSize));
+
+    numFreeBuffers = messagePool->GetFreeBufferCount();
+
+    for (Message *&clone : clones)
+    {
+        VerifyOrQuit((clone = message->Clone()) != nullptr);
+    }
+
+    numCloneBuffers = numFreeBuffers - messagePool->GetFreeBufferCount();
+    instance->GetBufferInfo(bufferInfo);
+
+#if OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFERS_ENABLE
+    VerifyOrQuit(numCloneBuffers == kNumClones);
+    VerifyOrQuit(bufferInfo.mSharedBuffers == kNumClones * (message->GetBufferCount() - 1));
+#else
+    VerifyOrQuit(numCloneBuffers == kNumClones * message->GetBufferCount());
+    VerifyOrQuit(bufferInfo.mSharedBuffers == 0);
+#endif
+
+    printf("  %u clones of a %u-byte message in %u buffers use %u buffers, %u shared\n", kNumClones, kMessageSize,
+           message->GetBufferCount(), numCloneBuffers, bufferInfo.mSharedBuffers);
+
+    // Change the headers of the clones (e.g., hop limit, or
+    // prepended headers) and the end of the original message
+    // (e.g., appended metadata) and check that no other message
+    // is changed.
+
+    for (uint16_t i = 0; i < kNumClones; i++)
+    {
+        uint8_t header[kHeaderSize];
+
+        memset(header, static_cast<uint8_t>(i), sizeof(header));
+        SuccessOrQuit(clones[i]->WriteBytes(0, header, sizeof(uint32_t)));
+        SuccessOrQuit(clones[i]->PrependBytes(header, sizeof(header)));
+    }
+
+    SuccessOrQuit(message->Write<uint32_t>(kMessageSize - sizeof(uint32_t), 0));
+
+    for (uint16_t i = 0; i < kNumClones; i++)
+    {
+        SuccessOrQuit(clones[i]->Read(kHeaderSize + sizeof(uint32_t), readBuffer, kMessageSize - sizeof(uint32_t)));
+        VerifyOrQuit(memcmp(readBuffer, &writeBuffer[sizeof(uint32_t)], kMessageSize - sizeof(uint32_t)) == 0);
+        SuccessOrQuit(clones[i]->Read(kHeaderSize, byte));
+        VerifyOrQuit(byte == i);
+        clones[i]->Free();
+    }
+
+    VerifyOrQuit(message->CompareBytes(0, writeBuffer, kMessageSize - sizeof(uint32_t)));
+    VerifyOrQuit(messagePool->GetFreeBufferCount() == numFreeBuffers);
+
+    for (uint16_t iter = 0; iter < kNumIterations; iter++)
+    {
+        startTime = GetMonotonicNsec();
+
+        for (Message *&clone : clones)
+        {
+            VerifyOrQuit((clone = message->Clone()) != nullptr);
+        }
+
+        cloneDuration += GetMonotonicNsec() - startTime;
+
+        for (Message *clone : clones)
+        {
+            clone->Free();
+        }
+
+        startTime = GetMonotonicNsec();
+
+        for (Message *&clone : clones)
+        {
+            VerifyOrQuit((clone = messagePool->Allocate(Message::kTypeIp6, kHeaderSize)) != nullptr);
+            SuccessOrQuit(clone->AppendBytesFromMessage(*message, 0, kMessageSize));
+        }
+
+        copyDuration += GetMonotonicNsec() - startTime;
+
+        for (Message *clone : clones)
+        {
+            clone->Free();
+        }
+    }
+
+    printf("  Clone: %llu ns, copy: %llu ns per message\n",
+           static_cast<unsigned long long>(cloneDuration / (kNumIterations * kNumClones)),
+           static_cast<unsigned long long>(copyDuration / (kNumIterations * kNumClones)));
+
+    message->Free();
+    testFreeInstance(instance);
+}
+
+#if OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFERS_ENABLE
+void TestMessageCloneNoBufs(void)
+{
+    // Checks that a write to a buffer shared with a clone fails
+    // (without changing either message) when there is no free
+    // buffer to copy it, and succeeds once a buffer is freed.
+
+    static constexpr uint16_t kMessageSize = 300;
+
+    Instance    *instance;
+    MessagePool *messagePool;
+    Message     *message;
+    Message     *clone;
+    Message     *filler;
+    MessageQueue fillers;
+    uint8_t      writeBuffer[kMessageSize];
+    uint8_t      header[sizeof(uint32_t)];
+
+    printf("TestMessageCloneNoBufs\n");
+
+    instance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(instance != nullptr);
+
+    messagePool = &instance->Get<MessagePool>();
+
+    Random::NonCrypto::FillBuffer(writeBuffer, kMessageSize);
+    memset(header, 0, sizeof(header));
+
+    VerifyOrQuit((message = messagePool->Allocate(Message::kTypeIp6)) != nullptr);
+    SuccessOrQuit(message->AppendBytes(writeBuffer, kMessageSize));
+    VerifyOrQuit(message->GetBufferCount() > 1);
+
+    VerifyOrQuit((clone = message->Clone()) != nullptr);
+
+    while ((filler = messagePool->Allocate(Message::kTypeIp6)) != nullptr)
+    {
+        fillers.Enqueue(*filler);
+    }
+
+    VerifyOrQuit(messagePool->GetFreeBufferCount() == 0);
+
+    // The head buffer of a message is never shared.
+    SuccessOrQuit(clone->WriteBytes(0, header, sizeof(header)));
+
+    VerifyOrQuit(clone->WriteBytes(kMessageSize - sizeof(header), header, sizeof(header)) == kErrorNoBufs);
+    VerifyOrQuit(message->Write<uint32_t>(kMessageSize - sizeof(uint32_t), 0) == kErrorNoBufs);
+    VerifyOrQuit(clone->CompareBytes(sizeof(header), &writeBuffer[sizeof(header)], kMessageSize - sizeof(header)));
+    VerifyOrQuit(message->CompareBytes(0, writeBuffer, kMessageSize));
+
+    // Copying the shared buffers needs as many free buffers.
+
+    for (uint8_t i = 1; i < message->GetBufferCount(); i++)
+    {
+        fillers.DequeueAndFree(*fillers.GetHead());
+    }
+
+    SuccessOrQuit(clone->WriteBytes(kMessageSize - sizeof(header), header, sizeof(header)));
+    VerifyOrQuit(clone->CompareBytes(kMessageSize - sizeof(header), header, sizeof(header)));
+    VerifyOrQuit(message->CompareBytes(0, writeBuffer, kMessageSize));
+    VerifyOrQuit(messagePool->GetSharedBufferCount() == 0);
+
+    fillers.DequeueAndFreeAll();
+    clone->Free();
+    message->Free();
+    testFreeInstance(instance);
+}
+#endif
+
 } // namespace ot
 
 int main(void)
 {
     ot::TestMessage();
     ot::TestAppender();
+    ot::TestMessageDataChunks();
+    ot::TestMessageSequentialRead();
+    ot::TestMessageClone();
+    ot::TestMessageCloneFanOut();
+#if OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFERS_ENABLE
+    ot::TestMessageCloneNoBufs();
+#endif
     printf("All tests passed\n");
     return 0;
 }
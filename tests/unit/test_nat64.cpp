@@ -37,7 +37,11 @@
 #include "common/debug.hpp"
 #include "common/instance.hpp"
 #include "common/message.hpp"
+#include "common/random.hpp"
+#include "net/checksum.hpp"
 #include "net/ip6.hpp"
+#include "net/tcp6.hpp"
+#include "net/udp6.hpp"
 
 #if OPENTHREAD_CONFIG_NAT64_TRANSLATOR_ENABLE
 
@@ -297,6 +301,309 @@ void TestNat64(void)
     testFreeInstance(sInstance);
 }
 
+static constexpr uint16_t kNumMappings        = 200;
+static constexpr uint16_t kMaxPayloadLength   = 1000;
+static constexpr uint8_t  kRemoteIp4Address[] = {172, 16, 243, 197};
+
+static void ConfigureTranslator(Ip6::Prefix &aNat64Prefix)
+{
+    const uint8_t kIp6Address[] = {0xfd, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+                                   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+    const uint8_t kIp4Address[] = {192, 168, 0, 0};
+
+    Ip4::Cidr cidr;
+
+    // A /24 CIDR provides 254 addresses, enough for `kNumMappings`.
+    cidr.Set(kIp4Address, 24);
+    aNat64Prefix.Set(kIp6Address, 96);
+    SuccessOrQuit(sInstance->Get<Nat64::Translator>().SetIp4Cidr(cidr));
+    sInstance->Get<Nat64::Translator>().SetNat64Prefix(aNat64Prefix);
+}
+
+static Ip6::Address GetThreadAddress(uint16_t aIndex)
+{
+    Ip6::Address address;
+
+    address.Clear();
+    address.mFields.m8[0]  = 0xfd;
+    address.mFields.m8[1]  = 0x02;
+    address.mFields.m16[7] = Encoding::BigEndian::HostSwap16(aIndex + 1);
+
+    return address;
+}
+
+static uint16_t GetChecksumOffset(uint8_t aIpProto)
+{
+    uint16_t offset = Ip6::Icmp::Header::kChecksumFieldOffset;
+
+    if (aIpProto == Ip6::kProtoUdp)
+    {
+        offset = Ip6::Udp::Header::kChecksumFieldOffset;
+    }
+    else if (aIpProto == Ip6::kProtoTcp)
+    {
+        offset = Ip6::Tcp::Header::kChecksumFieldOffset;
+    }
+
+    return offset;
+}
+
+static void AppendPayload(Message &aMessage, uint8_t aIcmpType, uint16_t aLength)
+{
+    uint8_t payload[kMaxPayloadLength];
+
+    Random::NonCrypto::FillBuffer(payload, aLength);
+    payload[0] = aIcmpType;
+    payload[1] = 0;
+    SuccessOrQuit(aMessage.AppendBytes(payload, aLength));
+}
+
+// Returns a new IPv6 datagram (with a valid checksum) from `aSource`
+// to the NAT64 address of the remote IPv4 host.
+static Message *NewIp6Datagram(const Ip6::Prefix  &aNat64Prefix,
+                               const Ip6::Address &aSource,
+                               uint8_t             aIpProto,
+                               uint16_t            aPayloadLength)
+{
+    Message     *message = sInstance->Get<Ip6::Ip6>().NewMessage(0);
+    Ip6::Header  header;
+    Ip4::Address remote;
+
+    VerifyOrQuit(message != nullptr);
+
+    remote.SetBytes(kRemoteIp4Address);
+    header.Clear();
+    header.InitVersionTrafficClassFlow();
+    header.SetPayloadLength(aPayloadLength);
+    header.SetNextHeader(aIpProto);
+    header.SetHopLimit(64);
+    header.SetSource(aSource);
+    header.GetDestination().SynthesizeFromIp4Address(aNat64Prefix, remote);
+
+    SuccessOrQuit(message->Append(header));
+    AppendPayload(*message, Ip6::Icmp::Header::kTypeEchoRequest, aPayloadLength);
+
+    message->SetOffset(sizeof(header));
+    Checksum::UpdateMessageChecksum(*message, header.GetSource(), header.GetDestination(), aIpProto);
+    message->SetOffset(0);
+
+    return message;
+}
+
+// Returns a new IPv4 datagram (with a valid checksum) from the remote
+// IPv4 host to `aDestination`.
+static Message *NewIp4Datagram(const Ip4::Address &aDestination, uint8_t aIpProto, uint16_t aPayloadLength)
+{
+    Message    *message = sInstance->Get<Ip6::Ip6>().NewMessage(0);
+    Ip4::Header header;
+
+    VerifyOrQuit(message != nullptr);
+
+    header.Clear();
+    header.InitVersionIhl();
+    header.SetTotalLength(sizeof(header) + aPayloadLength);
+    header.SetProtocol(aIpProto);
+    header.SetTtl(64);
+    header.GetSource().SetBytes(kRemoteIp4Address);
+    header.SetDestination(aDestination);
+    Checksum::UpdateIp4HeaderChecksum(header);
+
+    SuccessOrQuit(message->Append(header));
+    AppendPayload(*message, Ip4::Icmp::Header::kTypeEchoReply, aPayloadLength);
+
+    message->SetOffset(sizeof(header));
+    Checksum::UpdateMessageChecksum(*message, header.GetSource(), header.GetDestination(), aIpProto);
+    message->SetOffset(0);
+
+    return message;
+}
+
+// Verifies that the checksum of a translated datagram matches the
+// one calculated over the whole datagram.
+template <typename HeaderType> static void VerifyTranslatedChecksum(Message &aMessage, uint8_t aIpProto)
+{
+    HeaderType header;
+    uint16_t   offset = sizeof(HeaderType) + GetChecksumOffset(aIpProto);
+    uint16_t   translatedChecksum;
+    uint16_t   expectedChecksum;
+
+    SuccessOrQuit(header.ParseFrom(aMessage));
+    SuccessOrQuit(aMessage.Read(offset, translatedChecksum));
+
+    aMessage.SetOffset(sizeof(HeaderType));
+    Checksum::UpdateMessageChecksum(aMessage, header.GetSource(), header.GetDestination(), aIpProto);
+    aMessage.SetOffset(0);
+    SuccessOrQuit(aMessage.Read(offset, expectedChecksum));
+
+    VerifyOrQuit(translatedChecksum == expectedChecksum);
+}
+
+void TestNat64TranslationChecksum(void)
+{
+    static const uint8_t kIp6Protos[] = {Ip6::kProtoUdp, Ip6::kProtoTcp, Ip6::kProtoIcmp6};
+    static const uint8_t kIp4Protos[] = {Ip4::kProtoUdp, Ip4::kProtoTcp, Ip4::kProtoIcmp};
+
+    Ip6::Prefix                               nat64Prefix;
+    Nat64::Translator::AddressMappingIterator iterator;
+    otNat64AddressMapping                     mapping;
+    uint16_t                                  numMappings = 0;
+
+    printf("Testing NAT64 translated checksums\n");
+
+    sInstance = testInitInstance();
+    ConfigureTranslator(nat64Prefix);
+
+    for (uint16_t i = 0; i < kNumMappings; i++)
+    {
+        Ip6::Address threadAddress = GetThreadAddress(i);
+        Ip4::Address mappedAddress;
+
+        for (uint8_t p = 0; p < GetArrayLength(kIp6Protos); p++)
+        {
+            Message    *message;
+            Ip4::Header ip4Header;
+            Ip6::Header ip6Header;
+            uint16_t    length = Random::NonCrypto::GetUint16InRange(Ip6::Tcp::Header::kChecksumFieldOffset + 2,
+                                                                      kMaxPayloadLength);
+
+            message = NewIp6Datagram(nat64Prefix, threadAddress, kIp6Protos[p], length);
+            VerifyOrQuit(sInstance->Get<Nat64::Translator>().TranslateFromIp6(*message) ==
+                         Nat64::Translator::kForward);
+            VerifyTranslatedChecksum<Ip4::Header>(*message, kIp4Protos[p]);
+            SuccessOrQuit(ip4Header.ParseFrom(*message));
+            mappedAddress = ip4Header.GetSource();
+            message->Free();
+
+            message = NewIp4Datagram(mappedAddress, kIp4Protos[p], length);
+            VerifyOrQuit(sInstance->Get<Nat64::Translator>().TranslateToIp6(*message) == Nat64::Translator::kForward);
+            VerifyTranslatedChecksum<Ip6::Header>(*message, kIp6Protos[p]);
+            SuccessOrQuit(ip6Header.ParseFrom(*message));
+            VerifyOrQuit(ip6Header.GetDestination() == threadAddress);
+            message->Free();
+        }
+
+        // An IPv4 UDP datagram without checksum gets one calculated.
+        {
+            Message *message =
+                NewIp4Datagram(mappedAddress, Ip4::kProtoUdp, Ip6::Udp::Header::kChecksumFieldOffset + 2);
+
+            message->Write<uint16_t>(sizeof(Ip4::Header) + Ip6::Udp::Header::kChecksumFieldOffset, 0);
+            VerifyOrQuit(sInstance->Get<Nat64::Translator>().TranslateToIp6(*message) == Nat64::Translator::kForward);
+            VerifyTranslatedChecksum<Ip6::Header>(*message, Ip6::kProtoUdp);
+            message->Free();
+        }
+    }
+
+    sInstance->Get<Nat64::Translator>().InitAddressMappingIterator(iterator);
+
+    while (sInstance->Get<Nat64::Translator>().GetNextAddressMapping(iterator, mapping) == kErrorNone)
+    {
+        numMappings++;
+    }
+
+    VerifyOrQuit(numMappings == kNumMappings);
+
+    testFreeInstance(sInstance);
+
+    printf("  ... PASS\n");
+}
+
+void TestNat64Performance(void)
+{
+    // Translates UDP datagrams from/to random hosts among `kNumMappings`
+    // mapped ones and measures the average time spent per datagram
+    // (including allocating and freeing the message). For reference,
+    // it also measures the time spent calculating the checksum over
+    // the whole datagram as done before incremental updates.
+
+    static constexpr uint32_t kNumDatagrams  = 20000;
+    static constexpr uint16_t kPayloadLength = 512;
+    static constexpr uint16_t kDatagramSize  = sizeof(Ip6::Header) + kPayloadLength;
+
+    static uint8_t sIp6Datagrams[kNumMappings][kDatagramSize];
+    static uint8_t sIp4Datagrams[kNumMappings][kDatagramSize];
+
+    Ip6::Prefix nat64Prefix;
+    Ip4::Header ip4Header;
+    Message    *message;
+    uint64_t    startTime;
+    uint64_t    duration6To4;
+    uint64_t    duration4To6;
+    uint64_t    durationFull;
+
+    printf("Testing NAT64 translation performance\n");
+
+    sInstance = testInitInstance();
+    ConfigureTranslator(nat64Prefix);
+
+    for (uint16_t i = 0; i < kNumMappings; i++)
+    {
+        message = NewIp6Datagram(nat64Prefix, GetThreadAddress(i), Ip6::kProtoUdp, kPayloadLength);
+        VerifyOrQuit(message->ReadBytes(0, sIp6Datagrams[i], kDatagramSize) == kDatagramSize);
+        VerifyOrQuit(sInstance->Get<Nat64::Translator>().TranslateFromIp6(*message) == Nat64::Translator::kForward);
+        SuccessOrQuit(ip4Header.ParseFrom(*message));
+        message->Free();
+
+        message = NewIp4Datagram(ip4Header.GetSource(), Ip4::kProtoUdp, kPayloadLength);
+        VerifyOrQuit(message->ReadBytes(0, sIp4Datagrams[i], message->GetLength()) == message->GetLength());
+        message->Free();
+    }
+
+    startTime = GetMonotonicNsec();
+
+    for (uint32_t count = 0; count < kNumDatagrams; count++)
+    {
+        message = sInstance->Get<Ip6::Ip6>().NewMessage(0);
+        VerifyOrQuit(message != nullptr);
+        SuccessOrQuit(message->AppendBytes(sIp6Datagrams[Random::NonCrypto::GetUint16InRange(0, kNumMappings)],
+                                           kDatagramSize));
+        VerifyOrQuit(sInstance->Get<Nat64::Translator>().TranslateFromIp6(*message) == Nat64::Translator::kForward);
+        message->Free();
+    }
+
+    duration6To4 = GetMonotonicNsec() - startTime;
+
+    startTime = GetMonotonicNsec();
+
+    for (uint32_t count = 0; count < kNumDatagrams; count++)
+    {
+        message = sInstance->Get<Ip6::Ip6>().NewMessage(0);
+        VerifyOrQuit(message != nullptr);
+        SuccessOrQuit(message->AppendBytes(sIp4Datagrams[Random::NonCrypto::GetUint16InRange(0, kNumMappings)],
+                                           sizeof(Ip4::Header) + kPayloadLength));
+        VerifyOrQuit(sInstance->Get<Nat64::Translator>().TranslateToIp6(*message) == Nat64::Translator::kForward);
+        message->Free();
+    }
+
+    duration4To6 = GetMonotonicNsec() - startTime;
+
+    message = sInstance->Get<Ip6::Ip6>().NewMessage(0);
+    VerifyOrQuit(message != nullptr);
+    SuccessOrQuit(message->AppendBytes(sIp6Datagrams[0], kDatagramSize));
+    message->SetOffset(sizeof(Ip6::Header));
+
+    startTime = GetMonotonicNsec();
+
+    for (uint32_t count = 0; count < kNumDatagrams; count++)
+    {
+        Checksum::UpdateMessageChecksum(*message, ip4Header.GetSource(), ip4Header.GetDestination(), Ip4::kProtoUdp);
+    }
+
+    durationFull = GetMonotonicNsec() - startTime;
+
+    message->Free();
+
+    printf("  %u mappings, %lu datagrams of %u bytes: 6to4 %lu ns, 4to6 %lu ns per datagram\n", kNumMappings,
+           ToUlong(kNumDatagrams), kPayloadLength, ToUlong(static_cast<uint32_t>(duration6To4 / kNumDatagrams)),
+           ToUlong(static_cast<uint32_t>(duration4To6 / kNumDatagrams)));
+    printf("  full checksum calculation: %lu ns per datagram\n",
+           ToUlong(static_cast<uint32_t>(durationFull / kNumDatagrams)));
+
+    testFreeInstance(sInstance);
+
+    printf("  ... PASS\n");
+}
+
 } // namespace BorderRouter
 } // namespace ot
 
@@ -306,6 +613,13 @@ int main(void)
 {
 #if OPENTHREAD_CONFIG_NAT64_TRANSLATOR_ENABLE
     ot::BorderRouter::TestNat64();
+    ot::BorderRouter::TestNat64TranslationChecksum();
+
+    if (IsBenchmarkEnabled())
+    {
+        ot::BorderRouter::TestNat64Performance();
+    }
+
     printf("All tests passed\n");
 #else  // OPENTHREAD_CONFIG_NAT64_TRANSLATOR_ENABLE
     printf("NAT64 is not enabled\n");
@@ -35,9 +35,10 @@
 #include "common/code_utils.hpp"
 #include "common/debug.hpp"
 #include "common/instance.hpp"
+#include "common/random.hpp"
 #include "net/netif.hpp"
 
-#include "test_util.h"
+#include "test_util.hpp"
 
 namespace ot {
 
@@ -205,11 +206,135 @@ void TestNetifMulticastAddresses(void)
     }
 }
 
+static void PrepareGroupAddress(Ip6::Address &aAddress, uint16_t aGroupId)
+{
+    // Uses a mix of scopes and unicast-prefix-based addresses, similar
+    // to the groups registered by MLR on a Backbone Router.
+
+    aAddress.Clear();
+    aAddress.mFields.m16[0] = HostSwap16((aGroupId % 2 == 0) ? 0xff05 : 0xff35);
+    aAddress.mFields.m16[1] = HostSwap16(0x0040);
+    aAddress.mFields.m16[2] = HostSwap16(0xfd00);
+    aAddress.mFields.m16[3] = HostSwap16(0xabcd);
+    aAddress.mFields.m16[7] = HostSwap16(aGroupId);
+}
+
+void TestNetifMulticastLookup(uint16_t aNumGroups)
+{
+    // Subscribes `aNumGroups` multicast groups, then verifies and
+    // measures `IsMulticastSubscribed()` against a linear scan of
+    // the subscribed address list. Half of the looked up groups are
+    // subscribed.
+
+    static constexpr uint32_t kNumLookups = 200000;
+
+    Instance                     *instance = testInitInstance();
+    TestNetif                     netif(*instance);
+    Ip6::Netif::MulticastAddress *groups   = new Ip6::Netif::MulticastAddress[aNumGroups];
+    Ip6::Address                  address;
+    uint32_t                      numFound;
+    uint64_t                      startTime;
+    uint64_t                      indexDuration;
+    uint64_t                      scanDuration;
+
+    printf("\nTestNetifMulticastLookup(%u groups)", aNumGroups);
+
+    netif.SubscribeAllNodesMulticast();
+    netif.SubscribeAllRoutersMulticast();
+
+    for (uint16_t i = 0; i < aNumGroups; i++)
+    {
+        groups[i].Clear();
+        PrepareGroupAddress(groups[i].GetAddress(), i);
+        netif.SubscribeMulticast(groups[i]);
+    }
+
+    for (uint16_t i = 0; i < 2 * aNumGroups; i++)
+    {
+        PrepareGroupAddress(address, i);
+        VerifyOrQuit(netif.IsMulticastSubscribed(address) == (i < aNumGroups));
+    }
+
+    SuccessOrQuit(address.FromString("ff02::1"));
+    VerifyOrQuit(netif.IsMulticastSubscribed(address));
+    SuccessOrQuit(address.FromString("ff03::2"));
+    VerifyOrQuit(netif.IsMulticastSubscribed(address));
+
+    netif.UnsubscribeAllRoutersMulticast();
+    VerifyOrQuit(!netif.IsMulticastSubscribed(address));
+
+    // Unsubscribe every other group and verify the lookups again.
+
+    for (uint16_t i = 0; i < aNumGroups; i += 2)
+    {
+        netif.UnsubscribeMulticast(groups[i]);
+    }
+
+    for (uint16_t i = 0; i < aNumGroups; i++)
+    {
+        PrepareGroupAddress(address, i);
+        VerifyOrQuit(netif.IsMulticastSubscribed(address) == (i % 2 == 1));
+    }
+
+    for (uint16_t i = 0; i < aNumGroups; i += 2)
+    {
+        netif.SubscribeMulticast(groups[i]);
+    }
+
+    numFound  = 0;
+    startTime = GetMonotonicNsec();
+
+    for (uint32_t count = 0; count < kNumLookups; count++)
+    {
+        PrepareGroupAddress(address, Random::NonCrypto::GetUint16InRange(0, 2 * aNumGroups));
+        numFound += netif.IsMulticastSubscribed(address) ? 1 : 0;
+    }
+
+    indexDuration = GetMonotonicNsec() - startTime;
+    VerifyOrQuit(numFound > 0 && numFound < kNumLookups);
+
+    numFound  = 0;
+    startTime = GetMonotonicNsec();
+
+    for (uint32_t count = 0; count < kNumLookups; count++)
+    {
+        PrepareGroupAddress(address, Random::NonCrypto::GetUint16InRange(0, 2 * aNumGroups));
+        numFound += netif.GetMulticastAddresses().ContainsMatching(address) ? 1 : 0;
+    }
+
+    scanDuration = GetMonotonicNsec() - startTime;
+    VerifyOrQuit(numFound > 0 && numFound < kNumLookups);
+
+    printf("\n  indexed: %lu ns per lookup, list scan: %lu ns per lookup",
+           ToUlong(static_cast<uint32_t>(indexDuration / kNumLookups)),
+           ToUlong(static_cast<uint32_t>(scanDuration / kNumLookups)));
+
+    for (uint16_t i = 0; i < aNumGroups; i++)
+    {
+        netif.UnsubscribeMulticast(groups[i]);
+    }
+
+    netif.UnsubscribeAllNodesMulticast();
+
+    for (uint16_t i = 0; i < aNumGroups; i++)
+    {
+        PrepareGroupAddress(address, i);
+        VerifyOrQuit(!netif.IsMulticastSubscribed(address));
+    }
+
+    delete[] groups;
+    testFreeInstance(instance);
+
+    printf("\n -- PASS\n");
+}
+
 } // namespace ot
 
 int main(void)
 {
     ot::TestNetifMulticastAddresses();
+    ot::TestNetifMulticastLookup(64);
+    ot::TestNetifMulticastLookup(512);
     printf("All tests passed\n");
     return 0;
 }
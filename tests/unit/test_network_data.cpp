@@ -31,6 +31,9 @@
 #include "common/array.hpp"
 #include "common/code_utils.hpp"
 #include "common/instance.hpp"
+#include "common/message.hpp"
+#include "common/random.hpp"
+#include "thread/lowpan.hpp"
 #include "thread/network_data_leader.hpp"
 #include "thread/network_data_local.hpp"
 #include "thread/network_data_service.hpp"
@@ -922,6 +925,452 @@ void TestNetworkDataDsnSrpAnycastSeqNumSelection(void)
     testFreeInstance(instance);
 }
 
+class LookupTestLeader : public Leader
+{
+    // Provides the lookups by iterating over the Prefix TLVs (as done
+    // before the lookup index was added) to check the results of the
+    // `Leader` lookups, and as the baseline for their benchmark. The
+    // test Network Data has a single route entry per Prefix TLV so
+    // that the results do not depend on the route entry comparison.
+
+public:
+    Error GetContext(const Ip6::Address &aAddress, Lowpan::Context &aContext) const
+    {
+        const PrefixTlv *prefixTlv = nullptr;
+
+        aContext.mPrefix.SetLength(0);
+
+        while ((prefixTlv = FindNextMatchingPrefixTlv(aAddress, prefixTlv)) != nullptr)
+        {
+            const ContextTlv *contextTlv = prefixTlv->FindSubTlv<ContextTlv>();
+
+            if ((contextTlv != nullptr) && (prefixTlv->GetPrefixLength() > aContext.mPrefix.GetLength()))
+            {
+                prefixTlv->CopyPrefixTo(aContext.mPrefix);
+                aContext.mContextId    = contextTlv->GetContextId();
+                aContext.mCompressFlag = contextTlv->IsCompress();
+            }
+        }
+
+        return (aContext.mPrefix.GetLength() > 0) ? kErrorNone : kErrorNotFound;
+    }
+
+    Error GetContext(uint8_t aContextId, Lowpan::Context &aContext) const
+    {
+        Error            error = kErrorNotFound;
+        TlvIterator      tlvIterator(GetTlvsStart(), GetTlvsEnd());
+        const PrefixTlv *prefixTlv;
+
+        while ((prefixTlv = tlvIterator.Iterate<PrefixTlv>()) != nullptr)
+        {
+            const ContextTlv *contextTlv = prefixTlv->FindSubTlv<ContextTlv>();
+
+            if ((contextTlv != nullptr) && (contextTlv->GetContextId() == aContextId))
+            {
+                prefixTlv->CopyPrefixTo(aContext.mPrefix);
+                aContext.mContextId    = contextTlv->GetContextId();
+                aContext.mCompressFlag = contextTlv->IsCompress();
+                ExitNow(error = kErrorNone);
+            }
+        }
+
+    exit:
+        return error;
+    }
+
+    bool IsOnMesh(const Ip6::Address &aAddress) const
+    {
+        const PrefixTlv *prefixTlv = nullptr;
+        bool             isOnMesh  = false;
+
+        while ((prefixTlv = FindNextMatchingPrefixTlv(aAddress, prefixTlv)) != nullptr)
+        {
+            const BorderRouterTlv *brTlv = prefixTlv->FindSubTlv<BorderRouterTlv>();
+
+            if ((brTlv != nullptr) && brTlv->GetFirstEntry()->IsOnMesh())
+            {
+                ExitNow(isOnMesh = true);
+            }
+        }
+
+    exit:
+        return isOnMesh;
+    }
+
+    Error RouteLookup(const Ip6::Address &aSource, const Ip6::Address &aDestination, uint16_t &aRloc16) const
+    {
+        Error            error     = kErrorNoRoute;
+        const PrefixTlv *prefixTlv = nullptr;
+
+        while ((prefixTlv = FindNextMatchingPrefixTlv(aSource, prefixTlv)) != nullptr)
+        {
+            const BorderRouterTlv *brTlv;
+
+            if (ExternalRouteLookup(prefixTlv->GetDomainId(), aDestination, aRloc16) == kErrorNone)
+            {
+                ExitNow(error = kErrorNone);
+            }
+
+            brTlv = prefixTlv->FindSubTlv<BorderRouterTlv>();
+
+            if ((brTlv != nullptr) && brTlv->GetFirstEntry()->IsDefaultRoute())
+            {
+                aRloc16 = brTlv->GetFirstEntry()->GetRloc();
+                ExitNow(error = kErrorNone);
+            }
+        }
+
+    exit:
+        return error;
+    }
+
+private:
+    const PrefixTlv *FindNextMatchingPrefixTlv(const Ip6::Address &aAddress, const PrefixTlv *aPrevTlv) const
+    {
+        const PrefixTlv *prefixTlv;
+        TlvIterator      tlvIterator((aPrevTlv == nullptr) ? GetTlvsStart() : aPrevTlv->GetNext(), GetTlvsEnd());
+
+        while ((prefixTlv = tlvIterator.Iterate<PrefixTlv>()) != nullptr)
+        {
+            if (aAddress.MatchesPrefix(prefixTlv->GetPrefix(), prefixTlv->GetPrefixLength()))
+            {
+                break;
+            }
+        }
+
+        return prefixTlv;
+    }
+
+    Error ExternalRouteLookup(uint8_t aDomainId, const Ip6::Address &aDestination, uint16_t &aRloc16) const
+    {
+        Error            error           = kErrorNoRoute;
+        const PrefixTlv *prefixTlv       = nullptr;
+        uint8_t          bestMatchLength = 0;
+
+        while ((prefixTlv = FindNextMatchingPrefixTlv(aDestination, prefixTlv)) != nullptr)
+        {
+            const HasRouteTlv *hasRouteTlv = prefixTlv->FindSubTlv<HasRouteTlv>();
+
+            if ((prefixTlv->GetDomainId() != aDomainId) || (hasRouteTlv == nullptr))
+            {
+                continue;
+            }
+
+            if ((error == kErrorNone) && (prefixTlv->GetPrefixLength() <= bestMatchLength))
+            {
+                continue;
+            }
+
+            aRloc16         = hasRouteTlv->GetFirstEntry()->GetRloc();
+            bestMatchLength = prefixTlv->GetPrefixLength();
+            error           = kErrorNone;
+        }
+
+        return error;
+    }
+};
+
+class NetworkDataBuilder
+{
+public:
+    NetworkDataBuilder(void)
+        : mLength(0)
+    {
+    }
+
+    void AddOnMeshPrefix(const char *aPrefix, uint16_t aRloc16, bool aDefaultRoute, uint8_t aContextId)
+    {
+        static constexpr uint16_t kFlags = (1 << 13) | (1 << 12) | (1 << 8); // Preferred, SLAAC and on-mesh.
+
+        uint16_t flags = kFlags | (aDefaultRoute ? (1 << 9) : 0);
+
+        StartPrefixTlv(aPrefix);
+        AppendSubTlvHeader(NetworkDataTlv::kTypeBorderRouter, sizeof(BorderRouterEntry));
+        AppendUint16(aRloc16);
+        AppendUint16(flags);
+        AppendSubTlvHeader(NetworkDataTlv::kTypeContext, 2);
+        Append((1 << 4) | aContextId); // Compress flag and Context ID.
+        Append(mBuffer[mPrefixTlvStart + 3]);
+        EndPrefixTlv();
+    }
+
+    void AddExternalRoute(const char *aPrefix, uint16_t aRloc16)
+    {
+        StartPrefixTlv(aPrefix);
+        AppendSubTlvHeader(NetworkDataTlv::kTypeHasRoute, sizeof(HasRouteEntry));
+        AppendUint16(aRloc16);
+        Append(0);
+        EndPrefixTlv();
+    }
+
+    void AddDnsSrpAnycastService(uint8_t aServiceId, uint8_t aSequenceNumber, uint16_t aRloc16)
+    {
+        const uint8_t kService[] = {
+            0x0b, 0x08, static_cast<uint8_t>(0x80 | aServiceId), 0x02, 0x5c, aSequenceNumber, 0x0d, 0x02,
+            static_cast<uint8_t>(aRloc16 >> 8), static_cast<uint8_t>(aRloc16 & 0xff),
+        };
+
+        for (uint8_t byte : kService)
+        {
+            Append(byte);
+        }
+    }
+
+    void Load(Instance &aInstance) const
+    {
+        Message *message = aInstance.Get<MessagePool>().Allocate(Message::kTypeIp6);
+
+        VerifyOrQuit(message != nullptr);
+        SuccessOrQuit(message->AppendBytes(mBuffer, mLength));
+        SuccessOrQuit(aInstance.Get<Leader>().SetNetworkData(0, 0, kFullSet, *message, 0, mLength));
+        message->Free();
+
+        printf("\nnetdata length: %u", mLength);
+    }
+
+private:
+    void Append(uint8_t aByte)
+    {
+        VerifyOrQuit(mLength < sizeof(mBuffer));
+        mBuffer[mLength++] = aByte;
+    }
+
+    void AppendUint16(uint16_t aValue)
+    {
+        Append(static_cast<uint8_t>(aValue >> 8));
+        Append(static_cast<uint8_t>(aValue & 0xff));
+    }
+
+    void AppendSubTlvHeader(NetworkDataTlv::Type aType, uint8_t aLength)
+    {
+        Append(static_cast<uint8_t>((aType << 1) | 1)); // Stable flag.
+        Append(aLength);
+    }
+
+    void StartPrefixTlv(const char *aPrefix)
+    {
+        Ip6::Prefix prefix;
+
+        SuccessOrQuit(prefix.FromString(aPrefix));
+
+        mPrefixTlvStart = mLength;
+        AppendSubTlvHeader(NetworkDataTlv::kTypePrefix, 0);
+        Append(0); // Domain ID.
+        Append(prefix.GetLength());
+
+        for (uint8_t i = 0; i < prefix.GetBytesSize(); i++)
+        {
+            Append(prefix.GetBytes()[i]);
+        }
+    }
+
+    void EndPrefixTlv(void) { mBuffer[mPrefixTlvStart + 1] = mLength - mPrefixTlvStart - sizeof(NetworkDataTlv); }
+
+    uint8_t mBuffer[NetworkData::kMaxSize];
+    uint8_t mLength;
+    uint8_t mPrefixTlvStart;
+};
+
+static void PrepareLookupNetworkData(Instance &aInstance)
+{
+    // Network Data of a large mesh with multiple BRs, each providing
+    // an OMR prefix and external routes, along with some services.
+    // Includes nested and duplicate prefixes.
+
+    NetworkDataBuilder builder;
+
+    builder.AddOnMeshPrefix("fd00:1:1:1::/64", 0x0400, /* aDefaultRoute */ true, 1);
+    builder.AddExternalRoute("::/0", 0x0400);
+    builder.AddExternalRoute("fc00::/7", 0x0400);
+    builder.AddOnMeshPrefix("fd00:1:1:2::/64", 0x0800, /* aDefaultRoute */ false, 2);
+    builder.AddExternalRoute("fd00:2::/32", 0x0800);
+    builder.AddOnMeshPrefix("fd00:1:1::/48", 0x0c00, /* aDefaultRoute */ true, 3);
+    builder.AddExternalRoute("64:ff9b::/96", 0x0c00);
+    builder.AddExternalRoute("fd00:2::/32", 0x0c00);
+    builder.AddDnsSrpAnycastService(1, 1, 0x0400);
+    builder.AddOnMeshPrefix("fd00:3:0:1::/64", 0x1000, /* aDefaultRoute */ true, 4);
+    builder.AddExternalRoute("fd00:2:0:1::/64", 0x1000);
+    builder.AddExternalRoute("2000::/3", 0x1000);
+    builder.AddDnsSrpAnycastService(2, 5, 0x0800);
+    builder.AddOnMeshPrefix("fd00:3:0:2::/64", 0x1400, /* aDefaultRoute */ false, 5);
+    builder.AddExternalRoute("2001:db8::/32", 0x1400);
+    builder.AddDnsSrpAnycastService(3, 7, 0x1000);
+
+    builder.Load(aInstance);
+}
+
+static void PrepareLookupAddress(Ip6::Address &aAddress)
+{
+    // Picks one of the addresses below and randomizes its last bytes
+    // so that it may or may not match a prefix in Network Data.
+
+    static const char *const kAddresses[] = {
+        "fd00:1:1:1::1", "fd00:1:1:2::1",  "fd00:1:1:3::1", "fd00:2::1",        "fd00:2:0:1::1", "fd00:3:0:1::1",
+        "fd00:3:0:2::1", "64:ff9b::808:808", "2001:db8::1",  "2600::1",          "fe80::1",       "ff02::1",
+    };
+
+    SuccessOrQuit(aAddress.FromString(kAddresses[Random::NonCrypto::GetUint8InRange(0, GetArrayLength(kAddresses))]));
+
+    for (uint8_t i = Random::NonCrypto::GetUint8InRange(2, sizeof(Ip6::Address)); i < sizeof(Ip6::Address); i++)
+    {
+        aAddress.mFields.m8[i] = Random::NonCrypto::GetUint8();
+    }
+}
+
+void TestNetworkDataLookupIndex(void)
+{
+    static constexpr uint16_t kNumLookups = 5000;
+
+    Instance         *instance;
+    LookupTestLeader *leader;
+
+    printf("\n\n-------------------------------------------------");
+    printf("\nTestNetworkDataLookupIndex()\n");
+
+    instance = testInitInstance();
+    VerifyOrQuit(instance != nullptr);
+
+    leader = &reinterpret_cast<LookupTestLeader &>(instance->Get<Leader>());
+    PrepareLookupNetworkData(*instance);
+
+    for (uint8_t contextId = 1; contextId < 16; contextId++)
+    {
+        Lowpan::Context context;
+        Lowpan::Context expectedContext;
+        Error           error = instance->Get<Leader>().GetContext(contextId, context);
+
+        VerifyOrQuit(error == leader->GetContext(contextId, expectedContext));
+
+        if (error == kErrorNone)
+        {
+            VerifyOrQuit(context.mPrefix == expectedContext.mPrefix);
+            VerifyOrQuit(context.mContextId == contextId);
+            VerifyOrQuit(context.mCompressFlag == expectedContext.mCompressFlag);
+        }
+    }
+
+    for (uint16_t count = 0; count < kNumLookups; count++)
+    {
+        Ip6::Address    source;
+        Ip6::Address    destination;
+        Lowpan::Context context;
+        Lowpan::Context expectedContext;
+        uint16_t        rloc16;
+        uint16_t        expectedRloc16;
+        Error           error;
+
+        PrepareLookupAddress(source);
+        PrepareLookupAddress(destination);
+
+        error = instance->Get<Leader>().GetContext(source, context);
+        VerifyOrQuit(error == leader->GetContext(source, expectedContext));
+
+        if (error == kErrorNone)
+        {
+            VerifyOrQuit(context.mPrefix == expectedContext.mPrefix);
+            VerifyOrQuit(context.mContextId == expectedContext.mContextId);
+        }
+
+        VerifyOrQuit(instance->Get<Leader>().IsOnMesh(source) == leader->IsOnMesh(source));
+
+        error = instance->Get<Leader>().RouteLookup(source, destination, rloc16);
+        VerifyOrQuit(error == leader->RouteLookup(source, destination, expectedRloc16));
+
+        if (error == kErrorNone)
+        {
+            VerifyOrQuit(rloc16 == expectedRloc16);
+        }
+    }
+
+    testFreeInstance(instance);
+}
+
+void TestNetworkDataLookupPerformance(void)
+{
+    // Measures the time per packet spent in the lookups done when
+    // forwarding a packet (6LoWPAN context of source and destination
+    // and route lookup), using the lookup index against iterating
+    // over the Prefix TLVs.
+
+    static constexpr uint16_t kNumAddresses = 1024;
+    static constexpr uint32_t kNumRounds    = 100;
+
+    Instance         *instance;
+    LookupTestLeader *leader;
+    Ip6::Address     *addresses;
+    uint64_t          startTime;
+    uint64_t          indexDuration  = 0;
+    uint64_t          tlvsDuration   = 0;
+    uint32_t          numPackets     = 0;
+    uint32_t          indexNumRoutes = 0;
+    uint32_t          tlvsNumRoutes  = 0;
+
+    printf("\n\n-------------------------------------------------");
+    printf("\nTestNetworkDataLookupPerformance()\n");
+
+    instance = testInitInstance();
+    VerifyOrQuit(instance != nullptr);
+
+    leader = &reinterpret_cast<LookupTestLeader &>(instance->Get<Leader>());
+    PrepareLookupNetworkData(*instance);
+
+    addresses = new Ip6::Address[kNumAddresses];
+
+    for (uint16_t i = 0; i < kNumAddresses; i++)
+    {
+        PrepareLookupAddress(addresses[i]);
+    }
+
+    for (uint32_t round = 0; round < kNumRounds; round++)
+    {
+        startTime = GetMonotonicNsec();
+
+        for (uint16_t i = 0; i + 1 < kNumAddresses; i++)
+        {
+            Lowpan::Context context;
+            uint16_t        rloc16;
+
+            IgnoreError(instance->Get<Leader>().GetContext(addresses[i], context));
+            IgnoreError(instance->Get<Leader>().GetContext(addresses[i + 1], context));
+
+            if (instance->Get<Leader>().RouteLookup(addresses[i], addresses[i + 1], rloc16) == kErrorNone)
+            {
+                indexNumRoutes++;
+            }
+        }
+
+        indexDuration += GetMonotonicNsec() - startTime;
+
+        startTime = GetMonotonicNsec();
+
+        for (uint16_t i = 0; i + 1 < kNumAddresses; i++)
+        {
+            Lowpan::Context context;
+            uint16_t        rloc16;
+
+            IgnoreError(leader->GetContext(addresses[i], context));
+            IgnoreError(leader->GetContext(addresses[i + 1], context));
+
+            if (leader->RouteLookup(addresses[i], addresses[i + 1], rloc16) == kErrorNone)
+            {
+                tlvsNumRoutes++;
+            }
+        }
+
+        tlvsDuration += GetMonotonicNsec() - startTime;
+        numPackets += kNumAddresses - 1;
+    }
+
+    VerifyOrQuit(indexNumRoutes == tlvsNumRoutes);
+
+    printf("\n%lu packets (%lu routed): lookup index %lu ns, iterating TLVs %lu ns per packet", ToUlong(numPackets),
+           ToUlong(indexNumRoutes), ToUlong(static_cast<uint32_t>(indexDuration / numPackets)),
+           ToUlong(static_cast<uint32_t>(tlvsDuration / numPackets)));
+
+    delete[] addresses;
+    testFreeInstance(instance);
+}
+
 } // namespace NetworkData
 } // namespace ot
 
@@ -933,6 +1382,12 @@ int main(void)
 #endif
     ot::NetworkData::TestNetworkDataDsnSrpServices();
     ot::NetworkData::TestNetworkDataDsnSrpAnycastSeqNumSelection();
+    ot::NetworkData::TestNetworkDataLookupIndex();
+
+    if (IsBenchmarkEnabled())
+    {
+        ot::NetworkData::TestNetworkDataLookupPerformance();
+    }
 
     printf("\nAll tests passed\n");
     return 0;
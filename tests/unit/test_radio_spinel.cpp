@@ -0,0 +1,396 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+// RCP recovery is disabled by default, the tests exercise the async requests the recovery relies on.
+#undef OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT
+#define OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT 2
+#define OPENTHREAD_POSIX_CONFIG_RCP_TIME_SYNC_INTERVAL (60 * 1000 * 1000)
+
+#include <string.h>
+
+#include <openthread/config.h>
+#include <openthread/platform/time.h>
+
+#include "test_platform.h"
+#include "test_util.hpp"
+#include "common/code_utils.hpp"
+#include "lib/spinel/radio_spinel.hpp"
+
+static uint64_t sNow = 0;
+
+extern "C" uint64_t otPlatTimeGet(void) { return sNow; }
+
+namespace ot {
+namespace Spinel {
+
+// A fake RCP link which answers every request with the response the RCP
+// would send, unless told to hold, drop or reject it. Time only advances
+// when `WaitForFrame()` runs out of frames to deliver.
+
+class FakeInterface
+{
+public:
+    static constexpr uint8_t kMaxFrames = 16;
+
+    FakeInterface(SpinelInterface::ReceiveFrameCallback aCallback,
+                  void                                 *aCallbackContext,
+                  SpinelInterface::RxFrameBuffer       &aFrameBuffer)
+        : mCallback(aCallback)
+        , mCallbackContext(aCallbackContext)
+        , mFrameBuffer(aFrameBuffer)
+    {
+        Reset();
+    }
+
+    void Reset(void)
+    {
+        mNumPending   = 0;
+        mNumHeld      = 0;
+        mHold         = false;
+        mDropKey      = SPINEL_PROP_LAST_STATUS;
+        mRejectKey    = SPINEL_PROP_LAST_STATUS;
+        mRejectStatus = SPINEL_STATUS_OK;
+    }
+
+    otError SendFrame(const uint8_t *aFrame, uint16_t aLength)
+    {
+        uint8_t           header;
+        uint32_t          cmd;
+        spinel_prop_key_t key;
+        const uint8_t    *data;
+        spinel_size_t     len;
+        uint32_t          responseCmd;
+
+        VerifyOrQuit(spinel_datatype_unpack(aFrame, aLength, "CiiD", &header, &cmd, &key, &data, &len) > 0);
+
+        if (key == mDropKey)
+        {
+            // Drop the response once, as if the RCP had stopped responding.
+            mDropKey = SPINEL_PROP_LAST_STATUS;
+            ExitNow();
+        }
+
+        if (key == mRejectKey)
+        {
+            uint8_t statusData[sizeof(uint32_t)];
+
+            len = static_cast<spinel_size_t>(spinel_datatype_pack(statusData, sizeof(statusData),
+                                                                  SPINEL_DATATYPE_UINT_PACKED_S, mRejectStatus));
+            AddFrame(SPINEL_HEADER_GET_TID(header), SPINEL_CMD_PROP_VALUE_IS, SPINEL_PROP_LAST_STATUS, statusData,
+                     static_cast<uint16_t>(len));
+            ExitNow();
+        }
+
+        responseCmd = (cmd == SPINEL_CMD_PROP_VALUE_INSERT) ? SPINEL_CMD_PROP_VALUE_INSERTED : SPINEL_CMD_PROP_VALUE_IS;
+        AddFrame(SPINEL_HEADER_GET_TID(header), responseCmd, key, data, static_cast<uint16_t>(len));
+
+    exit:
+        return OT_ERROR_NONE;
+    }
+
+    otError WaitForFrame(uint64_t aTimeoutUs)
+    {
+        otError error = OT_ERROR_NONE;
+
+        if (mNumPending == 0)
+        {
+            sNow += aTimeoutUs;
+            ExitNow(error = OT_ERROR_RESPONSE_TIMEOUT);
+        }
+
+        Deliver(mPending[0]);
+        mNumPending--;
+        memmove(&mPending[0], &mPending[1], mNumPending * sizeof(Frame));
+
+    exit:
+        return error;
+    }
+
+    otError HardwareReset(void)
+    {
+        uint8_t statusData[sizeof(uint32_t)];
+        int     len;
+
+        len = spinel_datatype_pack(statusData, sizeof(statusData), SPINEL_DATATYPE_UINT_PACKED_S,
+                                   SPINEL_STATUS_RESET_SOFTWARE);
+        AddFrame(0, SPINEL_CMD_PROP_VALUE_IS, SPINEL_PROP_LAST_STATUS, statusData, static_cast<uint16_t>(len));
+
+        return OT_ERROR_NONE;
+    }
+
+    void     Deinit(void) {}
+    uint32_t GetBusSpeed(void) const { return 0; }
+
+    void DeliverHeld(uint8_t aIndex)
+    {
+        VerifyOrQuit(aIndex < mNumHeld);
+        Deliver(mHeld[aIndex]);
+    }
+
+    uint8_t           mNumHeld;
+    bool              mHold;
+    spinel_prop_key_t mDropKey;
+    spinel_prop_key_t mRejectKey;
+    spinel_status_t   mRejectStatus;
+
+private:
+    struct Frame
+    {
+        uint8_t  mData[64];
+        uint16_t mLength;
+    };
+
+    void AddFrame(spinel_tid_t aTid, uint32_t aCmd, spinel_prop_key_t aKey, const uint8_t *aData, uint16_t aLength)
+    {
+        Frame *frame;
+        int    len;
+
+        if (mHold && aTid != 0)
+        {
+            VerifyOrQuit(mNumHeld < kMaxFrames);
+            frame = &mHeld[mNumHeld++];
+        }
+        else
+        {
+            VerifyOrQuit(mNumPending < kMaxFrames);
+            frame = &mPending[mNumPending++];
+        }
+
+        len = spinel_datatype_pack(frame->mData, sizeof(frame->mData), "Cii",
+                                   SPINEL_HEADER_FLAG | SPINEL_HEADER_IID_0 | aTid, aCmd, aKey);
+        VerifyOrQuit(len > 0 && len + aLength <= static_cast<int>(sizeof(frame->mData)));
+        memcpy(&frame->mData[len], aData, aLength);
+        frame->mLength = static_cast<uint16_t>(len + aLength);
+    }
+
+    void Deliver(const Frame &aFrame)
+    {
+        SuccessOrQuit(mFrameBuffer.WriteBytes(aFrame.mData, aFrame.mLength));
+        mCallback(mCallbackContext);
+    }
+
+    SpinelInterface::ReceiveFrameCallback mCallback;
+    void                                 *mCallbackContext;
+    SpinelInterface::RxFrameBuffer       &mFrameBuffer;
+    Frame                                 mPending[kMaxFrames];
+    uint8_t                               mNumPending;
+    Frame                                 mHeld[kMaxFrames];
+};
+
+class RadioSpinelTester : public RadioSpinel<FakeInterface>
+{
+public:
+    static constexpr uint8_t kMaxDone = 8;
+
+    RadioSpinelTester(void)
+        : mNumDone(0)
+    {
+        mResetRadioOnStartup = false;
+        mIsReady             = true;
+    }
+
+    otError SetAsync(spinel_prop_key_t aKey, uint16_t aValue)
+    {
+        return RadioSpinel::SetAsync(aKey, static_cast<AsyncResponseHandler>(&RadioSpinelTester::HandleDone),
+                                     SPINEL_DATATYPE_UINT16_S, aValue);
+    }
+
+    otError InsertAsync(spinel_prop_key_t aKey, uint16_t aValue)
+    {
+        return RadioSpinel::InsertAsync(aKey, static_cast<AsyncResponseHandler>(&RadioSpinelTester::HandleDone),
+                                        SPINEL_DATATYPE_UINT16_S, aValue);
+    }
+
+    void HandleDone(spinel_prop_key_t aKey, otError aError)
+    {
+        VerifyOrQuit(mNumDone < kMaxDone);
+        mDoneKeys[mNumDone]   = aKey;
+        mDoneErrors[mNumDone] = aError;
+        mNumDone++;
+    }
+
+    void VerifyIdle(void) const
+    {
+        VerifyOrQuit(mNumAsyncRequests == 0);
+        VerifyOrQuit(mCmdTidsInUse == 0);
+
+        for (const AsyncRequest &entry : mAsyncRequests)
+        {
+            VerifyOrQuit(entry.mTid == 0);
+        }
+    }
+
+    FakeInterface &GetInterface(void) { return mSpinelInterface; }
+
+    void TestOutOfOrderResponses(void)
+    {
+        FakeInterface &fake = GetInterface();
+
+        printf("TestOutOfOrderResponses");
+
+        fake.mHold = true;
+        SuccessOrQuit(SetAsync(SPINEL_PROP_MAC_15_4_PANID, 0x1234));
+        SuccessOrQuit(SetAsync(SPINEL_PROP_MAC_15_4_SADDR, 0x5678));
+        SuccessOrQuit(InsertAsync(SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES, 0x9abc));
+        VerifyOrQuit(mNumAsyncRequests == 3);
+        VerifyOrQuit(fake.mNumHeld == 3);
+
+        // Responses arrive in a different order than the requests were sent.
+        fake.DeliverHeld(2);
+        fake.DeliverHeld(0);
+        fake.DeliverHeld(1);
+
+        VerifyOrQuit(mNumDone == 3);
+        VerifyOrQuit(mDoneKeys[0] == SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES);
+        VerifyOrQuit(mDoneKeys[1] == SPINEL_PROP_MAC_15_4_PANID);
+        VerifyOrQuit(mDoneKeys[2] == SPINEL_PROP_MAC_15_4_SADDR);
+
+        for (uint8_t i = 0; i < mNumDone; i++)
+        {
+            VerifyOrQuit(mDoneErrors[i] == OT_ERROR_NONE);
+        }
+
+        SuccessOrQuit(WaitAsyncResponses());
+        VerifyIdle();
+
+        // A response repeated after its request completed is not matched.
+        fake.DeliverHeld(0);
+        VerifyOrQuit(mNumDone == 3);
+
+        Finish();
+        printf(" -- PASS\n");
+    }
+
+    void TestResponseTimeout(void)
+    {
+        FakeInterface &fake = GetInterface();
+
+        printf("TestResponseTimeout");
+
+        fake.mDropKey = SPINEL_PROP_MAC_15_4_SADDR;
+        SuccessOrQuit(SetAsync(SPINEL_PROP_MAC_15_4_PANID, 0x1234));
+        SuccessOrQuit(SetAsync(SPINEL_PROP_MAC_15_4_SADDR, 0x5678));
+
+        VerifyOrQuit(WaitAsyncResponses() == OT_ERROR_RESPONSE_TIMEOUT);
+        VerifyOrQuit(mRcpFailed);
+        VerifyIdle();
+
+        // Only the answered request completes, the other one is cleared without calling its handler.
+        VerifyOrQuit(mNumDone == 1);
+        VerifyOrQuit(mDoneKeys[0] == SPINEL_PROP_MAC_15_4_PANID);
+
+        mRcpFailed = false;
+        Finish();
+        printf(" -- PASS\n");
+    }
+
+    void TestErrorStatus(void)
+    {
+        FakeInterface &fake = GetInterface();
+
+        printf("TestErrorStatus");
+
+        fake.mRejectKey    = SPINEL_PROP_MAC_15_4_SADDR;
+        fake.mRejectStatus = SPINEL_STATUS_INVALID_ARGUMENT;
+        SuccessOrQuit(SetAsync(SPINEL_PROP_MAC_15_4_PANID, 0x1234));
+        SuccessOrQuit(SetAsync(SPINEL_PROP_MAC_15_4_SADDR, 0x5678));
+
+        SuccessOrQuit(WaitAsyncResponses());
+        VerifyOrQuit(!mRcpFailed);
+        VerifyIdle();
+
+        VerifyOrQuit(mNumDone == 2);
+        VerifyOrQuit(mDoneKeys[0] == SPINEL_PROP_MAC_15_4_PANID);
+        VerifyOrQuit(mDoneErrors[0] == OT_ERROR_NONE);
+        VerifyOrQuit(mDoneKeys[1] == SPINEL_PROP_MAC_15_4_SADDR);
+        VerifyOrQuit(mDoneErrors[1] == OT_ERROR_INVALID_ARGS);
+
+        Finish();
+        printf(" -- PASS\n");
+    }
+
+    void TestRecoveryRetriesRestore(void)
+    {
+        FakeInterface &fake = GetInterface();
+
+        printf("TestRecoveryRetriesRestore");
+
+        mState     = kStateReceive;
+        mRcpFailed = true;
+
+        // The RCP stops responding again while its properties are restored.
+        fake.mDropKey = SPINEL_PROP_MAC_15_4_PANID;
+        RecoverFromRcpFailure();
+
+        VerifyOrQuit(mRcpFailed);
+        VerifyOrQuit(mState == kStateReceive);
+        VerifyOrQuit(mRcpFailureCount == 1);
+        VerifyOrQuit(mRcpRestoreFailureCount == 1);
+        VerifyIdle();
+
+        RecoverFromRcpFailure();
+
+        VerifyOrQuit(!mRcpFailed);
+        VerifyOrQuit(mState == kStateReceive);
+        VerifyOrQuit(mRcpFailureCount == 0);
+        VerifyOrQuit(mRcpRestoreFailureCount == 0);
+        VerifyOrQuit(mRadioSpinelMetrics.mRcpRestorationCount == 2);
+        VerifyIdle();
+
+        mState = kStateDisabled;
+        Finish();
+        printf(" -- PASS\n");
+    }
+
+private:
+    void Finish(void)
+    {
+        GetInterface().Reset();
+        mNumDone = 0;
+    }
+
+    uint8_t           mNumDone;
+    spinel_prop_key_t mDoneKeys[kMaxDone];
+    otError           mDoneErrors[kMaxDone];
+};
+
+} // namespace Spinel
+} // namespace ot
+
+int main(void)
+{
+    ot::Spinel::RadioSpinelTester radioSpinel;
+
+    radioSpinel.TestOutOfOrderResponses();
+    radioSpinel.TestResponseTimeout();
+    radioSpinel.TestErrorStatus();
+    radioSpinel.TestRecoveryRetriesRestore();
+
+    printf("All tests passed\n");
+    return 0;
+}
@@ -0,0 +1,403 @@
+/*
+ *  Copyright (c) 2023, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "common/encoding.hpp"
+#include "common/instance.hpp"
+#include "common/message.hpp"
+#include "net/ip6_address.hpp"
+#include "net/reassembly_table.hpp"
+
+#include "test_platform.h"
+#include "test_util.hpp"
+
+namespace ot {
+
+static constexpr uint16_t kNumEntries        = 32;
+static constexpr uint16_t kMaxDatagramLength = 1280;
+
+struct TestKey
+{
+    uint32_t GetHash(void) const
+    {
+        uint8_t bytes[2 * sizeof(Ip6::Address) + sizeof(uint32_t)];
+
+        memcpy(bytes, &mSource, sizeof(Ip6::Address));
+        memcpy(&bytes[sizeof(Ip6::Address)], &mDestination, sizeof(Ip6::Address));
+        Encoding::BigEndian::WriteUint32(mIdentification, &bytes[2 * sizeof(Ip6::Address)]);
+
+        return HashIndex<kNumEntries>::CalculateHash(bytes, sizeof(bytes));
+    }
+
+    bool operator==(const TestKey &aOther) const
+    {
+        return (mIdentification == aOther.mIdentification) && (mSource == aOther.mSource) &&
+               (mDestination == aOther.mDestination);
+    }
+
+    Ip6::Address mSource;
+    Ip6::Address mDestination;
+    uint32_t     mIdentification;
+};
+
+typedef ReassemblyTable<TestKey, kNumEntries, kMaxDatagramLength> TestTable;
+
+static TestKey MakeKey(uint16_t aSourceId, uint32_t aIdentification)
+{
+    TestKey key;
+
+    memset(&key, 0, sizeof(key));
+    key.mSource.mFields.m8[0]       = 0xfd;
+    key.mSource.mFields.m16[7]      = aSourceId;
+    key.mDestination.mFields.m8[0]  = 0xfd;
+    key.mDestination.mFields.m8[15] = 1;
+    key.mIdentification             = aIdentification;
+
+    return key;
+}
+
+void TestReassemblyTableBlocks(void)
+{
+    Instance         *instance;
+    Message          *message;
+    TestTable        *table;
+    TestTable::Entry *entry;
+
+    printf("\nTestReassemblyTableBlocks");
+
+    instance = testInitInstance();
+    VerifyOrQuit(instance != nullptr);
+
+    table = new TestTable();
+
+    message = instance->Get<MessagePool>().Allocate(Message::kTypeIp6);
+    VerifyOrQuit(message != nullptr);
+
+    entry = table->Add(MakeKey(1, 100), *message);
+    VerifyOrQuit(entry != nullptr);
+    VerifyOrQuit(&entry->GetMessage() == message);
+    VerifyOrQuit(!entry->IsComplete());
+
+    // Fragments received out of order: [512, 1000) then [0, 256).
+
+    SuccessOrQuit(entry->MarkReceived(512, 488));
+    SuccessOrQuit(entry->SetDatagramLength(1000));
+    VerifyOrQuit(!entry->IsComplete());
+
+    SuccessOrQuit(entry->MarkReceived(0, 256));
+    VerifyOrQuit(!entry->IsComplete());
+
+    // Duplicate, misaligned, overlapping and too long fragments.
+
+    VerifyOrQuit(entry->MarkReceived(0, 256) == kErrorDuplicated);
+    VerifyOrQuit(entry->MarkReceived(512, 488) == kErrorDuplicated);
+    VerifyOrQuit(entry->MarkReceived(260, 8) == kErrorParse);
+    VerifyOrQuit(entry->MarkReceived(248, 16) == kErrorParse);
+    VerifyOrQuit(entry->MarkReceived(256, 264) == kErrorParse);
+    VerifyOrQuit(entry->MarkReceived(1280, 8) == kErrorParse);
+    VerifyOrQuit(!entry->IsComplete());
+
+    // The missing fragment completes the datagram.
+
+    SuccessOrQuit(entry->MarkReceived(256, 256));
+    VerifyOrQuit(entry->IsComplete());
+
+    table->Remove(*entry);
+    VerifyOrQuit(table->Find(MakeKey(1, 100)) == nullptr);
+
+    message->Free();
+    delete table;
+    testFreeInstance(instance);
+
+    printf("\n -- PASS\n");
+}
+
+void TestReassemblyTableLength(void)
+{
+    Instance         *instance;
+    Message          *message;
+    TestTable        *table;
+    TestTable::Entry *entry;
+
+    printf("\nTestReassemblyTableLength");
+
+    instance = testInitInstance();
+    VerifyOrQuit(instance != nullptr);
+
+    table = new TestTable();
+
+    message = instance->Get<MessagePool>().Allocate(Message::kTypeIp6);
+    VerifyOrQuit(message != nullptr);
+
+    // A hole: [0, 8) and [1000, 1008) are received before a last
+    // fragment [16, 24). The last fragment ends before a received
+    // fragment, so the datagram length is rejected and the datagram
+    // never completes with the missing [8, 16).
+
+    entry = table->Add(MakeKey(1, 100), *message);
+    VerifyOrQuit(entry != nullptr);
+
+    SuccessOrQuit(entry->MarkReceived(0, 8));
+    SuccessOrQuit(entry->MarkReceived(1000, 8));
+    SuccessOrQuit(entry->MarkReceived(16, 8));
+    VerifyOrQuit(entry->SetDatagramLength(24) == kErrorParse);
+    VerifyOrQuit(!entry->IsComplete());
+
+    table->Remove(*entry);
+
+    // A fragment past the end: once the last fragment gives the
+    // length, a fragment ending past it is rejected.
+
+    entry = table->Add(MakeKey(1, 101), *message);
+    VerifyOrQuit(entry != nullptr);
+
+    SuccessOrQuit(entry->MarkReceived(16, 8));
+    SuccessOrQuit(entry->SetDatagramLength(24));
+    VerifyOrQuit(entry->MarkReceived(24, 8) == kErrorParse);
+    VerifyOrQuit(entry->MarkReceived(1000, 8) == kErrorParse);
+    VerifyOrQuit(entry->MarkReceived(8, 24) == kErrorParse);
+    VerifyOrQuit(!entry->IsComplete());
+
+    SuccessOrQuit(entry->MarkReceived(0, 16));
+    VerifyOrQuit(entry->IsComplete());
+
+    table->Remove(*entry);
+
+    // A conflicting last fragment: a second last fragment giving a
+    // different length is rejected.
+
+    entry = table->Add(MakeKey(1, 102), *message);
+    VerifyOrQuit(entry != nullptr);
+
+    SuccessOrQuit(entry->MarkReceived(32, 8));
+    SuccessOrQuit(entry->SetDatagramLength(40));
+    SuccessOrQuit(entry->MarkReceived(16, 5));
+    VerifyOrQuit(entry->SetDatagramLength(21) == kErrorParse);
+    VerifyOrQuit(entry->SetDatagramLength(48) == kErrorParse);
+    SuccessOrQuit(entry->SetDatagramLength(40));
+    VerifyOrQuit(!entry->IsComplete());
+
+    table->Remove(*entry);
+
+    message->Free();
+    delete table;
+    testFreeInstance(instance);
+
+    printf("\n -- PASS\n");
+}
+
+void TestReassemblyTableLookup(void)
+{
+    Instance  *instance;
+    Message   *messages[kNumEntries];
+    TestTable *table;
+
+    printf("\nTestReassemblyTableLookup");
+
+    instance = testInitInstance();
+    VerifyOrQuit(instance != nullptr);
+
+    table = new TestTable();
+
+    for (uint16_t i = 0; i < kNumEntries; i++)
+    {
+        VerifyOrQuit(!table->IsFull());
+
+        messages[i] = instance->Get<MessagePool>().Allocate(Message::kTypeIp6);
+        VerifyOrQuit(messages[i] != nullptr);
+
+        // Use the same identification from different sources, and
+        // different identifications from the same source.
+        VerifyOrQuit(table->Add(MakeKey(i / 2, i % 2), *messages[i]) != nullptr);
+    }
+
+    VerifyOrQuit(table->IsFull());
+    VerifyOrQuit(table->Add(MakeKey(kNumEntries, 0), *messages[0]) == nullptr);
+
+    for (uint16_t i = 0; i < kNumEntries; i++)
+    {
+        TestTable::Entry *entry = table->Find(MakeKey(i / 2, i % 2));
+
+        VerifyOrQuit(entry != nullptr);
+        VerifyOrQuit(&entry->GetMessage() == messages[i]);
+        VerifyOrQuit(table->Find(*messages[i]) == entry);
+    }
+
+    VerifyOrQuit(table->Find(MakeKey(0, 2)) == nullptr);
+    VerifyOrQuit(table->Find(MakeKey(kNumEntries, 0)) == nullptr);
+
+    // Remove every other entry by message and check the others remain.
+
+    for (uint16_t i = 0; i < kNumEntries; i += 2)
+    {
+        table->Remove(*messages[i]);
+    }
+
+    VerifyOrQuit(!table->IsFull());
+
+    for (uint16_t i = 0; i < kNumEntries; i++)
+    {
+        TestTable::Entry *entry = table->Find(MakeKey(i / 2, i % 2));
+
+        VerifyOrQuit((entry == nullptr) == (i % 2 == 0));
+    }
+
+    table->Clear();
+
+    for (uint16_t i = 0; i < kNumEntries; i++)
+    {
+        VerifyOrQuit(table->Find(MakeKey(i / 2, i % 2)) == nullptr);
+        messages[i]->Free();
+    }
+
+    delete table;
+    testFreeInstance(instance);
+
+    printf("\n -- PASS\n");
+}
+
+void TestReassemblyTablePerformance(void)
+{
+    // Simulates a fragment storm where `kNumEntries` datagrams are
+    // reassembled concurrently with their fragments interleaved, and
+    // compares the time spent locating the datagram of each fragment
+    // using the table against a linear scan which reads the key back
+    // from each message being reassembled.
+
+    static constexpr uint16_t kNumFragments = kMaxDatagramLength / 64;
+    static constexpr uint32_t kNumRounds    = 200;
+
+    Instance  *instance;
+    Message   *messages[kNumEntries];
+    TestKey    keys[kNumEntries];
+    TestTable *table;
+    uint64_t   startTime;
+    uint64_t   tableDuration  = 0;
+    uint64_t   linearDuration = 0;
+    uint32_t   numFragments   = 0;
+    uint32_t   numLinearFound = 0;
+
+    printf("\nTestReassemblyTablePerformance");
+
+    instance = testInitInstance();
+    VerifyOrQuit(instance != nullptr);
+
+    table = new TestTable();
+
+    for (uint16_t i = 0; i < kNumEntries; i++)
+    {
+        messages[i] = instance->Get<MessagePool>().Allocate(Message::kTypeIp6);
+        VerifyOrQuit(messages[i] != nullptr);
+        SuccessOrQuit(messages[i]->SetLength(sizeof(TestKey)));
+    }
+
+    for (uint32_t round = 0; round < kNumRounds; round++)
+    {
+        for (uint16_t i = 0; i < kNumEntries; i++)
+        {
+            keys[i] = MakeKey(i, round);
+            messages[i]->Write(0, keys[i]);
+            VerifyOrQuit(table->Add(keys[i], *messages[i]) != nullptr);
+        }
+
+        startTime = GetMonotonicNsec();
+
+        for (uint16_t fragment = 0; fragment < kNumFragments; fragment++)
+        {
+            for (uint16_t i = 0; i < kNumEntries; i++)
+            {
+                TestTable::Entry *entry = table->Find(keys[i]);
+
+                VerifyOrQuit(entry != nullptr);
+                numFragments++;
+            }
+        }
+
+        tableDuration += GetMonotonicNsec() - startTime;
+
+        startTime = GetMonotonicNsec();
+
+        for (uint16_t fragment = 0; fragment < kNumFragments; fragment++)
+        {
+            for (uint16_t i = 0; i < kNumEntries; i++)
+            {
+                for (Message *message : messages)
+                {
+                    TestKey key;
+
+                    SuccessOrQuit(message->Read(0, key));
+
+                    if (key == keys[i])
+                    {
+                        numLinearFound++;
+                        break;
+                    }
+                }
+            }
+        }
+
+        linearDuration += GetMonotonicNsec() - startTime;
+
+        table->Clear();
+    }
+
+    VerifyOrQuit(numLinearFound == numFragments);
+
+    printf("\n  %u datagrams, %lu fragments: table %lu ns, linear scan %lu ns per fragment", kNumEntries,
+           ToUlong(numFragments), ToUlong(static_cast<uint32_t>(tableDuration / numFragments)),
+           ToUlong(static_cast<uint32_t>(linearDuration / numFragments)));
+
+    for (Message *message : messages)
+    {
+        message->Free();
+    }
+
+    delete table;
+    testFreeInstance(instance);
+
+    printf("\n -- PASS\n");
+}
+
+} // namespace ot
+
+int main(void)
+{
+    ot::TestReassemblyTableBlocks();
+    ot::TestReassemblyTableLength();
+    ot::TestReassemblyTableLookup();
+
+    if (IsBenchmarkEnabled())
+    {
+        ot::TestReassemblyTablePerformance();
+    }
+
+    printf("\nAll tests passed.\n");
+    return 0;
+}
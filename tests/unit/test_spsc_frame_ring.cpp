@@ -0,0 +1,245 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string.h>
+#include <thread>
+
+#include "test_platform.h"
+#include "test_util.h"
+
+#include <openthread/config.h>
+
+#include "posix/platform/spsc_frame_ring.hpp"
+
+namespace ot {
+namespace Posix {
+
+static constexpr uint16_t kNumSlots = 4;
+static constexpr uint16_t kSlotSize = 8;
+
+typedef SpscFrameRing<kNumSlots, kSlotSize> TestRing;
+
+static void Produce(TestRing &aRing, uint32_t aValue)
+{
+    TestRing::Slot *slot = aRing.GetWriteSlot();
+
+    VerifyOrQuit(slot != nullptr, "GetWriteSlot() failed on a ring which is not full");
+    slot->mTimestamp = aValue;
+    slot->mError     = OT_ERROR_NONE;
+    slot->mLength    = sizeof(aValue);
+    memcpy(slot->mData, &aValue, sizeof(aValue));
+    aRing.Commit();
+}
+
+static void Consume(TestRing &aRing, uint32_t aValue)
+{
+    const TestRing::Slot *slot = aRing.GetReadSlot();
+    uint32_t              value;
+
+    VerifyOrQuit(slot != nullptr, "GetReadSlot() failed on a ring which is not empty");
+    VerifyOrQuit(slot->mTimestamp == aValue, "GetReadSlot() returned the slots out of order");
+    VerifyOrQuit(slot->mLength == sizeof(value));
+    memcpy(&value, slot->mData, sizeof(value));
+    VerifyOrQuit(value == aValue, "slot data is corrupted");
+    aRing.Release();
+}
+
+void TestSpscFrameRingEmpty(void)
+{
+    TestRing ring;
+
+    VerifyOrQuit(ring.GetReadSlot() == nullptr, "GetReadSlot() succeeded on an empty ring");
+    VerifyOrQuit(ring.GetQueuedCount() == 0);
+    VerifyOrQuit(ring.GetDroppedCount() == 0);
+
+    // A write slot which is not committed is not visible to the consumer.
+    VerifyOrQuit(ring.GetWriteSlot() != nullptr);
+    VerifyOrQuit(ring.GetReadSlot() == nullptr, "GetReadSlot() returned a slot which is not committed");
+
+    Produce(ring, 1);
+    VerifyOrQuit(ring.GetQueuedCount() == 1);
+    Consume(ring, 1);
+    VerifyOrQuit(ring.GetReadSlot() == nullptr, "GetReadSlot() succeeded after the ring was drained");
+    VerifyOrQuit(ring.GetQueuedCount() == 0);
+
+    printf("TestSpscFrameRingEmpty() passed\n");
+}
+
+void TestSpscFrameRingFull(void)
+{
+    TestRing ring;
+
+    for (uint32_t i = 0; i < kNumSlots; i++)
+    {
+        Produce(ring, i);
+    }
+
+    VerifyOrQuit(ring.GetQueuedCount() == kNumSlots);
+    VerifyOrQuit(ring.GetWriteSlot() == nullptr, "GetWriteSlot() succeeded on a full ring");
+
+    ring.CountDropped();
+    ring.CountDropped();
+    VerifyOrQuit(ring.GetDroppedCount() == 2);
+
+    // Releasing a single slot makes room for exactly one frame.
+    Consume(ring, 0);
+    Produce(ring, kNumSlots);
+    VerifyOrQuit(ring.GetWriteSlot() == nullptr, "GetWriteSlot() succeeded on a full ring");
+
+    for (uint32_t i = 1; i <= kNumSlots; i++)
+    {
+        Consume(ring, i);
+    }
+
+    VerifyOrQuit(ring.GetReadSlot() == nullptr);
+    VerifyOrQuit(ring.GetDroppedCount() == 2);
+
+    printf("TestSpscFrameRingFull() passed\n");
+}
+
+void TestSpscFrameRingWrapAround(void)
+{
+    TestRing ring;
+    uint32_t produced = 0;
+    uint32_t consumed = 0;
+
+    // Cycle through the slots many times with a varying fill level, so that both indexes wrap the slot array.
+    for (uint32_t round = 0; round < 100; round++)
+    {
+        uint32_t count = round % kNumSlots + 1;
+
+        for (uint32_t i = 0; i < count; i++)
+        {
+            Produce(ring, produced++);
+        }
+
+        VerifyOrQuit(ring.GetQueuedCount() == produced - consumed);
+
+        for (uint32_t i = 0; i < count; i++)
+        {
+            Consume(ring, consumed++);
+        }
+
+        VerifyOrQuit(ring.GetReadSlot() == nullptr);
+    }
+
+    printf("TestSpscFrameRingWrapAround() passed\n");
+}
+
+class SpscFrameRingTester
+{
+public:
+    static void SetIndexes(TestRing &aRing, uint32_t aIndex)
+    {
+        aRing.mHead.store(aIndex);
+        aRing.mTail.store(aIndex);
+    }
+};
+
+void TestSpscFrameRingIndexOverflow(void)
+{
+    TestRing ring;
+
+    // Start the indexes just below the `uint32_t` limit so that they overflow while frames are queued.
+    SpscFrameRingTester::SetIndexes(ring, UINT32_MAX - 1);
+
+    for (uint32_t i = 0; i < kNumSlots; i++)
+    {
+        Produce(ring, i);
+    }
+
+    VerifyOrQuit(ring.GetQueuedCount() == kNumSlots);
+    VerifyOrQuit(ring.GetWriteSlot() == nullptr, "GetWriteSlot() succeeded on a full ring after the overflow");
+
+    for (uint32_t i = 0; i < kNumSlots; i++)
+    {
+        Consume(ring, i);
+    }
+
+    VerifyOrQuit(ring.GetReadSlot() == nullptr, "GetReadSlot() succeeded on an empty ring after the overflow");
+
+    printf("TestSpscFrameRingIndexOverflow() passed\n");
+}
+
+void TestSpscFrameRingProducerConsumer(void)
+{
+    static constexpr uint32_t kNumFrames = 200000;
+
+    TestRing    ring;
+    std::thread producer([&ring]() {
+        for (uint32_t i = 0; i < kNumFrames; i++)
+        {
+            TestRing::Slot *slot;
+
+            // Waits for the consumer on a full ring, like the I/O thread does.
+            while ((slot = ring.GetWriteSlot()) == nullptr)
+            {
+                std::this_thread::yield();
+            }
+
+            slot->mTimestamp = i;
+            slot->mError     = OT_ERROR_NONE;
+            slot->mLength    = sizeof(i);
+            memcpy(slot->mData, &i, sizeof(i));
+            ring.Commit();
+        }
+    });
+
+    for (uint32_t i = 0; i < kNumFrames; i++)
+    {
+        while (ring.GetReadSlot() == nullptr)
+        {
+            std::this_thread::yield();
+        }
+
+        VerifyOrQuit(ring.GetQueuedCount() <= kNumSlots);
+        Consume(ring, i);
+    }
+
+    producer.join();
+
+    VerifyOrQuit(ring.GetReadSlot() == nullptr);
+    VerifyOrQuit(ring.GetDroppedCount() == 0);
+
+    printf("TestSpscFrameRingProducerConsumer() passed\n");
+}
+
+} // namespace Posix
+} // namespace ot
+
+int main(void)
+{
+    ot::Posix::TestSpscFrameRingEmpty();
+    ot::Posix::TestSpscFrameRingFull();
+    ot::Posix::TestSpscFrameRingWrapAround();
+    ot::Posix::TestSpscFrameRingIndexOverflow();
+    ot::Posix::TestSpscFrameRingProducerConsumer();
+
+    printf("All tests passed\n");
+    return 0;
+}
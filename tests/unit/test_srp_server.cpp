@@ -714,6 +714,315 @@ void TestSrpServerIgnore(void)
     Log("End of TestSrpServerIgnore");
 }
 
+void TestSrpServerLeaseExpiry(void)
+{
+    Srp::Server                *srpServer;
+    Srp::Client                *srpClient;
+    Srp::Client::Service        service1;
+    Srp::Client::Service        service2;
+    const Srp::Server::Host    *host;
+    const Srp::Server::Service *service;
+    uint16_t                    heapAllocations;
+
+    Log("--------------------------------------------------------------------------------------------");
+    Log("TestSrpServerLeaseExpiry");
+
+    InitTest();
+
+    srpServer = &sInstance->Get<Srp::Server>();
+    srpClient = &sInstance->Get<Srp::Client>();
+
+    heapAllocations = sHeapAllocatedPtrs.GetLength();
+
+    PrepareService1(service1);
+    PrepareService2(service2);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Start SRP server.
+
+    SuccessOrQuit(srpServer->SetAddressMode(Srp::Server::kAddressModeUnicast));
+    srpServer->SetServiceHandler(HandleSrpServerUpdate, sInstance);
+
+    srpServer->SetEnabled(true);
+    AdvanceTime(10000);
+    VerifyOrQuit(srpServer->GetState() == Srp::Server::kStateRunning);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Start SRP client with short lease (30 sec) and key lease (60 sec)
+    // intervals and register two services.
+
+    srpClient->SetCallback(HandleSrpClientCallback, sInstance);
+    srpClient->SetLeaseInterval(30);
+    srpClient->SetKeyLeaseInterval(60);
+
+    srpClient->EnableAutoStartMode(nullptr, nullptr);
+    AdvanceTime(2000);
+    VerifyOrQuit(srpClient->IsRunning());
+
+    SuccessOrQuit(srpClient->SetHostName(kHostName));
+    SuccessOrQuit(srpClient->EnableAutoHostAddress());
+
+    SuccessOrQuit(srpClient->AddService(service1));
+    SuccessOrQuit(srpClient->AddService(service2));
+
+    sUpdateHandlerMode       = kAccept;
+    sProcessedUpdateCallback = false;
+    sProcessedClientCallback = false;
+
+    AdvanceTime(2 * 1000);
+
+    VerifyOrQuit(sProcessedUpdateCallback);
+    VerifyOrQuit(sProcessedClientCallback);
+    VerifyOrQuit(sLastClientCallbackError == kErrorNone);
+
+    VerifyOrQuit(service1.GetState() == Srp::Client::kRegistered);
+    VerifyOrQuit(service2.GetState() == Srp::Client::kRegistered);
+    ValidateHost(*srpServer, kHostName);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Stop the SRP client so that it no longer refreshes its
+    // registration.
+
+    srpClient->DisableAutoStartMode();
+    srpClient->Stop();
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Wait for the lease to expire. Validate that the host and its
+    // services are removed but their names are retained, and that
+    // the update handler is notified.
+
+    sProcessedUpdateCallback = false;
+
+    AdvanceTime(30 * 1000);
+
+    VerifyOrQuit(sProcessedUpdateCallback);
+
+    host = srpServer->GetNextHost(nullptr);
+    VerifyOrQuit(host != nullptr);
+    VerifyOrQuit(host->IsDeleted());
+    VerifyOrQuit(srpServer->GetNextHost(host) == nullptr);
+
+    service = host->GetServices().GetHead();
+    VerifyOrQuit(service != nullptr);
+
+    for (; service != nullptr; service = service->GetNext())
+    {
+        VerifyOrQuit(service->IsDeleted());
+    }
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Wait for the key lease to expire. Validate that the host and
+    // its services are fully removed.
+
+    AdvanceTime(30 * 1000);
+
+    VerifyOrQuit(srpServer->GetNextHost(nullptr) == nullptr);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Disable SRP server, verify that all heap allocations by SRP server
+    // are freed.
+
+    Log("Disabling SRP server");
+
+    srpServer->SetEnabled(false);
+    AdvanceTime(100);
+
+    VerifyOrQuit(heapAllocations == sHeapAllocatedPtrs.GetLength());
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Finalize OT instance and validate all heap allocations are freed.
+
+    Log("Finalizing OT instance");
+    FinalizeTest();
+
+    VerifyOrQuit(sHeapAllocatedPtrs.IsEmpty());
+
+    Log("End of TestSrpServerLeaseExpiry");
+}
+
+static uint16_t CountActiveServices(const Srp::Server::Host &aHost, const char *aServiceName)
+{
+    // Returns the number of active (not deleted) base services of
+    // `aHost` with `aServiceName` (without the domain).
+
+    uint16_t count = 0;
+
+    for (const Srp::Server::Service &service : aHost.GetServices())
+    {
+        const char *name = service.GetServiceName();
+
+        if (!service.IsSubType() && !service.IsDeleted() &&
+            StringStartsWith(name, aServiceName, kStringCaseInsensitiveMatch) && (name[strlen(aServiceName)] == '.'))
+        {
+            count++;
+        }
+    }
+
+    return count;
+}
+
+void TestSrpServerLeaseExpiryBatch(void)
+{
+    // Validate that when more services expire at the same time than
+    // `OPENTHREAD_CONFIG_SRP_SERVER_MAX_LEASE_EXPIRIES_PER_RUN`, the
+    // lease timer processes them over multiple runs and all of them
+    // are expired.
+
+    static constexpr uint16_t kNumServices = OPENTHREAD_CONFIG_SRP_SERVER_MAX_LEASE_EXPIRIES_PER_RUN + 4;
+    static constexpr uint16_t kNameSize    = 8;
+
+    static const char kServiceName[] = "_s._udp";
+
+    Srp::Server                *srpServer;
+    Srp::Client                *srpClient;
+    Srp::Client::Service        services[kNumServices];
+    Srp::Client::Service        longLeaseService;
+    char                        instanceLabels[kNumServices][kNameSize];
+    const Srp::Server::Host    *host;
+    uint16_t                    heapAllocations;
+
+    Log("--------------------------------------------------------------------------------------------");
+    Log("TestSrpServerLeaseExpiryBatch");
+
+    InitTest();
+
+    srpServer = &sInstance->Get<Srp::Server>();
+    srpClient = &sInstance->Get<Srp::Client>();
+
+    heapAllocations = sHeapAllocatedPtrs.GetLength();
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Start SRP server.
+
+    SuccessOrQuit(srpServer->SetAddressMode(Srp::Server::kAddressModeUnicast));
+    srpServer->SetServiceHandler(HandleSrpServerUpdate, sInstance);
+
+    srpServer->SetEnabled(true);
+    AdvanceTime(10000);
+    VerifyOrQuit(srpServer->GetState() == Srp::Server::kStateRunning);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Start SRP client and register `kNumServices` services with a
+    // short lease (30 sec). The services do not fit in one update
+    // message, so the client registers them one by one.
+
+    srpClient->SetCallback(HandleSrpClientCallback, sInstance);
+
+    srpClient->EnableAutoStartMode(nullptr, nullptr);
+    AdvanceTime(2000);
+    VerifyOrQuit(srpClient->IsRunning());
+
+    SuccessOrQuit(srpClient->SetHostName(kHostName));
+    SuccessOrQuit(srpClient->EnableAutoHostAddress());
+
+    for (uint16_t index = 0; index < kNumServices; index++)
+    {
+        snprintf(instanceLabels[index], kNameSize, "i%u", index);
+
+        memset(&services[index], 0, sizeof(services[index]));
+        services[index].mName         = kServiceName;
+        services[index].mInstanceName = instanceLabels[index];
+        services[index].mPort         = 1000 + index;
+        services[index].mLease        = 30;
+
+        SuccessOrQuit(srpClient->AddService(services[index]));
+    }
+
+    sUpdateHandlerMode       = kAccept;
+    sProcessedUpdateCallback = false;
+    sProcessedClientCallback = false;
+
+    AdvanceTime(10 * 1000);
+
+    VerifyOrQuit(sProcessedUpdateCallback);
+    VerifyOrQuit(sProcessedClientCallback);
+    VerifyOrQuit(sLastClientCallbackError == kErrorNone);
+
+    for (const Srp::Client::Service &clientService : services)
+    {
+        VerifyOrQuit(clientService.GetState() == Srp::Client::kRegistered);
+    }
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Register another service with the default (long) lease. This
+    // refreshes the host lease so that the short lease services
+    // expire on their own and not along with the host.
+
+    PrepareService2(longLeaseService);
+    SuccessOrQuit(srpClient->AddService(longLeaseService));
+
+    sProcessedUpdateCallback = false;
+    sProcessedClientCallback = false;
+
+    AdvanceTime(2 * 1000);
+
+    VerifyOrQuit(sProcessedUpdateCallback);
+    VerifyOrQuit(sProcessedClientCallback);
+    VerifyOrQuit(sLastClientCallbackError == kErrorNone);
+    VerifyOrQuit(longLeaseService.GetState() == Srp::Client::kRegistered);
+
+    ValidateHost(*srpServer, kHostName);
+
+    host = srpServer->GetNextHost(nullptr);
+    VerifyOrQuit(CountActiveServices(*host, kServiceName) == kNumServices);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Stop the SRP client. Move the time past the short lease
+    // without firing the alarm (as if the timer was delayed) so
+    // that all short lease services are already expired when the
+    // lease timer fires.
+
+    srpClient->DisableAutoStartMode();
+    srpClient->Stop();
+
+    sNow += 40 * 1000;
+
+    // Fire the due timers until the lease timer runs. The first run
+    // expires at most `MAX_LEASE_EXPIRIES_PER_RUN` services and
+    // re-arms the timer right away to process the remaining ones.
+
+    while (CountActiveServices(*host, kServiceName) == kNumServices)
+    {
+        VerifyOrQuit(sAlarmOn && (sAlarmTime <= sNow));
+        ProcessRadioTxAndTasklets();
+        otPlatAlarmMilliFired(sInstance);
+    }
+
+    VerifyOrQuit(CountActiveServices(*host, kServiceName) ==
+                 kNumServices - OPENTHREAD_CONFIG_SRP_SERVER_MAX_LEASE_EXPIRIES_PER_RUN);
+    VerifyOrQuit(sAlarmOn && (sAlarmTime == sNow));
+
+    AdvanceTime(0);
+    VerifyOrQuit(CountActiveServices(*host, kServiceName) == 0);
+
+    // The host and the long lease service must remain registered.
+
+    VerifyOrQuit(srpServer->GetNextHost(nullptr) == host);
+    VerifyOrQuit(!host->IsDeleted());
+    VerifyOrQuit(CountActiveServices(*host, longLeaseService.GetName()) == 1);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Disable SRP server, verify that all heap allocations by SRP server
+    // are freed.
+
+    Log("Disabling SRP server");
+
+    srpServer->SetEnabled(false);
+    AdvanceTime(100);
+
+    VerifyOrQuit(heapAllocations == sHeapAllocatedPtrs.GetLength());
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Finalize OT instance and validate all heap allocations are freed.
+
+    Log("Finalizing OT instance");
+    FinalizeTest();
+
+    VerifyOrQuit(sHeapAllocatedPtrs.IsEmpty());
+
+    Log("End of TestSrpServerLeaseExpiryBatch");
+}
+
 #if OPENTHREAD_CONFIG_REFERENCE_DEVICE_ENABLE
 void TestUpdateLeaseShortVariant(void)
 {
@@ -918,6 +1227,8 @@ int main(void)
     TestSrpServerBase();
     TestSrpServerReject();
     TestSrpServerIgnore();
+    TestSrpServerLeaseExpiry();
+    TestSrpServerLeaseExpiryBatch();
 #if OPENTHREAD_CONFIG_REFERENCE_DEVICE_ENABLE
     TestUpdateLeaseShortVariant();
 #endif
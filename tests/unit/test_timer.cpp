@@ -26,12 +26,16 @@
  *  POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <stdlib.h>
+
 #include "test_platform.h"
+#include "test_util.hpp"
 
 #include "common/array.hpp"
 #include "common/code_utils.hpp"
 #include "common/debug.hpp"
 #include "common/instance.hpp"
+#include "common/new.hpp"
 #include "common/timer.hpp"
 
 enum
@@ -99,6 +103,7 @@ public:
     explicit TestTimer(ot::Instance &aInstance)
         : TimerType(aInstance, TestTimer::HandleTimerFired)
         , mFiredCounter(0)
+        , mFiredTime(0)
     {
     }
 
@@ -108,16 +113,20 @@ public:
     {
         sCallCount[kCallCountIndexTimerHandler]++;
         mFiredCounter++;
+        mFiredTime = sNow;
     }
 
     uint32_t GetFiredCounter(void) { return mFiredCounter; }
 
+    uint32_t GetFiredTime(void) { return mFiredTime; }
+
     void ResetFiredCounter(void) { mFiredCounter = 0; }
 
     static void RemoveAll(ot::Instance &aInstance) { TimerType::RemoveAll(aInstance); }
 
 private:
     uint32_t mFiredCounter; //< Number of times timer has been fired so far
+    uint32_t mFiredTime;    //< The time when the timer was last fired
 };
 
 template <typename TimerType> void AlarmFired(otInstance *aInstance);
@@ -346,6 +355,7 @@ template <typename TimerType> int TestTwoTimers(void)
 
     AlarmFired<TimerType>(instance);
 
+#if !OPENTHREAD_CONFIG_TIMER_WHEEL_ENABLE
     VerifyOrQuit(sCallCount[kCallCountIndexAlarmStop] == 0, "Stop CallCount Failed.");
     VerifyOrQuit(sCallCount[kCallCountIndexTimerHandler] == 1, "Handler CallCount Failed.");
     VerifyOrQuit(timer2.GetFiredCounter() == 1, "Fire Counter failed.");
@@ -355,6 +365,10 @@ template <typename TimerType> int TestTwoTimers(void)
     VerifyOrQuit(sTimerOn == true, "Platform Timer State Failed.");
 
     AlarmFired<TimerType>(instance);
+#else
+    // The timing wheel fires all the expired timers (timer 2 followed by timer 1) from the same alarm callback.
+    VerifyOrQuit(timer2.GetFiredTime() == sNow && timer1.GetFiredTime() == sNow, "Fire time failed.");
+#endif
 
     VerifyOrQuit(sCallCount[kCallCountIndexAlarmStop] == 1, "Stop CallCount Failed.");
     VerifyOrQuit(sCallCount[kCallCountIndexTimerHandler] == 2, "Handler CallCount Failed.");
@@ -475,7 +489,12 @@ template <typename TimerType> static void TenTimers(uint32_t aTimeShift)
 
     const uint32_t kTimerStopCountAfterTrigger[kNumTriggers] = {0, 0, 0, 0, 0, 0, 1};
 
+#if !OPENTHREAD_CONFIG_TIMER_WHEEL_ENABLE
     const uint32_t kTimerStartCountAfterTrigger[kNumTriggers] = {3, 4, 5, 7, 9, 11, 11};
+#else
+    // The timing wheel fires all expired timers from one alarm callback.
+    const uint32_t kTimerStartCountAfterTrigger[kNumTriggers] = {3, 4, 5, 6, 7, 8, 8};
+#endif
 
     ot::Instance *instance = testInitInstance();
 
@@ -579,6 +598,107 @@ template <typename TimerType> int TestTenTimers(void)
     return 0;
 }
 
+/**
+ * Measure the TimerScheduler's cost of starting, restarting and firing a large number of timers.
+ *
+ * Every timer is also checked to be fired exactly once and exactly at its fire time.
+ */
+template <typename TimerType> void TimerSchedulerPerformance(uint32_t aNumTimers)
+{
+    const uint32_t kTimeT0       = 1000;
+    const uint32_t kMaxInterval  = 100000;
+    const uint16_t kNumRestarts  = 4;
+    ot::Instance  *instance      = testInitInstance();
+    uint32_t       seed          = 0x1234567;
+    uint32_t       numAlarmFired = 0;
+
+    TestTimer<TimerType> *timers;
+    uint64_t              startTime;
+    uint64_t              startNsec;
+    uint64_t              restartNsec;
+    uint64_t              fireNsec;
+
+    printf("TestTimerSchedulerPerformance() num timers:%-6u ", aNumTimers);
+
+    timers = static_cast<TestTimer<TimerType> *>(malloc(sizeof(TestTimer<TimerType>) * aNumTimers));
+    VerifyOrQuit(timers != nullptr);
+
+    for (uint32_t i = 0; i < aNumTimers; i++)
+    {
+        new (&timers[i]) TestTimer<TimerType>(*instance);
+    }
+
+    TestTimer<TimerType>::RemoveAll(*instance);
+    InitCounters();
+    sNow = kTimeT0;
+
+    startTime = GetMonotonicNsec();
+
+    for (uint32_t i = 0; i < aNumTimers; i++)
+    {
+        seed = seed * 1103515245 + 12345;
+        timers[i].Start(1 + (seed >> 8) % kMaxInterval);
+    }
+
+    startNsec = GetMonotonicNsec() - startTime;
+
+    startTime = GetMonotonicNsec();
+
+    for (uint16_t n = 0; n < kNumRestarts; n++)
+    {
+        for (uint32_t i = 0; i < aNumTimers; i++)
+        {
+            seed = seed * 1103515245 + 12345;
+            timers[i].Start(1 + (seed >> 8) % kMaxInterval);
+        }
+    }
+
+    restartNsec = GetMonotonicNsec() - startTime;
+
+    startTime = GetMonotonicNsec();
+
+    while (sTimerOn)
+    {
+        sNow = sPlatT0 + sPlatDt;
+        AlarmFired<TimerType>(instance);
+        numAlarmFired++;
+    }
+
+    fireNsec = GetMonotonicNsec() - startTime;
+
+    VerifyOrQuit(sCallCount[kCallCountIndexTimerHandler] == aNumTimers);
+
+    for (uint32_t i = 0; i < aNumTimers; i++)
+    {
+        VerifyOrQuit(!timers[i].IsRunning());
+        VerifyOrQuit(timers[i].GetFiredCounter() == 1);
+        VerifyOrQuit(timers[i].GetFiredTime() == timers[i].GetFireTime().GetValue());
+    }
+
+    printf("start:%6u ns, restart:%6u ns, fire:%6u ns (per timer), alarm callbacks:%-6u --> PASSED\n",
+           static_cast<uint32_t>(startNsec / aNumTimers),
+           static_cast<uint32_t>(restartNsec / (aNumTimers * kNumRestarts)),
+           static_cast<uint32_t>(fireNsec / aNumTimers), numAlarmFired);
+
+    free(timers);
+    testFreeInstance(instance);
+}
+
+template <typename TimerType> int TestTimerSchedulerPerformance(void)
+{
+    printf("Timer scheduler: %s\n", OPENTHREAD_CONFIG_TIMER_WHEEL_ENABLE ? "timing wheel" : "sorted list");
+
+    TimerSchedulerPerformance<TimerType>(100);
+    TimerSchedulerPerformance<TimerType>(1000);
+
+    if (IsBenchmarkEnabled())
+    {
+        TimerSchedulerPerformance<TimerType>(10000);
+    }
+
+    return 0;
+}
+
 /**
  * Test the `Timer::Time` class.
  */
@@ -671,6 +791,7 @@ template <typename TimerType> void RunTimerTests(void)
     TestOneTimer<TimerType>();
     TestTwoTimers<TimerType>();
     TestTenTimers<TimerType>();
+    TestTimerSchedulerPerformance<TimerType>();
 }
 
 int main(void)
@@ -0,0 +1,429 @@
+/*
+ *  Copyright (c) 2023, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string.h>
+
+#include "test_platform.h"
+
+#include <openthread/config.h>
+
+#include "test_util.hpp"
+#include "common/code_utils.hpp"
+#include "common/instance.hpp"
+#include "radio/trel_interface.hpp"
+
+#if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
+
+namespace ot {
+namespace Trel {
+
+typedef Interface::Peer Peer;
+
+static Instance *sInstance;
+
+class PeerTableTester
+{
+public:
+    static constexpr uint16_t kPeerTableSize = Interface::kPeerTableSize;
+
+    static Interface &GetInterface(void) { return sInstance->Get<Interface>(); }
+
+    static uint16_t GetNumPeers(void) { return GetInterface().mPeerTable.GetLength(); }
+
+    static Peer &GetPeerAt(uint16_t aIndex) { return GetInterface().mPeerTable[aIndex]; }
+
+    static Peer *FindPeer(const Mac::ExtAddress &aExtAddress) { return GetInterface().FindPeer(aExtAddress); }
+
+    static Peer *FindPeer(const Ip6::SockAddr &aSockAddr) { return GetInterface().FindPeer(aSockAddr); }
+
+    static Peer *FindPeerLinear(const Mac::ExtAddress &aExtAddress)
+    {
+        return GetInterface().mPeerTable.FindMatching(aExtAddress);
+    }
+
+    static Peer *FindPeerLinear(const Ip6::SockAddr &aSockAddr)
+    {
+        return GetInterface().mPeerTable.FindMatching(aSockAddr);
+    }
+
+    static void MarkPeerUsed(Peer &aPeer) { GetInterface().MarkPeerUsed(aPeer); }
+
+    static void VerifyIndexes(void)
+    {
+        Interface &interface  = GetInterface();
+        uint16_t   numIndexed = 0;
+
+        // Every entry in the table must be found through both indexes,
+        // and no index may contain a stale entry.
+
+        for (Peer &peer : interface.mPeerTable)
+        {
+            VerifyOrQuit(interface.FindPeer(peer.GetExtAddress()) == &peer);
+            VerifyOrQuit(interface.FindPeer(peer.GetSockAddr()) == &peer);
+        }
+
+        for (uint16_t index = 0; index < kPeerTableSize; index++)
+        {
+            bool inTable = (index < interface.mPeerTable.GetLength());
+
+            VerifyOrQuit(interface.mExtAddressIndex.Contains(index) == inTable);
+            VerifyOrQuit(interface.mSockAddrIndex.Contains(index) == inTable);
+            numIndexed += inTable ? 1 : 0;
+        }
+
+        VerifyOrQuit(numIndexed == interface.mPeerTable.GetLength());
+    }
+};
+
+static Mac::ExtAddress PeerExtAddress(uint16_t aPeerNum)
+{
+    Mac::ExtAddress extAddress;
+
+    memset(&extAddress, 0, sizeof(extAddress));
+    extAddress.m8[0] = 0x12;
+    extAddress.m8[6] = static_cast<uint8_t>(aPeerNum >> 8);
+    extAddress.m8[7] = static_cast<uint8_t>(aPeerNum & 0xff);
+
+    return extAddress;
+}
+
+static uint16_t PeerNumOf(const Peer &aPeer)
+{
+    return static_cast<uint16_t>((aPeer.GetExtAddress().m8[6] << 8) | aPeer.GetExtAddress().m8[7]);
+}
+
+static Ip6::SockAddr PeerSockAddr(uint16_t aPeerNum, uint16_t aPort = 19788)
+{
+    Ip6::SockAddr sockAddr;
+
+    sockAddr.Clear();
+    sockAddr.GetAddress().mFields.m8[0]  = 0xfd;
+    sockAddr.GetAddress().mFields.m8[14] = static_cast<uint8_t>(aPeerNum >> 8);
+    sockAddr.GetAddress().mFields.m8[15] = static_cast<uint8_t>(aPeerNum & 0xff);
+    sockAddr.SetPort(aPort);
+
+    return sockAddr;
+}
+
+static void ReportPeer(uint16_t                      aPeerNum,
+                       const MeshCoP::ExtendedPanId &aExtPanId,
+                       const Ip6::SockAddr          &aSockAddr,
+                       bool                          aRemoved = false)
+{
+    // TXT data is encoded as "xa=<ext-addr>" and "xp=<ext-panid>"
+    // entries, each prefixed with its length.
+
+    static constexpr uint8_t kEntryLength = sizeof("xa=") - 1 + sizeof(Mac::ExtAddress);
+
+    Mac::ExtAddress    extAddress = PeerExtAddress(aPeerNum);
+    uint8_t            txtData[2 * (kEntryLength + 1)];
+    uint8_t           *cur = txtData;
+    otPlatTrelPeerInfo info;
+
+    static_assert(sizeof(Mac::ExtAddress) == sizeof(MeshCoP::ExtendedPanId), "unexpected ExtPanId size");
+
+    *cur++ = kEntryLength;
+    memcpy(cur, "xa=", 3);
+    memcpy(cur + 3, extAddress.m8, sizeof(extAddress));
+    cur += kEntryLength;
+
+    *cur++ = kEntryLength;
+    memcpy(cur, "xp=", 3);
+    memcpy(cur + 3, aExtPanId.m8, sizeof(aExtPanId));
+
+    info.mRemoved   = aRemoved;
+    info.mTxtData   = txtData;
+    info.mTxtLength = sizeof(txtData);
+    info.mSockAddr  = aSockAddr;
+
+    otPlatTrelHandleDiscoveredPeerInfo(sInstance, &info);
+}
+
+static void ReportPeer(uint16_t aPeerNum)
+{
+    ReportPeer(aPeerNum, sInstance->Get<MeshCoP::ExtendedPanIdManager>().GetExtPanId(), PeerSockAddr(aPeerNum));
+}
+
+static void RemovePeer(uint16_t aPeerNum)
+{
+    ReportPeer(aPeerNum, sInstance->Get<MeshCoP::ExtendedPanIdManager>().GetExtPanId(), PeerSockAddr(aPeerNum),
+               /* aRemoved */ true);
+}
+
+static void FillPeerTable(void)
+{
+    for (uint16_t peerNum = 0; peerNum < PeerTableTester::kPeerTableSize; peerNum++)
+    {
+        ReportPeer(peerNum);
+    }
+
+    VerifyOrQuit(PeerTableTester::GetNumPeers() == PeerTableTester::kPeerTableSize);
+    PeerTableTester::VerifyIndexes();
+}
+
+void TestTrelPeerTable(void)
+{
+    MeshCoP::ExtendedPanId otherExtPanId;
+    uint16_t               newPeerNum = PeerTableTester::kPeerTableSize;
+
+    sInstance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(sInstance != nullptr);
+
+    sInstance->Get<Interface>().SetEnabled(true);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    printf("TestTrelPeerTable: Add and look up peers");
+
+    FillPeerTable();
+
+    for (uint16_t peerNum = 0; peerNum < PeerTableTester::kPeerTableSize; peerNum++)
+    {
+        Peer *peer = PeerTableTester::FindPeer(PeerExtAddress(peerNum));
+
+        VerifyOrQuit(peer != nullptr);
+        VerifyOrQuit(peer->GetSockAddr() == PeerSockAddr(peerNum));
+        VerifyOrQuit(PeerTableTester::FindPeer(PeerSockAddr(peerNum)) == peer);
+    }
+
+    VerifyOrQuit(PeerTableTester::FindPeer(PeerExtAddress(newPeerNum)) == nullptr);
+    VerifyOrQuit(PeerTableTester::FindPeer(PeerSockAddr(newPeerNum)) == nullptr);
+    VerifyOrQuit(PeerTableTester::FindPeer(PeerSockAddr(0, /* aPort */ 1234)) == nullptr);
+
+    printf(" -- PASS\n");
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    printf("TestTrelPeerTable: Update and remove peers");
+
+    // Change the socket address of a peer.
+
+    ReportPeer(3, sInstance->Get<MeshCoP::ExtendedPanIdManager>().GetExtPanId(), PeerSockAddr(3, 1234));
+    VerifyOrQuit(PeerTableTester::GetNumPeers() == PeerTableTester::kPeerTableSize);
+    VerifyOrQuit(PeerTableTester::FindPeer(PeerSockAddr(3)) == nullptr);
+    VerifyOrQuit(PeerTableTester::FindPeer(PeerSockAddr(3, 1234)) == PeerTableTester::FindPeer(PeerExtAddress(3)));
+    PeerTableTester::VerifyIndexes();
+
+    // Move the socket address of peer 4 to peer 5, which should
+    // remove the now stale entry for peer 4.
+
+    ReportPeer(5, sInstance->Get<MeshCoP::ExtendedPanIdManager>().GetExtPanId(), PeerSockAddr(4));
+    VerifyOrQuit(PeerTableTester::GetNumPeers() == PeerTableTester::kPeerTableSize - 1);
+    VerifyOrQuit(PeerTableTester::FindPeer(PeerExtAddress(4)) == nullptr);
+    VerifyOrQuit(PeerTableTester::FindPeer(PeerSockAddr(4)) == PeerTableTester::FindPeer(PeerExtAddress(5)));
+    VerifyOrQuit(PeerTableTester::FindPeer(PeerSockAddr(5)) == nullptr);
+    PeerTableTester::VerifyIndexes();
+
+    // Remove entries from the middle and the end of the table.
+
+    RemovePeer(0);
+    RemovePeer(PeerTableTester::kPeerTableSize - 1);
+    RemovePeer(PeerTableTester::kPeerTableSize - 1);
+    VerifyOrQuit(PeerTableTester::GetNumPeers() == PeerTableTester::kPeerTableSize - 3);
+    VerifyOrQuit(PeerTableTester::FindPeer(PeerExtAddress(0)) == nullptr);
+    VerifyOrQuit(PeerTableTester::FindPeer(PeerSockAddr(0)) == nullptr);
+    PeerTableTester::VerifyIndexes();
+
+    while (PeerTableTester::GetNumPeers() > 0)
+    {
+        RemovePeer(PeerNumOf(PeerTableTester::GetPeerAt(0)));
+        PeerTableTester::VerifyIndexes();
+    }
+
+    printf(" -- PASS\n");
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    printf("TestTrelPeerTable: Evict least recently used peer");
+
+    FillPeerTable();
+
+    // Use peer 2 and then every other peer except peer 7, so that
+    // peer 7 is the least recently used one followed by peer 2.
+
+    PeerTableTester::MarkPeerUsed(*PeerTableTester::FindPeer(PeerExtAddress(2)));
+
+    for (uint16_t peerNum = 0; peerNum < PeerTableTester::kPeerTableSize; peerNum++)
+    {
+        if ((peerNum != 7) && (peerNum != 2))
+        {
+            PeerTableTester::MarkPeerUsed(*PeerTableTester::FindPeer(PeerExtAddress(peerNum)));
+        }
+    }
+
+    ReportPeer(newPeerNum);
+    VerifyOrQuit(PeerTableTester::GetNumPeers() == PeerTableTester::kPeerTableSize);
+    VerifyOrQuit(PeerTableTester::FindPeer(PeerExtAddress(7)) == nullptr);
+    VerifyOrQuit(PeerTableTester::FindPeer(PeerSockAddr(7)) == nullptr);
+    VerifyOrQuit(PeerTableTester::FindPeer(PeerExtAddress(newPeerNum)) != nullptr);
+    PeerTableTester::VerifyIndexes();
+
+    // Peer 2 is now the least recently used (the newly added peer
+    // counts as just used).
+
+    newPeerNum++;
+    ReportPeer(newPeerNum);
+    VerifyOrQuit(PeerTableTester::FindPeer(PeerExtAddress(2)) == nullptr);
+    VerifyOrQuit(PeerTableTester::FindPeer(PeerExtAddress(newPeerNum)) != nullptr);
+    PeerTableTester::VerifyIndexes();
+
+    // A peer from a different network is evicted first, even when it
+    // is the most recently used one.
+
+    otherExtPanId = sInstance->Get<MeshCoP::ExtendedPanIdManager>().GetExtPanId();
+    otherExtPanId.m8[0] ^= 0xff;
+
+    ReportPeer(10, otherExtPanId, PeerSockAddr(10));
+    PeerTableTester::MarkPeerUsed(*PeerTableTester::FindPeer(PeerExtAddress(10)));
+
+    newPeerNum++;
+    ReportPeer(newPeerNum);
+    VerifyOrQuit(PeerTableTester::FindPeer(PeerExtAddress(10)) == nullptr);
+    VerifyOrQuit(PeerTableTester::FindPeer(PeerExtAddress(newPeerNum)) != nullptr);
+    VerifyOrQuit(PeerTableTester::GetNumPeers() == PeerTableTester::kPeerTableSize);
+    PeerTableTester::VerifyIndexes();
+
+    printf(" -- PASS\n");
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    printf("TestTrelPeerTable: Clear table on disable");
+
+    sInstance->Get<Interface>().SetEnabled(false);
+    VerifyOrQuit(PeerTableTester::GetNumPeers() == 0);
+    PeerTableTester::VerifyIndexes();
+    sInstance->Get<Interface>().SetEnabled(true);
+
+    printf(" -- PASS\n");
+
+    testFreeInstance(sInstance);
+}
+
+void TestTrelPeerTableLookupPerformance(void)
+{
+    static constexpr uint16_t kNumRounds = 2000;
+
+    uint32_t numFound = 0;
+    uint64_t startTime;
+    uint64_t indexedTime[2];
+    uint64_t linearTime[2];
+
+    sInstance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(sInstance != nullptr);
+
+    sInstance->Get<Interface>().SetEnabled(true);
+
+    printf("TestTrelPeerTableLookupPerformance");
+
+    FillPeerTable();
+
+    // Look up every peer plus as many absent ones, which is the
+    // worst case for a linear search.
+
+    startTime = GetMonotonicNsec();
+
+    for (uint16_t round = 0; round < kNumRounds; round++)
+    {
+        for (uint16_t peerNum = 0; peerNum < 2 * PeerTableTester::kPeerTableSize; peerNum++)
+        {
+            numFound += (PeerTableTester::FindPeer(PeerExtAddress(peerNum)) != nullptr);
+        }
+    }
+
+    indexedTime[0] = GetMonotonicNsec() - startTime;
+    startTime      = GetMonotonicNsec();
+
+    for (uint16_t round = 0; round < kNumRounds; round++)
+    {
+        for (uint16_t peerNum = 0; peerNum < 2 * PeerTableTester::kPeerTableSize; peerNum++)
+        {
+            numFound += (PeerTableTester::FindPeer(PeerSockAddr(peerNum)) != nullptr);
+        }
+    }
+
+    indexedTime[1] = GetMonotonicNsec() - startTime;
+
+    VerifyOrQuit(numFound == 2 * kNumRounds * PeerTableTester::kPeerTableSize);
+    numFound  = 0;
+    startTime = GetMonotonicNsec();
+
+    for (uint16_t round = 0; round < kNumRounds; round++)
+    {
+        for (uint16_t peerNum = 0; peerNum < 2 * PeerTableTester::kPeerTableSize; peerNum++)
+        {
+            numFound += (PeerTableTester::FindPeerLinear(PeerExtAddress(peerNum)) != nullptr);
+        }
+    }
+
+    linearTime[0] = GetMonotonicNsec() - startTime;
+    startTime     = GetMonotonicNsec();
+
+    for (uint16_t round = 0; round < kNumRounds; round++)
+    {
+        for (uint16_t peerNum = 0; peerNum < 2 * PeerTableTester::kPeerTableSize; peerNum++)
+        {
+            numFound += (PeerTableTester::FindPeerLinear(PeerSockAddr(peerNum)) != nullptr);
+        }
+    }
+
+    linearTime[1] = GetMonotonicNsec() - startTime;
+
+    VerifyOrQuit(numFound == 2 * kNumRounds * PeerTableTester::kPeerTableSize);
+
+    printf(" -- PASS\n");
+
+    printf("  %u peers, %u lookups per key type\n", PeerTableTester::kPeerTableSize,
+           2 * kNumRounds * PeerTableTester::kPeerTableSize);
+    printf("  ExtAddress : indexed %6.1f ns/lookup, linear %6.1f ns/lookup\n",
+           static_cast<double>(indexedTime[0]) / (2.0 * kNumRounds * PeerTableTester::kPeerTableSize),
+           static_cast<double>(linearTime[0]) / (2.0 * kNumRounds * PeerTableTester::kPeerTableSize));
+    printf("  SockAddr   : indexed %6.1f ns/lookup, linear %6.1f ns/lookup\n",
+           static_cast<double>(indexedTime[1]) / (2.0 * kNumRounds * PeerTableTester::kPeerTableSize),
+           static_cast<double>(linearTime[1]) / (2.0 * kNumRounds * PeerTableTester::kPeerTableSize));
+
+    testFreeInstance(sInstance);
+}
+
+} // namespace Trel
+} // namespace ot
+
+#endif // OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
+
+int main(void)
+{
+#if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
+    ot::Trel::TestTrelPeerTable();
+
+    if (IsBenchmarkEnabled())
+    {
+        ot::Trel::TestTrelPeerTableLookupPerformance();
+    }
+
+    printf("\nAll tests passed.\n");
+#else
+    printf("TREL feature is not enabled\n");
+#endif
+
+    return 0;
+}
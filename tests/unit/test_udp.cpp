@@ -0,0 +1,242 @@
+/*
+ *  Copyright (c) 2023, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "common/instance.hpp"
+#include "common/message.hpp"
+#include "common/random.hpp"
+#include "net/udp6.hpp"
+
+#include "test_platform.h"
+#include "test_util.hpp"
+
+namespace ot {
+
+static constexpr uint16_t kNumSockets = 256;
+static constexpr uint16_t kBasePort   = 20000;
+static constexpr uint16_t kPeerPort   = 30000;
+
+static Instance *sInstance;
+
+static Ip6::Udp::Socket *sSockets[kNumSockets];
+static uint32_t          sReceived[kNumSockets];
+
+static void HandleUdpReceive(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo)
+{
+    OT_UNUSED_VARIABLE(aMessage);
+    OT_UNUSED_VARIABLE(aMessageInfo);
+
+    sReceived[reinterpret_cast<uintptr_t>(aContext)]++;
+}
+
+static void PrepareMessageInfo(Ip6::MessageInfo &aMessageInfo, uint16_t aSockPort, uint16_t aPeerPort)
+{
+    aMessageInfo.Clear();
+    aMessageInfo.GetPeerAddr().mFields.m8[0]  = 0xfd;
+    aMessageInfo.GetPeerAddr().mFields.m8[15] = 1;
+    aMessageInfo.SetPeerPort(aPeerPort);
+    aMessageInfo.GetSockAddr().mFields.m8[0]  = 0xfd;
+    aMessageInfo.GetSockAddr().mFields.m8[15] = 2;
+    aMessageInfo.SetSockPort(aSockPort);
+}
+
+// Returns the index of the socket which received the datagram, or
+// `kNumSockets` if none did.
+static uint16_t Deliver(uint16_t aSockPort, uint16_t aPeerPort)
+{
+    Message         *message = sInstance->Get<Ip6::Udp>().NewMessage();
+    Ip6::MessageInfo messageInfo;
+    uint16_t         index;
+
+    VerifyOrQuit(message != nullptr);
+    SuccessOrQuit(message->SetLength(8));
+
+    PrepareMessageInfo(messageInfo, aSockPort, aPeerPort);
+
+    memset(sReceived, 0, sizeof(sReceived));
+    sInstance->Get<Ip6::Udp>().HandlePayload(*message, messageInfo);
+    message->Free();
+
+    for (index = 0; index < kNumSockets; index++)
+    {
+        if (sReceived[index] != 0)
+        {
+            VerifyOrQuit(sReceived[index] == 1);
+            break;
+        }
+    }
+
+    return index;
+}
+
+static void OpenSockets(void)
+{
+    for (uint16_t i = 0; i < kNumSockets; i++)
+    {
+        sSockets[i] = new Ip6::Udp::Socket(*sInstance);
+        SuccessOrQuit(sSockets[i]->Open(HandleUdpReceive, reinterpret_cast<void *>(static_cast<uintptr_t>(i))));
+        SuccessOrQuit(sSockets[i]->Bind(kBasePort + i));
+    }
+}
+
+static void CloseSockets(void)
+{
+    for (Ip6::Udp::Socket *&socket : sSockets)
+    {
+        SuccessOrQuit(socket->Close());
+        delete socket;
+        socket = nullptr;
+    }
+}
+
+void TestUdpSocketDemux(void)
+{
+    printf("\nTestUdpSocketDemux");
+
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != nullptr);
+
+    OpenSockets();
+
+    for (uint16_t i = 0; i < kNumSockets; i++)
+    {
+        VerifyOrQuit(sInstance->Get<Ip6::Udp>().IsPortInUse(kBasePort + i));
+        VerifyOrQuit(Deliver(kBasePort + i, kPeerPort) == i);
+    }
+
+    VerifyOrQuit(!sInstance->Get<Ip6::Udp>().IsPortInUse(kBasePort + kNumSockets));
+    VerifyOrQuit(Deliver(kBasePort + kNumSockets, kPeerPort) == kNumSockets);
+
+    // Re-bind socket 1 to the port of socket 0 and connect it. As the
+    // socket opened later, it comes first in the socket list and so
+    // takes precedence for datagrams from its peer only.
+
+    SuccessOrQuit(sSockets[1]->Bind(kBasePort));
+    SuccessOrQuit(sSockets[1]->Connect(kPeerPort));
+    VerifyOrQuit(!sInstance->Get<Ip6::Udp>().IsPortInUse(kBasePort + 1));
+    VerifyOrQuit(Deliver(kBasePort + 1, kPeerPort) == kNumSockets);
+    VerifyOrQuit(Deliver(kBasePort, kPeerPort) == 1);
+    VerifyOrQuit(Deliver(kBasePort, kPeerPort + 1) == 0);
+
+    // Closing and re-opening socket 0 moves it ahead of socket 1, so
+    // it now receives all datagrams on the shared port.
+
+    SuccessOrQuit(sSockets[0]->Close());
+    VerifyOrQuit(Deliver(kBasePort, kPeerPort + 1) == kNumSockets);
+    VerifyOrQuit(Deliver(kBasePort, kPeerPort) == 1);
+
+    SuccessOrQuit(sSockets[0]->Open(HandleUdpReceive, reinterpret_cast<void *>(static_cast<uintptr_t>(0))));
+    SuccessOrQuit(sSockets[0]->Bind(kBasePort));
+    VerifyOrQuit(Deliver(kBasePort, kPeerPort) == 0);
+    VerifyOrQuit(Deliver(kBasePort, kPeerPort + 1) == 0);
+
+    SuccessOrQuit(sSockets[0]->Close());
+    VerifyOrQuit(Deliver(kBasePort, kPeerPort) == 1);
+
+    CloseSockets();
+
+    for (uint16_t i = 0; i < kNumSockets; i++)
+    {
+        VerifyOrQuit(!sInstance->Get<Ip6::Udp>().IsPortInUse(kBasePort + i));
+    }
+
+    testFreeInstance(sInstance);
+
+    printf("\n -- PASS\n");
+}
+
+void TestUdpDemuxPerformance(void)
+{
+    // Delivers datagrams to random ports among `kNumSockets` bound
+    // sockets and measures the average time spent per datagram.
+
+    static constexpr uint32_t kNumDatagrams = 200000;
+
+    Message         *message;
+    Ip6::MessageInfo messageInfo;
+    uint64_t         startTime;
+    uint64_t         duration;
+
+    printf("\nTestUdpDemuxPerformance");
+
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != nullptr);
+
+    OpenSockets();
+    memset(sReceived, 0, sizeof(sReceived));
+
+    message = sInstance->Get<Ip6::Udp>().NewMessage();
+    VerifyOrQuit(message != nullptr);
+
+    startTime = GetMonotonicNsec();
+
+    for (uint32_t count = 0; count < kNumDatagrams; count++)
+    {
+        PrepareMessageInfo(messageInfo, kBasePort + Random::NonCrypto::GetUint16InRange(0, kNumSockets), kPeerPort);
+        sInstance->Get<Ip6::Udp>().HandlePayload(*message, messageInfo);
+    }
+
+    duration = GetMonotonicNsec() - startTime;
+
+    {
+        uint32_t total = 0;
+
+        for (uint32_t received : sReceived)
+        {
+            total += received;
+        }
+
+        VerifyOrQuit(total == kNumDatagrams);
+    }
+
+    printf("\n  %u sockets, %lu datagrams: %lu ns per datagram", kNumSockets, ToUlong(kNumDatagrams),
+           ToUlong(static_cast<uint32_t>(duration / kNumDatagrams)));
+
+    message->Free();
+    CloseSockets();
+    testFreeInstance(sInstance);
+
+    printf("\n -- PASS\n");
+}
+
+} // namespace ot
+
+int main(void)
+{
+    ot::TestUdpSocketDemux();
+
+    if (IsBenchmarkEnabled())
+    {
+        ot::TestUdpDemuxPerformance();
+    }
+
+    printf("\nAll tests passed.\n");
+    return 0;
+}
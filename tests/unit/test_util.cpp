@@ -29,6 +29,8 @@
 #include "test_util.hpp"
 
 #include <ctype.h>
+#include <stdlib.h>
+#include <time.h>
 
 void DumpBuffer(const char *aTextMessage, const uint8_t *aBuffer, uint16_t aBufferLength)
 {
@@ -69,3 +71,14 @@ void DumpBuffer(const char *aTextMessage, const uint8_t *aBuffer, uint16_t aBuff
 
     printf("    %s\n", charBuff);
 }
+
+uint64_t GetMonotonicNsec(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return static_cast<uint64_t>(now.tv_sec) * 1000000000ull + static_cast<uint64_t>(now.tv_nsec);
+}
+
+bool IsBenchmarkEnabled(void) { return getenv("OT_UNIT_TEST_BENCHMARK") != nullptr; }
@@ -43,4 +43,24 @@
  */
 void DumpBuffer(const char *aTextMessage, const uint8_t *aBuffer, uint16_t aBufferLength);
 
+/**
+ * Returns the current time of the host's monotonic clock in nanoseconds.
+ *
+ * @returns The monotonic clock time in nanoseconds.
+ *
+ */
+uint64_t GetMonotonicNsec(void);
+
+/**
+ * Indicates whether the (slow) performance measurements in the unit tests should run.
+ *
+ * Performance measurements are skipped by default and are enabled by setting the `OT_UNIT_TEST_BENCHMARK` environment
+ * variable, e.g., using the `ot-unit-benchmark` build target.
+ *
+ * @retval TRUE   The performance measurements should run.
+ * @retval FALSE  The performance measurements should be skipped.
+ *
+ */
+bool IsBenchmarkEnabled(void);
+
 #endif